@@ -105,6 +105,30 @@ static void riscv_clock_at_tick(riscv_timecounter *tc)
   riscv_clock_write_mtimecmp(&clint->mtimecmp[cpu], value);
 }
 
+#if !defined(RTEMS_SMP) || !defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR)
+static void riscv_clock_program_next_event(uint64_t ns)
+{
+  riscv_timecounter *tc;
+  volatile RISCV_CLINT_regs *clint;
+  uint64_t frequency;
+  uint64_t delta;
+  uint32_t cpu = rtems_scheduler_get_processor();
+
+  cpu = _RISCV_Map_cpu_index_to_hardid(cpu);
+
+  tc = &riscv_clock_tc;
+  clint = tc->clint;
+  frequency = tc->base.tc_frequency;
+  delta = (ns / 1000000000) * frequency;
+  delta += ((ns % 1000000000) * frequency + 999999999) / 1000000000;
+
+  riscv_clock_write_mtimecmp(
+    &clint->mtimecmp[cpu],
+    riscv_clock_read_mtime(&clint->mtime) + delta
+  );
+}
+#endif
+
 static void riscv_clock_handler_install(void)
 {
   rtems_status_code sc;
@@ -259,4 +283,9 @@ RTEMS_SYSINIT_ITEM(
 #define Clock_driver_support_install_isr(isr) \
   riscv_clock_handler_install()
 
+#if !defined(RTEMS_SMP) || !defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR)
+#define Clock_driver_support_program_next_event(ns) \
+  riscv_clock_program_next_event(ns)
+#endif
+
 #include "../../../shared/dev/clock/clockimpl.h"
@@ -71,6 +71,22 @@ static void arm_gt_clock_at_tick(void)
 #endif /* ARM_GENERIC_TIMER_UNMASK_AT_TICK */
 }
 
+#if !defined(RTEMS_SMP) || !defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR)
+static void arm_gt_clock_program_next_event(uint64_t ns)
+{
+  uint64_t frequency;
+  uint64_t delta;
+
+  frequency = arm_gt_clock_instance.tc.tc_frequency;
+  delta = (ns / 1000000000) * frequency;
+  delta += ((ns % 1000000000) * frequency + 999999999) / 1000000000;
+  arm_gt_clock_set_compare_value(arm_gt_clock_get_count() + delta);
+#ifdef ARM_GENERIC_TIMER_UNMASK_AT_TICK
+  arm_gt_clock_set_control(0x1);
+#endif /* ARM_GENERIC_TIMER_UNMASK_AT_TICK */
+}
+#endif
+
 static void arm_gt_clock_handler_install(void)
 {
   rtems_status_code sc;
@@ -194,5 +210,10 @@ RTEMS_SYSINIT_ITEM(
 #define Clock_driver_support_install_isr(isr) \
   arm_gt_clock_handler_install()
 
+#if !defined(RTEMS_SMP) || !defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR)
+#define Clock_driver_support_program_next_event(ns) \
+  arm_gt_clock_program_next_event(ns)
+#endif
+
 /* Include shared source clock driver code */
 #include "../../shared/dev/clock/clockimpl.h"
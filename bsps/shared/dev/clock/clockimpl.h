@@ -88,6 +88,39 @@
   #define Clock_driver_support_set_interrupt_affinity(online_processors)
 #endif
 
+/*
+ * A clock driver may support the tickless clock operation, see
+ * CONFIGURE_TICKLESS_CLOCK.  It shall define
+ * Clock_driver_support_program_next_event(nanoseconds) which programs the
+ * clock interrupt of the current processor to occur after the specified
+ * nanoseconds.  The clock interrupt shall be a one-shot interrupt after this
+ * call.  The driver may define CLOCK_DRIVER_TICKLESS_MAXIMUM_NANOSECONDS to
+ * limit the interval.
+ */
+#ifdef Clock_driver_support_program_next_event
+  #if CLOCK_DRIVER_USE_FAST_IDLE || CLOCK_DRIVER_ISRS_PER_TICK
+    #error "The tickless clock operation does not support Fast Idle or n ISRs per tick"
+  #endif
+
+  #if defined(CLOCK_DRIVER_USE_DUMMY_TIMECOUNTER) || \
+    defined(Clock_driver_timecounter_tick)
+    #error "The tickless clock operation requires the default timecounter tick"
+  #endif
+
+  #if defined(RTEMS_SMP) && defined(CLOCK_DRIVER_USE_ONLY_BOOT_PROCESSOR)
+    #error "The tickless clock operation requires a clock interrupt on each processor"
+  #endif
+
+  #ifndef CLOCK_DRIVER_TICKLESS_MAXIMUM_NANOSECONDS
+    #define CLOCK_DRIVER_TICKLESS_MAXIMUM_NANOSECONDS UINT64_MAX
+  #endif
+
+static void Clock_driver_program_next_event( uint64_t nanoseconds )
+{
+  Clock_driver_support_program_next_event( nanoseconds );
+}
+#endif
+
 /*
  * A specialized clock driver may use for example rtems_timecounter_tick_simple()
  * instead of the default.
@@ -251,4 +284,17 @@ void _Clock_Initialize( void )
   #if CLOCK_DRIVER_ISRS_PER_TICK
     Clock_driver_isrs = CLOCK_DRIVER_ISRS_PER_TICK_VALUE;
   #endif
+
+  /*
+   *  Switch to the tickless clock operation if configured.  The clock
+   *  interrupts of all processors are programmed on demand from now on.
+   */
+  #ifdef Clock_driver_support_program_next_event
+    if ( _Watchdog_Tickless_is_configured ) {
+      _Watchdog_Tickless_enable(
+        Clock_driver_program_next_event,
+        CLOCK_DRIVER_TICKLESS_MAXIMUM_NANOSECONDS
+      );
+    }
+  #endif
 }
@@ -48,7 +48,7 @@ static void Shm_Poll_Set_timer( Watchdog_Control *the_watchdog )
   _Watchdog_Insert(
     &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
     the_watchdog,
-    cpu->Watchdog.ticks + 1
+    _Watchdog_Per_CPU_get_ticks( cpu ) + 1
   );
   _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
   _ISR_lock_ISR_enable( &lock_context );
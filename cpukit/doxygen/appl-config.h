@@ -224,6 +224,67 @@
  */
 #define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY
 
+/* Generated from spec:/acfg/if/bdbuf-replacement-policy */
+
+/**
+ * @brief This configuration option is an initializer define.
+ *
+ * The value of this configuration option defines the replacement policy of
+ * the Block Device Cache.
+ *
+ * @par Default Value
+ * The default value is ``RTEMS_BDBUF_POLICY_LRU``.
+ *
+ * @par Value Constraints
+ * The value of this configuration option shall be ``RTEMS_BDBUF_POLICY_LRU``
+ * or ``RTEMS_BDBUF_POLICY_2Q``.
+ *
+ * @par Notes
+ * The ``RTEMS_BDBUF_POLICY_LRU`` policy recycles the least recently used
+ * buffer.  A sequential scan of many blocks, for example a file copy, evicts
+ * all other blocks from the cache.  The ``RTEMS_BDBUF_POLICY_2Q`` policy is
+ * scan-resistant.  Blocks which are accessed again after a while, for example
+ * file system metadata, stay in the cache while the blocks of a scan pass
+ * through.  The policy uses some additional memory for each shard to remember
+ * recently recycled blocks.  Use rtems_bdbuf_get_cache_stats() to compare the
+ * hit ratio of the policies.
+ */
+#define CONFIGURE_BDBUF_REPLACEMENT_POLICY
+
+/* Generated from spec:/acfg/if/bdbuf-shard-count */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * The value of this configuration option defines the count of independently
+ * locked shards of the Block Device Cache.
+ *
+ * @par Default Value
+ * The default value is 1.
+ *
+ * @par Value Constraints
+ * @parblock
+ * The value of this configuration option shall satisfy all of the following
+ * constraints:
+ *
+ * * It shall be greater than or equal to one.
+ *
+ * * It shall be less than or equal to <a
+ *   href="https://en.cppreference.com/w/c/types/integer">UINT32_MAX</a>.
+ * @endparblock
+ *
+ * @par Notes
+ * The count is rounded down to a power of two and limited to the count of
+ * buffer groups.  The buffers of the cache are evenly distributed to the
+ * shards.  The shard of a block is selected by the disk device and a run of
+ * 64 consecutive blocks.  Operations on blocks of different shards do not
+ * contend for a common lock, which improves the scalability of the cache on
+ * multiprocessor systems.  Since each shard manages only its part of the
+ * buffers, a shard may run out of buffers while other shards still have free
+ * buffers.
+ */
+#define CONFIGURE_BDBUF_SHARD_COUNT
+
 /* Generated from spec:/acfg/if/bdbuf-task-stack-size */
 
 /**
@@ -2067,6 +2128,8 @@
  *
  * * #CONFIGURE_IMFS_DISABLE_UTIME
  *
+ * * #CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+ *
  * * #CONFIGURE_IMFS_ENABLE_MKFIFO
  *
  * @{
@@ -2436,6 +2499,35 @@
  */
 #define CONFIGURE_IMFS_DISABLE_UTIME
 
+/* Generated from spec:/acfg/if/imfs-enable-extent-files */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * In case this configuration option is defined, then the regular files
+ * created in the root IMFS store their data in contiguous extents.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the regular files created
+ * in the root IMFS store their data in blocks of
+ * #CONFIGURE_IMFS_MEMFILE_BYTES_PER_BLOCK bytes.
+ *
+ * @par Notes
+ * @parblock
+ * The extent sizes of a file start at 256 bytes and double up to 64KiB.  All
+ * further extents have a size of 64KiB.  Reads and writes copy whole extents
+ * and the file size is only limited by the available memory.  Truncating a
+ * file frees the extents beyond the new file size.
+ *
+ * Other IMFS instances may use extent files through the file node control
+ * IMFS_mknod_control_extfile in their ::IMFS_mount_data.
+ *
+ * In case #CONFIGURE_IMFS_DISABLE_MKNOD_FILE is defined, then this
+ * configuration option has no effect.
+ * @endparblock
+ */
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
 /* Generated from spec:/acfg/if/imfs-enable-mkfifo */
 
 /**
@@ -2711,6 +2803,33 @@
  */
 #define CONFIGURE_EXTRA_TASK_STACKS
 
+/* Generated from spec:/acfg/if/heap-segregated-fit */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * In case this configuration option is defined, then the RTEMS Workspace and
+ * the C Program Heap use the segregated fit mode of the Heap Handler.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the RTEMS Workspace and the
+ * C Program Heap use the first fit mode of the Heap Handler.
+ *
+ * @par Notes
+ * @parblock
+ * In the segregated fit mode, the free blocks are organized in size classes
+ * with two levels of bitmaps.  This bounds the search time of an allocation
+ * independent of the count of free blocks.  The first fit mode searches the
+ * free list in address order and the search time depends on the
+ * fragmentation of the heap.
+ *
+ * The segregated fit mode needs a size class index which is placed at the
+ * begin of the first memory area of each heap.  The size of the index is about
+ * 1KiB on 32-bit targets.
+ * @endparblock
+ */
+#define CONFIGURE_HEAP_SEGREGATED_FIT
+
 /* Generated from spec:/acfg/if/initial-extensions */
 
 /**
@@ -2802,6 +2921,43 @@
  */
 #define CONFIGURE_MALLOC_DIRTY
 
+/* Generated from spec:/acfg/if/malloc-per-cpu-cache */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * In case this configuration option is defined, then a per-processor cache
+ * is used in front of the C Program Heap for small memory areas.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * @parblock
+ * The cache has a magazine for each power of two size class from 16 bytes up
+ * to 512 bytes for each configured processor.  Allocations without alignment
+ * and boundary constraints are satisfied by the magazines of the current
+ * processor without obtaining the allocator lock.  Frees of memory areas
+ * handed out by the cache do not obtain the allocator lock.  Empty magazines
+ * are refilled from the C Program Heap and full magazines are drained to the
+ * C Program Heap in batches.  This reduces the contention on the allocator
+ * lock in SMP configurations.
+ *
+ * Memory areas handed out by the cache are preceded by a tag which records
+ * the size class and the owner processor.  The tag occupies eight bytes
+ * rounded up to the heap alignment.  A memory area freed on another processor,
+ * in interrupt context, or with thread dispatching disabled is put to a
+ * lock-free remote free list of the owner.  Memory areas without a valid tag
+ * are freed to the C Program Heap.
+ *
+ * The memory held by the cache is reported by malloc_info() in the cached
+ * blocks information.  Use rtems_malloc_cache_flush() to return all memory
+ * held by the cache to the C Program Heap.
+ * @endparblock
+ */
+#define CONFIGURE_MALLOC_PER_CPU_CACHE
+
 /* Generated from spec:/acfg/if/max-file-descriptors */
 
 /**
@@ -3169,6 +3325,80 @@
  */
 #define CONFIGURE_MINIMUM_TASK_STACK_SIZE
 
+/* Generated from spec:/acfg/if/mutex-spin-nanoseconds */
+
+/**
+ * @brief This configuration option is an integer define.
+ *
+ * The value of this configuration option defines the maximum time in
+ * nanoseconds a thread spins for a priority inheritance mutex owned by a
+ * thread executing on another processor before it blocks.
+ *
+ * @par Default Value
+ * The default value is 0.
+ *
+ * @par Value Constraints
+ * @parblock
+ * The value of this configuration option shall satisfy all of the following
+ * constraints:
+ *
+ * * It shall be greater than or equal to zero.
+ *
+ * * It shall be less than or equal to <a
+ *   href="https://en.cppreference.com/w/c/types/integer">UINT32_MAX</a>.
+ * @endparblock
+ *
+ * @par Notes
+ * @parblock
+ * A value of zero disables the adaptive mutex spinning.
+ *
+ * The spinning is carried out by the priority inheritance variants of the
+ * Classic binary semaphores, the POSIX mutexes, and the self-contained mutexes
+ * (for example the mutexes used by Newlib and the C++ standard library).  The
+ * spinning stops as soon as the owner releases the mutex, the owner no longer
+ * executes, or the spin time elapsed.  If the mutex is not available after the
+ * spinning, then the thread enqueues on the thread queue of the mutex as
+ * usual.  Use short spin times which are in the range of the typical critical
+ * section lengths.
+ *
+ * The spin successes and failures are counted for each processor and can be
+ * obtained by _Mutex_Spin_get_statistics().
+ *
+ * This configuration option is only evaluated in SMP configurations (e.g.
+ * RTEMS was built with the ``--enable-smp`` build configuration option).  In
+ * all other configurations it has no effect.
+ * @endparblock
+ */
+#define CONFIGURE_MUTEX_SPIN_NANOSECONDS
+
+/* Generated from spec:/acfg/if/objects-name-index */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * In case this configuration option is defined, then a name index is
+ * maintained for the objects of the Classic API classes and the classes with
+ * string names, for example the POSIX named semaphores and message queues.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * @parblock
+ * Without the name index, the object identification by name, for example
+ * rtems_task_ident() or sem_open(), searches linearly through all objects of
+ * the class.  With the name index, the search time does not depend on the
+ * object count in the usual case.
+ *
+ * The name index uses memory from the RTEMS Workspace.  The memory
+ * required for the configured object maxima is accounted for automatically.
+ * If the allocation of a name index fails, then the objects of the class are
+ * searched linearly.
+ * @endparblock
+ */
+#define CONFIGURE_OBJECTS_NAME_INDEX
+
 /* Generated from spec:/acfg/if/stack-checker-enabled */
 
 /**
@@ -3192,6 +3422,40 @@
  */
 #define CONFIGURE_STACK_CHECKER_ENABLED
 
+/* Generated from spec:/acfg/if/tickless-clock */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * In case this configuration option is defined, then the Clock Driver uses
+ * the tickless clock operation if it supports it.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * @parblock
+ * In the tickless clock operation, the clock interrupts are not periodic.  The
+ * clock interrupt of each processor is programmed to the expiration time of
+ * the nearest watchdog of the processor.  The clock ticks are derived from the
+ * uptime, so rtems_clock_get_ticks_since_boot() and the timeouts in clock
+ * ticks work as in the periodic clock operation.  This reduces the interrupt
+ * load and allows idle processors to stay longer in a low power state.
+ *
+ * While a task with a CPU budget algorithm, for example timeslicing, executes
+ * on a processor, the clock interrupt of this processor occurs at each clock
+ * tick.  A task which enables timeslicing through a mode change is preempted
+ * with a delay of up to the next watchdog expiration time of the processor.
+ *
+ * This configuration option requires
+ * #CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER and cannot be used together with
+ * #CONFIGURE_WATCHDOG_TIMING_WHEEL.  If the Clock Driver does not support the
+ * tickless clock operation, then this configuration option has no effect.
+ * @endparblock
+ */
+#define CONFIGURE_TICKLESS_CLOCK
+
 /* Generated from spec:/acfg/if/ticks-per-time-slice */
 
 /**
@@ -3321,6 +3585,37 @@
  */
 #define CONFIGURE_VERBOSE_SYSTEM_INITIALIZATION
 
+/* Generated from spec:/acfg/if/watchdog-timing-wheel */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * In case this configuration option is defined, then the watchdogs which are
+ * based on clock ticks are managed by a hierarchical timing wheel on each
+ * configured processor.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * @parblock
+ * Without this configuration option, the watchdogs based on clock ticks are
+ * managed by a red-black tree.  The insert and remove operations have a time
+ * complexity of O(log(n)) where n is the count of scheduled watchdogs.  With
+ * the timing wheel, the insert and remove operations have a time complexity
+ * of O(1).  The watchdogs of the timing wheel are moved to lower levels in the
+ * clock tick handler on demand.  This makes the timing wheel attractive for
+ * applications with a lot of timeouts which are canceled before they expire.
+ *
+ * Each timing wheel has a memory demand of about 256 pointers.  The watchdogs
+ * of the CLOCK_REALTIME and CLOCK_MONOTONIC clocks are still managed by
+ * red-black trees.  The order in which watchdogs expiring at the same clock
+ * tick are processed is unspecified.
+ * @endparblock
+ */
+#define CONFIGURE_WATCHDOG_TIMING_WHEEL
+
 /* Generated from spec:/acfg/if/zero-workspace-automatically */
 
 /**
@@ -4308,13 +4603,16 @@
  * * <a
  *   href=https://docs.rtems.org/branches/master/c-user/scheduling_concepts.html#deterministic-priority-smp-scheduler>Deterministic
  *   Priority SMP Scheduler</a> which can be configured through the
- *   #CONFIGURE_SCHEDULER_PRIORITY_SMP configuration option, and
+ *   #CONFIGURE_SCHEDULER_PRIORITY_SMP configuration option,
  *
  * * <a
  *   href=https://docs.rtems.org/branches/master/c-user/scheduling_concepts.html#arbitrary-processor-affinity-priority-smp-scheduler>Arbitrary
  *   Processor Affinity Priority SMP Scheduler</a> which can be configured
  *   through the #CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP configuration
- *   option
+ *   option, and
+ *
+ * * Sharded Priority SMP Scheduler which can be configured through the
+ *   #CONFIGURE_SCHEDULER_SHARDED_SMP configuration option
  *
  * this configuration option specifies the maximum numeric priority of any task
  * for these schedulers and one less that the number of priority levels for
@@ -4644,6 +4942,55 @@
  */
 #define CONFIGURE_SCHEDULER_PRIORITY_SMP
 
+/* Generated from spec:/acfg/if/scheduler-sharded-smp */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * In case this configuration option is defined, then the Sharded Priority SMP
+ * Scheduler algorithm is made available to the application.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * @parblock
+ * This scheduler configuration option is an advanced configuration option.
+ * Think twice before you use it.
+ *
+ * This scheduler algorithm is only available when RTEMS is built with SMP
+ * support enabled.
+ *
+ * In case no explicit <a
+ * href=https://docs.rtems.org/branches/master/c-user/config/scheduler-clustered.html>Clustered
+ * Scheduler Configuration</a> is present, then it is used as the scheduler for
+ * up to 32 processors.
+ *
+ * The scheduler uses a ready queue for each processor.  A ready thread is
+ * placed in the ready queue of the processor it used last.  A processor takes
+ * the highest priority thread from its own ready queue and steals a thread
+ * from another ready queue only if this queue contains a thread of a higher
+ * priority.  The set of scheduled threads is the same as for the <a
+ * href=https://docs.rtems.org/branches/master/c-user/scheduling_concepts.html#deterministic-priority-smp-scheduler>Deterministic
+ * Priority SMP Scheduler</a>, however, threads of equal priority are only
+ * dispatched in FIFO order within one ready queue.
+ *
+ * Like the other SMP schedulers, all operations of a scheduler instance are
+ * serialized by one lock which also protects the set of scheduled threads and
+ * the processor allocation.  The wakeup cost under contention on this lock is
+ * therefore about the same as for the Deterministic Priority SMP Scheduler.
+ * The ready queues reduce the thread migrations, so the data of the threads
+ * tends to stay in the processor caches.
+ *
+ * The #CONFIGURE_MAXIMUM_PROCESSORS configuration option shall be defined to
+ * use this scheduler.  The memory allocated for this scheduler depends on the
+ * #CONFIGURE_MAXIMUM_PRIORITY and #CONFIGURE_MAXIMUM_PROCESSORS configuration
+ * options.
+ * @endparblock
+ */
+#define CONFIGURE_SCHEDULER_SHARDED_SMP
+
 /* Generated from spec:/acfg/if/scheduler-simple */
 
 /**
@@ -4755,6 +5102,8 @@
  *
  *   * ``RTEMS_SCHEDULER_TABLE_PRIORITY_SMP( name, obj_name )``
  *
+ *   * ``RTEMS_SCHEDULER_TABLE_SHARDED_SMP( name, obj_name )``
+ *
  *   * ``RTEMS_SCHEDULER_TABLE_SIMPLE( name, obj_name )``
  *
  *   * ``RTEMS_SCHEDULER_TABLE_SIMPLE_SMP( name, obj_name )``
@@ -5029,4 +5378,42 @@
  */
 #define CONFIGURE_TASK_STACK_FROM_ALLOCATOR
 
+/* Generated from spec:/acfg/if/task-stack-recycling */
+
+/**
+ * @brief This configuration option is a boolean feature define.
+ *
+ * In case this configuration option is defined, then the task stacks are
+ * allocated through a stack pool which recycles the stack areas of deleted
+ * tasks.
+ *
+ * @par Default Configuration
+ * If this configuration option is undefined, then the described feature is not
+ * enabled.
+ *
+ * @par Notes
+ * @parblock
+ * The stack pool has free lists of stack areas for size classes from 1KiB to
+ * 224KiB with four size classes for each power of two.  The stack area of a
+ * deleted task is put on the free list of its size class.  A task creation
+ * takes a stack area from the free list of the size class of the requested
+ * stack size without an RTEMS Workspace allocation.  The thread-local storage
+ * area is part of the stack area and is recycled with it.  Stack areas larger
+ * than the largest size class are allocated from and freed to the RTEMS
+ * Workspace directly.
+ *
+ * If an allocation from the RTEMS Workspace fails, then all stack areas held
+ * by the stack pool are returned to the RTEMS Workspace and the allocation is
+ * retried.  The task stack space calculation accounts for the size class
+ * rounding.
+ *
+ * The hit and miss counts of the stack pool are reported by the ``wkspace``
+ * shell command.
+ *
+ * This configuration option and #CONFIGURE_TASK_STACK_ALLOCATOR are mutually
+ * exclusive.
+ * @endparblock
+ */
+#define CONFIGURE_TASK_STACK_RECYCLING
+
 /** @} */
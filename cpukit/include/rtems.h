@@ -81,6 +81,7 @@
 #include <rtems/rtems/tasks.h>
 #include <rtems/rtems/timer.h>
 #include <rtems/rtems/types.h>
+#include <rtems/rtems/waitset.h>
 
 #if defined(RTEMS_MULTIPROCESSING)
   #include <rtems/rtems/mp.h>
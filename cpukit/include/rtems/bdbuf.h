@@ -47,7 +47,7 @@ extern "C" {
  *
  * The Block Device Buffer Management implements a cache between the disk
  * devices and file systems.  The code provides read-ahead and write queuing to
- * the drivers and fast cache look-up using an AVL tree.
+ * the drivers and fast cache look-up using hash tables.
  *
  * The block size used by a file system can be set at runtime and must be a
  * multiple of the disk device block size.  The disk device's physical block
@@ -132,7 +132,8 @@ extern "C" {
  * Empty or cached buffers are added to the LRU list and removed from this
  * queue when a caller requests a buffer.  This is referred to as getting a
  * buffer in the code and the event get in the state diagram.  The buffer is
- * assigned to a block and inserted to the AVL based on the block/device key.
+ * assigned to a block and inserted to the hash table based on the block/device
+ * key.
  * If the block is to be read by the user and not in the cache it is transfered
  * from the disk into memory.  If no buffers are on the LRU list the modified
  * list is checked.  If buffers are on the modified the swap out task will be
@@ -158,7 +159,11 @@ extern "C" {
  * blocks from the cache.  The read-ahead is triggered after two misses of
  * ascending consecutive blocks or a read hit of a block read by the
  * most-resent read-ahead transfer.  The read-ahead works per disk, but all
- * transfers are issued by the read-ahead task.
+ * transfers are issued by the read-ahead task.  Each disk tracks several
+ * concurrent streams of read accesses.  A stream may have a stride of more
+ * than one block, which is detected by three accesses with the same distance.
+ * The read-ahead window of a stream shrinks if blocks read ahead were recycled
+ * before they were accessed.
  *
  * The cache has the following lists of buffers:
  *  - LRU: Accessed or transfered buffers released in least recently used
@@ -181,11 +186,11 @@ extern "C" {
  * @brief State of a buffer of the cache.
  *
  * The state has several implications.  Depending on the state a buffer can be
- * in the AVL tree, in a list, in use by an entity and a group user or not.
+ * in the hash table, in a list, in use by an entity and a group user or not.
  *
  * <table>
  *   <tr>
- *     <th>State</th><th>Valid Data</th><th>AVL Tree</th>
+ *     <th>State</th><th>Valid Data</th><th>Hash Table</th>
  *     <th>LRU List</th><th>Modified List</th><th>Synchronization List</th>
  *     <th>Group User</th><th>External User</th>
  *   </tr>
@@ -302,21 +307,13 @@ typedef struct rtems_bdbuf_group rtems_bdbuf_group;
 /**
  * To manage buffers we using buffer descriptors (BD). A BD holds a buffer plus
  * a range of other information related to managing the buffer in the cache. To
- * speed-up buffer lookup descriptors are organized in AVL-Tree. The fields
+ * speed-up buffer lookup descriptors are organized in hash tables. The fields
  * 'dd' and 'block' are search keys.
  */
 typedef struct rtems_bdbuf_buffer
 {
   rtems_chain_node link;       /**< Link the BD onto a number of lists. */
 
-  struct rtems_bdbuf_avl_node
-  {
-    struct rtems_bdbuf_buffer* left;   /**< Left Child */
-    struct rtems_bdbuf_buffer* right;  /**< Right Child */
-    signed char                cache;  /**< Cache */
-    signed char                bal;    /**< The balance of the sub-tree */
-  } avl;
-
   rtems_disk_device *dd;        /**< disk device */
 
   rtems_blkdev_bnum block;      /**< block number on the device */
@@ -325,6 +322,11 @@ typedef struct rtems_bdbuf_buffer
 
   rtems_bdbuf_buf_state state;           /**< State of the buffer. */
 
+  bool read_ahead;               /**< The buffer was filled by a read-ahead
+                                  * transfer and not accessed since then. */
+  bool hot;                      /**< The buffer is on the hot list of the 2Q
+                                  * replacement policy when it is cached. */
+
   uint32_t waiters;              /**< The number of threads waiting on this
                                   * buffer. */
   rtems_bdbuf_group* group;      /**< Pointer to the group of BDs this BD is
@@ -354,6 +356,27 @@ struct rtems_bdbuf_group
   rtems_bdbuf_buffer* bdbuf;         /**< First BD this block covers. */
 };
 
+/**
+ * The replacement policy selects the cached buffer which is recycled if a
+ * buffer for another block is needed and no free buffer is available.
+ */
+typedef enum
+{
+  /**
+   * Recycle the least recently used buffer.
+   */
+  RTEMS_BDBUF_POLICY_LRU,
+
+  /**
+   * Use the scan-resistant 2Q policy.  Blocks enter the cache on a
+   * probationary LRU list.  A block which is accessed again after it was
+   * recycled from the probationary list moves to the hot LRU list.  Buffers
+   * are recycled from the probationary list first, so that a scan of many
+   * blocks does not evict the blocks on the hot list.
+   */
+  RTEMS_BDBUF_POLICY_2Q
+} rtems_bdbuf_replacement_policy;
+
 /**
  * Buffering configuration definition. See confdefs.h for support on using this
  * structure.
@@ -383,6 +406,10 @@ typedef struct rtems_bdbuf_config {
                                                 * allocation size. */
   rtems_task_priority read_ahead_priority;     /**< Priority of the read-ahead
                                                 * task. */
+  uint32_t            shard_count;             /**< Number of independently
+                                                * locked cache shards. */
+  rtems_bdbuf_replacement_policy replacement_policy; /**< Replacement policy
+                                                * of the cache. */
 } rtems_bdbuf_config;
 
 /**
@@ -455,6 +482,17 @@ extern const rtems_bdbuf_config rtems_bdbuf_configuration;
  */
 #define RTEMS_BDBUF_BUFFER_MAX_SIZE_DEFAULT (4096)
 
+/**
+ * Default count of cache shards.  A single shard protects the whole cache by
+ * one lock.
+ */
+#define RTEMS_BDBUF_SHARD_COUNT_DEFAULT (1)
+
+/**
+ * Default replacement policy.
+ */
+#define RTEMS_BDBUF_REPLACEMENT_POLICY_DEFAULT RTEMS_BDBUF_POLICY_LRU
+
 /**
  * Prepare buffering layer to work - initialize buffer descritors and (if it is
  * neccessary) buffers. After initialization all blocks is placed into the
@@ -707,6 +745,47 @@ rtems_bdbuf_get_device_stats (const rtems_disk_device *dd,
 void
 rtems_bdbuf_reset_device_stats (rtems_disk_device *dd);
 
+/**
+ * @brief Block device cache statistics.
+ *
+ * The statistics cover the read and get requests of all disk devices.
+ * Integer overflows in the statistic counters may happen.
+ */
+typedef struct {
+  /**
+   * @brief Count of requests which found the block in the cached or modified
+   * state.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief Count of requests which had to assign a buffer to the block.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief Count of cached buffers recycled for another block.
+   */
+  uint32_t evictions;
+
+  /**
+   * @brief Count of blocks moved to the hot list of the 2Q replacement policy.
+   */
+  uint32_t promotions;
+} rtems_bdbuf_cache_stats;
+
+/**
+ * @brief Returns the block device cache statistics.
+ */
+void
+rtems_bdbuf_get_cache_stats (rtems_bdbuf_cache_stats *stats);
+
+/**
+ * @brief Resets the block device cache statistics.
+ */
+void
+rtems_bdbuf_reset_cache_stats (void);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -92,10 +92,12 @@ typedef struct rtems_blkdev_sg_buffer {
  * of blocks from or to the device.
  *
  * Transfer requests are issued to the disk device driver with the
- * @ref RTEMS_BLKIO_REQUEST IO control.  The transfer request completion status
- * must be signalled with rtems_blkdev_request_done().  This function must be
- * called exactly once per request.  The return value of the IO control will be
- * ignored for transfer requests.
+ * @ref RTEMS_BLKIO_REQUEST IO control by rtems_blkdev_submit_request().  The
+ * driver may have several requests in progress up to the queue depth of the
+ * disk and may complete them in any order.  The transfer request completion
+ * status must be signalled with rtems_blkdev_request_done().  This function
+ * must be called exactly once per request.  The return value of the IO control
+ * will be ignored for transfer requests.
  *
  * @see rtems_blkdev_create().
  */
@@ -130,6 +132,18 @@ typedef struct rtems_blkdev_request {
    */
   rtems_id io_task;
 
+  /**
+   * The physical disk device which holds a queue slot for this request, or
+   * NULL.  It is set by rtems_blkdev_submit_request().
+   */
+  rtems_disk_device *dd;
+
+  /**
+   * Chain node which may be used by the driver to queue the request until it
+   * completes the request.
+   */
+  rtems_chain_node link;
+
   /*
    * TODO: The use of these req blocks is not a great design. The req is a
    *       struct with a single 'bufs' declared in the req struct and the
@@ -148,7 +162,10 @@ typedef struct rtems_blkdev_request {
 /**
  * @brief Signals transfer request completion status.
  *
- * This function must be called exactly once per request.
+ * This function must be called exactly once per request.  It may be called
+ * from interrupt context.  Requests may complete in any order.  The queue slot
+ * of the request is released before the request done callback function is
+ * invoked, so that the callback function may submit a new request.
  *
  * @param[in,out] req The transfer request.
  * @param[in] status The status of the operation should be
@@ -161,9 +178,67 @@ static inline void rtems_blkdev_request_done(
   rtems_status_code status
 )
 {
+  rtems_disk_device *dd = req->dd;
+
+  if (dd != NULL) {
+    rtems_counting_semaphore_post(&dd->queue_slots);
+  }
+
   (*req->done)(req, status);
 }
 
+/**
+ * @brief Submits the transfer request to the disk device.
+ *
+ * The request is issued to the driver with the @ref RTEMS_BLKIO_REQUEST IO
+ * control.  The function does not wait for the completion of the request.  The
+ * request done callback function is invoked once the driver completes the
+ * request.  If the queue depth of the disk is limited and the queue is full,
+ * then the calling task waits until another request of the disk completes.
+ *
+ * If the queue depth is limited, then a driver may hold back requests until
+ * the queue is full or the disk is unplugged.  Call rtems_blkdev_unplug()
+ * before waiting for the completion of a request.
+ *
+ * @param[in] dd The disk device.
+ * @param[in, out] req The transfer request.
+ *
+ * @see rtems_blkdev_set_queue_depth().
+ */
+void rtems_blkdev_submit_request(
+  rtems_disk_device *dd,
+  rtems_blkdev_request *req
+);
+
+/**
+ * @brief Unplugs the disk device.
+ *
+ * Tells the driver with the @ref RTEMS_BLKIO_UNPLUG IO control that the
+ * submitter waits for the completion of the requests submitted so far.  The
+ * driver shall complete them without waiting for further requests.  Nothing
+ * is done if the queue depth of the disk is unlimited.
+ *
+ * @param[in] dd The disk device.
+ */
+void rtems_blkdev_unplug(rtems_disk_device *dd);
+
+/**
+ * @brief Sets the queue depth of the disk device.
+ *
+ * The queue depth is the maximum count of transfer requests of the physical
+ * disk which may be in progress at the driver at the same time.  The default
+ * is @ref RTEMS_DISK_QUEUE_DEPTH_UNLIMITED.  The queue depth shall be set
+ * while no requests of the disk are in progress, for example directly after
+ * the disk creation.
+ *
+ * @param[in] dd The disk device.
+ * @param[in] queue_depth The new queue depth.
+ */
+void rtems_blkdev_set_queue_depth(
+  rtems_disk_device *dd,
+  uint32_t queue_depth
+);
+
 /**
  * @brief The start block in a request.
  *
@@ -189,6 +264,9 @@ static inline void rtems_blkdev_request_done(
 #define RTEMS_BLKIO_PURGEDEV        _IO('B', 10)
 #define RTEMS_BLKIO_GETDEVSTATS     _IOR('B', 11, rtems_blkdev_stats *)
 #define RTEMS_BLKIO_RESETDEVSTATS   _IO('B', 12)
+#define RTEMS_BLKIO_UNPLUG          _IO('B', 13)
+#define RTEMS_BLKIO_GETQUEUEDEPTH   _IOR('B', 14, uint32_t)
+#define RTEMS_BLKIO_SETQUEUEDEPTH   _IOW('B', 15, uint32_t)
 
 /** @} */
 
@@ -249,6 +327,16 @@ static inline int rtems_disk_fd_reset_device_stats(int fd)
   return ioctl(fd, RTEMS_BLKIO_RESETDEVSTATS);
 }
 
+static inline int rtems_disk_fd_get_queue_depth(int fd, uint32_t *queue_depth)
+{
+  return ioctl(fd, RTEMS_BLKIO_GETQUEUEDEPTH, queue_depth);
+}
+
+static inline int rtems_disk_fd_set_queue_depth(int fd, uint32_t queue_depth)
+{
+  return ioctl(fd, RTEMS_BLKIO_SETQUEUEDEPTH, &queue_depth);
+}
+
 /**
  * @name Block Device Driver Capabilities
  */
@@ -116,6 +116,16 @@
     RTEMS_BDBUF_READ_AHEAD_TASK_PRIORITY_DEFAULT
 #endif
 
+#ifndef CONFIGURE_BDBUF_SHARD_COUNT
+  #define CONFIGURE_BDBUF_SHARD_COUNT \
+    RTEMS_BDBUF_SHARD_COUNT_DEFAULT
+#endif
+
+#ifndef CONFIGURE_BDBUF_REPLACEMENT_POLICY
+  #define CONFIGURE_BDBUF_REPLACEMENT_POLICY \
+    RTEMS_BDBUF_REPLACEMENT_POLICY_DEFAULT
+#endif
+
 #define _CONFIGURE_LIBBLOCK_TASKS \
   ( 1 + CONFIGURE_SWAPOUT_WORKER_TASKS \
     + ( CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS != 0 ) )
@@ -142,7 +152,9 @@ const rtems_bdbuf_config rtems_bdbuf_configuration = {
   CONFIGURE_BDBUF_CACHE_MEMORY_SIZE,
   CONFIGURE_BDBUF_BUFFER_MIN_SIZE,
   CONFIGURE_BDBUF_BUFFER_MAX_SIZE,
-  CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY
+  CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY,
+  CONFIGURE_BDBUF_SHARD_COUNT,
+  CONFIGURE_BDBUF_REPLACEMENT_POLICY
 };
 
 #ifdef __cplusplus
@@ -44,6 +44,7 @@
 #ifdef CONFIGURE_INIT
 
 #include <rtems/score/watchdogticks.h>
+#include <rtems/confdefs/percpu.h>
 
 #if !defined(CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER) \
   && !defined(CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER) \
@@ -62,6 +63,23 @@
   #include <rtems/sysinit.h>
 #endif
 
+#ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+  #include <rtems/score/watchdogimpl.h>
+  #include <rtems/sysinit.h>
+#endif
+
+#ifdef CONFIGURE_TICKLESS_CLOCK
+  #ifndef CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+    #error "CONFIGURE_TICKLESS_CLOCK requires CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER"
+  #endif
+
+  #ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+    #error "CONFIGURE_TICKLESS_CLOCK and CONFIGURE_WATCHDOG_TIMING_WHEEL are mutually exclusive"
+  #endif
+
+  #include <rtems/score/watchdogimpl.h>
+#endif
+
 #ifndef CONFIGURE_MICROSECONDS_PER_TICK
   #define CONFIGURE_MICROSECONDS_PER_TICK 10000
 #endif
@@ -86,6 +104,20 @@ extern "C" {
   );
 #endif
 
+#ifdef CONFIGURE_WATCHDOG_TIMING_WHEEL
+  Watchdog_Wheel _Watchdog_Wheels[ _CONFIGURE_MAXIMUM_PROCESSORS ];
+
+  RTEMS_SYSINIT_ITEM(
+    _Watchdog_Wheel_initialize,
+    RTEMS_SYSINIT_PER_CPU_DATA,
+    RTEMS_SYSINIT_ORDER_LAST
+  );
+#endif
+
+#ifdef CONFIGURE_TICKLESS_CLOCK
+  const bool _Watchdog_Tickless_is_configured = true;
+#endif
+
 const uint32_t _Watchdog_Microseconds_per_tick =
   CONFIGURE_MICROSECONDS_PER_TICK;
 
@@ -50,7 +50,9 @@
 #define _CONFIGURE_HEAP_EXTEND_VIA_SBRK
 #endif
 
-#if defined(_CONFIGURE_HEAP_EXTEND_VIA_SBRK) || defined(CONFIGURE_MALLOC_DIRTY)
+#if defined(_CONFIGURE_HEAP_EXTEND_VIA_SBRK) \
+  || defined(CONFIGURE_MALLOC_DIRTY) \
+  || defined(CONFIGURE_MALLOC_PER_CPU_CACHE)
 #include <rtems/malloc.h>
 #endif
 
@@ -68,6 +70,11 @@ rtems_malloc_dirtier_t rtems_malloc_dirty_helper =
   rtems_malloc_dirty_memory;
 #endif
 
+#ifdef CONFIGURE_MALLOC_PER_CPU_CACHE
+const rtems_malloc_cache_operations * const rtems_malloc_cache =
+  &rtems_malloc_per_cpu_cache;
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -47,6 +47,42 @@
 
 #include <rtems/confdefs/unlimited.h>
 
+#ifndef CONFIGURE_MAXIMUM_BARRIERS
+  #define CONFIGURE_MAXIMUM_BARRIERS 0
+#endif
+
+#ifndef CONFIGURE_MAXIMUM_MESSAGE_QUEUES
+  #define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 0
+#endif
+
+#ifndef CONFIGURE_MAXIMUM_PARTITIONS
+  #define CONFIGURE_MAXIMUM_PARTITIONS 0
+#endif
+
+#ifndef CONFIGURE_MAXIMUM_PERIODS
+  #define CONFIGURE_MAXIMUM_PERIODS 0
+#endif
+
+#ifndef CONFIGURE_MAXIMUM_PORTS
+  #define CONFIGURE_MAXIMUM_PORTS 0
+#endif
+
+#ifndef CONFIGURE_MAXIMUM_REGIONS
+  #define CONFIGURE_MAXIMUM_REGIONS 0
+#endif
+
+#ifndef CONFIGURE_MAXIMUM_SEMAPHORES
+  #define CONFIGURE_MAXIMUM_SEMAPHORES 0
+#endif
+
+#ifndef CONFIGURE_MAXIMUM_TIMERS
+  #define CONFIGURE_MAXIMUM_TIMERS 0
+#endif
+
+#ifdef CONFIGURE_OBJECTS_NAME_INDEX
+  #include <rtems/score/objectimpl.h>
+#endif
+
 #if CONFIGURE_MAXIMUM_BARRIERS > 0
   #include <rtems/rtems/barrierdata.h>
 #endif
@@ -84,6 +120,10 @@
 extern "C" {
 #endif
 
+#ifdef CONFIGURE_OBJECTS_NAME_INDEX
+  const bool _Objects_Name_index_is_enabled = true;
+#endif
+
 #if CONFIGURE_MAXIMUM_BARRIERS > 0
   BARRIER_INFORMATION_DEFINE( CONFIGURE_MAXIMUM_BARRIERS );
 #endif
@@ -79,6 +79,18 @@
   #include <rtems/posix/key.h>
 #endif
 
+#ifndef CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES
+  #define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES 0
+#endif
+
+#ifndef CONFIGURE_MAXIMUM_POSIX_SEMAPHORES
+  #define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES 0
+#endif
+
+#ifndef CONFIGURE_MAXIMUM_POSIX_SHMS
+  #define CONFIGURE_MAXIMUM_POSIX_SHMS 0
+#endif
+
 #if CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES > 0
   #include <rtems/posix/mqueue.h>
 #endif
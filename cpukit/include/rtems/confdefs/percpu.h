@@ -53,6 +53,7 @@
 
 #include <rtems/confdefs/bsp.h>
 #include <rtems/score/context.h>
+#include <rtems/score/mutexspin.h>
 #include <rtems/score/percpu.h>
 #include <rtems/score/smp.h>
 
@@ -150,6 +151,12 @@ const size_t _Thread_Idle_stack_size = CONFIGURE_IDLE_TASK_STACK_SIZE;
   const Thread_Idle_body _Thread_Idle_body = CONFIGURE_IDLE_TASK_BODY;
 #endif
 
+/* Adaptive mutex spin configuration */
+
+#if defined(CONFIGURE_MUTEX_SPIN_NANOSECONDS) && defined(RTEMS_SMP)
+  const uint32_t _Mutex_Spin_nanoseconds = CONFIGURE_MUTEX_SPIN_NANOSECONDS;
+#endif
+
 #ifdef __cplusplus
 }
 #endif
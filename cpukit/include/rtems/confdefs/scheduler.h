@@ -51,6 +51,7 @@
   && !defined(CONFIGURE_SCHEDULER_PRIORITY) \
   && !defined(CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP) \
   && !defined(CONFIGURE_SCHEDULER_PRIORITY_SMP) \
+  && !defined(CONFIGURE_SCHEDULER_SHARDED_SMP) \
   && !defined(CONFIGURE_SCHEDULER_SIMPLE) \
   && !defined(CONFIGURE_SCHEDULER_SIMPLE_SMP) \
   && !defined(CONFIGURE_SCHEDULER_STRONG_APA) \
@@ -140,6 +141,23 @@ extern "C" {
   #endif
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_SHARDED_SMP
+  #ifndef CONFIGURE_SCHEDULER_NAME
+    #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'M', 'P', 'S', 'H' )
+  #endif
+
+  #ifndef CONFIGURE_SCHEDULER_TABLE_ENTRIES
+    #define CONFIGURE_SCHEDULER \
+      RTEMS_SCHEDULER_SHARDED_SMP( \
+        dflt, \
+        CONFIGURE_MAXIMUM_PRIORITY + 1 \
+      )
+
+    #define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+      RTEMS_SCHEDULER_TABLE_SHARDED_SMP( dflt, CONFIGURE_SCHEDULER_NAME )
+  #endif
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_STRONG_APA
   #ifndef CONFIGURE_SCHEDULER_NAME
     #define CONFIGURE_SCHEDULER_NAME rtems_build_name( 'M', 'A', 'P', 'A' )
@@ -124,6 +124,9 @@ typedef union {
   #ifdef CONFIGURE_SCHEDULER_PRIORITY_AFFINITY_SMP
     Scheduler_priority_affinity_SMP_Node Priority_affinity_SMP;
   #endif
+  #ifdef CONFIGURE_SCHEDULER_SHARDED_SMP
+    Scheduler_sharded_SMP_Node Sharded_SMP;
+  #endif
   #ifdef CONFIGURE_SCHEDULER_STRONG_APA
     Scheduler_strong_APA_Node Strong_APA;
   #endif
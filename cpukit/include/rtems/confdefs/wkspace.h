@@ -44,16 +44,20 @@
 #ifdef CONFIGURE_INIT
 
 #include <rtems/confdefs/bdbuf.h>
+#include <rtems/confdefs/extensions.h>
 #include <rtems/confdefs/inittask.h>
 #include <rtems/confdefs/initthread.h>
+#include <rtems/confdefs/objectsclassic.h>
 #include <rtems/confdefs/objectsposix.h>
 #include <rtems/confdefs/percpu.h>
 #include <rtems/confdefs/threads.h>
 #include <rtems/confdefs/wkspacesupport.h>
 #include <rtems/score/coremsg.h>
 #include <rtems/score/context.h>
+#include <rtems/score/heap.h>
 #include <rtems/score/memory.h>
 #include <rtems/score/stack.h>
+#include <rtems/score/stackpool.h>
 #include <rtems/sysinit.h>
 
 #if CPU_STACK_ALIGNMENT > CPU_HEAP_ALIGNMENT
@@ -67,7 +71,19 @@
     RTEMS_ALIGN_UP( ( _stack_size ) + CONTEXT_FP_SIZE, CPU_STACK_ALIGNMENT )
 #endif
 
-#ifdef CONFIGURE_TASK_STACK_FROM_ALLOCATOR
+#ifdef CONFIGURE_TASK_STACK_RECYCLING
+  #if defined(CONFIGURE_TASK_STACK_ALLOCATOR) \
+    || defined(CONFIGURE_TASK_STACK_DEALLOCATOR)
+    #error "CONFIGURE_TASK_STACK_RECYCLING and a custom task stack allocator are mutually exclusive"
+  #endif
+
+  #define _Configure_From_stackspace( _stack_size ) \
+    _Configure_From_workspace( \
+      STACK_POOL_ALLOCATION_SIZE( \
+        _CONFIGURE_TASK_STACK_ALLOC_SIZE( _stack_size ) \
+      ) \
+    )
+#elif defined(CONFIGURE_TASK_STACK_FROM_ALLOCATOR)
   #define _Configure_From_stackspace( _stack_size ) \
     CONFIGURE_TASK_STACK_FROM_ALLOCATOR( \
       _CONFIGURE_TASK_STACK_ALLOC_SIZE( _stack_size ) \
@@ -103,11 +119,43 @@
  * into two parts so that we have a free block for the last allocation.  See
  * _Heap_Block_split().
  */
-#define _CONFIGURE_HEAP_HANDLER_OVERHEAD \
-  _Configure_Align_up( HEAP_BLOCK_HEADER_SIZE, CPU_HEAP_ALIGNMENT )
+#ifdef CONFIGURE_HEAP_SEGREGATED_FIT
+  #define _CONFIGURE_HEAP_HANDLER_OVERHEAD \
+    ( _Configure_Align_up( HEAP_BLOCK_HEADER_SIZE, CPU_HEAP_ALIGNMENT ) \
+      + sizeof( Heap_Segregated_fit_index ) + CPU_ALIGNMENT )
+#else
+  #define _CONFIGURE_HEAP_HANDLER_OVERHEAD \
+    _Configure_Align_up( HEAP_BLOCK_HEADER_SIZE, CPU_HEAP_ALIGNMENT )
+#endif
+
+#ifdef CONFIGURE_OBJECTS_NAME_INDEX
+  #define _Configure_Memory_for_name_index( _number ) \
+    ( _Configure_Zero_or_one( _number ) \
+      * _Configure_From_workspace( OBJECTS_NAME_INDEX_SIZE( \
+          rtems_resource_maximum_per_allocation( _number ) ) ) )
+
+  #define _CONFIGURE_MEMORY_FOR_OBJECTS_NAME_INDEX \
+    ( _Configure_Memory_for_name_index( _CONFIGURE_TASKS ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_BARRIERS ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_MESSAGE_QUEUES ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_PARTITIONS ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_PERIODS ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_PORTS ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_REGIONS ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_SEMAPHORES ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_TIMERS ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_USER_EXTENSIONS ) \
+      + _Configure_Memory_for_name_index( \
+          CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_POSIX_SEMAPHORES ) \
+      + _Configure_Memory_for_name_index( CONFIGURE_MAXIMUM_POSIX_SHMS ) )
+#else
+  #define _CONFIGURE_MEMORY_FOR_OBJECTS_NAME_INDEX 0
+#endif
 
 #define CONFIGURE_EXECUTIVE_RAM_SIZE \
   ( _CONFIGURE_MEMORY_FOR_POSIX_OBJECTS \
+    + _CONFIGURE_MEMORY_FOR_OBJECTS_NAME_INDEX \
     + CONFIGURE_MESSAGE_BUFFER_MEMORY \
     + 1024 * CONFIGURE_MEMORY_OVERHEAD \
     + _CONFIGURE_HEAP_HANDLER_OVERHEAD )
@@ -158,6 +206,15 @@ const uintptr_t _Workspace_Size = CONFIGURE_EXECUTIVE_RAM_SIZE;
     _Workspace_Malloc_initialize_unified;
 #endif
 
+#ifdef CONFIGURE_HEAP_SEGREGATED_FIT
+  uintptr_t ( * const _Workspace_Heap_initializer )(
+    Heap_Control *,
+    void *,
+    uintptr_t,
+    uintptr_t
+  ) = _Heap_Initialize_segregated_fit;
+#endif
+
 uint32_t rtems_minimum_stack_size = CONFIGURE_MINIMUM_TASK_STACK_SIZE;
 
 const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
@@ -221,6 +278,23 @@ const uintptr_t _Stack_Space_size = _CONFIGURE_STACK_SPACE_SIZE;
 #elif defined(CONFIGURE_TASK_STACK_ALLOCATOR) \
   || defined(CONFIGURE_TASK_STACK_DEALLOCATOR)
   #error "CONFIGURE_TASK_STACK_ALLOCATOR and CONFIGURE_TASK_STACK_DEALLOCATOR must be both defined or both undefined"
+#elif defined(CONFIGURE_TASK_STACK_RECYCLING)
+  static Stack_Pool_Control _Configure_Stack_pool;
+
+  Stack_Pool_Control * const _Stack_Pool = &_Configure_Stack_pool;
+
+  const bool _Stack_Allocator_avoids_workspace = false;
+
+  const Stack_Allocator_allocate _Stack_Allocator_allocate =
+    _Stack_Pool_Allocate;
+
+  const Stack_Allocator_free _Stack_Allocator_free = _Stack_Pool_Free;
+
+  RTEMS_SYSINIT_ITEM(
+    _Stack_Pool_Initialize,
+    RTEMS_SYSINIT_STACK_ALLOCATOR,
+    RTEMS_SYSINIT_ORDER_MIDDLE
+  );
 #endif
 
 #ifdef CONFIGURE_IDLE_TASK_STORAGE_SIZE
@@ -17,6 +17,7 @@
 #include <rtems.h>
 #include <rtems/libio.h>
 #include <rtems/chain.h>
+#include <rtems/thread.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -64,25 +65,48 @@ typedef int (*rtems_block_device_ioctl)(
 #define RTEMS_DISK_READ_AHEAD_SIZE_AUTO (0)
 
 /**
- * @brief Block device read-ahead control.
+ * @brief Count of concurrent read-ahead streams tracked for each disk.
+ */
+#define RTEMS_DISK_READ_AHEAD_STREAM_COUNT 4
+
+/**
+ * @brief Maximum block distance of two accesses which belong to the same
+ * read-ahead stream.
+ */
+#define RTEMS_DISK_READ_AHEAD_MAX_STRIDE 16
+
+/**
+ * @brief Queue depth of a disk which does not limit the count of transfer
+ * requests in progress at the driver.
+ */
+#define RTEMS_DISK_QUEUE_DEPTH_UNLIMITED 0
+
+/**
+ * @brief Block device read-ahead stream.
+ *
+ * A stream is a sequence of read accesses with a constant block distance
+ * (the stride).  A stride of one is a sequential stream.
  */
 typedef struct {
   /**
-   * @brief Chain node for the read-ahead request queue of the read-ahead task.
+   * @brief Block of the last access of this stream.
+   *
+   * A value of @ref RTEMS_DISK_READ_AHEAD_NO_TRIGGER indicates an unused
+   * stream.
    */
-  rtems_chain_node node;
+  rtems_blkdev_bnum last;
 
   /**
-   * @brief Block value to trigger the read-ahead request.
+   * @brief Block value to trigger the read-ahead request of this stream.
    *
    * A value of @ref RTEMS_DISK_READ_AHEAD_NO_TRIGGER will disable further
-   * read-ahead requests (except the ones triggered by @a rtems_bdbuf_peek)
-   * since no valid block can have this value.
+   * read-ahead requests of this stream since no valid block can have this
+   * value.
    */
   rtems_blkdev_bnum trigger;
 
   /**
-   * @brief Start block for the next read-ahead request.
+   * @brief Start block for the next read-ahead request of this stream.
    *
    * In case the trigger value is out of range of valid blocks, this value my
    * be arbitrary.
@@ -90,12 +114,80 @@ typedef struct {
   rtems_blkdev_bnum next;
 
   /**
-   * @brief Size of the next read-ahead request in blocks.
+   * @brief Start block of the last read-ahead request of this stream.
+   *
+   * The blocks of the stream from this block up to the next block were read
+   * ahead.
+   */
+  rtems_blkdev_bnum begin;
+
+  /**
+   * @brief Block distance of the accesses of this stream.
+   */
+  uint32_t stride;
+
+  /**
+   * @brief Block distance of the last two accesses of this stream.
+   *
+   * The stride changes to this value if the next access has the same
+   * distance.
+   */
+  uint32_t candidate_stride;
+
+  /**
+   * @brief Count of blocks read by a read-ahead request of this stream.
    *
-   * A value of @ref RTEMS_DISK_READ_AHEAD_SIZE_AUTO will try to read the rest
-   * of the disk but at most the configured max_read_ahead_blocks.
+   * The window shrinks if blocks read ahead were recycled before they were
+   * accessed and grows if the read-ahead requests hit.  It is at most the
+   * configured max_read_ahead_blocks.
+   */
+  uint32_t window;
+
+  /**
+   * @brief Time stamp of the last access to select the least recently used
+   * stream for replacement.
+   */
+  uint32_t stamp;
+} rtems_blkdev_read_ahead_stream;
+
+/**
+ * @brief Block device read-ahead control.
+ */
+typedef struct {
+  /**
+   * @brief Chain node for the read-ahead request queue of the read-ahead task.
+   */
+  rtems_chain_node node;
+
+  /**
+   * @brief Start block for the next read-ahead request of a
+   * @a rtems_bdbuf_peek.
+   */
+  rtems_blkdev_bnum next;
+
+  /**
+   * @brief Size of the next read-ahead request of a @a rtems_bdbuf_peek in
+   * blocks.
+   *
+   * A value of @ref RTEMS_DISK_READ_AHEAD_SIZE_AUTO indicates that no peek
+   * request is pending.
    */
   uint32_t nr_blocks;
+
+  /**
+   * @brief Bit set of the streams with a pending read-ahead request.
+   */
+  uint32_t pending;
+
+  /**
+   * @brief Source of the stream time stamps.
+   */
+  uint32_t stamp;
+
+  /**
+   * @brief Read-ahead streams.
+   */
+  rtems_blkdev_read_ahead_stream streams[RTEMS_DISK_READ_AHEAD_STREAM_COUNT];
 } rtems_blkdev_read_ahead;
 
 /**
@@ -164,6 +256,22 @@ typedef struct {
    * Error count of transfers issued by write requests.
    */
   uint32_t write_errors;
+
+  /**
+   * @brief Read-ahead hit count.
+   *
+   * A read-ahead hit occurs in the rtems_bdbuf_read() function in case the
+   * block was read by a read-ahead transfer and not accessed since then.
+   */
+  uint32_t read_ahead_hits;
+
+  /**
+   * @brief Read-ahead waste count.
+   *
+   * Count of blocks read by a read-ahead transfer which were removed from the
+   * cache or overwritten without a read access.
+   */
+  uint32_t read_ahead_waste;
 } rtems_blkdev_stats;
 
 /**
@@ -290,6 +398,31 @@ struct rtems_disk_device {
    * @brief Read-ahead control for this disk.
    */
   rtems_blkdev_read_ahead read_ahead;
+
+  /**
+   * @brief Protects the device statistics and the read-ahead control in the
+   * block device cache.
+   */
+  rtems_mutex lock;
+
+  /**
+   * @brief Maximum count of transfer requests of this disk which may be in
+   * progress at the driver at the same time.
+   *
+   * The value @ref RTEMS_DISK_QUEUE_DEPTH_UNLIMITED imposes no limit.  This
+   * field is only used in the physical disk device.
+   *
+   * @see rtems_blkdev_set_queue_depth().
+   */
+  uint32_t queue_depth;
+
+  /**
+   * @brief Free transfer request slots of this disk if the queue depth is
+   * limited.
+   *
+   * @see rtems_blkdev_submit_request().
+   */
+  rtems_counting_semaphore queue_slots;
 };
 
 /**
@@ -356,6 +489,13 @@ static inline rtems_blkdev_bnum rtems_disk_get_block_count(
   return dd->size;
 }
 
+static inline uint32_t rtems_disk_get_queue_depth(
+  const rtems_disk_device *dd
+)
+{
+  return dd->phys_dev->queue_depth;
+}
+
 /** @} */
 
 /**
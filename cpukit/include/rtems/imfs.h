@@ -112,6 +112,25 @@ typedef block_p *block_ptr;
 #define IMFS_MEMFILE_MAXIMUM_SIZE \
   (LAST_TRIPLY_INDIRECT * IMFS_MEMFILE_BYTES_PER_BLOCK)
 
+/**
+ *  IMFS "extfile" information
+ *
+ *  Extent files store their data in contiguous extents.  The first extent has
+ *  a size of IMFS_EXTFILE_FIRST_EXTENT_SIZE bytes.  Each following extent has
+ *  twice the size of its predecessor until the extent size reaches
+ *  IMFS_EXTFILE_FIRST_EXTENT_SIZE << IMFS_EXTFILE_MAXIMUM_EXTENT_SHIFT bytes.
+ *  All further extents have this maximum size.  The extent of a file offset
+ *  is computed and not searched.
+ *
+ *  A shared mapping of an extent file needs contiguous memory.  If the mapped
+ *  area spans more than one extent, then the leading extents up to the end of
+ *  the area are moved into one allocation.  The extent table still refers to
+ *  each extent, now inside this allocation.
+ */
+#define IMFS_EXTFILE_FIRST_EXTENT_SIZE 256
+
+#define IMFS_EXTFILE_MAXIMUM_EXTENT_SHIFT 8
+
 /** @} */
 
 /**
@@ -280,12 +299,44 @@ struct IMFS_jnode_tt {
   time_t              stat_mtime;            /* Time of last modification */
   time_t              stat_ctime;            /* Time of last status change */
   const IMFS_node_control *control;
+  IMFS_jnode_t       *index_next;            /* Next node in index bucket */
 };
 
+/**
+ * @brief The entry count at which a directory gets a hash index.
+ *
+ * Smaller directories are searched by a walk through the entry chain.  The
+ * hash index of a directory is built on demand by the first lookup once the
+ * directory has at least this count of entries.  It is freed once the
+ * directory is empty.
+ */
+#define IMFS_DIRECTORY_INDEX_THRESHOLD 32
+
 typedef struct {
   IMFS_jnode_t                          Node;
   rtems_chain_control                   Entries;
   rtems_filesystem_mount_table_entry_t *mt_fs;
+
+  /**
+   * @brief The count of nodes in the entry chain.
+   */
+  size_t                                entry_count;
+
+  /**
+   * @brief The buckets of the optional hash index of the entries.
+   *
+   * This member is NULL, if the directory has no hash index.  The entry chain
+   * defines the order of the entries returned by readdir() independent of the
+   * hash index.
+   */
+  IMFS_jnode_t                        **index;
+
+  /**
+   * @brief The bucket count minus one of the hash index.
+   *
+   * The bucket count is a power of two.
+   */
+  size_t                                index_mask;
 } IMFS_directory_t;
 
 typedef struct {
@@ -321,12 +372,22 @@ typedef struct {
   block_p         direct;           /* pointer to file image */
 } IMFS_linearfile_t;
 
+typedef struct {
+  IMFS_filebase_t File;
+  uint8_t       **extents;          /* table of extents */
+  size_t          extent_count;     /* count of allocated extents */
+  size_t          extent_slots;     /* size of the table of extents */
+  size_t          contiguous_count; /* count of leading contiguous extents */
+  size_t          map_count;        /* count of shared mappings */
+} IMFS_extfile_t;
+
 /* Support copy on write for linear files */
 typedef union {
   IMFS_jnode_t      Node;
   IMFS_filebase_t   File;
   IMFS_memfile_t    Memfile;
   IMFS_linearfile_t Linearfile;
+  IMFS_extfile_t    Extfile;
 } IMFS_file_t;
 
 typedef struct {
@@ -371,6 +432,11 @@ static inline IMFS_memfile_t *IMFS_iop_to_memfile( const rtems_libio_t *iop )
   return (IMFS_memfile_t *) iop->pathinfo.node_access;
 }
 
+static inline IMFS_extfile_t *IMFS_iop_to_extfile( const rtems_libio_t *iop )
+{
+  return (IMFS_extfile_t *) iop->pathinfo.node_access;
+}
+
 typedef struct {
   const IMFS_mknod_control *directory;
   const IMFS_mknod_control *device;
@@ -397,6 +463,7 @@ extern const IMFS_mknod_control IMFS_mknod_control_dir_default;
 extern const IMFS_mknod_control IMFS_mknod_control_dir_minimal;
 extern const IMFS_mknod_control IMFS_mknod_control_device;
 extern const IMFS_mknod_control IMFS_mknod_control_memfile;
+extern const IMFS_mknod_control IMFS_mknod_control_extfile;
 extern const IMFS_node_control IMFS_node_control_linfile;
 extern const IMFS_mknod_control IMFS_mknod_control_fifo;
 extern const IMFS_mknod_control IMFS_mknod_control_enosys;
@@ -1018,6 +1085,51 @@ static inline void IMFS_Set_handlers( rtems_filesystem_location_info_t *loc )
   loc->handlers = node->control->handlers;
 }
 
+/**
+ * @brief Searches a directory for an entry with the specified name.
+ *
+ * The "." and ".." names are not handled by this function.  In case the
+ * directory has no hash index and has at least
+ * IMFS_DIRECTORY_INDEX_THRESHOLD entries, then the hash index is built.  If
+ * there is not enough memory to build the hash index, then the entry chain
+ * is searched.
+ *
+ * @param dir The directory to search.
+ * @param name The entry name.
+ * @param namelen The entry name length.
+ *
+ * @retval NULL No entry with this name exists.
+ * @return The directory entry with this name.
+ */
+IMFS_jnode_t *IMFS_search_directory(
+  IMFS_directory_t *dir,
+  const char *name,
+  size_t namelen
+);
+
+/**
+ * @brief Inserts a node into the hash index of a directory.
+ *
+ * The directory must have a hash index.  Use IMFS_add_to_directory() to add
+ * a node to a directory.
+ *
+ * @param dir The directory.
+ * @param node The node to insert.
+ */
+void IMFS_directory_index_insert( IMFS_directory_t *dir, IMFS_jnode_t *node );
+
+/**
+ * @brief Removes a node from the hash index of a directory.
+ *
+ * The directory must have a hash index.  The hash index is freed if the
+ * directory has no entries.  Use IMFS_remove_from_directory() to remove a
+ * node from a directory.
+ *
+ * @param dir The directory.
+ * @param node The node to remove.
+ */
+void IMFS_directory_index_remove( IMFS_directory_t *dir, IMFS_jnode_t *node );
+
 static inline void IMFS_add_to_directory(
   IMFS_jnode_t *dir_node,
   IMFS_jnode_t *entry_node
@@ -1027,13 +1139,25 @@ static inline void IMFS_add_to_directory(
 
   entry_node->Parent = dir_node;
   rtems_chain_append_unprotected( &dir->Entries, &entry_node->Node );
+  ++dir->entry_count;
+
+  if ( dir->index != NULL ) {
+    IMFS_directory_index_insert( dir, entry_node );
+  }
 }
 
 static inline void IMFS_remove_from_directory( IMFS_jnode_t *node )
 {
-  IMFS_assert( node->Parent != NULL );
+  IMFS_directory_t *dir = (IMFS_directory_t *) node->Parent;
+
+  IMFS_assert( dir != NULL );
   node->Parent = NULL;
   rtems_chain_extract_unprotected( &node->Node );
+  --dir->entry_count;
+
+  if ( dir->index != NULL ) {
+    IMFS_directory_index_remove( dir, node );
+  }
 }
 
 static inline bool IMFS_is_directory( const IMFS_jnode_t *node )
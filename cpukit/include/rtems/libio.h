@@ -1014,6 +1014,27 @@ typedef int (*rtems_filesystem_mmap_t)(
   off_t off
 );
 
+/**
+ * @brief MUNMAP support.
+ *
+ * This handler is called by munmap() for a shared mapping of a regular file
+ * which was established by a successful call of the MMAP handler.  It may be
+ * used to release resources obtained by the MMAP handler, for example to
+ * allow the file system to move the file memory again.  The file location is
+ * valid during the call.
+ *
+ * @param[in] loc The location of the mapped file.
+ * @param[in] addr The starting address of the mapped memory.
+ * @param[in] len The length of the mapped memory.
+ *
+ * @see rtems_filesystem_default_munmap().
+ */
+typedef void (*rtems_filesystem_munmap_t)(
+  const rtems_filesystem_location_info_t *loc,
+  void *addr,
+  size_t len
+);
+
 /**
  * @brief File system node operations table.
  */
@@ -1034,6 +1055,7 @@ struct _rtems_filesystem_file_handlers_r {
   rtems_filesystem_readv_t readv_h;
   rtems_filesystem_writev_t writev_h;
   rtems_filesystem_mmap_t mmap_h;
+  rtems_filesystem_munmap_t munmap_h;
 };
 
 /**
@@ -1270,6 +1292,19 @@ int rtems_filesystem_default_mmap(
   off_t off
 );
 
+/**
+ * @brief Default MUNMAP handler.
+ *
+ * This handler does nothing.
+ *
+ * @see rtems_filesystem_munmap_t.
+ */
+void rtems_filesystem_default_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void *addr,
+  size_t len
+);
+
 /** @} */
 
 /**
@@ -96,6 +96,78 @@ extern const rtems_heap_extend_handler rtems_malloc_extend_handler;
 typedef void (*rtems_malloc_dirtier_t)(void *, size_t);
 extern rtems_malloc_dirtier_t rtems_malloc_dirty_helper;
 
+/**
+ *  @brief C program heap cache operations.
+ *
+ *  A cache in front of the C program heap may satisfy allocation and free
+ *  requests without the need to obtain the allocator lock.
+ */
+typedef struct {
+  /**
+   *  @brief Tries to allocate a memory area of at least the size from the
+   *  cache.
+   *
+   *  This handler is only called in a context which may obtain the allocator
+   *  lock.
+   *
+   *  @return Returns the begin address of the allocated memory area, or NULL
+   *    if the allocation cannot be satisfied by the cache.
+   */
+  void *( *allocate )( size_t size );
+
+  /**
+   *  @brief Tries to free the memory area to the cache.
+   *
+   *  @param ptr is the begin address of the memory area.
+   *
+   *  @param deferred indicates if the handler is called in a context which
+   *    may not obtain the allocator lock, for example in interrupt context.
+   *
+   *  @return Returns true, if the memory area was taken by the cache,
+   *    otherwise false.
+   */
+  bool ( *free )( void *ptr, bool deferred );
+
+  /**
+   *  @brief Gets the usable size of a memory area handed out by the cache.
+   *
+   *  This handler does not obtain the allocator lock.
+   *
+   *  @param ptr is the begin address of the memory area.
+   *
+   *  @return Returns the usable size of the memory area, or zero if the
+   *    memory area was not handed out by the cache.
+   */
+  size_t ( *usable_size )( void *ptr );
+
+  /**
+   *  @brief Returns all memory areas held by the cache to the heap.
+   */
+  void ( *flush )( void );
+
+  /**
+   *  @brief Gets the information about the blocks held by the cache.
+   *
+   *  The block sizes are accounted in the same way as in
+   *  _Heap_Get_information().
+   */
+  void ( *get_information )( Heap_Information *info );
+} rtems_malloc_cache_operations;
+
+/**
+ *  @brief The C program heap cache.
+ *
+ *  This constant is defined by the application configuration option
+ *  #CONFIGURE_MALLOC_PER_CPU_CACHE via <rtems/confdefs.h> or a default
+ *  configuration.  By default, no cache is used.
+ */
+extern const rtems_malloc_cache_operations * const rtems_malloc_cache;
+
+/**
+ *  @brief The per-processor C program heap cache.
+ */
+extern const rtems_malloc_cache_operations rtems_malloc_per_cpu_cache;
+
 /** @} */
 
 /**
@@ -271,6 +343,16 @@ void *rtems_heap_greedy_allocate_all_except_largest(
  */
 void rtems_heap_greedy_free( void *opaque );
 
+/**
+ * @brief Returns all memory areas held by the C program heap cache to the
+ *   heap.
+ *
+ * In case no cache is configured, then this function does nothing.
+ *
+ * @see #CONFIGURE_MALLOC_PER_CPU_CACHE.
+ */
+void rtems_malloc_cache_flush( void );
+
 /** @} */
 
 #ifdef __cplusplus
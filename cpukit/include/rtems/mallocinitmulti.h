@@ -39,6 +39,7 @@
 
 #include <rtems/malloc.h>
 #include <rtems/score/heapimpl.h>
+#include <rtems/score/wkspacedata.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -65,7 +66,7 @@ static inline Heap_Control *_Malloc_Initialize_for_multiple_areas(
 
   mem = _Memory_Get();
   RTEMS_Malloc_Heap = heap;
-  init_or_extend = _Heap_Initialize;
+  init_or_extend = _Workspace_Heap_initializer;
   page_size = CPU_HEAP_ALIGNMENT;
 
   for (i = 0; i < _Memory_Get_count( mem ); ++i) {
@@ -86,7 +87,7 @@ static inline Heap_Control *_Malloc_Initialize_for_multiple_areas(
     }
   }
 
-  if ( init_or_extend == _Heap_Initialize ) {
+  if ( init_or_extend == _Workspace_Heap_initializer ) {
     _Internal_error( INTERNAL_ERROR_NO_MEMORY_FOR_HEAP );
   }
 
@@ -40,6 +40,7 @@
 #include <rtems/malloc.h>
 #include <rtems/score/assert.h>
 #include <rtems/score/heapimpl.h>
+#include <rtems/score/wkspacedata.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -67,7 +68,7 @@ static inline Heap_Control *_Malloc_Initialize_for_one_area(
 
   RTEMS_Malloc_Heap = heap;
   area = _Memory_Get_area( mem, 0 );
-  space_available = _Heap_Initialize(
+  space_available = ( *_Workspace_Heap_initializer )(
     heap,
     _Memory_Get_free_begin( area ),
     _Memory_Get_free_size( area ),
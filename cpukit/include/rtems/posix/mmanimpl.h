@@ -54,6 +54,13 @@ typedef struct mmap_mappings_s {
   size_t             len;   /**< The length of memory mapped */
   int                flags; /**< The mapping flags */
   POSIX_Shm_Control *shm;   /**< The shared memory object or NULL */
+
+  /**
+   * The file location of a shared mapping of a regular file.  It is valid if
+   * has_location is true.
+   */
+  rtems_filesystem_location_info_t location;
+  bool               has_location; /**< The location is valid */
 } mmap_mapping;
 
 extern rtems_chain_control mmap_mappings;
@@ -143,6 +143,8 @@ typedef struct {
   void                        *buffer_table;
   size_t                       buffer_count;
   size_t                       buffer_size;
+  rtems_interval               poll_interval;
+  void                      ( *poll_handler )( int fd );
 } rtems_printer_task_context;
 
 static inline void rtems_printer_task_initialize(
@@ -204,6 +206,14 @@ static inline void rtems_printer_task_set_buffer_size(
   context->buffer_size = buffer_size;
 }
 
+static inline void rtems_printer_task_set_poll_interval(
+  rtems_printer_task_context *context,
+  rtems_interval            poll_interval
+)
+{
+  context->poll_interval = poll_interval;
+}
+
 /**
  * @brief Creates a printer task.
  *
@@ -239,6 +249,50 @@ int rtems_print_printer_task(
  */
 void rtems_printer_task_drain(rtems_printer_task_context *context);
 
+/**
+ * @brief Starts the printk() ring buffers.
+ *
+ * Afterwards, printk(), vprintk(), and putk() no longer output the characters
+ * one by one through rtems_putc().  Instead, each formatted record is copied
+ * into a ring buffer of the current processor without blocking.  Each ring
+ * buffer is a lock-free single-producer/single-consumer queue.  The producers
+ * on one processor are serialized by a short interrupt disabled section.  If
+ * a ring buffer is full, then the record is dropped and a notice is written
+ * by the consumer.
+ *
+ * The ring buffers are drained by the printer task started with the context.
+ * It polls the ring buffers with the poll interval of the context and writes
+ * the records in the order of their creation to the file descriptor of the
+ * context.  A call to rtems_printer_task_drain() drains also the ring
+ * buffers.
+ *
+ * In case of a fatal error, _Terminate() takes over the ring buffers before
+ * the fatal extensions are invoked.  The remaining records are written
+ * synchronously through rtems_putc() and afterwards printk() uses rtems_putc()
+ * again, so that the output of the fatal extensions is not deferred.  The
+ * printer task stops to consume records.  A record which the printer task
+ * consumes at the time of the fatal error may be written twice.
+ *
+ * @param[out] printer is initialized to print into the ring buffers, see also
+ *   rtems_print_printer_printk().
+ *
+ * @param[in, out] context is the initialized printer task context.  If the
+ *   poll interval is zero, then a default of ten milliseconds is used.
+ *
+ * @param ring_size is the size in bytes of the ring buffer of each processor.
+ *   It shall be a power of two.
+ *
+ * @retval 0 Successful operation.
+ * @retval EINVAL Invalid ring size or printer task context parameters.
+ * @retval EBUSY The printk() ring buffers are already started.
+ * @retval ENOMEM Not enough resources.
+ */
+int rtems_printk_ring_start(
+  rtems_printer              *printer,
+  rtems_printer_task_context *context,
+  size_t                      ring_size
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -64,10 +64,13 @@ extern "C" {
  * Profiling information includes critical timing values such as the maximum
  * time of disabled thread dispatching which is a measure for the thread
  * dispatch latency.  On SMP configurations statistics of all SMP locks in the
- * system are available.
+ * system are available.  The wakeup latency histograms of each processor show
+ * how long threads wait from their unblock up to their actual execution.
  *
  * Profiling information can be retrieved via rtems_profiling_iterate() and
- * reported as an XML dump via rtems_profiling_report_xml().  These functions
+ * reported as an XML dump via rtems_profiling_report_xml().  The wakeup
+ * latency histograms can be reported in a human readable form via
+ * rtems_profiling_report_wakeup_latency().  These functions
  * are always available, but actual profiling data is only available if enabled
  * at build configuration time.
  *
@@ -90,7 +93,14 @@ typedef enum {
    *
    * @see rtems_profiling_smp_lock.
    */
-  RTEMS_PROFILING_SMP_LOCK
+  RTEMS_PROFILING_SMP_LOCK,
+
+  /**
+   * @brief Type of per-CPU wakeup latency profiling data.
+   *
+   * @see rtems_profiling_wakeup_latency.
+   */
+  RTEMS_PROFILING_WAKEUP_LATENCY
 } rtems_profiling_type;
 
 /**
@@ -278,6 +288,83 @@ typedef struct {
   uint64_t contention_counts[RTEMS_PROFILING_SMP_LOCK_CONTENTION_COUNTS];
 } rtems_profiling_smp_lock;
 
+/**
+ * @brief Count of priority bands of the wakeup latency histograms.
+ */
+#define RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BANDS 4
+
+/**
+ * @brief Count of task priority values covered by one priority band of the
+ * wakeup latency histograms.
+ *
+ * The priority band with index N covers the task priorities from
+ * N * RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BAND_WIDTH up to
+ * (N + 1) * RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BAND_WIDTH minus one.  The
+ * last priority band covers also all greater task priorities.
+ */
+#define RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BAND_WIDTH 64
+
+/**
+ * @brief Count of buckets of the wakeup latency histograms.
+ */
+#define RTEMS_PROFILING_WAKEUP_LATENCY_BUCKETS 24
+
+/**
+ * @brief Per-CPU wakeup latency profiling data.
+ *
+ * The wakeup latency is the time interval from the unblock of a thread up to
+ * the context switch to this thread.  It includes the time the thread spends
+ * in the ready state while threads of higher or equal priority execute.  It
+ * is accounted on the processor which performs the context switch to the
+ * thread.  The CPU counters of all processors must be synchronized to get
+ * meaningful values.
+ */
+typedef struct {
+  /**
+   * @brief The profiling data header.
+   */
+  rtems_profiling_header header;
+
+  /**
+   * @brief The processor index of this profiling data.
+   */
+  uint32_t processor_index;
+
+  /**
+   * @brief The name of the scheduler instance which owns the processor.
+   *
+   * If the processor is not owned by a scheduler instance, then the name is
+   * zero.
+   */
+  uint32_t scheduler_name;
+
+  /**
+   * @brief The maximum wakeup latency in nanoseconds.
+   */
+  uint32_t max_wakeup_latency;
+
+  /**
+   * @brief The lower bounds of the histogram buckets in nanoseconds.
+   *
+   * The histogram bucket with index N counts the wakeup latencies greater
+   * than or equal to its lower bound and less than the lower bound of the
+   * next bucket.  The last bucket has no upper bound.
+   */
+  uint32_t bucket_lower_bounds[RTEMS_PROFILING_WAKEUP_LATENCY_BUCKETS];
+
+  /**
+   * @brief The wakeup latency histograms for each priority band.
+   *
+   * The first index is the priority band of the task priority at the context
+   * switch to the task.  The second index is the histogram bucket.
+   *
+   * The values may overflow.
+   */
+  uint32_t histograms
+    [RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BANDS]
+    [RTEMS_PROFILING_WAKEUP_LATENCY_BUCKETS];
+} rtems_profiling_wakeup_latency;
+
 /**
  * @brief Collection of profiling data.
  */
@@ -296,6 +383,11 @@ typedef union {
    * @brief SMP lock profiling data if indicated by the header.
    */
   rtems_profiling_smp_lock smp_lock;
+
+  /**
+   * @brief Per-CPU wakeup latency profiling data if indicated by the header.
+   */
+  rtems_profiling_wakeup_latency wakeup_latency;
 } rtems_profiling_data;
 
 /**
@@ -339,6 +431,18 @@ int rtems_profiling_report_xml(
   const char *indentation
 );
 
+/**
+ * @brief Reports the wakeup latency histograms of all processors in a human
+ * readable form.
+ *
+ * Only histogram buckets with a non-zero count are reported.
+ *
+ * @param[in] printer The RTEMS printer to send the output too.
+ *
+ * @returns As specified by printf().
+ */
+int rtems_profiling_report_wakeup_latency(const rtems_printer *printer);
+
 /** @} */
 
 #ifdef __cplusplus
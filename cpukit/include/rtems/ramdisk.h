@@ -135,6 +135,26 @@ typedef struct ramdisk {
    * @brief Free the RAM disk at the block device delete request.
    */
   bool free_at_delete_request;
+
+  /**
+   * @brief Protects the held back requests.
+   */
+  rtems_mutex lock;
+
+  /**
+   * @brief Requests held back until the queue of the disk is full or the disk
+   * is unplugged.
+   *
+   * Requests are only held back if the queue depth of the disk is limited.
+   *
+   * @see rtems_blkdev_set_queue_depth().
+   */
+  rtems_chain_control pending;
+
+  /**
+   * @brief Count of held back requests.
+   */
+  uint32_t pending_count;
 } ramdisk;
 
 int ramdisk_ioctl(rtems_disk_device *dd, uint32_t req, void *argp);
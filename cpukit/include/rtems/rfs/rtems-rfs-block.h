@@ -74,6 +74,43 @@
     rtems_rfs_buffer_mark_dirty (_h); \
   } while (0)
 
+/**
+ * The inode slot holding the number of extents in an extent map.
+ */
+#define RTEMS_RFS_BLOCK_EXTENT_COUNT (RTEMS_RFS_INODE_BLOCKS - 1)
+
+/**
+ * The number of extents held in the inode.
+ */
+#define RTEMS_RFS_BLOCK_INODE_EXTENTS (RTEMS_RFS_BLOCK_EXTENT_COUNT / 2)
+
+/**
+ * The number of extent tables an extent map can have.
+ */
+#define RTEMS_RFS_BLOCK_EXTENT_TABLES (RTEMS_RFS_BLOCK_EXTENT_COUNT)
+
+/**
+ * The maximum number of blocks reserved for an extent map.
+ */
+#define RTEMS_RFS_BLOCK_MAP_RESERVE (64)
+
+/**
+ * An extent is a run of contiguous blocks.
+ */
+typedef struct rtems_rfs_block_extent_s
+{
+  /**
+   * The first block of the extent.
+   */
+  rtems_rfs_block_no start;
+
+  /**
+   * The number of blocks in the extent.
+   */
+  uint32_t count;
+
+} rtems_rfs_block_extent;
+
 /**
  * A block map manges the block lists that originate from an inode. The inode
  * contains a number of block numbers. A block map takes those block numbers
@@ -107,6 +144,21 @@
  *  @li 335,544,320 bytes for a 1024 byte block size,
  *  @li 2,684,354,560 bytes for a 2048 byte block size, and
  *  @li 21,474,836,480 bytes for a 4096 byte block size.
+ *
+ * An inode with the RTEMS_RFS_INODE_FLAG_EXTENTS flag holds its map as
+ * extents. An extent is a run of contiguous blocks and is held as the first
+ * block number followed by the block count. The last inode slot holds the
+ * number of extents. If the extents fit in the remaining slots they are held
+ * in the inode, else the remaining slots hold the block numbers of extent
+ * tables. Finding a block walks the extents from the one last found so
+ * sequential access does not read the tables again.
+ *
+ * Blocks are added to an extent map from a reservation. The reservation is a
+ * run of blocks allocated in the bitmaps when the map needs a block and has
+ * none reserved. The size of the reservation follows the size of the map so
+ * a file being written allocates contiguous runs of blocks with one bitmap
+ * search per run. The blocks not used are returned to the bitmaps when the
+ * map is shrunk or closed.
  */
 typedef struct rtems_rfs_block_map_s
 {
@@ -152,6 +204,37 @@ typedef struct rtems_rfs_block_map_s
    */
   uint32_t blocks[RTEMS_RFS_INODE_BLOCKS];
 
+  /**
+   * Is the map held as extents ?
+   */
+  bool extents;
+
+  /**
+   * The index of the extent last found in an extent map.
+   */
+  uint32_t extent_index;
+
+  /**
+   * The block position in the map of the first block of the extent last
+   * found.
+   */
+  rtems_rfs_block_no extent_bno;
+
+  /**
+   * The extent last found. A count of 0 means there is no extent.
+   */
+  rtems_rfs_block_extent extent;
+
+  /**
+   * The first block reserved for an extent map.
+   */
+  rtems_rfs_block_no reserved_start;
+
+  /**
+   * The number of blocks reserved for an extent map.
+   */
+  size_t reserved_count;
+
   /**
    * Singly Buffer handle.
    */
@@ -174,6 +257,12 @@ typedef struct rtems_rfs_block_map_s
  */
 #define rtems_rfs_block_map_count(_m) ((_m)->size.count)
 
+/**
+ * Return the extent count in an extent map.
+ */
+#define rtems_rfs_block_map_extents(_m) \
+  ((_m)->blocks[RTEMS_RFS_BLOCK_EXTENT_COUNT])
+
 /**
  * Return the map's size element.
  */
@@ -257,7 +346,7 @@ int rtems_rfs_block_map_open (rtems_rfs_file_system*  fs,
 
 /**
  * Close the map. The buffer handles are closed and any help buffers are
- * released.
+ * released. The blocks reserved for an extent map are freed.
  *
  * @param[in] fs is the file system data.
  * @param[in] map is a pointer to the map that is opened.
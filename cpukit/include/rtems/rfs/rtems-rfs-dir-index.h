@@ -0,0 +1,184 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @brief RTEMS File System Directory Index
+ *
+ * @ingroup rtems_rfs
+ *
+ * RTEMS File System Directory Index
+ *
+ * A directory that grows past a single block on a file system with the
+ * directory index feature is indexed by the hash of the entry names. The
+ * first block of the directory becomes the root of a tree that is at most two
+ * levels deep. Each index block holds sorted pairs of a hash and the position
+ * of a block in the directory. The leaves of the tree are normal directory
+ * blocks and all entries with the same hash are held in the same leaf. A look
+ * up reads the root, an optional node and a single leaf.
+ *
+ * An index block starts with an empty directory entry so reading the directory
+ * or checking it is empty skips the index blocks.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#if !defined (_RTEMS_RFS_DIR_INDEX_H_)
+#define _RTEMS_RFS_DIR_INDEX_H_
+
+#include <rtems/rfs/rtems-rfs-block.h>
+#include <rtems/rfs/rtems-rfs-dir.h>
+#include <rtems/rfs/rtems-rfs-file-system.h>
+#include <rtems/rfs/rtems-rfs-inode.h>
+
+/**
+ * The magic number of an index block.
+ */
+#define RTEMS_RFS_DIR_INDEX_MAGIC (0x52465849)
+
+/**
+ * Define the offsets of the fields of an index block. The fields follow the
+ * empty directory entry at the start of the block. The ID field holds the
+ * magic number, the depth is the number of index blocks on the path from the
+ * block to a leaf, including the block, and
+ * the count is the number of index entries.
+ */
+#define RTEMS_RFS_DIR_INDEX_HEADER  (RTEMS_RFS_DIR_ENTRY_SIZE)
+#define RTEMS_RFS_DIR_INDEX_ID      (RTEMS_RFS_DIR_INDEX_HEADER + 0)
+#define RTEMS_RFS_DIR_INDEX_DEPTH   (RTEMS_RFS_DIR_INDEX_HEADER + 4)
+#define RTEMS_RFS_DIR_INDEX_COUNT   (RTEMS_RFS_DIR_INDEX_HEADER + 6)
+#define RTEMS_RFS_DIR_INDEX_ENTRIES (RTEMS_RFS_DIR_INDEX_HEADER + 8)
+
+/**
+ * An index entry is the lowest hash held below the entry and the position of
+ * the block in the directory. The hash of the first entry in an index block is
+ * not used.
+ */
+#define RTEMS_RFS_DIR_INDEX_ENTRY_HASH (0)
+#define RTEMS_RFS_DIR_INDEX_ENTRY_BNO  (4)
+#define RTEMS_RFS_DIR_INDEX_ENTRY_SIZE (8)
+
+/**
+ * The maximum depth of the index. The root points to leaves at depth 1 and to
+ * nodes at depth 2.
+ */
+#define RTEMS_RFS_DIR_INDEX_MAX_DEPTH (2)
+
+/**
+ * Return the number of entries an index block can hold.
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_dir_index_limit(_fs) \
+  ((rtems_rfs_fs_block_size (_fs) - RTEMS_RFS_DIR_INDEX_ENTRIES) / \
+   RTEMS_RFS_DIR_INDEX_ENTRY_SIZE)
+
+/**
+ * Is the directory indexed ?
+ *
+ * @param[in] fs is the file system.
+ * @param[in] dir is the directory inode.
+ *
+ * @retval true The directory is indexed.
+ * @retval false The directory is searched from the start.
+ */
+bool rtems_rfs_dir_index_enabled (rtems_rfs_file_system*  fs,
+                                  rtems_rfs_inode_handle* dir);
+
+/**
+ * Look up the leaf block that holds the entries with the hash.
+ *
+ * @param[in] fs is the file system.
+ * @param[in] map is the block map of the directory.
+ * @param[in] hash is the hash of the name.
+ * @param[out] leaf will be filled in with the position of the leaf block in
+ *                  the directory.
+ *
+ * @retval 0 Successful operation.
+ * @retval EIO The index is not valid.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_dir_index_lookup (rtems_rfs_file_system* fs,
+                                rtems_rfs_block_map*   map,
+                                uint32_t               hash,
+                                rtems_rfs_block_no*    leaf);
+
+/**
+ * Add an entry to an indexed directory. A full leaf is split and the index
+ * grows as needed.
+ *
+ * @param[in] fs is the file system.
+ * @param[in] map is the block map of the directory.
+ * @param[in] name is a pointer to the name of the entry to be added.
+ * @param[in] length is the length of the name excluding a terminating 0.
+ * @param[in] ino is the ino of the entry.
+ *
+ * @retval 0 Successful operation.
+ * @retval EFBIG The index cannot hold the entry.
+ * @retval ENOSPC There is no free block to grow the index.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_dir_index_add_entry (rtems_rfs_file_system* fs,
+                                   rtems_rfs_block_map*   map,
+                                   const char*            name,
+                                   size_t                 length,
+                                   rtems_rfs_ino          ino);
+
+/**
+ * Index a directory held in a single full block. The entries are moved to new
+ * leaf blocks and the first block becomes the root of the index. If an error
+ * occurs the new blocks are returned and the directory is left in the single
+ * block.
+ *
+ * @param[in] fs is the file system.
+ * @param[in] dir is the directory inode.
+ * @param[in] map is the block map of the directory.
+ *
+ * @retval 0 Successful operation.
+ * @retval ENOSPC There is no free block for the leaves.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_dir_index_create (rtems_rfs_file_system*  fs,
+                                rtems_rfs_inode_handle* dir,
+                                rtems_rfs_block_map*    map);
+
+/**
+ * Stop using the index of a directory. The index blocks are erased and the
+ * directory is searched from the start.
+ *
+ * @param[in] fs is the file system.
+ * @param[in] dir is the directory inode.
+ * @param[in] map is the block map of the directory.
+ *
+ * @retval 0 Successful operation.
+ * @retval error_code An error occurred.
+ */
+int rtems_rfs_dir_index_drop (rtems_rfs_file_system*  fs,
+                              rtems_rfs_inode_handle* dir,
+                              rtems_rfs_block_map*    map);
+
+#endif
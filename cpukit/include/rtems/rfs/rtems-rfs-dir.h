@@ -130,6 +130,20 @@
 #define rtems_rfs_dir_set_entry_length(_e, _l) \
   rtems_rfs_write_u16 (_e + RTEMS_RFS_DIR_ENTRY_LEN, _l)
 
+/**
+ * Validate the directory entry data.
+ *
+ * @param[in] _f is a pointer to the file system.
+ * @param[in] _l is the length of the entry.
+ * @param[in] _i is the ino of the entry.
+ *
+ * @retval true The entry is not valid.
+ * @retval false The entry is valid.
+ */
+#define rtems_rfs_dir_entry_valid(_f, _l, _i) \
+  (((_l) <= RTEMS_RFS_DIR_ENTRY_SIZE) || ((_l) >= rtems_rfs_fs_max_name (_f)) \
+   || (_i < RTEMS_RFS_ROOT_INO) || (_i > rtems_rfs_fs_inodes (_f)))
+
 /**
  * Look up a directory entry in the directory pointed to by the inode. The look
  * up is local to this directory. No need to decend.
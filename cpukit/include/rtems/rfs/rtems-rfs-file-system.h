@@ -56,6 +56,7 @@
 #define RTEMS_RFS_SB_OFFSET_GROUP_BLOCKS    (RTEMS_RFS_SB_OFFSET_GROUPS          + 4)
 #define RTEMS_RFS_SB_OFFSET_GROUP_INODES    (RTEMS_RFS_SB_OFFSET_GROUP_BLOCKS    + 4)
 #define RTEMS_RFS_SB_OFFSET_INODE_SIZE      (RTEMS_RFS_SB_OFFSET_GROUP_INODES    + 4)
+#define RTEMS_RFS_SB_OFFSET_FEATURES        (RTEMS_RFS_SB_OFFSET_INODE_SIZE      + 4)
 
 /**
  * RFS Version Number.
@@ -68,6 +69,27 @@
  */
 #define RTEMS_RFS_VERSION_MASK INT32_C(0x00000000)
 
+/**
+ * RFS Feature Flags. The lower half of the features word holds the
+ * incompatible features. A volume with an incompatible feature this code does
+ * not know is not mounted. The upper half holds the compatible features that
+ * can be ignored safely.
+ */
+#define RTEMS_RFS_FEATURE_EXTENTS          (1 << 0)  /**< Block maps held as
+                                                      * extents. */
+#define RTEMS_RFS_FEATURE_DIR_INDEX        (1 << 1)  /**< Large directories
+                                                      * are indexed. */
+#define RTEMS_RFS_FEATURE_INCOMPAT_MASK    UINT32_C(0x0000ffff)
+#define RTEMS_RFS_FEATURE_SUPPORTED        (RTEMS_RFS_FEATURE_EXTENTS | \
+                                            RTEMS_RFS_FEATURE_DIR_INDEX)
+
+/**
+ * The superblock is erased to all ones before it is written so a volume
+ * formatted before the features word was added reads as all ones. Such a
+ * volume has no features.
+ */
+#define RTEMS_RFS_FEATURE_NONE             UINT32_C(0xffffffff)
+
 /**
  * The root inode number. Do not use 0 as this has special meaning in some
  * Unix operating systems.
@@ -186,6 +208,11 @@ struct _rtems_rfs_file_system
    */
   uint32_t max_name_length;
 
+  /**
+   * The features the file system was formatted with.
+   */
+  uint32_t features;
+
   /**
    * A disk is broken down into a series of groups.
    */
@@ -298,6 +325,29 @@ struct _rtems_rfs_file_system
  */
 #define rtems_rfs_fs_no_local_cache(_f) ((_f)->flags & RTEMS_RFS_FS_NO_LOCAL_CACHE)
 
+/**
+ * Return the features the file system was formatted with.
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_features(_fs) ((_fs)->features)
+
+/**
+ * Are new block maps held as extents ?
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_extents(_fs) \
+  (((_fs)->features & RTEMS_RFS_FEATURE_EXTENTS) != 0)
+
+/**
+ * Are directories indexed when they grow past a block ?
+ *
+ * @param[in] _fs is a pointer to the file system.
+ */
+#define rtems_rfs_fs_dir_index(_fs) \
+  (((_fs)->features & RTEMS_RFS_FEATURE_DIR_INDEX) != 0)
+
 /**
  * The disk device number.
  *
@@ -158,6 +158,26 @@ int rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
                                   bool                   inode,
                                   rtems_rfs_bitmap_bit*  result);
 
+/**
+ * @brief Allocate a run of blocks.
+ *
+ * The first block is allocated as rtems_rfs_group_bitmap_alloc() does. The
+ * run is extended with the free blocks that follow it in the same group until
+ * the requested count is reached or an allocated block is found.
+ *
+ * @param fs The file system data.
+ * @param goal The goal to seed the bitmap search.
+ * @param count The number of blocks wanted.
+ * @param result The first block of the run.
+ * @param allocated The number of blocks in the run. Always at least 1.
+ * @retval int The error number (errno). No error if 0.
+ */
+int rtems_rfs_group_bitmap_alloc_run (rtems_rfs_file_system* fs,
+                                      rtems_rfs_bitmap_bit   goal,
+                                      size_t                 count,
+                                      rtems_rfs_bitmap_bit*  result,
+                                      size_t*                allocated);
+
 /**
  * @brief Free the group allocated bit.
  *
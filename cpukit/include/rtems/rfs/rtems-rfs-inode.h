@@ -113,6 +113,14 @@ typedef uint32_t rtems_rfs_inode_block;
 #define RTEMS_RFS_INODE_DATA_NAME_SIZE \
   (RTEMS_RFS_INODE_BLOCKS * sizeof (rtems_rfs_inode_block))
 
+/**
+ * Inode flags. The flags indicate the mode the blocks are being held in and
+ * how a directory is searched.
+ */
+#define RTEMS_RFS_INODE_FLAG_EXTENTS   (1 << 0) /**< The blocks hold extents. */
+#define RTEMS_RFS_INODE_FLAG_DIR_INDEX (1 << 1) /**< The directory is
+                                                 * indexed. */
+
 /**
  * The inode.
  */
@@ -134,7 +142,8 @@ typedef struct _rtems_rfs_inode
   uint32_t owner;
 
   /**
-   * Reserved.
+   * The flags. See RTEMS_RFS_INODE_FLAG_EXTENTS and
+   * RTEMS_RFS_INODE_FLAG_DIR_INDEX.
    */
   uint16_t flags;
 
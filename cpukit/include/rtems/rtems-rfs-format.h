@@ -84,6 +84,16 @@ typedef struct _rtems_rfs_format_config
    */
   bool initialise_inodes;
 
+  /**
+   * Hold the block maps of new files and directories as extents.
+   */
+  bool extents;
+
+  /**
+   * Index directories that grow past a single block.
+   */
+  bool dir_index;
+
   /**
    * Is the format verbose.
    */
@@ -297,6 +297,24 @@ typedef uint32_t rtems_attribute;
  */
 #define RTEMS_PRIORITY_CEILING 0x00000080
 
+/* Generated from spec:/rtems/attr/if/segregated-fit */
+
+/**
+ * @ingroup RTEMSAPIClassicAttr
+ *
+ * @brief This attribute constant indicates that the Classic API region
+ *   created by rtems_region_create() shall use the segregated fit allocation
+ *   strategy.
+ *
+ * @par Notes
+ * The segregated fit allocation strategy organizes the free segments of the
+ * region in size classes.  This bounds the search time of
+ * rtems_region_get_segment() independent of the count of free segments.  A
+ * size class index of about 1KiB (on 32-bit targets) is placed at the begin
+ * of the region memory area.
+ */
+#define RTEMS_SEGREGATED_FIT 0x00000400
+
 /* Generated from spec:/rtems/attr/if/semaphore-class */
 
 /**
@@ -276,6 +276,20 @@ static inline bool _Attributes_Is_system_task(
    return ( attribute_set & RTEMS_SYSTEM_TASK ) ? true : false;
 }
 
+/**
+ *  @brief Checks if the segregated fit attribute
+ *  is enabled in the attribute_set.
+ *
+ *  This function returns TRUE if the segregated fit attribute
+ *  is enabled in the attribute_set and FALSE otherwise.
+ */
+static inline bool _Attributes_Is_segregated_fit(
+  rtems_attribute attribute_set
+)
+{
+   return ( attribute_set & RTEMS_SEGREGATED_FIT ) ? true : false;
+}
+
 /**@}*/
 
 #ifdef __cplusplus
@@ -899,7 +899,7 @@ rtems_interval rtems_clock_get_ticks_per_second( void );
 rtems_interval rtems_clock_get_ticks_since_boot( void );
 
 /* Generated from spec:/rtems/clock/if/get-ticks-since-boot-macro */
-#define rtems_clock_get_ticks_since_boot() _Watchdog_Ticks_since_boot
+#define rtems_clock_get_ticks_since_boot() _Watchdog_Get_ticks_since_boot()
 
 /* Generated from spec:/rtems/clock/if/get-uptime */
 
@@ -1034,7 +1034,7 @@ uint64_t rtems_clock_get_uptime_nanoseconds( void );
  */
 static inline rtems_interval rtems_clock_tick_later( rtems_interval delta )
 {
-  return _Watchdog_Ticks_since_boot + delta;
+  return _Watchdog_Get_ticks_since_boot() + delta;
 }
 
 /* Generated from spec:/rtems/clock/if/tick-later-usec */
@@ -1073,7 +1073,7 @@ static inline rtems_interval rtems_clock_tick_later_usec(
    * Add one additional tick, since we do not know the time to the clock
    * next tick.
    */
-  return _Watchdog_Ticks_since_boot + 1
+  return _Watchdog_Get_ticks_since_boot() + 1
     + ( delta_in_usec + us_per_tick - 1 ) / us_per_tick;
 }
 
@@ -1124,7 +1124,7 @@ static inline rtems_interval rtems_clock_tick_later_usec(
  */
 static inline bool rtems_clock_tick_before( rtems_interval ticks )
 {
-  return (int32_t) ( ticks - _Watchdog_Ticks_since_boot ) > 0;
+  return (int32_t) ( ticks - _Watchdog_Get_ticks_since_boot() ) > 0;
 }
 
 /* Generated from spec:/rtems/clock/if/tick */
@@ -39,6 +39,7 @@
 #define _RTEMS_RTEMS_EVENTDATA_H
 
 #include <rtems/rtems/event.h>
+#include <rtems/score/waitset.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -58,6 +59,14 @@ typedef struct {
    * @brief The member contains the pending events.
    */
   rtems_event_set pending_events;
+
+  /**
+   * @brief This member references the wait set member which is notified when
+   *   events of the event set of the member are sent.
+   *
+   * It is NULL, if the events are not a member of a wait set.
+   */
+  Wait_set_Member *wait_set_member;
 } Event_Control;
 
 /** @} */
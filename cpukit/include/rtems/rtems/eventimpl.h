@@ -126,6 +126,7 @@ rtems_status_code _Event_Surrender(
 static inline void _Event_Initialize( Event_Control *event )
 {
   event->pending_events = 0;
+  event->wait_set_member = NULL;
 }
 
 /**
@@ -895,6 +895,529 @@ rtems_status_code rtems_message_queue_get_number_pending(
  */
 rtems_status_code rtems_message_queue_flush( rtems_id id, uint32_t *count );
 
+/* Generated from spec:/rtems/message/if/obtain-buffer */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Obtains a free message buffer from the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[out] buffer is the pointer to a ``void`` pointer object.  When the
+ *   directive call is successful, the begin address of the obtained message
+ *   buffer will be stored in this object.
+ *
+ * This directive obtains a free message buffer from the message buffer pool of
+ * the queue specified by ``id``.  The message buffer can hold a message of the
+ * maximum message size of the queue.  The calling task may fill in the message
+ * in place and submit it with rtems_message_queue_send_buffer() or
+ * rtems_message_queue_urgent_buffer().  This avoids the copy of the message
+ * into a message buffer of the queue done by rtems_message_queue_send().  An
+ * obtained message buffer which is not submitted shall be returned by
+ * rtems_message_queue_release_buffer().
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_TOO_MANY There was no free message buffer available.
+ *
+ * @par Notes
+ * The message buffers of the queue are shared by the pending messages, the
+ * obtained message buffers, and the borrowed message buffers.  Each obtained
+ * or borrowed message buffer reduces the number of messages which can be
+ * pending on the queue.  The message buffers are part of the queue, so they
+ * shall not be used after the queue was deleted.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_obtain_buffer(
+  rtems_id id,
+  void   **buffer
+);
+
+/* Generated from spec:/rtems/message/if/send-buffer */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Puts the message contained in an obtained message buffer at the rear
+ *   of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the message buffer obtained by
+ *   rtems_message_queue_obtain_buffer() or borrowed by
+ *   rtems_message_queue_receive_buffer() from the queue.
+ *
+ * @param size is the size in bytes of the message to send.
+ *
+ * This directive sends the message of ``size`` bytes in length contained in
+ * the message ``buffer`` to the queue specified by ``id``.  If a task is
+ * waiting at the queue to borrow a message buffer, then the message buffer is
+ * handed over to the task and the task is unblocked.  If a task is waiting at
+ * the queue to receive a copy of the message, then the message is copied to
+ * the waiting task's buffer, the message buffer is freed, and the task is
+ * unblocked.  If no tasks are waiting at the queue, then the message buffer is
+ * placed at the rear of the queue without a copy of the message.  When the
+ * directive call is successful, the message buffer shall no longer be used by
+ * the calling task.  A borrowed message buffer may be submitted to forward the
+ * message without a copy.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was not the begin
+ *   address of a message buffer obtained or borrowed from the queue.
+ *
+ * @retval ::RTEMS_INVALID_SIZE The size of the message exceeded the maximum
+ *   message size of the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct().  The message buffer is still obtained by
+ *   the calling task.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may unblock a task.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_send_buffer(
+  rtems_id id,
+  void    *buffer,
+  size_t   size
+);
+
+/* Generated from spec:/rtems/message/if/urgent-buffer */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Puts the message contained in an obtained message buffer at the
+ *   front of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the message buffer obtained by
+ *   rtems_message_queue_obtain_buffer() or borrowed by
+ *   rtems_message_queue_receive_buffer() from the queue.
+ *
+ * @param size is the size in bytes of the message to send urgently.
+ *
+ * This directive sends the message of ``size`` bytes in length contained in
+ * the message ``buffer`` to the queue specified by ``id``.  Waiting tasks are
+ * handled like by rtems_message_queue_send_buffer().  If no tasks are waiting
+ * at the queue, then the message buffer is placed at the front of the queue
+ * without a copy of the message.  When the directive call is successful, the
+ * message buffer shall no longer be used by the calling task.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was not the begin
+ *   address of a message buffer obtained or borrowed from the queue.
+ *
+ * @retval ::RTEMS_INVALID_SIZE The size of the message exceeded the maximum
+ *   message size of the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct().  The message buffer is still obtained by
+ *   the calling task.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may unblock a task.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_urgent_buffer(
+  rtems_id id,
+  void    *buffer,
+  size_t   size
+);
+
+/* Generated from spec:/rtems/message/if/receive-buffer */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Borrows the message buffer of a message from the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param[out] buffer is the pointer to a ``void`` pointer object.  When the
+ *   directive call is successful, the begin address of the borrowed message
+ *   buffer will be stored in this object.
+ *
+ * @param[out] size is the pointer to a size_t object.  When the directive call
+ *   is successful, the size in bytes of the received message will be stored
+ *   in this object.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * This directive receives a message from the queue specified by ``id`` like
+ * rtems_message_queue_receive().  In contrast to rtems_message_queue_receive(),
+ * the message is not copied to a buffer of the calling task.  Instead, the
+ * message buffer containing the message is lent to the calling task.  The
+ * borrowed message buffer shall be returned by
+ * rtems_message_queue_release_buffer() after use.
+ *
+ * The #RTEMS_WAIT and #RTEMS_NO_WAIT options and the ``timeout`` parameter
+ * have the same meaning as for rtems_message_queue_receive().  If the calling
+ * task waits at the queue and a task sends a message with
+ * rtems_message_queue_send() or rtems_message_queue_urgent(), then the
+ * message is copied to a free message buffer of the queue.  If no free message
+ * buffer is available in this case, then the calling task continues to wait
+ * and the sender gets the ::RTEMS_TOO_MANY status.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``size`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_UNSATISFIED The queue was empty.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting to receive a message
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
+ *   task was waiting to receive a message.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * When the #RTEMS_NO_WAIT option is set, the directive may be called from
+ *   within interrupt context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * When the request cannot be immediately satisfied and the #RTEMS_WAIT
+ *   option is set, the calling task blocks at some point during the directive
+ *   call.
+ *
+ * * The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_receive_buffer(
+  rtems_id       id,
+  void         **buffer,
+  size_t        *size,
+  rtems_option   option_set,
+  rtems_interval timeout
+);
+
+/* Generated from spec:/rtems/message/if/release-buffer */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Returns an obtained or borrowed message buffer to the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the message buffer obtained by
+ *   rtems_message_queue_obtain_buffer() or borrowed by
+ *   rtems_message_queue_receive_buffer() from the queue.
+ *
+ * This directive returns the message buffer to the message buffer pool of the
+ * queue specified by ``id``.  When the directive call is successful, the
+ * message buffer shall no longer be used by the calling task.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was not the begin
+ *   address of a message buffer obtained or borrowed from the queue.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_release_buffer(
+  rtems_id id,
+  void    *buffer
+);
+
+/* Generated from spec:/rtems/message/if/send-many */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Puts a batch of messages at the rear of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the first message to send.  Message
+ *   ``i`` begins at ``buffer`` plus ``i`` times the maximum message size of
+ *   the queue.
+ *
+ * @param sizes is the begin address of an array with ``count`` elements.
+ *   Element ``i`` is the size in bytes of message ``i``.
+ *
+ * @param count is the count of messages to send.
+ *
+ * @param[out] sent is the pointer to an uint32_t object.  The count of sent
+ *   messages will be stored in this object.
+ *
+ * This directive sends the messages like ``count`` calls to
+ * rtems_message_queue_send() in array order.  In contrast to individual
+ * calls, the queue is locked once for all messages which are put at the rear
+ * of the queue, and tasks waiting to receive a message are unblocked in one
+ * pass.  The directive stops at the first message for which no free message
+ * buffer is available.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``sizes`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``sent`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``count`` parameter was zero.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue was a global queue which
+ *   may have tasks of remote nodes waiting to receive a message.
+ *
+ * @retval ::RTEMS_INVALID_SIZE The size of a message exceeded the maximum
+ *   message size of the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct().  No message was sent.
+ *
+ * @retval ::RTEMS_TOO_MANY The maximum number of pending messages was
+ *   reached.  Only the count of messages stored in ``sent`` was sent.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may unblock tasks.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_send_many(
+  rtems_id      id,
+  const void   *buffer,
+  const size_t *sizes,
+  uint32_t      count,
+  uint32_t     *sent
+);
+
+/* Generated from spec:/rtems/message/if/urgent-many */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Puts a batch of messages at the front of the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of the first message to send.  Message
+ *   ``i`` begins at ``buffer`` plus ``i`` times the maximum message size of
+ *   the queue.
+ *
+ * @param sizes is the begin address of an array with ``count`` elements.
+ *   Element ``i`` is the size in bytes of message ``i``.
+ *
+ * @param count is the count of messages to send.
+ *
+ * @param[out] sent is the pointer to an uint32_t object.  The count of sent
+ *   messages will be stored in this object.
+ *
+ * This directive sends the messages like ``count`` calls to
+ * rtems_message_queue_urgent() in array order.  So, the last message of the
+ * batch ends up at the front of the queue.  Otherwise, the directive behaves
+ * like rtems_message_queue_send_many().
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``sizes`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``sent`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``count`` parameter was zero.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue was a global queue which
+ *   may have tasks of remote nodes waiting to receive a message.
+ *
+ * @retval ::RTEMS_INVALID_SIZE The size of a message exceeded the maximum
+ *   message size of the queue as defined by rtems_message_queue_create() or
+ *   rtems_message_queue_construct().  No message was sent.
+ *
+ * @retval ::RTEMS_TOO_MANY The maximum number of pending messages was
+ *   reached.  Only the count of messages stored in ``sent`` was sent.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may be called from within interrupt context.
+ *
+ * * The directive may unblock tasks.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_urgent_many(
+  rtems_id      id,
+  const void   *buffer,
+  const size_t *sizes,
+  uint32_t      count,
+  uint32_t     *sent
+);
+
+/* Generated from spec:/rtems/message/if/receive-many */
+
+/**
+ * @ingroup RTEMSAPIClassicMessage
+ *
+ * @brief Receives a batch of messages from the queue.
+ *
+ * @param id is the queue identifier.
+ *
+ * @param buffer is the begin address of a buffer for ``count`` messages.
+ *   Message ``i`` will be stored at ``buffer`` plus ``i`` times the maximum
+ *   message size of the queue.  The buffer size in bytes shall be at least
+ *   ``count`` times the maximum message size of the queue.
+ *
+ * @param[out] sizes is the begin address of an array with ``count`` elements.
+ *   When the directive call is successful, element ``i`` will be set to the
+ *   size in bytes of received message ``i``.
+ *
+ * @param count is the maximum count of messages to receive.
+ *
+ * @param[out] received is the pointer to an uint32_t object.  When the
+ *   directive call is successful, the count of received messages will be
+ *   stored in this object.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * This directive receives up to ``count`` pending messages from the queue
+ * specified by ``id`` while the queue is locked once.  If no message is
+ * pending, then the directive behaves like rtems_message_queue_receive() and
+ * exactly one message is received when the directive call is successful.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``buffer`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``sizes`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``received`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``count`` parameter was zero.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no queue associated with the identifier
+ *   specified by ``id``.
+ *
+ * @retval ::RTEMS_ILLEGAL_ON_REMOTE_OBJECT The queue resided on a remote node.
+ *
+ * @retval ::RTEMS_UNSATISFIED The queue was empty.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting to receive a message
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The queue was deleted while the calling
+ *   task was waiting to receive a message.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * When the #RTEMS_NO_WAIT option is set, the directive may be called from
+ *   within interrupt context.
+ *
+ * * The directive may be called from within task context.
+ *
+ * * When the request cannot be immediately satisfied and the #RTEMS_WAIT
+ *   option is set, the calling task blocks at some point during the directive
+ *   call.
+ *
+ * * The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_message_queue_receive_many(
+  rtems_id       id,
+  void          *buffer,
+  size_t        *sizes,
+  uint32_t       count,
+  uint32_t      *received,
+  rtems_option   option_set,
+  rtems_interval timeout
+);
+
 /* Generated from spec:/rtems/message/if/buffer */
 
 /**
@@ -90,6 +90,62 @@ rtems_status_code _Message_queue_Submit(
   Message_queue_Submit_types  submit_type
 );
 
+/**
+ * @brief Submits the message contained in an obtained message buffer to the
+ *   message queue.
+ *
+ * This function implements the directives rtems_message_queue_send_buffer()
+ * and rtems_message_queue_urgent_buffer().
+ *
+ * @param id is the message queue identifier.
+ *
+ * @param buffer is the begin address of the obtained message buffer.
+ *
+ * @param size is the size of the message.
+ *
+ * @param submit_type determines whether the message is appended or
+ *   prepended.
+ *
+ * @return Returns the directive status code.
+ */
+rtems_status_code _Message_queue_Submit_buffer(
+  rtems_id                         id,
+  void                            *buffer,
+  size_t                           size,
+  CORE_message_queue_Submit_types  submit_type
+);
+
+/**
+ * @brief Submits a batch of messages to the message queue.
+ *
+ * This function implements the directives rtems_message_queue_send_many()
+ * and rtems_message_queue_urgent_many().
+ *
+ * @param id is the message queue identifier.
+ *
+ * @param buffer is the begin address of the first message.
+ *
+ * @param sizes is the begin address of the message size array.
+ *
+ * @param count is the count of messages to submit.
+ *
+ * @param[out] submitted is the pointer to an uint32_t object.  The count of
+ *   submitted messages is stored in this object.
+ *
+ * @param submit_type determines whether the messages are appended or
+ *   prepended.
+ *
+ * @return Returns the directive status code.
+ */
+rtems_status_code _Message_queue_Submit_many(
+  rtems_id                         id,
+  const void                      *buffer,
+  const size_t                    *sizes,
+  uint32_t                         count,
+  uint32_t                        *submitted,
+  CORE_message_queue_Submit_types  submit_type
+);
+
 /**
  *  @brief Deallocates a message queue control block into
  *  the inactive chain of free message queue control blocks.
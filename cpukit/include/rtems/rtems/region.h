@@ -185,6 +185,11 @@ rtems_status_code rtems_region_get_segment_size(
  *
  * * The **priority discipline** is selected by the #RTEMS_PRIORITY attribute.
  *
+ * The **allocation strategy** is selected by the #RTEMS_SEGREGATED_FIT
+ * attribute.  By default, the region uses a first fit allocation strategy.
+ * With the #RTEMS_SEGREGATED_FIT attribute, the free segments are organized in
+ * size classes and the search time for a segment is bounded.
+ *
  * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
  *
  * @retval ::RTEMS_INVALID_NAME The ``name`` parameter was invalid.
@@ -39,10 +39,12 @@
 #define _RTEMS_RTEMS_SEMDATA_H
 
 #include <rtems/rtems/sem.h>
+#include <rtems/score/atomic.h>
 #include <rtems/score/coremutex.h>
 #include <rtems/score/coresem.h>
 #include <rtems/score/mrsp.h>
 #include <rtems/score/object.h>
+#include <rtems/score/waitset.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -96,10 +98,52 @@ typedef struct {
      */
     CORE_semaphore_Control Semaphore;
 
+    /**
+     * @brief This member provides the fast path state of the semaphore
+     *   variants which support the fast path.
+     *
+     * The fast path is supported by the simple binary semaphores, the
+     * counting semaphores, and the mutexes without a priority ceiling.  For
+     * these variants, the state is placed after the count or nest level and
+     * does not overlap with the members used by the variant.
+     */
+    struct {
+      /**
+       * @brief This member overlaps with the thread queue of the variant.
+       */
+      Thread_queue_Control Wait_queue;
+
+      /**
+       * @brief This member overlaps with the count or the nest level of the
+       *   variant.
+       */
+      uint32_t count_or_nest_level;
+
+      /**
+       * @brief This member contains the fast path state.
+       *
+       * If the state is SEMAPHORE_FAST_PATH_FROZEN, then the fast path is
+       * disabled and the state of the variant is maintained by the thread
+       * queue lock protected members.  Otherwise, for mutexes the state is
+       * the owner of the mutex and for semaphores the state is the count
+       * shifted left by one.
+       */
+      Atomic_Uintptr state;
+    } Fast_path;
+
 #if defined(RTEMS_SMP)
     MRSP_Control MRSP;
 #endif
   } Core_control;
+
+  /**
+   * @brief This member references the wait set member which is notified when
+   *   the semaphore is released.
+   *
+   * It is NULL, if the semaphore is not a member of a wait set.  Only simple
+   * binary and counting semaphores may be members of a wait set.
+   */
+  Wait_set_Member *wait_set_member;
 }   Semaphore_Control;
 
 /**
@@ -41,6 +41,7 @@
 #include <rtems/score/coremuteximpl.h>
 #include <rtems/score/coresemimpl.h>
 #include <rtems/score/mrspimpl.h>
+#include <rtems/score/waitsetimpl.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -156,6 +157,429 @@ static inline const Thread_queue_Operations *_Semaphore_Get_operations(
   return &_Thread_queue_Operations_FIFO;
 }
 
+/**
+ * @brief If the fast path state of a semaphore has this value, then the fast
+ *   path is frozen.
+ *
+ * The owner of a mutex is a thread control block, so the least significant
+ * bit of the mutex fast path state is zero.  The count of a semaphore is
+ * shifted left by one, so the least significant bit of the semaphore fast
+ * path state is zero.
+ */
+#define SEMAPHORE_FAST_PATH_FROZEN ( (uintptr_t) 1 )
+
+/**
+ * @brief This constant defines the maximum count of a semaphore which can be
+ *   represented by the fast path state.
+ */
+#define SEMAPHORE_FAST_PATH_COUNT_MAXIMUM ( UINTPTR_MAX >> 1 )
+
+/**
+ * @brief Checks if the semaphore variant supports the fast path.
+ *
+ * @param variant is the semaphore variant.
+ *
+ * @return Returns true, if the semaphore variant supports the fast path,
+ *   otherwise false.
+ */
+static inline bool _Semaphore_Has_fast_path( Semaphore_Variant variant )
+{
+  return variant == SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY
+    || variant == SEMAPHORE_VARIANT_MUTEX_NO_PROTOCOL
+    || variant == SEMAPHORE_VARIANT_SIMPLE_BINARY
+    || variant == SEMAPHORE_VARIANT_COUNTING;
+}
+
+/**
+ * @brief Checks if the semaphore variant is a mutex which supports the fast
+ *   path.
+ *
+ * @param variant is the semaphore variant.
+ *
+ * @return Returns true, if the semaphore variant is a mutex which supports
+ *   the fast path, otherwise false.
+ */
+static inline bool _Semaphore_Is_fast_path_mutex( Semaphore_Variant variant )
+{
+  return variant == SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY
+    || variant == SEMAPHORE_VARIANT_MUTEX_NO_PROTOCOL;
+}
+
+/**
+ * @brief Freezes the fast path of the semaphore.
+ *
+ * After this call, the state of the semaphore is maintained by the thread
+ * queue lock protected members, for example the owner of the mutex or the
+ * count of the semaphore.  The fast path operations fail until the fast path
+ * is thawed.
+ *
+ * The thread queue lock of the semaphore shall be owned by the caller.
+ *
+ * @param[in, out] the_semaphore is the semaphore.
+ *
+ * @param variant is the semaphore variant.
+ */
+static inline void _Semaphore_Fast_path_freeze(
+  Semaphore_Control *the_semaphore,
+  Semaphore_Variant  variant
+)
+{
+  Atomic_Uintptr *state_obj;
+  uintptr_t       state;
+
+  if ( !_Semaphore_Has_fast_path( variant ) ) {
+    return;
+  }
+
+  state_obj = &the_semaphore->Core_control.Fast_path.state;
+  state = _Atomic_Load_uintptr( state_obj, ATOMIC_ORDER_RELAXED );
+
+  do {
+    if ( state == SEMAPHORE_FAST_PATH_FROZEN ) {
+      return;
+    }
+  } while (
+    !_Atomic_Compare_exchange_uintptr(
+      state_obj,
+      &state,
+      SEMAPHORE_FAST_PATH_FROZEN,
+      ATOMIC_ORDER_ACQUIRE,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+
+  if ( _Semaphore_Is_fast_path_mutex( variant ) ) {
+    _CORE_mutex_Set_owner(
+      &the_semaphore->Core_control.Mutex.Recursive.Mutex,
+      (Thread_Control *) state
+    );
+  } else {
+    the_semaphore->Core_control.Semaphore.count = (uint32_t) ( state >> 1 );
+  }
+}
+
+/**
+ * @brief Thaws the fast path of the semaphore if no thread waits for the
+ *   semaphore.
+ *
+ * The thread queue lock of the semaphore shall be owned by the caller.
+ *
+ * @param[in, out] the_semaphore is the semaphore.
+ *
+ * @param variant is the semaphore variant.
+ */
+static inline void _Semaphore_Fast_path_thaw(
+  Semaphore_Control *the_semaphore,
+  Semaphore_Variant  variant
+)
+{
+  uintptr_t state;
+
+  if (
+    !_Semaphore_Has_fast_path( variant )
+      || the_semaphore->Core_control.Wait_queue.Queue.heads != NULL
+  ) {
+    return;
+  }
+
+  if ( _Semaphore_Is_fast_path_mutex( variant ) ) {
+    state = (uintptr_t) _CORE_mutex_Get_owner(
+      &the_semaphore->Core_control.Mutex.Recursive.Mutex
+    );
+  } else {
+    uint32_t count;
+
+    count = the_semaphore->Core_control.Semaphore.count;
+
+    if ( count <= SEMAPHORE_FAST_PATH_COUNT_MAXIMUM ) {
+      state = (uintptr_t) count << 1;
+    } else {
+      state = SEMAPHORE_FAST_PATH_FROZEN;
+    }
+  }
+
+  _Atomic_Store_uintptr(
+    &the_semaphore->Core_control.Fast_path.state,
+    state,
+    ATOMIC_ORDER_RELEASE
+  );
+}
+
+/**
+ * @brief Gets the owner of the mutex variant of the semaphore.
+ *
+ * If the thread queue lock of the semaphore is not owned by the caller, then
+ * the result is only a snapshot.
+ *
+ * @param the_semaphore is the semaphore.
+ *
+ * @param variant is the semaphore variant.
+ *
+ * @return Returns the owner of the mutex.
+ */
+static inline Thread_Control *_Semaphore_Get_mutex_owner(
+  const Semaphore_Control *the_semaphore,
+  Semaphore_Variant        variant
+)
+{
+  if ( _Semaphore_Is_fast_path_mutex( variant ) ) {
+    uintptr_t state;
+
+    state = _Atomic_Load_uintptr(
+      RTEMS_DECONST(
+        Atomic_Uintptr *,
+        &the_semaphore->Core_control.Fast_path.state
+      ),
+      ATOMIC_ORDER_RELAXED
+    );
+
+    if ( state != SEMAPHORE_FAST_PATH_FROZEN ) {
+      return (Thread_Control *) state;
+    }
+  }
+
+  return _CORE_mutex_Get_owner(
+    &the_semaphore->Core_control.Mutex.Recursive.Mutex
+  );
+}
+
+/**
+ * @brief Gets the count of the simple binary or counting semaphore variant of
+ *   the semaphore.
+ *
+ * If the thread queue lock of the semaphore is not owned by the caller, then
+ * the result is only a snapshot.
+ *
+ * @param the_semaphore is the semaphore.
+ *
+ * @return Returns the count of the semaphore.
+ */
+static inline uint32_t _Semaphore_Get_count(
+  const Semaphore_Control *the_semaphore
+)
+{
+  uintptr_t state;
+
+  state = _Atomic_Load_uintptr(
+    RTEMS_DECONST(
+      Atomic_Uintptr *,
+      &the_semaphore->Core_control.Fast_path.state
+    ),
+    ATOMIC_ORDER_RELAXED
+  );
+
+  if ( state != SEMAPHORE_FAST_PATH_FROZEN ) {
+    return (uint32_t) ( state >> 1 );
+  }
+
+  return _CORE_semaphore_Get_count( &the_semaphore->Core_control.Semaphore );
+}
+
+/**
+ * @brief Obtains the wait set member of the semaphore for a notification.
+ *
+ * This function shall be called with interrupts disabled and the semaphore
+ * lock not owned by the caller.  The wait set shall be notified through
+ * _Wait_set_Member_notify() after the semaphore was released.
+ *
+ * @param[in, out] the_semaphore is the semaphore.
+ *
+ * @param[in, out] queue_context is the thread queue context.
+ *
+ * @retval NULL The semaphore is not a member of a wait set.
+ *
+ * @return Returns the obtained wait set member.
+ */
+static inline Wait_set_Member *_Semaphore_Obtain_wait_set_member(
+  Semaphore_Control    *the_semaphore,
+  Thread_queue_Context *queue_context
+)
+{
+  Wait_set_Member *member;
+
+  /*
+   * A member attached concurrently needs no notification, since the waiting
+   * threads check the readiness of a member after it was attached.
+   */
+  if ( the_semaphore->wait_set_member == NULL ) {
+    return NULL;
+  }
+
+  _Thread_queue_Acquire_critical(
+    &the_semaphore->Core_control.Wait_queue,
+    queue_context
+  );
+  member = _Wait_set_Member_obtain(
+    the_semaphore->wait_set_member,
+    &queue_context->Lock_context.Lock_context
+  );
+  _Thread_queue_Release_critical(
+    &the_semaphore->Core_control.Wait_queue,
+    queue_context
+  );
+
+  return member;
+}
+
+/**
+ * @brief Tries to obtain the semaphore using the fast path.
+ *
+ * The fast path succeeds only if the semaphore is available and the fast
+ * path is not frozen.  It does not acquire the thread queue lock.  The
+ * uncontended acquire of a priority inheritance mutex has no effect on
+ * priorities, so the priority inheritance is carried out entirely by the
+ * slow path.
+ *
+ * @param[in, out] the_semaphore is the semaphore.
+ *
+ * @param variant is the semaphore variant.
+ *
+ * @param[in, out] executing is the executing thread.
+ *
+ * @return Returns true, if the semaphore was obtained, otherwise false.
+ */
+static inline bool _Semaphore_Fast_path_obtain(
+  Semaphore_Control *the_semaphore,
+  Semaphore_Variant  variant,
+  Thread_Control    *executing
+)
+{
+  Atomic_Uintptr *state_obj;
+  uintptr_t       state;
+
+  state_obj = &the_semaphore->Core_control.Fast_path.state;
+
+  if ( _Semaphore_Is_fast_path_mutex( variant ) ) {
+    state = 0;
+
+    if (
+      !_Atomic_Compare_exchange_uintptr(
+        state_obj,
+        &state,
+        (uintptr_t) executing,
+        ATOMIC_ORDER_ACQUIRE,
+        ATOMIC_ORDER_RELAXED
+      )
+    ) {
+      return false;
+    }
+
+    _Thread_Resource_count_increment( executing );
+    return true;
+  }
+
+  if (
+    variant != SEMAPHORE_VARIANT_SIMPLE_BINARY
+      && variant != SEMAPHORE_VARIANT_COUNTING
+  ) {
+    return false;
+  }
+
+  state = _Atomic_Load_uintptr( state_obj, ATOMIC_ORDER_RELAXED );
+
+  do {
+    /* The semaphore is frozen or the count is zero */
+    if ( state <= SEMAPHORE_FAST_PATH_FROZEN ) {
+      return false;
+    }
+  } while (
+    !_Atomic_Compare_exchange_uintptr(
+      state_obj,
+      &state,
+      state - 2,
+      ATOMIC_ORDER_ACQUIRE,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+
+  return true;
+}
+
+/**
+ * @brief Tries to release the semaphore using the fast path.
+ *
+ * The fast path succeeds only if the fast path is not frozen.  Threads which
+ * wait for the semaphore freeze the fast path, so they are always dequeued by
+ * the slow path.  For a mutex, the fast path succeeds only if the executing
+ * thread is the owner and the nest level is zero.  For a semaphore, the fast
+ * path succeeds only if the maximum count is not reached.
+ *
+ * @param[in, out] the_semaphore is the semaphore.
+ *
+ * @param variant is the semaphore variant.
+ *
+ * @param[in, out] executing is the executing thread.
+ *
+ * @return Returns true, if the semaphore was released, otherwise false.
+ */
+static inline bool _Semaphore_Fast_path_release(
+  Semaphore_Control *the_semaphore,
+  Semaphore_Variant  variant,
+  Thread_Control    *executing
+)
+{
+  Atomic_Uintptr *state_obj;
+  uintptr_t       state;
+  uintptr_t       maximum_count;
+
+  state_obj = &the_semaphore->Core_control.Fast_path.state;
+
+  if ( _Semaphore_Is_fast_path_mutex( variant ) ) {
+    state = _Atomic_Load_uintptr( state_obj, ATOMIC_ORDER_RELAXED );
+
+    /* Only the owner changes the nest level */
+    if (
+      state != (uintptr_t) executing
+        || the_semaphore->Core_control.Mutex.Recursive.nest_level != 0
+        || !_Atomic_Compare_exchange_uintptr(
+          state_obj,
+          &state,
+          0,
+          ATOMIC_ORDER_RELEASE,
+          ATOMIC_ORDER_RELAXED
+        )
+    ) {
+      return false;
+    }
+
+    _Thread_Resource_count_decrement( executing );
+    return true;
+  }
+
+  if ( variant == SEMAPHORE_VARIANT_SIMPLE_BINARY ) {
+    maximum_count = 1;
+  } else if ( variant == SEMAPHORE_VARIANT_COUNTING ) {
+    maximum_count = UINT32_MAX;
+
+    if ( maximum_count > SEMAPHORE_FAST_PATH_COUNT_MAXIMUM ) {
+      maximum_count = SEMAPHORE_FAST_PATH_COUNT_MAXIMUM;
+    }
+  } else {
+    return false;
+  }
+
+  state = _Atomic_Load_uintptr( state_obj, ATOMIC_ORDER_RELAXED );
+
+  do {
+    if (
+      state == SEMAPHORE_FAST_PATH_FROZEN
+        || ( state >> 1 ) >= maximum_count
+    ) {
+      return false;
+    }
+  } while (
+    !_Atomic_Compare_exchange_uintptr(
+      state_obj,
+      &state,
+      state + 2,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+
+  return true;
+}
+
 /**
  *  @brief Allocates a semaphore control block from
  *  the inactive chain of free semaphore control blocks.
@@ -163,7 +163,7 @@ static inline Watchdog_Interval _Timer_Get_CPU_ticks(
   const Per_CPU_Control *cpu
 )
 {
-  return (Watchdog_Interval) cpu->Watchdog.ticks;
+  return (Watchdog_Interval) _Watchdog_Per_CPU_get_ticks( cpu );
 }
 
 rtems_status_code _Timer_Fire(
@@ -0,0 +1,428 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplClassicWaitSet
+ *
+ * @brief This header file defines the Wait Set Manager API.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/* Generated from spec:/rtems/wait-set/if/header */
+
+#ifndef _RTEMS_RTEMS_WAITSET_H
+#define _RTEMS_RTEMS_WAITSET_H
+
+#include <stdint.h>
+#include <rtems/rtems/event.h>
+#include <rtems/rtems/options.h>
+#include <rtems/rtems/status.h>
+#include <rtems/rtems/types.h>
+#include <rtems/score/waitset.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Generated from spec:/rtems/wait-set/if/group */
+
+/**
+ * @defgroup RTEMSAPIClassicWaitSet Wait Set Manager
+ *
+ * @ingroup RTEMSAPIClassic
+ *
+ * @brief The Wait Set Manager provides a facility to wait for one of several
+ *   semaphores, message queues, and events at once.
+ *
+ * A wait set has members.  Each member refers to one object.  A task waiting
+ * on the wait set is unblocked when one of the objects becomes ready.  The
+ * directive returns the index of the ready member.  It does not obtain the
+ * semaphore or receive the message or events.  The task shall do this with a
+ * directive using the #RTEMS_NO_WAIT option.  If this directive returns
+ * ::RTEMS_UNSATISFIED, then another task was faster and the task should wait
+ * on the wait set again.
+ *
+ * The wait set storage is provided by the application.  The directives which
+ * add members to and remove members from a wait set shall not be called while
+ * a task waits on the wait set.  The wait set storage shall not be reused
+ * before the wait set is destroyed.
+ */
+
+/* Generated from spec:/rtems/wait-set/if/maximum-members */
+
+/**
+ * @ingroup RTEMSAPIClassicWaitSet
+ *
+ * @brief This constant defines the maximum count of members of a wait set.
+ */
+#define RTEMS_WAIT_SET_MAXIMUM_MEMBERS WAIT_SET_MAXIMUM_MEMBERS
+
+/* Generated from spec:/rtems/wait-set/if/wait-set */
+
+/**
+ * @ingroup RTEMSAPIClassicWaitSet
+ *
+ * @brief This type represents a wait set.
+ */
+typedef Wait_set_Control rtems_wait_set;
+
+/* Generated from spec:/rtems/wait-set/if/initialize */
+
+/**
+ * @ingroup RTEMSAPIClassicWaitSet
+ *
+ * @brief Initializes the wait set.
+ *
+ * @param[out] wait_set is the wait set to initialize.
+ *
+ * The wait set has no members after initialization.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+void rtems_wait_set_initialize( rtems_wait_set *wait_set );
+
+/* Generated from spec:/rtems/wait-set/if/destroy */
+
+/**
+ * @ingroup RTEMSAPIClassicWaitSet
+ *
+ * @brief Destroys the wait set.
+ *
+ * @param[in, out] wait_set is the wait set to destroy.
+ *
+ * All members of the wait set are removed.  Tasks waiting on the wait set
+ * are unblocked and get the ::RTEMS_OBJECT_WAS_DELETED status.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive may unblock tasks.  This may cause the calling task to be
+ *   preempted.
+ * @endparblock
+ */
+void rtems_wait_set_destroy( rtems_wait_set *wait_set );
+
+/* Generated from spec:/rtems/wait-set/if/add-semaphore */
+
+/**
+ * @ingroup RTEMSAPIClassicWaitSet
+ *
+ * @brief Adds a semaphore to the wait set.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param index is the member index.
+ *
+ * @param id is the semaphore identifier.
+ *
+ * The member is ready while the count of the semaphore is greater than zero.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``index`` parameter was greater than or
+ *   equal to #RTEMS_WAIT_SET_MAXIMUM_MEMBERS.
+ *
+ * @retval ::RTEMS_RESOURCE_IN_USE The member specified by ``index`` was
+ *   already in use.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no local semaphore associated with the
+ *   identifier specified by ``id``.
+ *
+ * @retval ::RTEMS_NOT_DEFINED The semaphore was not a simple binary or
+ *   counting semaphore.
+ *
+ * @retval ::RTEMS_RESOURCE_IN_USE The semaphore was already a member of a wait
+ *   set.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_wait_set_add_semaphore(
+  rtems_wait_set *wait_set,
+  uint32_t        index,
+  rtems_id        id
+);
+
+/* Generated from spec:/rtems/wait-set/if/add-message-queue */
+
+/**
+ * @ingroup RTEMSAPIClassicWaitSet
+ *
+ * @brief Adds a message queue to the wait set.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param index is the member index.
+ *
+ * @param id is the message queue identifier.
+ *
+ * The member is ready while messages are pending on the message queue.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``index`` parameter was greater than or
+ *   equal to #RTEMS_WAIT_SET_MAXIMUM_MEMBERS.
+ *
+ * @retval ::RTEMS_RESOURCE_IN_USE The member specified by ``index`` was
+ *   already in use.
+ *
+ * @retval ::RTEMS_INVALID_ID There was no local message queue associated with
+ *   the identifier specified by ``id``.
+ *
+ * @retval ::RTEMS_RESOURCE_IN_USE The message queue was already a member of a
+ *   wait set.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_wait_set_add_message_queue(
+  rtems_wait_set *wait_set,
+  uint32_t        index,
+  rtems_id        id
+);
+
+/* Generated from spec:/rtems/wait-set/if/add-posix-message-queue */
+
+/**
+ * @ingroup RTEMSAPIClassicWaitSet
+ *
+ * @brief Adds a POSIX message queue to the wait set.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param index is the member index.
+ *
+ * @param mqdes is the POSIX message queue descriptor returned by mq_open().
+ *
+ * The member is ready while messages are pending on the message queue or the
+ * message queue descriptor is closed.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``index`` parameter was greater than or
+ *   equal to #RTEMS_WAIT_SET_MAXIMUM_MEMBERS.
+ *
+ * @retval ::RTEMS_RESOURCE_IN_USE The member specified by ``index`` was
+ *   already in use.
+ *
+ * @retval ::RTEMS_INVALID_ID The ``mqdes`` parameter was not a valid message
+ *   queue descriptor.
+ *
+ * @retval ::RTEMS_RESOURCE_IN_USE The message queue was already a member of a
+ *   wait set.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_wait_set_add_posix_message_queue(
+  rtems_wait_set *wait_set,
+  uint32_t        index,
+  rtems_id        mqdes
+);
+
+/* Generated from spec:/rtems/wait-set/if/add-events */
+
+/**
+ * @ingroup RTEMSAPIClassicWaitSet
+ *
+ * @brief Adds events of the calling task to the wait set.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param index is the member index.
+ *
+ * @param event_in is the event set of interest.
+ *
+ * The member is ready while at least one event of the event set specified by
+ * ``event_in`` is pending for the calling task.  The events are received by
+ * rtems_event_receive().
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``index`` parameter was greater than or
+ *   equal to #RTEMS_WAIT_SET_MAXIMUM_MEMBERS.
+ *
+ * @retval ::RTEMS_RESOURCE_IN_USE The member specified by ``index`` was
+ *   already in use.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``event_in`` parameter was the empty
+ *   event set.
+ *
+ * @retval ::RTEMS_RESOURCE_IN_USE The events of the calling task were already
+ *   a member of a wait set.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_wait_set_add_events(
+  rtems_wait_set  *wait_set,
+  uint32_t         index,
+  rtems_event_set  event_in
+);
+
+/* Generated from spec:/rtems/wait-set/if/remove */
+
+/**
+ * @ingroup RTEMSAPIClassicWaitSet
+ *
+ * @brief Removes a member from the wait set.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param index is the member index.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_NUMBER The ``index`` parameter was greater than or
+ *   equal to #RTEMS_WAIT_SET_MAXIMUM_MEMBERS.
+ *
+ * @retval ::RTEMS_INCORRECT_STATE The member specified by ``index`` was not
+ *   in use.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * The directive will not cause the calling task to be preempted.
+ * @endparblock
+ */
+rtems_status_code rtems_wait_set_remove(
+  rtems_wait_set *wait_set,
+  uint32_t        index
+);
+
+/* Generated from spec:/rtems/wait-set/if/wait */
+
+/**
+ * @ingroup RTEMSAPIClassicWaitSet
+ *
+ * @brief Waits until a member of the wait set is ready.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param option_set is the option set.
+ *
+ * @param timeout is the timeout in clock ticks if the #RTEMS_WAIT option is
+ *   set.  Use #RTEMS_NO_TIMEOUT to wait potentially forever.
+ *
+ * @param[out] index is the pointer to an uint32_t object.  When the directive
+ *   call is successful, the index of the ready member will be stored in this
+ *   object.
+ *
+ * The members are checked in a round-robin order starting with the member
+ * after the one returned by the previous call, so that a member which is
+ * always ready does not starve the other members.  A member of a deleted
+ * object is reported as ready, so that the task can observe the error.
+ *
+ * The **option set** specified in ``option_set`` is built through a *bitwise
+ * or* of the option constants described below.  Not all combinations of
+ * options are allowed.  Some options are mutually exclusive.  If mutually
+ * exclusive options are combined, the behaviour is undefined.  Options not
+ * mentioned below are not evaluated by this directive and have no effect.
+ * Default options can be selected by using the #RTEMS_DEFAULT_OPTIONS
+ * constant.
+ *
+ * The calling task can **wait** or **try to wait** for a ready member.  This
+ * is selected by the mutually exclusive #RTEMS_WAIT and #RTEMS_NO_WAIT
+ * options.  If #RTEMS_WAIT is used, then the ``timeout`` parameter is used.
+ *
+ * @retval ::RTEMS_SUCCESSFUL The requested operation was successful.
+ *
+ * @retval ::RTEMS_INVALID_ADDRESS The ``index`` parameter was NULL.
+ *
+ * @retval ::RTEMS_INCORRECT_STATE The wait set had no members.
+ *
+ * @retval ::RTEMS_UNSATISFIED No member was ready and the #RTEMS_NO_WAIT
+ *   option was set.
+ *
+ * @retval ::RTEMS_TIMEOUT The timeout happened while the calling task was
+ *   waiting.
+ *
+ * @retval ::RTEMS_OBJECT_WAS_DELETED The wait set was destroyed while the
+ *   calling task was waiting.
+ *
+ * @par Constraints
+ * @parblock
+ * The following constraints apply to this directive:
+ *
+ * * The directive may be called from within task context.
+ *
+ * * When no member is ready and the #RTEMS_WAIT option is set, the calling
+ *   task blocks at some point during the directive call.
+ *
+ * * The timeout functionality of the directive requires a clock tick.
+ * @endparblock
+ */
+rtems_status_code rtems_wait_set_wait(
+  rtems_wait_set *wait_set,
+  rtems_option    option_set,
+  rtems_interval  timeout,
+  uint32_t       *index
+);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_RTEMS_WAITSET_H */
@@ -273,6 +273,41 @@
     RTEMS_SCHEDULER_TABLE_PRIORITY_SMP( name, obj_name )
 #endif
 
+#ifdef CONFIGURE_SCHEDULER_SHARDED_SMP
+  #ifndef RTEMS_SMP
+    #error "CONFIGURE_SCHEDULER_SHARDED_SMP cannot be used if RTEMS_SMP is disabled"
+  #endif
+
+  #include <rtems/score/schedulershardedsmp.h>
+
+  #ifndef CONFIGURE_MAXIMUM_PROCESSORS
+    #error "CONFIGURE_MAXIMUM_PROCESSORS must be defined to configure the Sharded Priority SMP scheduler"
+  #endif
+
+  #define SCHEDULER_SHARDED_SMP_CONTEXT_NAME( name ) \
+    SCHEDULER_CONTEXT_NAME( sharded_SMP_ ## name )
+
+  #define RTEMS_SCHEDULER_SHARDED_SMP( name, prio_count ) \
+    static struct { \
+      Scheduler_sharded_SMP_Context Base; \
+      Scheduler_sharded_SMP_Shard   Shard[ CONFIGURE_MAXIMUM_PROCESSORS ]; \
+      Chain_Control \
+        Ready[ CONFIGURE_MAXIMUM_PROCESSORS + 1 ][ ( prio_count ) ]; \
+      Processor_mask Shards[ ( prio_count ) ]; \
+    } SCHEDULER_SHARDED_SMP_CONTEXT_NAME( name )
+
+  #define RTEMS_SCHEDULER_TABLE_SHARDED_SMP( name, obj_name ) \
+    { \
+      &SCHEDULER_SHARDED_SMP_CONTEXT_NAME( name ).Base.Base.Base, \
+      SCHEDULER_SHARDED_SMP_ENTRY_POINTS, \
+      RTEMS_ARRAY_SIZE( \
+        SCHEDULER_SHARDED_SMP_CONTEXT_NAME( name ).Ready[ 0 ] \
+      ) - 1, \
+      ( obj_name ) \
+      SCHEDULER_CONTROL_IS_NON_PREEMPT_MODE_SUPPORTED( false ) \
+    }
+#endif
+
 #ifdef CONFIGURE_SCHEDULER_STRONG_APA
   #ifndef RTEMS_SMP
     #error "CONFIGURE_SCHEDULER_STRONG_APA cannot be used if RTEMS_SMP is disabled"
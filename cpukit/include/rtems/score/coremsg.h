@@ -41,6 +41,7 @@
 #include <rtems/score/coremsgbuffer.h>
 #include <rtems/score/isrlock.h>
 #include <rtems/score/threadq.h>
+#include <rtems/score/waitset.h>
 #include <rtems/score/watchdog.h>
 
 #ifdef __cplusplus
@@ -161,6 +162,15 @@ struct CORE_message_queue_Control {
    *  when it does not contain a pending message.
    */
   Chain_Control                      Inactive_messages;
+
+  /**
+   * @brief This member references the wait set member which is notified when
+   *   the message queue transitions from zero messages pending to one
+   *   message pending.
+   *
+   * It is NULL, if the message queue is not a member of a wait set.
+   */
+  Wait_set_Member                   *wait_set_member;
 };
 
 /** @} */
@@ -86,6 +86,73 @@ extern "C" {
  */
 typedef int CORE_message_queue_Submit_types;
 
+/**
+ * @brief This thread wait option indicates that the receiver waits for a copy
+ *   of the message in its buffer.
+ *
+ * @see _CORE_message_queue_Seize().
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_COPY 0
+
+/**
+ * @brief This thread wait option indicates that the receiver waits to borrow
+ *   the message buffer of the message.
+ *
+ * @see _CORE_message_queue_Seize_buffer().
+ */
+#define CORE_MESSAGE_QUEUE_RECEIVE_BORROW 1
+
+/**
+ * @brief This structure is used by the operations which transfer a batch of
+ *   messages.
+ *
+ * @see _CORE_message_queue_Submit_many() and _CORE_message_queue_Seize_many().
+ */
+typedef struct {
+  /**
+   * @brief This member contains the thread queue context used to acquire the
+   *   message queue.
+   *
+   * This member shall be the first member of the structure, since the thread
+   * queue flush filters cast the thread queue context to this structure.
+   */
+  Thread_queue_Context Base;
+
+  /**
+   * @brief This member references the message queue of the batch operation.
+   */
+  CORE_message_queue_Control *the_message_queue;
+
+  /**
+   * @brief This member references the first message to submit.
+   *
+   * Message @a i begins at @a source plus @a i times the maximum message size
+   * of the message queue.
+   */
+  const char *source;
+
+  /**
+   * @brief This member references the sizes of the messages to submit.
+   */
+  const size_t *sizes;
+
+  /**
+   * @brief This member contains the count of messages to submit.
+   */
+  uint32_t count;
+
+  /**
+   * @brief This member contains the count of messages already submitted.
+   */
+  uint32_t done;
+
+  /**
+   * @brief This member determines whether the messages are prepended,
+   *   appended, or enqueued in priority order.
+   */
+  CORE_message_queue_Submit_types submit_type;
+} CORE_message_queue_Batch_context;
+
 /**
  * @brief This handler shall allocate the message buffer storage area for a
  *   message queue.
@@ -292,6 +359,38 @@ Status_Control _CORE_message_queue_Submit(
   Thread_queue_Context             *queue_context
 );
 
+/**
+ * @brief Submits a message contained in a lent message buffer to the message
+ *   queue.
+ *
+ * The message buffer shall be lent by _CORE_message_queue_Lend_buffer().  The
+ * message content is not copied if the message is enqueued or a receiver
+ * waits to borrow the message buffer.  The message buffer is no longer lent
+ * after this call, if the message was submitted.
+ *
+ * The sender never blocks since the message buffer is already available.
+ *
+ * @param[in, out] the_message_queue The message queue to submit the message.
+ * @param[in, out] the_message The lent message buffer containing the message.
+ * @param size The size of the message.
+ * @param submit_type Determines whether the message is prepended,
+ *        appended, or enqueued in priority order.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully submitted to the
+ *   message queue.
+ * @retval STATUS_MESSAGE_INVALID_SIZE The message size was too big.  The
+ *   message buffer is still lent.
+ */
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control      *the_message_queue,
+  CORE_message_queue_Buffer       *the_message,
+  size_t                           size,
+  CORE_message_queue_Submit_types  submit_type,
+  Thread_queue_Context            *queue_context
+);
+
 /**
  * @brief Seizes a message from the message queue.
  *
@@ -334,6 +433,146 @@ Status_Control _CORE_message_queue_Seize(
   Thread_queue_Context       *queue_context
 );
 
+/**
+ * @brief Seizes a message from the message queue and lends its message buffer
+ *   to the caller.
+ *
+ * In contrast to _CORE_message_queue_Seize() the message is not copied.  The
+ * message buffer shall be returned to the message queue by
+ * _CORE_message_queue_Free_message_buffer() after use.
+ *
+ * @param[in, out] the_message_queue The message queue to seize a message from.
+ * @param executing The executing thread.
+ * @param[out] buffer_p The begin address of the message content is stored in
+ *   this object.
+ * @param[out] size_p The size of the message is stored in this object.
+ * @param wait Indicates whether the calling thread is willing to block
+ *        if the message queue is empty.
+ * @param queue_context The thread queue context used for
+ *   _CORE_message_queue_Acquire() or _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL The message was successfully seized from the
+ *   message queue.
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no
+ *   pending message.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ *
+ * @note Returns message priority via return area in TCB.
+ */
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control  *the_message_queue,
+  Thread_Control              *executing,
+  void                       **buffer_p,
+  size_t                      *size_p,
+  bool                         wait,
+  Thread_queue_Context        *queue_context
+);
+
+/**
+ * @brief Submits a batch of messages to the message queue.
+ *
+ * The messages are delivered as if _CORE_message_queue_Submit() was called
+ * for each message in order with @a wait set to false.  In contrast to
+ * individual submits, the message queue lock is acquired once for all
+ * messages enqueued as pending messages.  Threads waiting to receive are
+ * dequeued and unblocked in one pass.
+ *
+ * Message @a i begins at @a buffer plus @a i times the maximum message size
+ * of the message queue.  The sender never blocks.
+ *
+ * @param[in, out] the_message_queue The message queue to submit the messages.
+ * @param buffer The begin address of the first message.
+ * @param sizes The sizes of the messages.
+ * @param count The count of messages to submit.  The count shall be greater
+ *   than zero.
+ * @param[out] submitted The count of submitted messages is stored in this
+ *   object.
+ * @param submit_type Determines whether the messages are prepended,
+ *        appended, or enqueued in priority order.
+ * @param[in, out] context The batch context.  The thread queue context of
+ *   the batch context shall be used for _CORE_message_queue_Acquire() or
+ *   _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL All messages were successfully submitted to the
+ *   message queue.
+ * @retval STATUS_MESSAGE_INVALID_SIZE A message size was too big.  No message
+ *   was submitted.
+ * @retval STATUS_TOO_MANY No inactive message buffer was available for one of
+ *   the messages.  The messages before this message were submitted.
+ */
+Status_Control _CORE_message_queue_Submit_many(
+  CORE_message_queue_Control       *the_message_queue,
+  const void                       *buffer,
+  const size_t                     *sizes,
+  uint32_t                          count,
+  uint32_t                         *submitted,
+  CORE_message_queue_Submit_types   submit_type,
+  CORE_message_queue_Batch_context *context
+);
+
+/**
+ * @brief Seizes a batch of messages from the message queue.
+ *
+ * Up to @a count pending messages are copied to the destination buffer while
+ * the message queue lock is acquired once.  Threads waiting to send are
+ * dequeued and unblocked in one pass for as many of them as inactive message
+ * buffers are available.  If no message is pending, then the behaviour is
+ * the same as for _CORE_message_queue_Seize() and at most one message is
+ * seized.
+ *
+ * Message @a i is stored at @a buffer plus @a i times the maximum message
+ * size of the message queue.
+ *
+ * @param[in, out] the_message_queue The message queue to seize the messages
+ *   from.
+ * @param executing The executing thread.
+ * @param[out] buffer The begin address of the destination buffer.
+ * @param[out] sizes The sizes of the seized messages are stored in this
+ *   array.
+ * @param count The maximum count of messages to seize.  The count shall be
+ *   greater than zero.
+ * @param[out] seized The count of seized messages is stored in this object.
+ * @param wait Indicates whether the calling thread is willing to block
+ *        if the message queue is empty.
+ * @param[in, out] context The batch context.  The thread queue context of
+ *   the batch context shall be used for _CORE_message_queue_Acquire() or
+ *   _CORE_message_queue_Acquire_critical().
+ *
+ * @retval STATUS_SUCCESSFUL At least one message was successfully seized
+ *   from the message queue.
+ * @retval STATUS_UNSATISFIED Wait was set to false and there is currently no
+ *   pending message.
+ * @retval STATUS_TIMEOUT A timeout occurred.
+ */
+Status_Control _CORE_message_queue_Seize_many(
+  CORE_message_queue_Control       *the_message_queue,
+  Thread_Control                   *executing,
+  void                             *buffer,
+  size_t                           *sizes,
+  uint32_t                          count,
+  uint32_t                         *seized,
+  bool                              wait,
+  CORE_message_queue_Batch_context *context
+);
+
+/**
+ * @brief Enqueues the message into the pending messages of the message queue.
+ *
+ * The message content shall be already present in the message buffer.
+ *
+ * @param[in, out] the_message_queue The message queue to enqueue a message.
+ * @param[in, out] the_message The message to enqueue.
+ * @param content_size The message content size in bytes.
+ * @param submit_type Determines whether the message is prepended,
+ *        appended, or enqueued in priority order.
+ */
+void _CORE_message_queue_Enqueue_message(
+  CORE_message_queue_Control      *the_message_queue,
+  CORE_message_queue_Buffer       *the_message,
+  size_t                           content_size,
+  CORE_message_queue_Submit_types  submit_type
+);
+
 /**
  * @brief Inserts a message into the message queue.
  *
@@ -508,6 +747,84 @@ _CORE_message_queue_Allocate_message_buffer (
      _Chain_Get_unprotected( &the_message_queue->Inactive_messages );
 }
 
+/**
+ * @brief Lends a message buffer from the inactive message buffer chain.
+ *
+ * The message buffer is marked as lent.  Lent message buffers shall be
+ * returned to the message queue by _CORE_message_queue_Submit_buffer() or
+ * _CORE_message_queue_Free_message_buffer().  The lending of message buffers
+ * shall not be used for message queues with blocking senders, since the
+ * message queue may be full while no message is pending.
+ *
+ * @param the_message_queue The message queue to operate upon.
+ *
+ * @retval pointer The lent message buffer.
+ * @retval NULL The inactive message buffer chain is empty.
+ */
+static inline CORE_message_queue_Buffer *_CORE_message_queue_Lend_buffer(
+  CORE_message_queue_Control *the_message_queue
+)
+{
+  CORE_message_queue_Buffer *the_message;
+
+  the_message =
+    _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+
+  if ( the_message != NULL ) {
+    _Chain_Set_off_chain( &the_message->Node );
+  }
+
+  return the_message;
+}
+
+/**
+ * @brief Gets the lent message buffer associated with the message content
+ *   address.
+ *
+ * @param the_message_queue The message queue to operate upon.
+ *
+ * @param buffer The begin address of the message content of a lent message
+ *   buffer.
+ *
+ * @retval pointer The lent message buffer.
+ * @retval NULL The address is not the begin of the message content of a
+ *   message buffer of the message queue or the message buffer is not lent.
+ */
+static inline CORE_message_queue_Buffer *_CORE_message_queue_Get_lent_buffer(
+  const CORE_message_queue_Control *the_message_queue,
+  const void                       *buffer
+)
+{
+  CORE_message_queue_Buffer *the_message;
+  uintptr_t                  buffer_size;
+  uintptr_t                  offset;
+
+  buffer_size = RTEMS_ALIGN_UP(
+    the_message_queue->maximum_message_size,
+    sizeof( uintptr_t )
+  );
+  buffer_size += sizeof( CORE_message_queue_Buffer );
+  offset = (uintptr_t) buffer -
+    offsetof( CORE_message_queue_Buffer, buffer ) -
+    (uintptr_t) the_message_queue->message_buffers;
+
+  if (
+    offset / buffer_size >= the_message_queue->maximum_pending_messages ||
+      offset % buffer_size != 0
+  ) {
+    return NULL;
+  }
+
+  the_message = (CORE_message_queue_Buffer *)
+    ( (uintptr_t) the_message_queue->message_buffers + offset );
+
+  if ( !_Chain_Is_node_off_chain( &the_message->Node ) ) {
+    return NULL;
+  }
+
+  return the_message;
+}
+
 /**
  * @brief Frees a message buffer to inactive message buffer chain.
  *
@@ -612,13 +929,93 @@ static inline
     do { } while ( 0 )
 #endif
 
+/**
+ * @brief Delivers the message to the thread waiting to receive.
+ *
+ * If the thread borrows message buffers, then the lent message buffer is
+ * handed over to the thread.  If no message buffer is lent, then a message
+ * buffer is lent for the thread.  If no message buffer is available, then
+ * nothing is delivered.  If the thread receives a copy of the message, then
+ * the lent message buffer is freed.
+ *
+ * The thread is not dequeued by this function.
+ *
+ * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param[in, out] the_thread The thread waiting to receive a message.
+ * @param[in, out] lent_message The lent message buffer containing the
+ *   message, or NULL if the message is not contained in a message buffer of
+ *   the message queue.
+ * @param buffer The buffer that is copied to the threads mutable_object.
+ * @param size The size of the buffer.
+ * @param submit_type Indicates whether the thread should be willing to block in the future.
+ *
+ * @retval true The message was delivered to the thread.
+ * @retval false No message buffer was available to lend it to the thread.
+ */
+static inline bool _CORE_message_queue_Deliver_to_receiver(
+  CORE_message_queue_Control      *the_message_queue,
+  Thread_Control                  *the_thread,
+  CORE_message_queue_Buffer       *lent_message,
+  const void                      *buffer,
+  size_t                           size,
+  CORE_message_queue_Submit_types  submit_type
+)
+{
+  if ( the_thread->Wait.option == CORE_MESSAGE_QUEUE_RECEIVE_BORROW ) {
+    CORE_message_queue_Buffer *the_message;
+
+    if ( lent_message != NULL ) {
+      the_message = lent_message;
+    } else {
+      the_message = _CORE_message_queue_Lend_buffer( the_message_queue );
+
+      if ( the_message == NULL ) {
+        return false;
+      }
+
+      _CORE_message_queue_Copy_buffer( buffer, the_message->buffer, size );
+    }
+
+    the_message->size = size;
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
+    the_message->priority = submit_type;
+#endif
+    *(void **) the_thread->Wait.return_argument_second.mutable_object =
+      the_message->buffer;
+  } else {
+    _CORE_message_queue_Copy_buffer(
+      buffer,
+      the_thread->Wait.return_argument_second.mutable_object,
+      size
+    );
+
+    if ( lent_message != NULL ) {
+      _CORE_message_queue_Free_message_buffer(
+        the_message_queue,
+        lent_message
+      );
+    }
+  }
+
+  *(size_t *) the_thread->Wait.return_argument = size;
+  the_thread->Wait.count = (uint32_t) submit_type;
+  return true;
+}
+
 /**
  * @brief Gets the first locked thread waiting to receive and dequeues it.
  *
  * This method dequeues the first locked thread waiting to receive a message,
  *      dequeues it and returns the corresponding Thread_Control.
  *
+ * The message is delivered to the thread by
+ * _CORE_message_queue_Deliver_to_receiver().  If the message cannot be
+ * delivered, then no thread is dequeued.
+ *
  * @param[in, out] the_message_queue The message queue to operate upon.
+ * @param[in, out] lent_message The lent message buffer containing the
+ *   message, or NULL if the message is not contained in a message buffer of
+ *   the message queue.
  * @param buffer The buffer that is copied to the threads mutable_object.
  * @param size The size of the buffer.
  * @param submit_type Indicates whether the thread should be willing to block in the future.
@@ -629,6 +1026,7 @@ static inline
  */
 static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
   CORE_message_queue_Control      *the_message_queue,
+  CORE_message_queue_Buffer       *lent_message,
   const void                      *buffer,
   size_t                           size,
   CORE_message_queue_Submit_types  submit_type,
@@ -659,6 +1057,21 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
     return NULL;
   }
 
+  the_thread = ( *the_message_queue->operations->first )( heads );
+
+  if (
+    !_CORE_message_queue_Deliver_to_receiver(
+      the_message_queue,
+      the_thread,
+      lent_message,
+      buffer,
+      size,
+      submit_type
+    )
+  ) {
+    return NULL;
+  }
+
   the_thread = ( *the_message_queue->operations->surrender )(
     &the_message_queue->Wait_queue.Queue,
     heads,
@@ -666,15 +1079,6 @@ static inline Thread_Control *_CORE_message_queue_Dequeue_receiver(
     queue_context
   );
 
-   *(size_t *) the_thread->Wait.return_argument = size;
-   the_thread->Wait.count = (uint32_t) submit_type;
-
-  _CORE_message_queue_Copy_buffer(
-    buffer,
-    the_thread->Wait.return_argument_second.mutable_object,
-    size
-  );
-
   _Thread_queue_Resume(
     &the_message_queue->Wait_queue.Queue,
     the_thread,
@@ -73,6 +73,10 @@ extern "C" {
  * we can allocate memory.  The other blocks are used and provide an allocated
  * memory area.  The free blocks are accessible via a list of free blocks.
  *
+ * Optionally, a heap may use the segregated fit method, see
+ * _Heap_Initialize_segregated_fit().  The free blocks are then sorted into
+ * size classes so that a suitable free block can be found in constant time.
+ *
  * Blocks or areas cover a continuous set of memory addresses. They have a
  * begin and end address.  The end address is not part of the set.  The size of
  * a block or area equals the distance between the begin and end address in
@@ -333,6 +337,63 @@ struct Heap_Block {
   Heap_Block *prev;
 };
 
+/**
+ * @brief The binary logarithm of the second level size class count of the
+ * segregated fit index.
+ */
+#define HEAP_SEGREGATED_FIT_SL_LOG2 3
+
+/**
+ * @brief The second level size class count of the segregated fit index.
+ *
+ * Each power of two size range is divided into this count of linear size
+ * classes.
+ */
+#define HEAP_SEGREGATED_FIT_SL_COUNT ( 1U << HEAP_SEGREGATED_FIT_SL_LOG2 )
+
+/**
+ * @brief The first level size class count of the segregated fit index.
+ *
+ * The first level covers block sizes up to 2^32 - 1 bytes.  Larger blocks
+ * are managed by the last size class.
+ */
+#define HEAP_SEGREGATED_FIT_FL_COUNT ( 32U - HEAP_SEGREGATED_FIT_SL_LOG2 )
+
+/**
+ * @brief Segregated fit index of the free blocks.
+ *
+ * In the segregated fit mode, the free list of the heap is kept sorted by the
+ * size class of the free blocks.  For each size class the index contains the
+ * first free block of this class in the free list.  Two levels of bitmaps
+ * indicate the non-empty size classes.  This enables the search for a free
+ * block of a suitable size and the insertion and removal of free blocks in
+ * constant time.
+ *
+ * @see _Heap_Initialize_segregated_fit().
+ */
+typedef struct {
+  /**
+   * @brief The first level bitmap.
+   *
+   * A set bit indicates that the corresponding second level bitmap is not
+   * zero.
+   */
+  uint32_t fl_bitmap;
+
+  /**
+   * @brief The second level bitmaps.
+   *
+   * A set bit indicates that the corresponding size class is not empty.
+   */
+  uint32_t sl_bitmap[ HEAP_SEGREGATED_FIT_FL_COUNT ];
+
+  /**
+   * @brief The first free block of each size class.
+   */
+  Heap_Block *first[ HEAP_SEGREGATED_FIT_FL_COUNT ]
+    [ HEAP_SEGREGATED_FIT_SL_COUNT ];
+} Heap_Segregated_fit_index;
+
 /**
  * @brief Control block used to manage a heap.
  */
@@ -344,6 +405,14 @@ struct Heap_Control {
   uintptr_t area_end;
   Heap_Block *first_block;
   Heap_Block *last_block;
+
+  /**
+   * @brief The segregated fit index of the free blocks.
+   *
+   * In the default first fit mode, this member is NULL.
+   */
+  Heap_Segregated_fit_index *segregated_fit;
+
   Heap_Statistics stats;
   #ifdef HEAP_PROTECTION
     Heap_Protection Protection;
@@ -404,6 +473,35 @@ uintptr_t _Heap_Extend(
   uintptr_t unused
 );
 
+/**
+ * @brief Initializes the heap control block to manage the area in the
+ *   segregated fit mode.
+ *
+ * The segregated fit index is placed at the begin of the area.  The remaining
+ * area is managed like by _Heap_Initialize().  In this mode, the free blocks
+ * are kept in size classes which provide a bounded allocation and free time
+ * independent of the heap fragmentation.  An aligned or boundary constrained
+ * allocation only tries the first block of each size class, so it may fail
+ * even if another free block would satisfy it.  All other heap operations are
+ * available and work in the same way as in the default first fit mode.
+ *
+ * @param[out] heap The heap control block to manage the area.
+ * @param area_begin The starting address of the area.
+ * @param area_size The size of the area in bytes.
+ * @param page_size The alignment for address values.
+ *
+ * @retval some_value The maximum memory available.
+ * @retval 0 The initialization failed.
+ *
+ * @see Heap_Initialization_or_extend_handler.
+ */
+uintptr_t _Heap_Initialize_segregated_fit(
+  Heap_Control *heap,
+  void *area_begin,
+  uintptr_t area_size,
+  uintptr_t page_size
+);
+
 /**
  * @brief This function returns always zero.
  *
@@ -696,6 +696,229 @@ static inline void _Heap_Block_set_size(
   block->size_and_flag = size | flag;
 }
 
+/**
+ * @brief Inserts the free block into the segregated fit index and free list.
+ *
+ * @param[in, out] heap The heap in the segregated fit mode.
+ * @param[in, out] block The free block to insert.
+ * @param block_size The size of the free block.
+ */
+void _Heap_Segregated_fit_insert(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t block_size
+);
+
+/**
+ * @brief Removes the free block from the segregated fit index and free list.
+ *
+ * @param[in, out] heap The heap in the segregated fit mode.
+ * @param[in, out] block The free block to remove.
+ * @param block_size The size of the free block used to insert it.
+ */
+void _Heap_Segregated_fit_remove(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t block_size
+);
+
+/**
+ * @brief Moves the free block to the size class of the new block size.
+ *
+ * @param[in, out] heap The heap in the segregated fit mode.
+ * @param[in, out] block The free block.  The block size field shall still
+ *   contain the old block size.
+ * @param new_block_size The new size of the free block.
+ */
+void _Heap_Segregated_fit_resize(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t new_block_size
+);
+
+/**
+ * @brief Returns the first free block of the first non-empty size class
+ *   suitable for the block size.
+ *
+ * @param heap The heap in the segregated fit mode.
+ * @param block_size The block size.
+ * @param good_fit If this parameter is true, then only size classes which
+ *   contain exclusively blocks of at least the block size are considered,
+ *   otherwise the size class of the block size is considered as well.
+ *
+ * @retval NULL There is no suitable free block.
+ * @return Returns the first free block of the first non-empty suitable size
+ *   class.  This block and all blocks after it in the free list belong to
+ *   size classes greater than or equal to the size class of the block size.
+ */
+Heap_Block *_Heap_Segregated_fit_search(
+  const Heap_Control *heap,
+  uintptr_t block_size,
+  bool good_fit
+);
+
+/**
+ * @brief Returns the first free block of the next non-empty size class.
+ *
+ * @param heap The heap in the segregated fit mode.
+ * @param block The free block.
+ *
+ * @retval NULL There is no non-empty size class greater than the size class
+ *   of the block.
+ * @return Returns the first free block of the smallest non-empty size class
+ *   which is greater than the size class of the block.
+ */
+Heap_Block *_Heap_Segregated_fit_next(
+  const Heap_Control *heap,
+  const Heap_Block *block
+);
+
+/**
+ * @brief Gets the size class indices of the block size.
+ *
+ * @param block_size The block size.
+ * @param[out] fl The first level index.
+ * @param[out] sl The second level index.
+ */
+static inline void _Heap_Segregated_fit_mapping(
+  uintptr_t block_size,
+  unsigned int *fl,
+  unsigned int *sl
+)
+{
+  uint64_t const value = block_size;
+  unsigned int msb;
+
+  if ( value == 0 ) {
+    *fl = 0;
+    *sl = 0;
+    return;
+  }
+
+  msb = 63U - (unsigned int) __builtin_clzll( value );
+
+  if ( msb < HEAP_SEGREGATED_FIT_SL_LOG2 ) {
+    *fl = 0;
+    *sl = 0;
+  } else if ( msb - HEAP_SEGREGATED_FIT_SL_LOG2 >= HEAP_SEGREGATED_FIT_FL_COUNT ) {
+    *fl = HEAP_SEGREGATED_FIT_FL_COUNT - 1;
+    *sl = HEAP_SEGREGATED_FIT_SL_COUNT - 1;
+  } else {
+    *fl = msb - HEAP_SEGREGATED_FIT_SL_LOG2;
+    *sl = (unsigned int) ( value >> ( msb - HEAP_SEGREGATED_FIT_SL_LOG2 ) )
+      & ( HEAP_SEGREGATED_FIT_SL_COUNT - 1 );
+  }
+}
+
+/**
+ * @brief Checks if the heap uses the segregated fit mode.
+ *
+ * @param heap The heap to check.
+ *
+ * @retval true The heap uses the segregated fit mode.
+ * @retval false The heap uses the default first fit mode.
+ */
+static inline bool _Heap_Is_segregated_fit( const Heap_Control *heap )
+{
+  return heap->segregated_fit != NULL;
+}
+
+/**
+ * @brief Inserts a new free block into the free blocks of the heap.
+ *
+ * In the first fit mode, the block is inserted after the free list anchor.
+ * In the segregated fit mode, the block is inserted into its size class.
+ *
+ * @param[in, out] heap The heap.
+ * @param[in, out] free_list_anchor The free list anchor.
+ * @param[in, out] block The new free block.
+ * @param block_size The size of the new free block.
+ */
+static inline void _Heap_Free_list_insert_block(
+  Heap_Control *heap,
+  Heap_Block *free_list_anchor,
+  Heap_Block *block,
+  uintptr_t block_size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_fit_insert( heap, block, block_size );
+  } else {
+    _Heap_Free_list_insert_after( free_list_anchor, block );
+  }
+}
+
+/**
+ * @brief Removes a free block from the free blocks of the heap.
+ *
+ * @param[in, out] heap The heap.
+ * @param[in, out] block The free block to remove.  The block size field shall
+ *   contain the size used to insert the block.
+ */
+static inline void _Heap_Free_list_remove_block(
+  Heap_Control *heap,
+  Heap_Block *block
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_fit_remove( heap, block, _Heap_Block_size( block ) );
+  } else {
+    _Heap_Free_list_remove( block );
+  }
+}
+
+/**
+ * @brief Replaces a free block by a new free block in the free blocks of the
+ *   heap.
+ *
+ * @param[in, out] heap The heap.
+ * @param[in, out] old_block The free block to replace.  The block size field
+ *   shall contain the size used to insert the block.
+ * @param[in, out] new_block The new free block.
+ * @param new_block_size The size of the new free block.
+ */
+static inline void _Heap_Free_list_replace_block(
+  Heap_Control *heap,
+  Heap_Block *old_block,
+  Heap_Block *new_block,
+  uintptr_t new_block_size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_fit_remove(
+      heap,
+      old_block,
+      _Heap_Block_size( old_block )
+    );
+    _Heap_Segregated_fit_insert( heap, new_block, new_block_size );
+  } else {
+    _Heap_Free_list_replace( old_block, new_block );
+  }
+}
+
+/**
+ * @brief Notifies the free blocks of the heap that the size of a free block
+ *   changes.
+ *
+ * In the first fit mode, the free list position is independent of the block
+ * size, so nothing needs to be done.
+ *
+ * @param[in, out] heap The heap.
+ * @param[in, out] block The free block.  The block size field shall still
+ *   contain the old block size.
+ * @param new_block_size The new size of the free block.
+ */
+static inline void _Heap_Free_list_resize_block(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t new_block_size
+)
+{
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    _Heap_Segregated_fit_resize( heap, block, new_block_size );
+  }
+}
+
 /**
  * @brief Returns if the previous heap block is used.
  *
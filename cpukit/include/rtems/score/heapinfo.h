@@ -166,6 +166,16 @@ typedef struct {
   Heap_Information Free;
   Heap_Information Used;
   Heap_Statistics Stats;
+
+  /**
+   * @brief Information about the used blocks held by a cache in front of the
+   * heap.
+   *
+   * The blocks held by the cache are not included in the used blocks
+   * information.  This information is only provided by malloc_info().  For
+   * other heaps, it is zero.
+   */
+  Heap_Information Cached;
 } Heap_Information_block;
 
 /** @} */
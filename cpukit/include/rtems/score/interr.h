@@ -236,6 +236,25 @@ typedef enum {
 
 typedef CPU_Uint32ptr Internal_errors_t;
 
+/**
+ * @brief Handler to flush deferred output.
+ *
+ * @see _Terminate_Flush_handler.
+ */
+typedef void ( *Terminate_Flush_handler )( void );
+
+/**
+ * @brief This handler is called by _Terminate() before the fatal extensions
+ *   are invoked.
+ *
+ * A subsystem which defers the kernel character output, for example to a
+ * ring buffer drained by a task, may set this handler to write the deferred
+ * output synchronously and to use the synchronous output afterwards.  The
+ * handler is called at most once.  The handler shall not rely on other tasks,
+ * since they may no longer run.
+ */
+extern Terminate_Flush_handler _Terminate_Flush_handler;
+
 /**
  * @brief Initiates system termination.
  *
@@ -243,9 +262,10 @@ typedef CPU_Uint32ptr Internal_errors_t;
  * determines that a fatal error has occurred or a final system state is
  * reached (for example after exit()).
  *
- * The first action of this function is to call the fatal handler of the user
- * extensions.  For the initial extensions the following conditions are
- * required
+ * The first action of this function is to call the _Terminate_Flush_handler
+ * if it is set, so that the output of the initial extensions is not deferred.
+ * Then the fatal handler of the user extensions is called.  For the initial
+ * extensions the following conditions are required
  * - a valid stack pointer and enough stack space,
  * - a valid code memory, and
  * - valid read-only data.
@@ -0,0 +1,111 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMutexSpin
+ *
+ * @brief This header file provides interfaces of the adaptive mutex spinning
+ *   which are used by the implementation and the application configuration.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_MUTEXSPIN_H
+#define _RTEMS_SCORE_MUTEXSPIN_H
+
+#include <rtems/score/basedefs.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSScoreMutexSpin Adaptive Mutex Spinning
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This group contains the adaptive mutex spinning implementation.
+ *
+ * In SMP configurations, a thread which tries to obtain a priority
+ * inheritance mutex owned by a thread executing on another processor may spin
+ * for a bounded time before it enqueues on the thread queue of the mutex.  If
+ * the owner releases the mutex during this time, then the block, thread
+ * dispatch, and unblock round trip is avoided.  The spinning stops as soon as
+ * the owner no longer executes.  The spinning is used by the priority
+ * inheritance variants of the Classic binary semaphores, the POSIX mutexes,
+ * and the self-contained mutexes.
+ *
+ * The spin time is defined by the application configuration option
+ * #CONFIGURE_MUTEX_SPIN_NANOSECONDS.  A spin time of zero disables the
+ * adaptive mutex spinning.
+ *
+ * @{
+ */
+
+/**
+ * @brief The adaptive mutex spin statistics.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the count of spins which ended with the mutex
+   *   obtained by the spinning thread.
+   */
+  uint64_t successes;
+
+  /**
+   * @brief This member contains the count of spins which ended with an
+   *   enqueue of the spinning thread on the thread queue of the mutex.
+   */
+  uint64_t failures;
+} Mutex_Spin_statistics;
+
+/**
+ * @brief The maximum time in nanoseconds a thread spins for a mutex owned by
+ *   a thread executing on another processor.
+ *
+ * Application provided via <rtems/confdefs.h>.  A value of zero disables the
+ * adaptive mutex spinning.
+ */
+extern const uint32_t _Mutex_Spin_nanoseconds;
+
+/**
+ * @brief Gets the adaptive mutex spin statistics summed up over all
+ *   processors.
+ *
+ * In uniprocessor configurations, the statistics are zero.
+ *
+ * @param[out] statistics is the structure to return the statistics.
+ */
+void _Mutex_Spin_get_statistics( Mutex_Spin_statistics *statistics );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_SCORE_MUTEXSPIN_H */
@@ -0,0 +1,117 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMutexSpin
+ *
+ * @brief This header file provides interfaces of the adaptive mutex spinning
+ *   which are only used by the implementation.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_MUTEXSPINIMPL_H
+#define _RTEMS_SCORE_MUTEXSPINIMPL_H
+
+#include <rtems/score/mutexspin.h>
+#include <rtems/score/threadimpl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RTEMSScoreMutexSpin
+ *
+ * @{
+ */
+
+#if defined(RTEMS_SMP)
+/**
+ * @brief Checks if it is worth to spin for the mutex owned by the thread.
+ *
+ * @param owner is the owner of the mutex.
+ *
+ * @retval true The adaptive mutex spinning is enabled and the owner executes
+ *   on a processor.
+ *
+ * @retval false Otherwise.
+ */
+static inline bool _Mutex_Spin_is_worthwhile( const Thread_Control *owner )
+{
+  return _Mutex_Spin_nanoseconds != 0
+    && _Thread_Is_executing_on_a_processor( owner );
+}
+
+/**
+ * @brief Spins while the thread owns the thread queue and executes on a
+ *   processor.
+ *
+ * The spinning is bounded by _Mutex_Spin_nanoseconds.  The thread queue lock
+ * shall not be owned by the caller.  Interrupts should be enabled.  The
+ * caller shall check the owner of the thread queue after the re-acquisition
+ * of the thread queue lock and account the outcome with
+ * _Mutex_Spin_account().
+ *
+ * @param queue is the thread queue of the mutex.
+ *
+ * @param owner is the owner of the mutex at the begin of the spinning.
+ */
+void _Mutex_Spin_wait(
+  const Thread_queue_Queue *queue,
+  const Thread_Control     *owner
+);
+
+/**
+ * @brief Accounts the outcome of a spin in the statistics of the current
+ *   processor.
+ *
+ * Interrupts shall be disabled.
+ *
+ * @param success indicates if the mutex was obtained after the spin.
+ */
+static inline void _Mutex_Spin_account( bool success )
+{
+  Per_CPU_Control *cpu_self;
+
+  cpu_self = _Per_CPU_Get();
+
+  if ( success ) {
+    ++cpu_self->Mutex_spin.successes;
+  } else {
+    ++cpu_self->Mutex_spin.failures;
+  }
+}
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_SCORE_MUTEXSPINIMPL_H */
@@ -186,6 +186,49 @@ typedef void ( *Objects_Thread_queue_Extract_callout )(
 
 typedef struct Objects_Information Objects_Information;
 
+/**
+ * @brief The name index of an object class.
+ *
+ * The name index is a hash table of the named active objects of an object
+ * class.  The object index of the object identifier is used to link the
+ * objects of a bucket.  An object index value of zero terminates a bucket.
+ *
+ * @see _Objects_Name_index_create().
+ */
+typedef struct {
+  /**
+   * @brief This member contains the count of buckets minus one.
+   *
+   * The count of buckets is a power of two.
+   */
+  uint32_t bucket_mask;
+
+  /**
+   * @brief This member references the table of the next object index of each
+   *   object.
+   *
+   * The table is indexed by the object index minus OBJECTS_INDEX_MINIMUM.  It
+   * is located directly after the buckets.
+   */
+  Objects_Maximum *next;
+
+  /**
+   * @brief This member contains the object index of the first object of each
+   *   bucket.
+   */
+  Objects_Maximum buckets[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Objects_Name_index;
+
+/**
+ * @brief Gets the maximum size in bytes of a name index for the maximum
+ *   count of objects.
+ *
+ * @param _maximum is the maximum count of objects.
+ */
+#define OBJECTS_NAME_INDEX_SIZE( _maximum ) \
+  ( sizeof( Objects_Name_index ) \
+    + 3 * ( _maximum ) * sizeof( Objects_Maximum ) )
+
 /**
  * @brief The information structure used to manage each API class of objects.
  *
@@ -330,6 +373,16 @@ struct Objects_Information {
    */
   RBTree_Control Global_by_name;
 #endif
+
+  /**
+   * @brief This member references the name index of this object class.
+   *
+   * This member is statically initialized to NULL.  The name index is created
+   * by _Objects_Initialize_information() if the application configuration
+   * option CONFIGURE_OBJECTS_NAME_INDEX is defined.  If it is NULL, then the
+   * name lookups search the local table.
+   */
+  Objects_Name_index *name_index;
 };
 
 /**
@@ -425,7 +478,8 @@ Objects_Information name##_Information = { \
   NULL, \
   NULL, \
   NULL \
-  OBJECTS_INFORMATION_MP( name##_Information, NULL ) \
+  OBJECTS_INFORMATION_MP( name##_Information, NULL ), \
+  NULL \
 }
 
 /**
@@ -467,7 +521,8 @@ Objects_Information name##_Information = { \
   NULL, \
   NULL, \
   &name##_Objects[ 0 ].Object \
-  OBJECTS_INFORMATION_MP( name##_Information, ex ) \
+  OBJECTS_INFORMATION_MP( name##_Information, ex ), \
+  NULL \
 }
 
 /** @} */
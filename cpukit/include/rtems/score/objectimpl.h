@@ -444,6 +444,143 @@ size_t _Objects_Name_to_string(
   size_t        buffer_size
 );
 
+/**
+ * @brief Indicates if the name index is enabled.
+ *
+ * This constant is provided by the application configuration through the
+ * CONFIGURE_OBJECTS_NAME_INDEX option.
+ */
+extern const bool _Objects_Name_index_is_enabled;
+
+/**
+ * @brief Creates a name index for the object class.
+ *
+ * The name index contains the named objects of the local table.
+ *
+ * @param information is the object information.
+ *
+ * @param local_table is the local table used to populate the name index.
+ *
+ * @param maximum is the maximum count of objects of the local table.
+ *
+ * @retval NULL There was not enough memory available to allocate the name
+ *   index.
+ *
+ * @return Returns the name index.
+ */
+Objects_Name_index *_Objects_Name_index_create(
+  const Objects_Information *information,
+  Objects_Control * const   *local_table,
+  Objects_Maximum            maximum
+);
+
+/**
+ * @brief Inserts the object into the name index of the object class.
+ *
+ * The object shall be in the local table.  Objects without a name are not
+ * inserted.
+ *
+ * @param information is the object information.  It shall have a name index.
+ *
+ * @param the_object is the object to insert.
+ */
+void _Objects_Name_index_insert(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+);
+
+/**
+ * @brief Removes the object from the name index of the object class.
+ *
+ * @param information is the object information.  It shall have a name index.
+ *
+ * @param the_object is the object to remove.
+ */
+void _Objects_Name_index_remove(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+);
+
+/**
+ * @brief Sets the name of the object and updates the name index of the
+ *   object class.
+ *
+ * The name and the index entry are changed atomically with respect to
+ * concurrent lookups.
+ *
+ * @param information is the object information.  It shall have a name index.
+ *
+ * @param[in, out] the_object is the object to rename.  It shall be in the
+ *   local table.
+ *
+ * @param name is the new name of the object.
+ */
+void _Objects_Name_index_set_name(
+  const Objects_Information *information,
+  Objects_Control           *the_object,
+  Objects_Name               name
+);
+
+/**
+ * @brief Searches the name index for the local object with the 32-bit
+ *   unsigned integer name and the lowest object index.
+ *
+ * This function may be called from within any runtime context.
+ *
+ * @param information is the object information.  It shall have a name index.
+ *
+ * @param name is the name of the object to find.  Objects with a name of zero
+ *   are not contained in the name index.
+ *
+ * @param[out] id is the pointer to an object identifier variable.  The object
+ *   identifier will be stored in the referenced variable, if an object was
+ *   found.
+ *
+ * @retval true An object was found.
+ *
+ * @retval false No local object exists with the name.
+ */
+bool _Objects_Name_index_find_u32(
+  const Objects_Information *information,
+  uint32_t                   name,
+  Objects_Id                *id
+);
+
+/**
+ * @brief Searches the name index for the object with the string name and the
+ *   lowest object index.
+ *
+ * The caller shall own the object allocator lock.
+ *
+ * @param information is the object information.  It shall have a name index.
+ *
+ * @param name is the name of the object to find.
+ *
+ * @retval NULL No object exists with the name.
+ *
+ * @return Returns the object associated with the name.
+ */
+Objects_Control *_Objects_Name_index_find_string(
+  const Objects_Information *information,
+  const char                *name
+);
+
+/**
+ * @brief Acquires the lock which protects the name indices and the local
+ *   tables against concurrent lookups.
+ *
+ * @param[out] lock_context is the lock context.
+ */
+void _Objects_Name_index_acquire( ISR_lock_Context *lock_context );
+
+/**
+ * @brief Releases the lock which protects the name indices and the local
+ *   tables against concurrent lookups.
+ *
+ * @param lock_context is the lock context.
+ */
+void _Objects_Name_index_release( ISR_lock_Context *lock_context );
+
 /**
  * @brief Sets objects name.
  *
@@ -477,6 +614,11 @@ static inline void _Objects_Namespace_remove_u32(
 )
 {
   _Assert( !_Objects_Has_string_name( information ) );
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_remove( information, the_object );
+  }
+
   the_object->name.name_u32 = 0;
 }
 
@@ -756,6 +898,10 @@ static inline Objects_Id _Objects_Open_u32(
     the_object
   );
 
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
+
   return the_object->id;
 }
 
@@ -786,6 +932,10 @@ static inline void _Objects_Open_string(
     _Objects_Get_index( the_object->id ),
     the_object
   );
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_insert( information, the_object );
+  }
 }
 
 /**
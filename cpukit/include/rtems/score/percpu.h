@@ -59,7 +59,7 @@ extern "C" {
 
 #if defined( RTEMS_SMP )
   #if defined( RTEMS_PROFILING )
-    #define PER_CPU_CONTROL_SIZE_PROFILING 332
+    #define PER_CPU_CONTROL_SIZE_PROFILING 720
   #else
     #define PER_CPU_CONTROL_SIZE_PROFILING 0
   #endif
@@ -259,6 +259,31 @@ typedef struct Per_CPU_Job {
 
 #endif /* defined( RTEMS_SMP ) */
 
+/**
+ * @brief This constant defines the count of priority bands of the wakeup
+ *   latency histograms.
+ */
+#define PER_CPU_WAKEUP_LATENCY_PRIORITY_BANDS 4
+
+/**
+ * @brief This constant defines the count of unmapped thread priority values
+ *   covered by one priority band of the wakeup latency histograms.
+ *
+ * The last priority band covers also all greater priority values.
+ */
+#define PER_CPU_WAKEUP_LATENCY_PRIORITY_BAND_WIDTH 64
+
+/**
+ * @brief This constant defines the count of buckets of the wakeup latency
+ *   histograms.
+ *
+ * The bucket with index @a i counts the wakeup latencies in the interval
+ * [2^i, 2^(i+1)) in CPU counter ticks.  The first bucket counts also the
+ * wakeup latencies of zero ticks and the last bucket counts also all greater
+ * wakeup latencies.
+ */
+#define PER_CPU_WAKEUP_LATENCY_BUCKETS 24
+
 /**
  * @brief Per-CPU statistics.
  */
@@ -335,6 +360,29 @@ typedef struct {
    * This value may overflow.
    */
   uint64_t total_interrupt_time;
+
+  /**
+   * @brief The maximum wakeup latency in CPU counter ticks.
+   *
+   * The wakeup latency is the time interval from the unblock of a thread by
+   * _Scheduler_Unblock() up to the context switch to this thread in
+   * _Thread_Do_dispatch() on this processor.  The CPU counters of all
+   * processors must be synchronized to get meaningful values.
+   */
+  CPU_Counter_ticks max_wakeup_latency;
+
+  /**
+   * @brief The wakeup latency histograms for each priority band.
+   *
+   * The first index is the priority band of the unmapped thread priority at
+   * the context switch to the thread.  The second index is the base two
+   * logarithm of the wakeup latency in CPU counter ticks.
+   *
+   * The counters may overflow.
+   */
+  uint32_t wakeup_latency_histogram
+    [ PER_CPU_WAKEUP_LATENCY_PRIORITY_BANDS ]
+    [ PER_CPU_WAKEUP_LATENCY_BUCKETS ];
 #endif /* defined( RTEMS_PROFILING ) */
 } Per_CPU_Stats;
 #pragma GCC diagnostic pop
@@ -511,6 +559,31 @@ typedef struct Per_CPU_Control {
      * @see Per_CPU_Watchdog_index.
      */
     Watchdog_Header Header[ PER_CPU_WATCHDOG_COUNT ];
+
+    /**
+     * @brief Watchdog ticks on this processor at the last CPU budget
+     * accounting in the tickless clock operation.
+     *
+     * @see _Watchdog_Tickless_tick().
+     */
+    uint64_t budget_ticks;
+
+#if defined(RTEMS_SMP)
+    /**
+     * @brief Job to program the clock interrupt of this processor on behalf
+     * of another processor in the tickless clock operation.
+     *
+     * @see _Watchdog_Tickless_update().
+     */
+    struct Per_CPU_Job tickless_job;
+
+    /**
+     * @brief Indicates if the tickless job is pending.
+     *
+     * This member is protected by the Per_CPU_Control::Watchdog::Lock lock.
+     */
+    bool tickless_job_pending;
+#endif
   } Watchdog;
 
   #if defined( RTEMS_SMP )
@@ -622,6 +695,27 @@ typedef struct Per_CPU_Control {
       struct Per_CPU_Job **tail;
     } Jobs;
 
+    /**
+     * @brief Adaptive mutex spin statistics of this processor.
+     *
+     * Only the processor associated with this control is allowed to change
+     * these members and this is done with interrupts disabled.
+     *
+     * @see _Mutex_Spin_get_statistics().
+     */
+    struct {
+      /**
+       * @brief The count of spins which ended with the mutex obtained.
+       */
+      uint64_t successes;
+
+      /**
+       * @brief The count of spins which ended with an enqueue on the thread
+       * queue of the mutex.
+       */
+      uint64_t failures;
+    } Mutex_spin;
+
     /**
      * @brief Indicates if the processor has been successfully started via
      * _CPU_SMP_Start_processor().
@@ -39,6 +39,7 @@
 
 #include <rtems/score/percpu.h>
 #include <rtems/score/isrlock.h>
+#include <rtems/score/priority.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -166,6 +167,52 @@ static inline void _Profiling_Update_max_interrupt_delay(
 #endif
 }
 
+/**
+ * @brief Updates the wakeup latency profiling statistics.
+ *
+ * @param[out] cpu The cpu control.
+ * @param wakeup_latency The time interval from the unblock of a thread up
+ *   to the context switch to this thread.
+ * @param unmapped_priority The unmapped priority of the thread at the context
+ *   switch.
+ */
+static inline void _Profiling_Update_wakeup_latency(
+  Per_CPU_Control   *cpu,
+  CPU_Counter_ticks  wakeup_latency,
+  Priority_Control   unmapped_priority
+)
+{
+#if defined( RTEMS_PROFILING )
+  Per_CPU_Stats *stats = &cpu->Stats;
+  Priority_Control band;
+  unsigned int bucket;
+
+  if ( stats->max_wakeup_latency < wakeup_latency ) {
+    stats->max_wakeup_latency = wakeup_latency;
+  }
+
+  band = unmapped_priority / PER_CPU_WAKEUP_LATENCY_PRIORITY_BAND_WIDTH;
+
+  if ( band >= PER_CPU_WAKEUP_LATENCY_PRIORITY_BANDS ) {
+    band = PER_CPU_WAKEUP_LATENCY_PRIORITY_BANDS - 1;
+  }
+
+  bucket = 31U - (unsigned int) __builtin_clz(
+    (uint32_t) wakeup_latency | 1U
+  );
+
+  if ( bucket >= PER_CPU_WAKEUP_LATENCY_BUCKETS ) {
+    bucket = PER_CPU_WAKEUP_LATENCY_BUCKETS - 1;
+  }
+
+  ++stats->wakeup_latency_histogram[ band ][ bucket ];
+#else
+  (void) cpu;
+  (void) wakeup_latency;
+  (void) unmapped_priority;
+#endif
+}
+
 /**
  * @brief Updates the interrupt profiling statistics.
  *
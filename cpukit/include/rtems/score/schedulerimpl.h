@@ -340,6 +340,11 @@ static inline void _Scheduler_Unblock( Thread_Control *the_thread )
   scheduler = _Thread_Scheduler_get_home( the_thread );
 #endif
 
+#if defined(RTEMS_PROFILING)
+  the_thread->unblock_instant = _CPU_Counter_read();
+  the_thread->is_wakeup_latency_pending = true;
+#endif
+
   _Scheduler_Acquire_critical( scheduler, &lock_context );
   ( *scheduler->Operations.unblock )( scheduler, the_thread, scheduler_node );
   _Scheduler_Release_critical( scheduler, &lock_context );
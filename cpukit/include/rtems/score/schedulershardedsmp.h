@@ -0,0 +1,400 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerShardedSMP
+ *
+ * @brief This header file provides interfaces of the @ref
+ *   RTEMSScoreSchedulerShardedSMP which are used by the implementation and the
+ *   @ref RTEMSImplApplConfig.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifndef _RTEMS_SCORE_SCHEDULERSHARDEDSMP_H
+#define _RTEMS_SCORE_SCHEDULERSHARDEDSMP_H
+
+#include <rtems/score/processormask.h>
+#include <rtems/score/scheduler.h>
+#include <rtems/score/schedulerpriority.h>
+#include <rtems/score/schedulersmp.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif /* __cplusplus */
+
+/**
+ * @defgroup RTEMSScoreSchedulerShardedSMP Sharded Priority SMP Scheduler
+ *
+ * @ingroup RTEMSScoreSchedulerSMP
+ *
+ * @brief This group contains the Sharded Priority SMP Scheduler
+ *   implementation.
+ *
+ * This is an implementation of the global fixed priority scheduler (G-FP).  In
+ * contrast to the Deterministic Priority SMP Scheduler, the ready nodes are
+ * distributed over one shard per processor.  Each shard uses one ready chain
+ * per priority and a priority bit map.  A ready node is placed in the shard of
+ * the processor which its thread used last.  The nodes of idle threads are
+ * placed in a dedicated idle shard.
+ *
+ * The highest ready node for a processor is taken from its own shard if no
+ * other shard contains a node of a higher priority, otherwise it is stolen
+ * from a shard with the highest priority node.  A priority bit map of all
+ * processor shards and a set of shards for each priority make this decision
+ * independent of the processor count.  In case a node needs a
+ * processor and there are several lowest priority scheduled nodes, then the
+ * processor used last by the thread of the node is preferred.  This reduces
+ * thread migrations and keeps the data of the threads in the processor
+ * caches.  The scheduled set is still the set of the highest priority ready
+ * nodes.  The FIFO order of nodes with equal priority is only maintained
+ * within a shard.
+ *
+ * All operations of a scheduler instance are serialized by the scheduler
+ * instance lock, like for the other SMP schedulers.  The SMP scheduler
+ * framework uses this lock to protect the scheduled chain, the idle threads,
+ * and the processor allocation of the instance, and it is the scheduler lock
+ * of the threads.  Each operation writes the lock, the scheduled chain, and,
+ * if a shard becomes empty or non-empty at a priority, the priority bit map
+ * of all processor shards.  So, the wakeup cost under contention and the
+ * cache lines shared by the processors are about the same as for the
+ * Deterministic Priority SMP Scheduler, no gain is expected here.  Per-shard
+ * locks would require a scheduled set and processor allocation which work
+ * without the instance lock, which is not supported by the framework.  The
+ * gain of the shards is the cache affinity of the threads due to fewer
+ * thread migrations.
+ *
+ * The thread preempt mode will be ignored.
+ *
+ * @{
+ */
+
+/**
+ * @brief This structure represents a shard of the ready nodes.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the priority bit map of the shard.
+   *
+   * The shards are placed on distinct cache lines.
+   */
+  Priority_bit_map_Control Bit_map RTEMS_ALIGNED( CPU_CACHE_LINE_BYTES );
+
+  /**
+   * @brief This member references the ready chains of the shard.
+   *
+   * There is one ready chain for each priority of the scheduler.
+   */
+  Chain_Control *Ready;
+
+  /**
+   * @brief This member contains the index of the shard.
+   *
+   * For processor shards it is the index of the associated processor.
+   */
+  uint32_t index;
+} Scheduler_sharded_SMP_Shard;
+
+/**
+ * @brief Scheduler context specialization for Sharded Priority SMP
+ * schedulers.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the SMP scheduler context.
+   */
+  Scheduler_SMP_Context Base;
+
+  /**
+   * @brief This member contains the priority bit map of the processor shards.
+   *
+   * A priority is set in the bit map if at least one processor shard has a
+   * ready node of this priority.
+   */
+  Priority_bit_map_Control Bit_map;
+
+  /**
+   * @brief This member references the processor shard sets by priority.
+   *
+   * For each priority, there is a set of the processor shards which have a
+   * ready node of this priority.  The sets follow the ready chains of the
+   * shards, see RTEMS_SCHEDULER_SHARDED_SMP().
+   */
+  Processor_mask *Shards;
+
+  /**
+   * @brief This member contains the priority of the idle threads.
+   */
+  unsigned int idle_priority;
+
+  /**
+   * @brief This member contains the shard for the nodes with the idle
+   *   priority.
+   */
+  Scheduler_sharded_SMP_Shard Idle;
+
+  /**
+   * @brief This member contains the processor shards.
+   *
+   * There is one shard for each configured processor.  The ready chains of
+   * the shards follow the shards, see RTEMS_SCHEDULER_SHARDED_SMP().
+   */
+  Scheduler_sharded_SMP_Shard Shard[ RTEMS_ZERO_LENGTH_ARRAY ];
+} Scheduler_sharded_SMP_Context;
+
+/**
+ * @brief Scheduler node specialization for Sharded Priority SMP schedulers.
+ */
+typedef struct {
+  /**
+   * @brief SMP scheduler node.
+   */
+  Scheduler_SMP_Node Base;
+
+  /**
+   * @brief The associated ready queue of this node.
+   */
+  Scheduler_priority_Ready_queue Ready_queue;
+
+  /**
+   * @brief This member references the shard of the ready queue of this node.
+   */
+  Scheduler_sharded_SMP_Shard *shard;
+} Scheduler_sharded_SMP_Node;
+
+/**
+ * @brief Entry points for the Sharded Priority SMP Scheduler.
+ */
+#define SCHEDULER_SHARDED_SMP_ENTRY_POINTS \
+  { \
+    _Scheduler_sharded_SMP_Initialize, \
+    _Scheduler_default_Schedule, \
+    _Scheduler_sharded_SMP_Yield, \
+    _Scheduler_sharded_SMP_Block, \
+    _Scheduler_sharded_SMP_Unblock, \
+    _Scheduler_sharded_SMP_Update_priority, \
+    _Scheduler_default_Map_priority, \
+    _Scheduler_default_Unmap_priority, \
+    _Scheduler_sharded_SMP_Ask_for_help, \
+    _Scheduler_sharded_SMP_Reconsider_help_request, \
+    _Scheduler_sharded_SMP_Withdraw_node, \
+    _Scheduler_sharded_SMP_Make_sticky, \
+    _Scheduler_sharded_SMP_Clean_sticky, \
+    _Scheduler_default_Pin_or_unpin_not_supported, \
+    _Scheduler_default_Pin_or_unpin_not_supported, \
+    _Scheduler_sharded_SMP_Add_processor, \
+    _Scheduler_sharded_SMP_Remove_processor, \
+    _Scheduler_sharded_SMP_Node_initialize, \
+    _Scheduler_default_Node_destroy, \
+    _Scheduler_default_Release_job, \
+    _Scheduler_default_Cancel_job, \
+    _Scheduler_SMP_Start_idle \
+    SCHEDULER_DEFAULT_SET_AFFINITY_OPERATION \
+  }
+
+/**
+ * @brief Initializes the sharded priority SMP scheduler.
+ *
+ * This routine initializes the sharded priority SMP scheduler.
+ *
+ * @param scheduler The scheduler to initialize.
+ */
+void _Scheduler_sharded_SMP_Initialize( const Scheduler_Control *scheduler );
+
+/**
+ * @brief Initializes the node with the given priority.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[out] node The node to initialize.
+ * @param the_thread The thread of the scheduler node.
+ * @param priority The priority for the initialization.
+ */
+void _Scheduler_sharded_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+);
+
+/**
+ * @brief Blocks the thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread to block.
+ * @param[in, out] node The @a thread's scheduler node.
+ */
+void _Scheduler_sharded_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Unblocks the thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread to unblock.
+ * @param[in, out] node The @a thread's scheduler node.
+ */
+void _Scheduler_sharded_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Updates the priority of the node.
+ *
+ * @param scheduler The scheduler instance.
+ * @param the_thread The thread for the operation.
+ * @param base_node The thread's scheduler node.
+ */
+void _Scheduler_sharded_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Asks for help operation.
+ *
+ * @param scheduler The scheduler instance to ask for help.
+ * @param the_thread The thread needing help.
+ * @param node The scheduler node.
+ *
+ * @retval true Ask for help was successful.
+ * @retval false Ask for help was not successful.
+ */
+bool _Scheduler_sharded_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Reconsiders help operation.
+ *
+ * @param scheduler The scheduler instance to reconsider the help
+ *   request.
+ * @param the_thread The thread reconsidering a help request.
+ * @param node The scheduler node.
+ */
+void _Scheduler_sharded_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Withdraws node operation.
+ *
+ * @param scheduler The scheduler instance to withdraw the node.
+ * @param the_thread The thread using the node.
+ * @param node The scheduler node to withdraw.
+ * @param next_state The next thread scheduler state in case the node is
+ *   scheduled.
+ */
+void _Scheduler_sharded_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+);
+
+/**
+ * @brief Makes the node sticky.
+ *
+ * @param scheduler is the scheduler of the node.
+ *
+ * @param[in, out] the_thread is the thread owning the node.
+ *
+ * @param[in, out] node is the scheduler node to make sticky.
+ */
+void _Scheduler_sharded_SMP_Make_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Cleans the sticky property from the node.
+ *
+ * @param scheduler is the scheduler of the node.
+ *
+ * @param[in, out] the_thread is the thread owning the node.
+ *
+ * @param[in, out] node is the scheduler node to clean the sticky property.
+ */
+void _Scheduler_sharded_SMP_Clean_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+);
+
+/**
+ * @brief Adds @a idle to @a scheduler.
+ *
+ * @param[in, out] scheduler The scheduler instance to add the processor to.
+ * @param idle The idle thrad control.
+ */
+void _Scheduler_sharded_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+);
+
+/**
+ * @brief Removes an idle thread from the given cpu.
+ *
+ * @param scheduler The scheduler instance.
+ * @param cpu The cpu control to remove from @a scheduler.
+ *
+ * @return The idle thread of the processor.
+ */
+Thread_Control *_Scheduler_sharded_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  struct Per_CPU_Control  *cpu
+);
+
+/**
+ * @brief Performs the yield of a thread.
+ *
+ * @param scheduler The scheduler instance.
+ * @param[in, out] the_thread The thread that performed the yield operation.
+ * @param node The scheduler node of @a the_thread.
+ */
+void _Scheduler_sharded_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif /* __cplusplus */
+
+#endif /* _RTEMS_SCORE_SCHEDULERSHARDEDSMP_H */
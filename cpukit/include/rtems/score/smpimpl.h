@@ -270,6 +270,148 @@ void _SMP_Multicast_action(
   void                 *arg
 );
 
+/**
+ * @brief This structure represents an asynchronous SMP multicast action.
+ *
+ * It is the completion handle of an action posted by
+ * _SMP_Multicast_action_post() or added to a batch by
+ * _SMP_Multicast_batch_add().  The storage shall remain valid and unchanged
+ * until the action is done.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the handler and argument of the action.
+   */
+  Per_CPU_Job_context Context;
+
+  /**
+   * @brief This member contains the set of target processors of the action.
+   */
+  Processor_mask targets;
+
+  /**
+   * @brief This member contains the per-processor jobs of the action.
+   */
+  Per_CPU_Job Jobs[ CPU_MAXIMUM_PROCESSORS ];
+} SMP_Multicast_action_control;
+
+/**
+ * @brief This structure represents a batch of asynchronous SMP multicast
+ *   actions.
+ *
+ * The actions of a batch are issued to the target processors with one
+ * inter-processor interrupt for each target processor.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the union of the sets of target processors of
+   *   the actions added to the batch since the last submit.
+   */
+  Processor_mask targets;
+} SMP_Multicast_batch;
+
+/**
+ * @brief Posts an SMP multicast action to the set of target processors.
+ *
+ * In contrast to _SMP_Multicast_action(), this function does not wait for
+ * the completion of the action.  Use _SMP_Multicast_action_is_done() or
+ * _SMP_Multicast_action_wait() to check or wait for the completion.  The
+ * current processor may be part of the set.  The action is carried out on the
+ * current processor after interrupts are enabled or while it waits for the
+ * completion.
+ *
+ * @param[out] action is the action control.  It is the completion handle of
+ *   the action.
+ *
+ * @param targets is the set of target processors for the action.
+ *
+ * @param handler is the multicast action handler.
+ *
+ * @param arg is the multicast action argument.
+ */
+void _SMP_Multicast_action_post(
+  SMP_Multicast_action_control *action,
+  const Processor_mask         *targets,
+  SMP_Action_handler            handler,
+  void                         *arg
+);
+
+/**
+ * @brief Checks if the SMP multicast action is done.
+ *
+ * @param action is the action control.
+ *
+ * @return Returns true, if the handler of the action was carried out by all
+ *   target processors, otherwise false.
+ */
+bool _SMP_Multicast_action_is_done(
+  const SMP_Multicast_action_control *action
+);
+
+/**
+ * @brief Waits until the SMP multicast action is done.
+ *
+ * The caller must ensure that no thread dispatch can happen during the call
+ * of this function, otherwise the behaviour is undefined.  In case a target
+ * processor is in a wrong state to process per-processor jobs, then this
+ * function results in an SMP_FATAL_WRONG_CPU_STATE_TO_PERFORM_JOBS fatal SMP
+ * error.
+ *
+ * @param action is the action control.  The action shall be posted or
+ *   submitted as part of a batch.
+ */
+void _SMP_Multicast_action_wait( const SMP_Multicast_action_control *action );
+
+/**
+ * @brief Initializes the batch of SMP multicast actions.
+ *
+ * @param[out] batch is the batch to initialize.
+ */
+static inline void _SMP_Multicast_batch_initialize(
+  SMP_Multicast_batch *batch
+)
+{
+  _Processor_mask_Zero( &batch->targets );
+}
+
+/**
+ * @brief Adds the SMP multicast action to the batch.
+ *
+ * The jobs of the action are added to the job lists of the target processors
+ * without an inter-processor interrupt.  The actions added to the same
+ * processor are carried out in the order of the additions.  The action shall
+ * not be waited for before the batch is submitted.
+ *
+ * @param[in, out] batch is the batch.
+ *
+ * @param[out] action is the action control.  It is the completion handle of
+ *   the action.
+ *
+ * @param targets is the set of target processors for the action.
+ *
+ * @param handler is the multicast action handler.
+ *
+ * @param arg is the multicast action argument.
+ */
+void _SMP_Multicast_batch_add(
+  SMP_Multicast_batch          *batch,
+  SMP_Multicast_action_control *action,
+  const Processor_mask         *targets,
+  SMP_Action_handler            handler,
+  void                         *arg
+);
+
+/**
+ * @brief Submits the batch of SMP multicast actions.
+ *
+ * An inter-processor interrupt is sent to each target processor of the
+ * actions added to the batch.  The batch is empty afterwards and may be used
+ * for further actions.
+ *
+ * @param[in, out] batch is the batch to submit.
+ */
+void _SMP_Multicast_batch_submit( SMP_Multicast_batch *batch );
+
 /**
  * @brief Initiates an SMP multicast action to the set of all online
  * processors.
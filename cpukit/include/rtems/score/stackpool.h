@@ -0,0 +1,271 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreStack
+ *
+ * @brief This header file provides interfaces of the stack pool which recycles
+ *   task stack areas.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_STACKPOOL_H
+#define _RTEMS_SCORE_STACKPOOL_H
+
+#include <rtems/score/freechain.h>
+#include <rtems/score/cpu.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RTEMSScoreStack
+ *
+ * @{
+ */
+
+/**
+ * @brief This constant defines the binary logarithm of the smallest size
+ *   class of the stack pool.
+ */
+#define STACK_POOL_MINIMUM_CLASS_LOG2 10
+
+/**
+ * @brief This constant defines the binary logarithm of the count of size
+ *   classes for each power of two.
+ */
+#define STACK_POOL_SUBCLASS_LOG2 2
+
+/**
+ * @brief This constant defines the count of size classes for each power of
+ *   two.
+ */
+#define STACK_POOL_SUBCLASS_COUNT ( 1U << STACK_POOL_SUBCLASS_LOG2 )
+
+/**
+ * @brief This constant defines the count of powers of two covered by the size
+ *   classes.
+ */
+#define STACK_POOL_LEVEL_COUNT 8
+
+/**
+ * @brief This constant defines the count of size classes of the stack pool.
+ */
+#define STACK_POOL_CLASS_COUNT \
+  ( STACK_POOL_LEVEL_COUNT * STACK_POOL_SUBCLASS_COUNT )
+
+/**
+ * @brief This constant defines the size of the largest size class.
+ *
+ * Stack areas larger than this size are allocated from and freed to the RTEMS
+ * Workspace directly.
+ */
+#define STACK_POOL_MAXIMUM_CLASS_SIZE \
+  ( ( (size_t) 2 * STACK_POOL_SUBCLASS_COUNT - 1 ) \
+    << ( STACK_POOL_MINIMUM_CLASS_LOG2 + STACK_POOL_LEVEL_COUNT - 1 \
+      - STACK_POOL_SUBCLASS_LOG2 ) )
+
+/**
+ * @brief This constant defines the size of the header placed in front of
+ *   each stack area allocated by the stack pool.
+ *
+ * The header size preserves the heap alignment of the stack area.
+ */
+#define STACK_POOL_HEADER_SIZE \
+  RTEMS_ALIGN_UP( sizeof( uint32_t ), CPU_HEAP_ALIGNMENT )
+
+/**
+ * @brief Gets an upper bound of the memory allocated from the RTEMS Workspace
+ *   by the stack pool for a stack area of the size.
+ *
+ * The rounding up to the size class adds less than a quarter of the size.
+ *
+ * @param _size is the stack area size.
+ */
+#define STACK_POOL_ALLOCATION_SIZE( _size ) \
+  ( ( _size ) + ( _size ) / STACK_POOL_SUBCLASS_COUNT \
+    + STACK_POOL_HEADER_SIZE )
+
+/**
+ * @brief This structure represents a size class of the stack pool.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the free stack areas of the size class.
+   */
+  Freechain_Control Free;
+
+  /**
+   * @brief This member contains the count of stack areas on the free list.
+   */
+  uint32_t cached;
+
+  /**
+   * @brief This member contains the count of allocations satisfied by the
+   *   free list.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief This member contains the count of allocations which had to
+   *   allocate a stack area from the RTEMS Workspace.
+   */
+  uint32_t misses;
+} Stack_Pool_Class;
+
+/**
+ * @brief This structure represents the stack pool.
+ *
+ * The stack pool is protected by the allocator mutex.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the size classes.
+   */
+  Stack_Pool_Class Classes[ STACK_POOL_CLASS_COUNT ];
+
+  /**
+   * @brief This member contains the count of allocations of stack areas
+   *   larger than the largest size class.
+   */
+  uint32_t oversized;
+
+  /**
+   * @brief This member contains the count of flushes of the stack pool.
+   */
+  uint32_t flushes;
+} Stack_Pool_Control;
+
+/**
+ * @brief This structure provides information about the stack pool.
+ */
+typedef struct {
+  /**
+   * @brief This member contains the count of allocations satisfied by the
+   *   stack pool.
+   */
+  uint32_t hits;
+
+  /**
+   * @brief This member contains the count of allocations of a size class
+   *   which had to allocate a stack area from the RTEMS Workspace.
+   */
+  uint32_t misses;
+
+  /**
+   * @brief This member contains the count of allocations of stack areas
+   *   larger than the largest size class.
+   */
+  uint32_t oversized;
+
+  /**
+   * @brief This member contains the count of flushes of the stack pool.
+   */
+  uint32_t flushes;
+
+  /**
+   * @brief This member contains the count of stack areas held by the stack
+   *   pool.
+   */
+  uint32_t cached;
+
+  /**
+   * @brief This member contains the total size in bytes of the stack areas
+   *   held by the stack pool.
+   */
+  uintptr_t cached_size;
+} Stack_Pool_Information;
+
+/**
+ * @brief This pointer references the stack pool.
+ *
+ * This constant is defined by the application configuration option
+ * #CONFIGURE_TASK_STACK_RECYCLING via <rtems/confdefs.h> or a default
+ * configuration.  By default, it is NULL and no stack pool is used.
+ */
+extern Stack_Pool_Control * const _Stack_Pool;
+
+/**
+ * @brief Initializes the stack pool.
+ */
+void _Stack_Pool_Initialize( void );
+
+/**
+ * @brief Allocates a stack area from the stack pool.
+ *
+ * The stack area is taken from the free list of its size class.  If the free
+ * list is empty, then the stack area is allocated from the RTEMS Workspace.
+ * If this allocation fails, then the stack pool is flushed and the allocation
+ * is retried.
+ *
+ * The caller shall own the allocator mutex.
+ *
+ * @param stack_size is the requested stack area size.
+ *
+ * @return Returns the begin of the allocated stack area or NULL.
+ */
+void *_Stack_Pool_Allocate( size_t stack_size );
+
+/**
+ * @brief Frees a stack area allocated by _Stack_Pool_Allocate().
+ *
+ * The stack area is put on the free list of its size class.
+ *
+ * The caller shall own the allocator mutex.
+ *
+ * @param stack_area is the stack area to free, or NULL.
+ */
+void _Stack_Pool_Free( void *stack_area );
+
+/**
+ * @brief Returns all stack areas held by the stack pool to the RTEMS
+ *   Workspace.
+ *
+ * The function does nothing, if no stack pool is configured.  The caller
+ * shall own the allocator mutex.
+ */
+void _Stack_Pool_Flush( void );
+
+/**
+ * @brief Gets the stack pool information.
+ *
+ * The information is zero, if no stack pool is configured.  The caller shall
+ * own the allocator mutex.
+ *
+ * @param[out] info is the stack pool information.
+ */
+void _Stack_Pool_Get_information( Stack_Pool_Information *info );
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _RTEMS_SCORE_STACKPOOL_H */
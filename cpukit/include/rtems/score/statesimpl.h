@@ -118,6 +118,9 @@ extern "C" {
 /** This macro corresponds to a task those life is changing. */
 #define STATES_LIFE_IS_CHANGING                0x00020000
 
+/** This macro corresponds to a task waiting for a wait set member. */
+#define STATES_WAITING_FOR_WAIT_SET            0x00040000
+
 /** This macro corresponds to a task being held by the debugger. */
 #define STATES_DEBUGGER                        0x08000000
 
@@ -146,7 +149,8 @@ extern "C" {
                                  STATES_WAITING_FOR_BARRIER            | \
                                  STATES_WAITING_FOR_BSD_WAKEUP         | \
                                  STATES_WAITING_FOR_FUTEX              | \
-                                 STATES_WAITING_FOR_RWLOCK             )
+                                 STATES_WAITING_FOR_RWLOCK             | \
+                                 STATES_WAITING_FOR_WAIT_SET           )
 
 /** This macro corresponds to a task waiting which is blocked. */
 #define STATES_BLOCKED         ( STATES_LOCALLY_BLOCKED         | \
@@ -879,6 +879,25 @@ struct _Thread_Control {
   SMP_lock_Stats Potpourri_stats;
 #endif
 
+#if defined(RTEMS_PROFILING)
+  /**
+   * @brief The instant in CPU counter ticks at which the thread was unblocked
+   *   the last time.
+   *
+   * This member is only valid if
+   * Thread_Control::is_wakeup_latency_pending is true.
+   */
+  CPU_Counter_ticks unblock_instant;
+
+  /**
+   * @brief This member is true, if the thread was unblocked and did not
+   *   execute since then, otherwise it is false.
+   *
+   * @see _Scheduler_Unblock() and _Thread_Do_dispatch().
+   */
+  bool is_wakeup_latency_pending;
+#endif
+
   /** This field is true if the thread is an idle thread. */
   bool                                  is_idle;
 #if defined(RTEMS_MULTIPROCESSING)
@@ -1142,6 +1161,7 @@ Thread_Information name##_Information = { \
     NULL, \
     NULL \
     OBJECTS_INFORMATION_MP( name##_Information.Objects, NULL ), \
+    NULL \
   }, { \
     NULL \
   } \
@@ -1180,7 +1200,8 @@ Thread_Information name##_Information = { \
     NULL, \
     NULL, \
     &name##_Objects[ 0 ].Control.Object \
-    OBJECTS_INFORMATION_MP( name##_Information.Objects, NULL ) \
+    OBJECTS_INFORMATION_MP( name##_Information.Objects, NULL ), \
+    NULL \
   }, { \
     &name##_Heads[ 0 ] \
   } \
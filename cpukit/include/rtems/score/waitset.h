@@ -0,0 +1,215 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWaitSet
+ *
+ * @brief This header file provides interfaces of the @ref RTEMSScoreWaitSet
+ *   which are used by the implementation and the API.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_WAITSET_H
+#define _RTEMS_SCORE_WAITSET_H
+
+#include <rtems/score/atomic.h>
+#include <rtems/score/object.h>
+#include <rtems/score/status.h>
+#include <rtems/score/threadq.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup RTEMSScoreWaitSet Wait Set Handler
+ *
+ * @ingroup RTEMSScore
+ *
+ * @brief This group contains the Wait Set Handler implementation.
+ *
+ * A wait set lets threads wait until one of several objects becomes ready.
+ * The objects notify the wait set through _Wait_set_Member_notify() when
+ * they become ready.  The waiting threads are blocked on the thread queue of
+ * the wait set, so no polling is involved.
+ *
+ * @{
+ */
+
+/**
+ * @brief This constant defines the maximum count of members of a wait set.
+ */
+#define WAIT_SET_MAXIMUM_MEMBERS 32
+
+typedef struct Wait_set_Control Wait_set_Control;
+
+typedef struct Wait_set_Member Wait_set_Member;
+
+/**
+ * @brief This structure provides the operations of a wait set member.
+ *
+ * The operations are provided by the API which implements the object kind of
+ * the member.
+ */
+typedef struct {
+  /**
+   * @brief Attaches the member to its object.
+   *
+   * After the successful return of this operation, the object shall notify
+   * the wait set when it becomes ready.  The member is obtained through
+   * _Wait_set_Member_obtain() while the object is locked and the wait set is
+   * notified through _Wait_set_Member_notify() after the object lock was
+   * released.
+   * An object may be attached to at most one member.
+   *
+   * @param member is the member.
+   *
+   * @retval STATUS_SUCCESSFUL The member was attached to its object.
+   *
+   * @retval STATUS_INVALID_ID There was no object associated with the
+   *   identifier of the member.
+   *
+   * @retval STATUS_NOT_DEFINED The object cannot be a member of a wait set.
+   *
+   * @retval STATUS_RESOURCE_IN_USE The object was already attached to a
+   *   member.
+   */
+  Status_Control ( *attach )( Wait_set_Member *member );
+
+  /**
+   * @brief Checks if the object of the member is ready.
+   *
+   * The check shall not change the state of the object.  If the object no
+   * longer exists, then the object shall be reported as ready, so that the
+   * waiting thread can observe the error.
+   *
+   * @param member is the member.
+   *
+   * @retval true The object is ready.
+   *
+   * @retval false Otherwise.
+   */
+  bool ( *is_ready )( const Wait_set_Member *member );
+
+  /**
+   * @brief Detaches the member from its object.
+   *
+   * After the return of this operation, the object shall no longer obtain
+   * the member for a notification.  The notifications in progress are waited
+   * for by the caller.
+   *
+   * @param member is the member.
+   */
+  void ( *detach )( Wait_set_Member *member );
+} Wait_set_Member_operations;
+
+/**
+ * @brief This structure represents a member of a wait set.
+ */
+struct Wait_set_Member {
+  /**
+   * @brief This member references the wait set of the member.
+   */
+  Wait_set_Control *wait_set;
+
+  /**
+   * @brief This member references the operations of the member.
+   *
+   * It is NULL, if the member is not in use.
+   */
+  const Wait_set_Member_operations *operations;
+
+  /**
+   * @brief This member contains the identifier of the object of the member.
+   */
+  Objects_Id id;
+
+  /**
+   * @brief This member contains an option specific to the object kind of the
+   *   member.
+   */
+  uint32_t option;
+
+  /**
+   * @brief This member contains the count of notifications in progress.
+   *
+   * The count is incremented by _Wait_set_Member_obtain() while the object is
+   * locked and decremented by _Wait_set_Member_notify().  A detach waits until
+   * the count is zero, so that the member and the wait set stay valid for the
+   * notifications in progress.
+   */
+  Atomic_Uint notifications_in_progress;
+};
+
+/**
+ * @brief This structure represents a wait set.
+ */
+struct Wait_set_Control {
+  /**
+   * @brief This member contains the thread queue of the threads waiting for
+   *   a member to become ready.
+   */
+  Thread_queue_Control Wait_queue;
+
+  /**
+   * @brief This member contains the count of notifications.
+   *
+   * The count is used to detect notifications while the members are checked
+   * by a waiting thread.
+   */
+  uint32_t notifications;
+
+  /**
+   * @brief This member contains a bit for each member in use.
+   */
+  uint32_t members_in_use;
+
+  /**
+   * @brief This member contains the index of the member checked first by the
+   *   next wait.
+   *
+   * The index advances past the last ready member, so that a steadily ready
+   * member does not starve the other members.  It is protected by the thread
+   * queue lock of the wait set.
+   */
+  uint32_t next_index;
+
+  /**
+   * @brief This member contains the members of the wait set.
+   */
+  Wait_set_Member Members[ WAIT_SET_MAXIMUM_MEMBERS ];
+};
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
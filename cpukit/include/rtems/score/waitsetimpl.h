@@ -0,0 +1,405 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWaitSet
+ *
+ * @brief This header file provides interfaces of the @ref RTEMSScoreWaitSet
+ *   which are only used by the implementation.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _RTEMS_SCORE_WAITSETIMPL_H
+#define _RTEMS_SCORE_WAITSETIMPL_H
+
+#include <rtems/score/waitset.h>
+#include <rtems/score/thread.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems/score/watchdogticks.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @addtogroup RTEMSScoreWaitSet
+ *
+ * @{
+ */
+
+/**
+ * @brief Initializes the wait set.
+ *
+ * @param[out] wait_set is the wait set to initialize.
+ */
+void _Wait_set_Initialize( Wait_set_Control *wait_set );
+
+/**
+ * @brief Destroys the wait set.
+ *
+ * All members are detached from their objects.  The threads waiting on the
+ * wait set are unblocked with the STATUS_OBJECT_WAS_DELETED status.
+ *
+ * @param[in, out] wait_set is the wait set to destroy.
+ */
+void _Wait_set_Destroy( Wait_set_Control *wait_set );
+
+/**
+ * @brief Notifies the wait set that one of its members may be ready.
+ *
+ * All threads waiting on the wait set are unblocked.  They check the members
+ * again.  This function shall be called while no thread queue lock is owned
+ * by the caller.  It may be called from within interrupt context.
+ *
+ * @param[in, out] wait_set is the wait set to notify.
+ */
+void _Wait_set_Notify( Wait_set_Control *wait_set );
+
+/**
+ * @brief Obtains the member for a notification, if the member is not NULL.
+ *
+ * This function shall be called while the object is locked.  The
+ * notification shall be carried out by _Wait_set_Member_notify() after the
+ * object lock was released.  Thread dispatching is disabled until then, so
+ * that a detach of the member cannot wait for a preempted notification.
+ *
+ * @param[in, out] member is the member attached to the object or NULL.
+ *
+ * @param lock_context is the lock context of the object lock.
+ *
+ * @return Returns the member.
+ */
+static inline Wait_set_Member *_Wait_set_Member_obtain(
+  Wait_set_Member        *member,
+  const ISR_lock_Context *lock_context
+)
+{
+  if ( member != NULL ) {
+    (void) _Thread_Dispatch_disable_critical( lock_context );
+    _Atomic_Fetch_add_uint(
+      &member->notifications_in_progress,
+      1,
+      ATOMIC_ORDER_RELAXED
+    );
+  }
+
+  return member;
+}
+
+/**
+ * @brief Notifies the wait set of the member obtained by
+ *   _Wait_set_Member_obtain(), if the member is not NULL.
+ *
+ * This function shall be called while no thread queue lock is owned by the
+ * caller.
+ *
+ * @param[in, out] member is the member to notify or NULL.
+ */
+static inline void _Wait_set_Member_notify( Wait_set_Member *member )
+{
+  if ( member != NULL ) {
+    _Wait_set_Notify( member->wait_set );
+    _Atomic_Fetch_sub_uint(
+      &member->notifications_in_progress,
+      1,
+      ATOMIC_ORDER_RELEASE
+    );
+    _Thread_Dispatch_enable( _Per_CPU_Get() );
+  }
+}
+
+/**
+ * @brief Attaches the member to the wait set member reference of an object.
+ *
+ * This function shall be called while the object is locked.
+ *
+ * @param[in, out] wait_set_member is the wait set member reference of the
+ *   object.
+ *
+ * @param member is the member to attach.
+ *
+ * @retval STATUS_SUCCESSFUL The member was attached.
+ *
+ * @retval STATUS_RESOURCE_IN_USE The object was already attached to a member.
+ */
+static inline Status_Control _Wait_set_Member_attach_to(
+  Wait_set_Member **wait_set_member,
+  Wait_set_Member  *member
+)
+{
+  if ( *wait_set_member != NULL ) {
+    return STATUS_RESOURCE_IN_USE;
+  }
+
+  *wait_set_member = member;
+  return STATUS_SUCCESSFUL;
+}
+
+/**
+ * @brief Detaches the member from the wait set member reference of an object.
+ *
+ * This function shall be called while the object is locked.  The reference
+ * is only cleared, if the object is still attached to the member.
+ *
+ * @param[in, out] wait_set_member is the wait set member reference of the
+ *   object.
+ *
+ * @param member is the member to detach.
+ */
+static inline void _Wait_set_Member_detach_from(
+  Wait_set_Member       **wait_set_member,
+  const Wait_set_Member  *member
+)
+{
+  if ( *wait_set_member == member ) {
+    *wait_set_member = NULL;
+  }
+}
+
+/**
+ * @brief Waits until a member of the wait set is ready.
+ *
+ * The members are checked in a round-robin order starting with the member
+ * after the one returned by the previous wait.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param[in, out] executing is the executing thread.
+ *
+ * @param wait indicates whether the executing thread is willing to block.
+ *
+ * @param timeout is the timeout in clock ticks.  Use WATCHDOG_NO_TIMEOUT to
+ *   wait potentially forever.  The timeout is not restarted if the thread is
+ *   unblocked and no member is ready.
+ *
+ * @param[out] index is the index of the ready member.
+ *
+ * @retval STATUS_SUCCESSFUL A member was ready.
+ *
+ * @retval STATUS_UNSATISFIED No member was ready and wait was false.
+ *
+ * @retval STATUS_TIMEOUT The timeout happened.
+ *
+ * @retval STATUS_OBJECT_WAS_DELETED The wait set was destroyed.
+ */
+Status_Control _Wait_set_Wait(
+  Wait_set_Control  *wait_set,
+  Thread_Control    *executing,
+  bool               wait,
+  Watchdog_Interval  timeout,
+  uint32_t          *index
+);
+
+/**
+ * @brief Adds a member to the wait set.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param index is the member index.
+ *
+ * @param operations are the member operations.
+ *
+ * @param id is the identifier of the object of the member.
+ *
+ * @param option is an option specific to the object kind of the member.
+ *
+ * @retval STATUS_SUCCESSFUL The member was added.
+ *
+ * @retval STATUS_INVALID_NUMBER The member index was invalid.
+ *
+ * @retval STATUS_RESOURCE_IN_USE The member was already in use.
+ *
+ * @return Otherwise, the status returned by the attach operation is
+ *   returned.
+ */
+Status_Control _Wait_set_Add(
+  Wait_set_Control                 *wait_set,
+  uint32_t                          index,
+  const Wait_set_Member_operations *operations,
+  Objects_Id                        id,
+  uint32_t                          option
+);
+
+/**
+ * @brief Removes a member from the wait set.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param index is the member index.
+ *
+ * @retval STATUS_SUCCESSFUL The member was removed.
+ *
+ * @retval STATUS_INVALID_NUMBER The member index was invalid.
+ *
+ * @retval STATUS_INCORRECT_STATE The member was not in use.
+ */
+Status_Control _Wait_set_Remove( Wait_set_Control *wait_set, uint32_t index );
+
+/**
+ * @brief Checks if the member index is valid.
+ *
+ * @param index is the member index.
+ *
+ * @retval true The member index is valid.
+ *
+ * @retval false Otherwise.
+ */
+static inline bool _Wait_set_Is_index_valid( uint32_t index )
+{
+  return index < WAIT_SET_MAXIMUM_MEMBERS;
+}
+
+/**
+ * @brief Checks if the member is in use.
+ *
+ * @param wait_set is the wait set.
+ *
+ * @param index is the valid member index.
+ *
+ * @retval true The member is in use.
+ *
+ * @retval false Otherwise.
+ */
+static inline bool _Wait_set_Is_member_in_use(
+  const Wait_set_Control *wait_set,
+  uint32_t                index
+)
+{
+  return ( wait_set->members_in_use & ( UINT32_C( 1 ) << index ) ) != 0;
+}
+
+/**
+ * @brief Checks if the wait set has no members.
+ *
+ * @param wait_set is the wait set.
+ *
+ * @retval true The wait set has no members.
+ *
+ * @retval false Otherwise.
+ */
+static inline bool _Wait_set_Is_empty( const Wait_set_Control *wait_set )
+{
+  return wait_set->members_in_use == 0;
+}
+
+/**
+ * @brief Prepares the member for use.
+ *
+ * The member shall be attached to its object afterwards.  If the attach
+ * fails, then the member shall be removed by _Wait_set_Member_remove().
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param index is the valid index of a member not in use.
+ *
+ * @param operations are the member operations.
+ *
+ * @param id is the identifier of the object of the member.
+ *
+ * @param option is an option specific to the object kind of the member.
+ *
+ * @return Returns the member.
+ */
+static inline Wait_set_Member *_Wait_set_Member_insert(
+  Wait_set_Control                 *wait_set,
+  uint32_t                          index,
+  const Wait_set_Member_operations *operations,
+  Objects_Id                        id,
+  uint32_t                          option
+)
+{
+  Wait_set_Member *member;
+
+  member = &wait_set->Members[ index ];
+  member->wait_set = wait_set;
+  member->operations = operations;
+  member->id = id;
+  member->option = option;
+  wait_set->members_in_use |= UINT32_C( 1 ) << index;
+
+  return member;
+}
+
+/**
+ * @brief Removes the member without detaching it from its object.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param index is the valid index of a member in use.
+ */
+static inline void _Wait_set_Member_remove(
+  Wait_set_Control *wait_set,
+  uint32_t          index
+)
+{
+  wait_set->Members[ index ].operations = NULL;
+  wait_set->members_in_use &= ~( UINT32_C( 1 ) << index );
+}
+
+/**
+ * @brief Detaches the member from its object and removes it.
+ *
+ * @param[in, out] wait_set is the wait set.
+ *
+ * @param index is the valid index of a member in use.
+ */
+static inline void _Wait_set_Member_detach_and_remove(
+  Wait_set_Control *wait_set,
+  uint32_t          index
+)
+{
+  Wait_set_Member *member;
+
+  member = &wait_set->Members[ index ];
+  ( *member->operations->detach )( member );
+
+  /*
+   * The object no longer obtains the member.  Wait for the notifications in
+   * progress on other processors.  They cannot be in progress on this
+   * processor, since thread dispatching is disabled during a notification.
+   */
+  while (
+    _Atomic_Load_uint(
+      &member->notifications_in_progress,
+      ATOMIC_ORDER_ACQUIRE
+    ) != 0
+  ) {
+    /* Wait */
+  }
+
+  _Wait_set_Member_remove( wait_set, index );
+}
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
+/* end of include file */
@@ -69,6 +69,8 @@ extern "C" {
 
 typedef struct Watchdog_Control Watchdog_Control;
 
+typedef struct Watchdog_Wheel Watchdog_Wheel;
+
 /**
  *  @brief Return type from a Watchdog Service Routine.
  *
@@ -98,6 +100,14 @@ typedef struct {
    * case no watchdog is scheduled.
    */
   RBTree_Node *first;
+
+  /**
+   * @brief The timing wheel used instead of the red-black tree to manage the
+   * scheduled watchdogs or NULL in case the red-black tree is used.
+   *
+   * @see _Watchdog_Wheel_initialize().
+   */
+  Watchdog_Wheel *wheel;
 } Watchdog_Header;
 
 /**
@@ -122,6 +132,26 @@ struct Watchdog_Control {
      * on a chain used to manage pending watchdogs by the timer server.
      */
     Chain_Node Chain;
+
+    /**
+     * @brief This field allows this to be placed on a slot of a timing wheel.
+     *
+     * The members overlay the left and right child pointers of the red-black
+     * tree node, so that the watchdog state stored in the node color is
+     * preserved.
+     */
+    struct {
+      /**
+       * @brief This member references the next watchdog of the slot or is NULL.
+       */
+      Watchdog_Control *next;
+
+      /**
+       * @brief This member references the pointer which references this
+       * watchdog.
+       */
+      Watchdog_Control **previous_next;
+    } Wheel;
   } Node;
 
 #if defined(RTEMS_SMP)
@@ -136,6 +166,60 @@ struct Watchdog_Control {
   uint64_t expire;
 };
 
+/**
+ * @brief This constant defines the count of bits of the expiration time used to
+ * select the slot of a timing wheel level.
+ */
+#define WATCHDOG_WHEEL_SLOT_BITS 6
+
+/**
+ * @brief This constant defines the count of slots of a timing wheel level.
+ */
+#define WATCHDOG_WHEEL_SLOT_COUNT ( 1 << WATCHDOG_WHEEL_SLOT_BITS )
+
+/**
+ * @brief This constant defines the count of timing wheel levels.
+ */
+#define WATCHDOG_WHEEL_LEVEL_COUNT 4
+
+/**
+ * @brief A hierarchical timing wheel to manage scheduled watchdogs.
+ *
+ * A watchdog is placed on the level selected by the distance of its
+ * expiration time from the current time of the wheel.  The slots of level
+ * @f$ i @f$ cover @f$ 64^i @f$ ticks each.  When the time passes the range of
+ * a slot of a higher level, the watchdogs of this slot are moved to the lower
+ * levels (cascading).  Watchdogs with an expiration time beyond the range of
+ * the highest level are kept on an overflow list.  The order in which
+ * watchdogs with the same expiration time are processed is unspecified.
+ *
+ * A timing wheel with all members set to zero is a valid empty wheel.
+ */
+struct Watchdog_Wheel {
+  /**
+   * @brief This member contains the time of the last processed tick.
+   */
+  uint64_t now;
+
+  /**
+   * @brief This member contains for each level a bit field which indicates the
+   * non-empty slots.
+   */
+  uint64_t occupied[ WATCHDOG_WHEEL_LEVEL_COUNT ];
+
+  /**
+   * @brief This member contains the first watchdog of each slot.
+   */
+  Watchdog_Control *slots[ WATCHDOG_WHEEL_LEVEL_COUNT ]
+    [ WATCHDOG_WHEEL_SLOT_COUNT ];
+
+  /**
+   * @brief This member references the first watchdog with an expiration time
+   * beyond the range of the highest level.
+   */
+  Watchdog_Control *overflow;
+};
+
 /** @} */
 
 #ifdef __cplusplus
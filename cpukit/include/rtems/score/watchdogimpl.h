@@ -72,6 +72,11 @@ typedef enum {
    */
   WATCHDOG_SCHEDULED_RED,
 
+  /**
+   * @brief The watchdog is scheduled and on a slot of a timing wheel.
+   */
+  WATCHDOG_SCHEDULED_WHEEL,
+
   /**
    * @brief The watchdog is inactive.
    */
@@ -120,6 +125,7 @@ static inline void _Watchdog_Header_initialize(
 {
   _RBTree_Initialize_empty( &header->Watchdogs );
   header->first = NULL;
+  header->wheel = NULL;
 }
 
 /**
@@ -288,6 +294,191 @@ void _Watchdog_Do_tickle(
     _Watchdog_Do_tickle( header, first, now, lock_context )
 #endif
 
+/**
+ * @brief Calls the routine of each expired watchdog of the timing wheel.
+ *
+ * The time of the timing wheel is advanced to @a now.  The slots of the
+ * higher levels are cascaded to the lower levels on demand.
+ *
+ * @param[in, out] wheel is the timing wheel.
+ *
+ * @param now is the current time.  It shall be the time of the timing wheel
+ *   plus one.
+ *
+ * @param lock is the lock which is released before the routine of a watchdog
+ *   is called and acquired afterwards.
+ *
+ * @param lock_context is the lock context used to release and acquire the
+ *   lock.
+ */
+void _Watchdog_Wheel_do_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#if defined(RTEMS_SMP)
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+);
+
+#if defined(RTEMS_SMP)
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Wheel_do_tickle( wheel, now, lock, lock_context )
+#else
+  #define _Watchdog_Wheel_tickle( wheel, now, lock, lock_context ) \
+    _Watchdog_Wheel_do_tickle( wheel, now, lock_context )
+#endif
+
+/**
+ * @brief Inserts the watchdog into the timing wheel.
+ *
+ * The expiration time of the watchdog shall be set.  A watchdog which expires
+ * at or before the time of the timing wheel expires with the next tick.
+ *
+ * @param[in, out] wheel is the timing wheel.
+ *
+ * @param[in, out] the_watchdog is the watchdog to insert.
+ */
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+);
+
+/**
+ * @brief Removes the watchdog from the timing wheel.
+ *
+ * The watchdog shall be on the timing wheel.
+ *
+ * @param[in, out] wheel is the timing wheel.
+ *
+ * @param[in, out] the_watchdog is the watchdog to remove.
+ */
+void _Watchdog_Wheel_remove(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+);
+
+/**
+ * @brief Uses a timing wheel for the ticks based watchdog header of each
+ *   configured processor.
+ *
+ * The timing wheels are provided by _Watchdog_Wheels.  This handler is
+ * registered as a system initialization step by the application
+ * configuration option CONFIGURE_WATCHDOG_TIMING_WHEEL.
+ */
+void _Watchdog_Wheel_initialize( void );
+
+/**
+ * @brief The timing wheels used by _Watchdog_Wheel_initialize().
+ *
+ * This table is defined by the application configuration.  It contains one
+ * timing wheel for each configured processor.
+ */
+extern Watchdog_Wheel _Watchdog_Wheels[];
+
+/**
+ * @brief Programs the clock interrupt of the current processor.
+ *
+ * @param nanoseconds is the time interval in nanoseconds after which the
+ *   clock interrupt shall occur.  An interval of zero shall result in a clock
+ *   interrupt as soon as possible.
+ */
+typedef void ( *Watchdog_Tickless_program )( uint64_t nanoseconds );
+
+/**
+ * @brief The tickless clock operation control.
+ */
+typedef struct {
+  /**
+   * @brief The handler to program the clock interrupt of the current
+   *   processor provided by the Clock Driver.
+   */
+  Watchdog_Tickless_program program;
+
+  /**
+   * @brief The maximum time interval in nanoseconds between two clock
+   *   interrupts of a processor.
+   */
+  uint64_t maximum_nanoseconds;
+
+  /**
+   * @brief The uptime in nanoseconds which corresponds to a watchdog ticks
+   *   value of zero.
+   */
+  uint64_t base_nanoseconds;
+} Watchdog_Tickless_control;
+
+/**
+ * @brief The tickless clock operation control.
+ */
+extern Watchdog_Tickless_control _Watchdog_Tickless;
+
+/**
+ * @brief Indicates if the tickless clock operation is configured.
+ *
+ * This constant is defined by the application configuration option
+ * CONFIGURE_TICKLESS_CLOCK.
+ */
+extern const bool _Watchdog_Tickless_is_configured;
+
+/**
+ * @brief Enables the tickless clock operation.
+ *
+ * This function shall be called by the Clock Driver during its
+ * initialization after the installation of the timecounter.  The Clock
+ * Driver shall call rtems_timecounter_tick() or _Watchdog_Tick() in its clock
+ * interrupt service routine.  The clock interrupts are no longer periodic.
+ * Each processor programs its clock interrupt to the expiration time of its
+ * nearest watchdog.  The watchdog ticks are derived from the uptime and are
+ * caught up in each clock interrupt.
+ *
+ * While a thread with a CPU budget operation executes on a processor, the
+ * clock interrupt occurs at each watchdog tick boundary, so that the
+ * timeslicing is carried out as in the periodic clock operation.
+ *
+ * @param program is the handler to program the clock interrupt of the
+ *   current processor.
+ *
+ * @param maximum_nanoseconds is the maximum time interval in nanoseconds
+ *   supported by the clock interrupt hardware.  The interval is further
+ *   limited so that the timecounter is updated before it overflows.
+ */
+void _Watchdog_Tickless_enable(
+  Watchdog_Tickless_program program,
+  uint64_t                  maximum_nanoseconds
+);
+
+/**
+ * @brief Gets the current watchdog ticks in the tickless clock operation.
+ *
+ * @return Returns the watchdog ticks derived from the uptime.
+ */
+uint64_t _Watchdog_Tickless_get_ticks( void );
+
+/**
+ * @brief Performs a watchdog tick in the tickless clock operation.
+ *
+ * All watchdog ticks since the last clock interrupt of the processor are
+ * caught up.  The expired watchdogs are removed and their routines are
+ * called.  The CPU budget of the executing thread is accounted for each
+ * elapsed watchdog tick.  Afterwards, the clock interrupt of the processor is
+ * programmed to the next watchdog expiration time.
+ *
+ * @param[in, out] cpu is the processor of the clock interrupt.
+ */
+void _Watchdog_Tickless_tick( Per_CPU_Control *cpu );
+
+/**
+ * @brief Updates the clock interrupt of the processor after the insert of a
+ *   new first watchdog.
+ *
+ * The watchdog lock of the processor shall be owned by the caller.  If the
+ * processor is not the current processor, then a job is submitted to the
+ * processor to carry out the update.
+ *
+ * @param[in, out] cpu is the processor of the watchdog.
+ */
+void _Watchdog_Tickless_update( Per_CPU_Control *cpu );
+
 /**
  * @brief Inserts a watchdog into the set of scheduled watchdogs according to
  * the specified expiration time.
@@ -630,6 +821,38 @@ static inline void _Watchdog_Per_CPU_release_critical(
   _ISR_lock_Release( &cpu->Watchdog.Lock, lock_context );
 }
 
+/**
+ * @brief Gets the watchdog ticks of the processor.
+ *
+ * In the tickless clock operation, the watchdog ticks of the processor are
+ * only updated by the clock interrupts, so the current watchdog ticks are
+ * derived from the uptime.
+ *
+ * @param cpu is the processor.
+ *
+ * @return Returns the watchdog ticks of the processor.
+ */
+static inline uint64_t _Watchdog_Per_CPU_get_ticks(
+  const Per_CPU_Control *cpu
+)
+{
+  uint64_t ticks;
+
+  ticks = cpu->Watchdog.ticks;
+
+  if ( RTEMS_PREDICT_FALSE( _Watchdog_Tickless_is_active ) ) {
+    uint64_t now;
+
+    now = _Watchdog_Tickless_get_ticks();
+
+    if ( now > ticks ) {
+      ticks = now;
+    }
+  }
+
+  return ticks;
+}
+
 /**
  * @brief Sets the watchdog's cpu to the given instance and sets its expiration
  *      time to the watchdog expiration time of the cpu plus the ticks.
@@ -655,7 +878,7 @@ static inline uint64_t _Watchdog_Per_CPU_insert_ticks(
   _Watchdog_Set_CPU( the_watchdog, cpu );
 
   _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context );
-  expire = ticks + cpu->Watchdog.ticks;
+  expire = ticks + _Watchdog_Per_CPU_get_ticks( cpu );
   _Watchdog_Insert(header, the_watchdog, expire);
   _Watchdog_Per_CPU_release_critical( cpu, &lock_context );
   return expire;
@@ -107,6 +107,38 @@ extern const uint32_t _Watchdog_Ticks_per_second;
  */
 extern const uint32_t _Watchdog_Ticks_per_timeslice;
 
+/**
+ * @brief Indicates if the tickless clock operation is active.
+ *
+ * This variable is set by _Watchdog_Tickless_enable() during the Clock Driver
+ * initialization.
+ */
+extern bool _Watchdog_Tickless_is_active;
+
+/**
+ * @brief Gets the watchdog ticks since boot in the tickless clock operation.
+ *
+ * @return Returns the watchdog ticks since boot derived from the uptime.
+ */
+Watchdog_Interval _Watchdog_Tickless_get_ticks_since_boot( void );
+
+/**
+ * @brief Gets the watchdog ticks since boot.
+ *
+ * In the tickless clock operation, the clock interrupts do not occur
+ * periodically, so the ticks since boot are derived from the uptime.
+ *
+ * @return Returns the watchdog ticks since boot.
+ */
+static inline Watchdog_Interval _Watchdog_Get_ticks_since_boot( void )
+{
+  if ( RTEMS_PREDICT_FALSE( _Watchdog_Tickless_is_active ) ) {
+    return _Watchdog_Tickless_get_ticks_since_boot();
+  }
+
+  return _Watchdog_Ticks_since_boot;
+}
+
 /** @} */
 
 #ifdef __cplusplus
@@ -100,6 +100,21 @@ struct Heap_Control *_Workspace_Malloc_initialize_unified( void );
  */
 extern struct Heap_Control *( * const _Workspace_Malloc_initializer )( void );
 
+/**
+ * @brief This constant provides the heap initialization handler used for the
+ *   RTEMS Workspace and the separate C Program Heap.
+ *
+ * This constant is defined by the application configuration option
+ * #CONFIGURE_HEAP_SEGREGATED_FIT via <rtems/confdefs.h> or a default
+ * configuration.  The default handler is _Heap_Initialize().
+ */
+extern uintptr_t ( * const _Workspace_Heap_initializer )(
+  struct Heap_Control *,
+  void *,
+  uintptr_t,
+  uintptr_t
+);
+
 /** @} */
 
 #ifdef __cplusplus
@@ -70,7 +70,7 @@ static inline void _Workspace_Initialize_for_multiple_areas( void )
   mem = _Memory_Get();
   page_size = CPU_HEAP_ALIGNMENT;
   remaining = rtems_configuration_get_work_space_size();
-  init_or_extend = _Heap_Initialize;
+  init_or_extend = _Workspace_Heap_initializer;
   unified = rtems_configuration_get_unified_work_area();
   overhead = _Heap_Area_overhead( page_size );
 
@@ -89,7 +89,7 @@ static inline void _Workspace_Initialize_for_one_area( void )
       size = wkspace_size_with_overhead;
     }
 
-    available_size = _Heap_Initialize(
+    available_size = ( *_Workspace_Heap_initializer )(
       &_Workspace_Area,
       _Memory_Get_free_begin( area ),
       size,
@@ -71,6 +71,8 @@ struct rtems_sparse_disk {
   rtems_sparse_disk_delete_handler delete_handler;
   uint8_t                          fill_pattern;
   rtems_sparse_disk_key           *key_table;
+  rtems_chain_control              pending;
+  uint32_t                         pending_count;
 };
 
 /**
@@ -52,6 +52,83 @@
  */
 #define bdbuf_config rtems_bdbuf_configuration
 
+/**
+ * Buffer waiters synchronization.
+ */
+typedef struct rtems_bdbuf_waiters {
+  unsigned                 count;
+  rtems_condition_variable cond_var;
+} rtems_bdbuf_waiters;
+
+/**
+ * A slot of the buffer descriptor lookup hash table. The key is stored in the
+ * slot, so that a lookup does not need to access the BDs of other keys.
+ */
+typedef struct rtems_bdbuf_hash_slot
+{
+  const rtems_disk_device* dd;           /**< Disk device key, NULL for a free
+                                          * slot. */
+  rtems_blkdev_bnum        block;        /**< Block key. */
+  rtems_bdbuf_buffer*      bd;           /**< The BD of the key, NULL for a
+                                          * ghost entry. */
+} rtems_bdbuf_hash_slot;
+
+/**
+ * The key of a block recently evicted from the probationary list of the 2Q
+ * replacement policy.
+ */
+typedef struct rtems_bdbuf_ghost
+{
+  const rtems_disk_device* dd;           /**< Disk device key. */
+  rtems_blkdev_bnum        block;        /**< Block key. */
+} rtems_bdbuf_ghost;
+
+/**
+ * A shard of the BD buffer cache. The groups and BDs of the cache are
+ * partitioned into shards. Each shard has its own lock, lookup table, lists
+ * and waiters, so that operations on buffers of different shards do not
+ * serialize.
+ * The shard of a buffer is selected by its device and a run of consecutive
+ * blocks.
+ */
+typedef struct rtems_bdbuf_shard
+{
+  rtems_mutex         lock;              /**< The shard lock. It locks all
+                                          * shard data, BD and lists. */
+  rtems_bdbuf_hash_slot* hash;           /**< Buffer descriptor lookup hash
+                                          * table using linear probing. There
+                                          * is one per shard. */
+  size_t              hash_mask;         /**< The slot count of the hash table
+                                          * minus one. The slot count is a
+                                          * power of two. */
+  rtems_chain_control lru;               /**< Least recently used list. With
+                                          * the 2Q replacement policy this is
+                                          * the probationary list. */
+  rtems_chain_control hot;               /**< Hot list of the 2Q replacement
+                                          * policy. */
+  size_t              hot_count;         /**< The count of BDs marked hot. */
+  size_t              hot_max;           /**< The maximum count of cached BDs
+                                          * on the hot list. */
+  rtems_bdbuf_ghost*  ghosts;            /**< Ring of the ghost entry keys in
+                                          * eviction order, NULL for the LRU
+                                          * replacement policy. */
+  size_t              ghost_max;         /**< The ghost ring size. */
+  size_t              ghost_head;        /**< The oldest ghost entry. */
+  size_t              ghost_count;       /**< The count of ghost entries. */
+  rtems_bdbuf_cache_stats stats;         /**< The cache statistics. */
+  rtems_chain_control modified;          /**< Modified buffers list */
+  rtems_chain_control sync;              /**< Buffers to sync list */
+
+  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
+                                          * ACCESS_CACHED, ACCESS_MODIFIED or
+                                          * ACCESS_EMPTY
+                                          * state. */
+  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
+                                          * state. */
+  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
+                                          * available. */
+} rtems_bdbuf_shard;
+
 /**
  * A swapout transfer transaction data. This data is passed to a worked thread
  * to handle the write phase of the transfer.
@@ -60,6 +137,7 @@ typedef struct rtems_bdbuf_swapout_transfer
 {
   rtems_chain_control   bds;         /**< The transfer list of BDs. */
   rtems_disk_device    *dd;          /**< The device the transfer is for. */
+  rtems_bdbuf_shard    *shard;       /**< The shard of the BDs. */
   bool                  syncing;     /**< The data is a sync'ing. */
   rtems_blkdev_request  write_req;   /**< The write request. */
 } rtems_bdbuf_swapout_transfer;
@@ -80,12 +158,21 @@ typedef struct rtems_bdbuf_swapout_worker
 } rtems_bdbuf_swapout_worker;
 
 /**
- * Buffer waiters synchronization.
+ * A read-ahead transfer request. The read-ahead task submits requests without
+ * waiting for their completion and finishes them later in submission order.
  */
-typedef struct rtems_bdbuf_waiters {
-  unsigned                 count;
-  rtems_condition_variable cond_var;
-} rtems_bdbuf_waiters;
+typedef struct rtems_bdbuf_read_ahead_request
+{
+  rtems_binary_semaphore done;           /**< Posted when the transfer is
+                                          * done. */
+  rtems_bdbuf_shard*     shard;          /**< The shard of the BDs. */
+  rtems_disk_device*     dd;             /**< The device of the request. */
+  size_t                 size;           /**< The size of this request in the
+                                          * read-ahead request area. */
+  rtems_blkdev_request   req;            /**< The transfer request. It is
+                                          * followed by the scatter/gather
+                                          * buffers and must be last. */
+} rtems_bdbuf_read_ahead_request;
 
 /**
  * The BD buffer cache.
@@ -96,6 +183,8 @@ typedef struct rtems_bdbuf_cache
   bool                swapout_enabled;   /**< Swapout is only running if
                                           * enabled. Set to false to kill the
                                           * swap out task. It deletes itself. */
+  rtems_mutex         swapout_lock;      /**< Protects the free swapout
+                                          * workers chain. */
   rtems_chain_control swapout_free_workers; /**< The work threads for the swapout
                                              * task. */
 
@@ -108,38 +197,39 @@ typedef struct rtems_bdbuf_cache
                                           * buffer size that fit in a group. */
   uint32_t            flags;             /**< Configuration flags. */
 
-  rtems_mutex         lock;              /**< The cache lock. It locks all
-                                          * cache data, BD and lists. */
+  rtems_bdbuf_shard*  shards;            /**< The shards. */
+  size_t              shard_count;       /**< The number of shards. It is a
+                                          * power of two. */
+  size_t              groups_per_shard;  /**< The number of groups of each
+                                          * shard. The last shard takes the
+                                          * remainder. */
+
   rtems_mutex         sync_lock;         /**< Sync calls block writes. */
-  bool                sync_active;       /**< True if a sync is active. */
+  bool                sync_active;       /**< True if a sync is active. All
+                                          * shards must be locked to change
+                                          * the sync state. */
   rtems_id            sync_requester;    /**< The sync requester. */
   rtems_disk_device  *sync_device;       /**< The device to sync and
                                           * BDBUF_INVALID_DEV not a device
                                           * sync. */
 
-  rtems_bdbuf_buffer* tree;              /**< Buffer descriptor lookup AVL tree
-                                          * root. There is only one. */
-  rtems_chain_control lru;               /**< Least recently used list */
-  rtems_chain_control modified;          /**< Modified buffers list */
-  rtems_chain_control sync;              /**< Buffers to sync list */
-
-  rtems_bdbuf_waiters access_waiters;    /**< Wait for a buffer in
-                                          * ACCESS_CACHED, ACCESS_MODIFIED or
-                                          * ACCESS_EMPTY
-                                          * state. */
-  rtems_bdbuf_waiters transfer_waiters;  /**< Wait for a buffer in TRANSFER
-                                          * state. */
-  rtems_bdbuf_waiters buffer_waiters;    /**< Wait for a buffer and no one is
-                                          * available. */
-
   rtems_bdbuf_swapout_transfer *swapout_transfer;
   rtems_bdbuf_swapout_worker *swapout_workers;
 
   size_t              group_count;       /**< The number of groups. */
   rtems_bdbuf_group*  groups;            /**< The groups. */
   rtems_id            read_ahead_task;   /**< Read-ahead task */
+  rtems_mutex         read_ahead_lock;   /**< Protects the read-ahead request
+                                          * chain. */
   rtems_chain_control read_ahead_chain;  /**< Read-ahead request chain */
   bool                read_ahead_enabled; /**< Read-ahead enabled */
+  char*               read_ahead_requests; /**< The read-ahead transfer
+                                          * requests in progress. Only used by
+                                          * the read-ahead task. */
+  size_t              read_ahead_requests_size; /**< The size of the
+                                          * read-ahead request area. */
+  size_t              read_ahead_requests_used; /**< The used size of the
+                                          * read-ahead request area. */
   rtems_status_code   init_status;       /**< The initialization status */
   pthread_once_t      once;
 } rtems_bdbuf_cache;
@@ -185,13 +275,9 @@ static rtems_task rtems_bdbuf_read_ahead_task(rtems_task_argument arg);
  * The Buffer Descriptor cache.
  */
 static rtems_bdbuf_cache bdbuf_cache = {
-  .lock = RTEMS_MUTEX_INITIALIZER(NULL),
+  .swapout_lock = RTEMS_MUTEX_INITIALIZER(NULL),
   .sync_lock = RTEMS_MUTEX_INITIALIZER(NULL),
-  .access_waiters = { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL) },
-  .transfer_waiters = {
-    .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL)
-  },
-  .buffer_waiters = { .cond_var = RTEMS_CONDITION_VARIABLE_INITIALIZER(NULL) },
+  .read_ahead_lock = RTEMS_MUTEX_INITIALIZER(NULL),
   .once = PTHREAD_ONCE_INIT
 };
 
@@ -230,18 +316,30 @@ rtems_bdbuf_show_usage (void)
   uint32_t total = 0;
   uint32_t val;
 
+  size_t   s;
+
   for (group = 0; group < bdbuf_cache.group_count; group++)
     total += bdbuf_cache.groups[group].users;
   printf ("bdbuf:group users=%lu", total);
-  val = rtems_bdbuf_list_count (&bdbuf_cache.lru);
-  printf (", lru=%lu", val);
-  total = val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.modified);
-  printf (", mod=%lu", val);
-  total += val;
-  val = rtems_bdbuf_list_count (&bdbuf_cache.sync);
-  printf (", sync=%lu", val);
-  total += val;
+  total = 0;
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    rtems_bdbuf_shard* shard = &bdbuf_cache.shards[s];
+
+    printf (", shard=%zu", s);
+    val = rtems_bdbuf_list_count (&shard->lru);
+    printf (", lru=%lu", val);
+    total += val;
+    val = rtems_bdbuf_list_count (&shard->hot);
+    printf (", hot=%lu", val);
+    total += val;
+    val = rtems_bdbuf_list_count (&shard->modified);
+    printf (", mod=%lu", val);
+    total += val;
+    val = rtems_bdbuf_list_count (&shard->sync);
+    printf (", sync=%lu", val);
+    total += val;
+  }
   printf (", total=%lu\n", total);
 }
 
@@ -272,12 +370,20 @@ rtems_bdbuf_show_users (const char* where, rtems_bdbuf_buffer* bd)
 #endif
 
 /**
- * The default maximum height of 32 allows for AVL trees having between
- * 5,704,880 and 4,294,967,295 nodes, depending on order of insertion.  You may
- * change this compile-time constant as you wish.
+ * The default shift of 6 maps runs of 64 consecutive blocks of a device to the
+ * same shard.  You may change this compile-time constant as you wish.
  */
-#ifndef RTEMS_BDBUF_AVL_MAX_HEIGHT
-#define RTEMS_BDBUF_AVL_MAX_HEIGHT (32)
+#ifndef RTEMS_BDBUF_SHARD_BLOCK_SHIFT
+#define RTEMS_BDBUF_SHARD_BLOCK_SHIFT (6)
+#endif
+
+/**
+ * The read-ahead task may have this many read-ahead transfer requests of the
+ * maximum read-ahead block count in progress.  Requests with less blocks need
+ * less room.  You may change this compile-time constant as you wish.
+ */
+#ifndef RTEMS_BDBUF_READ_AHEAD_REQUESTS
+#define RTEMS_BDBUF_READ_AHEAD_REQUESTS (4)
 #endif
 
 static void
@@ -294,491 +400,257 @@ rtems_bdbuf_fatal_with_state (rtems_bdbuf_buf_state state,
 }
 
 /**
- * Searches for the node with specified dd/block.
+ * Get the home slot index of the dd/block key in the hash table of the shard.
  *
- * @param root pointer to the root node of the AVL-Tree
- * @param dd disk device search key
- * @param block block search key
- * @retval NULL node with the specified dd/block is not found
- * @return pointer to the node with specified dd/block
+ * @param shard The shard.
+ * @param dd disk device key
+ * @param block block key
+ * @return The slot index.
  */
-static rtems_bdbuf_buffer *
-rtems_bdbuf_avl_search (rtems_bdbuf_buffer** root,
+static size_t
+rtems_bdbuf_hash_index (const rtems_bdbuf_shard *shard,
                         const rtems_disk_device *dd,
-                        rtems_blkdev_bnum    block)
+                        rtems_blkdev_bnum        block)
 {
-  rtems_bdbuf_buffer* p = *root;
+  uint32_t key;
 
-  while ((p != NULL) && ((p->dd != dd) || (p->block != block)))
-  {
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p = p->avl.right;
-    }
-    else
-    {
-      p = p->avl.left;
-    }
-  }
+  key = (uint32_t) (((uintptr_t) dd) >> 4) * UINT32_C (0x85ebca6b);
+  key ^= block;
+  key *= UINT32_C (0x9e3779b1);
+  key ^= key >> 16;
 
-  return p;
+  return key & shard->hash_mask;
 }
 
 /**
- * Inserts the specified node to the AVl-Tree.
+ * Searches for the BD with specified dd/block.
  *
- * @param root pointer to the root node of the AVL-Tree
- * @param node Pointer to the node to add.
- * @retval 0 The node added successfully
- * @retval -1 An error occurred
+ * @param shard The shard to search.
+ * @param dd disk device search key
+ * @param block block search key
+ * @retval NULL BD with the specified dd/block is not found
+ * @return pointer to the BD with specified dd/block
  */
-static int
-rtems_bdbuf_avl_insert(rtems_bdbuf_buffer** root,
-                       rtems_bdbuf_buffer*  node)
+static rtems_bdbuf_buffer *
+rtems_bdbuf_hash_search (const rtems_bdbuf_shard *shard,
+                         const rtems_disk_device *dd,
+                         rtems_blkdev_bnum        block)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
-
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
+  size_t index = rtems_bdbuf_hash_index (shard, dd, block);
 
-  if (p == NULL)
+  while (true)
   {
-    *root = node;
-    node->avl.left = NULL;
-    node->avl.right = NULL;
-    node->avl.bal = 0;
-    return 0;
-  }
+    const rtems_bdbuf_hash_slot *slot = &shard->hash[index];
 
-  while (p != NULL)
-  {
-    *buf_prev++ = p;
+    if (slot->dd == NULL)
+      return NULL;
 
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      q = p->avl.right;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.right = q = node;
-        break;
-      }
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      q = p->avl.left;
-      if (q == NULL)
-      {
-        q = node;
-        p->avl.left = q;
-        break;
-      }
-    }
-    else
-    {
-      return -1;
-    }
+    if (slot->dd == dd && slot->block == block)
+      return slot->bd;
 
-    p = q;
+    index = (index + 1) & shard->hash_mask;
   }
+}
 
-  q->avl.left = q->avl.right = NULL;
-  q->avl.bal = 0;
-  modified = true;
-  buf_prev--;
+/**
+ * Inserts the BD into the hash table. The hash table has at least twice as
+ * many slots as the shard has BDs and ghost entries, so there is always a free
+ * slot.
+ *
+ * @param shard The shard of the BD.
+ * @param bd The BD to insert.
+ * @retval 0 BD inserted
+ * @retval 1 BD inserted in place of a ghost entry with the same dd/block
+ * @retval -1 A BD with the same dd/block is already in the hash table
+ */
+static int
+rtems_bdbuf_hash_insert (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
+{
+  size_t index = rtems_bdbuf_hash_index (shard, bd->dd, bd->block);
 
-  while (modified)
+  while (true)
   {
-    if (p->avl.cache == -1)
-    {
-      switch (p->avl.bal)
-      {
-        case 1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = -1;
-          break;
+    rtems_bdbuf_hash_slot *slot = &shard->hash[index];
 
-        case -1:
-          p1 = p->avl.left;
-          if (p1->avl.bal == -1) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
-            if (p2->avl.bal == -1) p->avl.bal = +1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
+    if (slot->dd == NULL)
     {
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        case 0:
-          p->avl.bal = 1;
-          break;
-
-        case 1:
-          p1 = p->avl.right;
-          if (p1->avl.bal == 1) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-            p->avl.bal = 0;
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = +1; else p1->avl.bal = 0;
-            p = p2;
-          }
-          p->avl.bal = 0;
-          modified = false;
-          break;
-
-        default:
-          break;
-      }
+      slot->dd = bd->dd;
+      slot->block = bd->block;
+      slot->bd = bd;
+      return 0;
     }
-    q = p;
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
 
-      if (p->avl.cache == -1)
-      {
-        p->avl.left = q;
-      }
-      else
-      {
-        p->avl.right = q;
-      }
-    }
-    else
+    if (slot->dd == bd->dd && slot->block == bd->block)
     {
-      *root = p;
-      break;
+      if (slot->bd != NULL)
+        return -1;
+
+      slot->bd = bd;
+      return 1;
     }
-  };
 
-  return 0;
+    index = (index + 1) & shard->hash_mask;
+  }
 }
 
-
 /**
- * Removes the node from the tree.
+ * Removes the entry of the slot from the hash table. The following slots of
+ * the probe sequence are moved backwards, so that no deleted slot markers are
+ * needed.
  *
- * @param root Pointer to pointer to the root node
- * @param node Pointer to the node to remove
- * @retval 0 Item removed
- * @retval -1 No such item found
+ * @param shard The shard.
+ * @param hole The index of the slot to remove.
  */
-static int
-rtems_bdbuf_avl_remove(rtems_bdbuf_buffer**      root,
-                       const rtems_bdbuf_buffer* node)
+static void
+rtems_bdbuf_hash_remove_slot (rtems_bdbuf_shard *shard, size_t hole)
 {
-  const rtems_disk_device *dd = node->dd;
-  rtems_blkdev_bnum block = node->block;
+  size_t mask = shard->hash_mask;
+  size_t index = hole;
 
-  rtems_bdbuf_buffer*  p = *root;
-  rtems_bdbuf_buffer*  q;
-  rtems_bdbuf_buffer*  r;
-  rtems_bdbuf_buffer*  s;
-  rtems_bdbuf_buffer*  p1;
-  rtems_bdbuf_buffer*  p2;
-  rtems_bdbuf_buffer*  buf_stack[RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer** buf_prev = buf_stack;
-
-  bool modified = false;
+  while (true)
+  {
+    rtems_bdbuf_hash_slot *slot;
+    size_t                 home;
 
-  memset (buf_stack, 0, sizeof(buf_stack));
+    index = (index + 1) & mask;
+    slot = &shard->hash[index];
 
-  while (p != NULL)
-  {
-    *buf_prev++ = p;
+    if (slot->dd == NULL)
+      break;
 
-    if (((uintptr_t) p->dd < (uintptr_t) dd)
-        || ((p->dd == dd) && (p->block < block)))
-    {
-      p->avl.cache = 1;
-      p = p->avl.right;
-    }
-    else if ((p->dd != dd) || (p->block != block))
-    {
-      p->avl.cache = -1;
-      p = p->avl.left;
-    }
-    else
+    /*
+     * The slot may fill the hole if its home slot is not cyclically within
+     * the range after the hole up to the slot.
+     */
+    home = rtems_bdbuf_hash_index (shard, slot->dd, slot->block);
+    if (((index - home) & mask) >= ((index - hole) & mask))
     {
-      /* node found */
-      break;
+      shard->hash[hole] = *slot;
+      hole = index;
     }
   }
 
-  if (p == NULL)
-  {
-    /* there is no such node */
-    return -1;
-  }
+  shard->hash[hole].dd = NULL;
+  shard->hash[hole].bd = NULL;
+}
 
-  q = p;
+/**
+ * Get the slot index of the BD in the hash table.
+ *
+ * @param shard The shard of the BD.
+ * @param bd The BD to search.
+ * @param index The slot index of the BD.
+ * @retval 0 BD found
+ * @retval -1 No such BD found
+ */
+static int
+rtems_bdbuf_hash_find (const rtems_bdbuf_shard  *shard,
+                       const rtems_bdbuf_buffer *bd,
+                       size_t                   *index)
+{
+  size_t i = rtems_bdbuf_hash_index (shard, bd->dd, bd->block);
 
-  buf_prev--;
-  if (buf_prev > buf_stack)
-  {
-    p = *(buf_prev - 1);
-  }
-  else
+  while (shard->hash[i].bd != bd)
   {
-    p = NULL;
-  }
+    if (shard->hash[i].dd == NULL)
+      return -1;
 
-  /* at this moment q - is a node to delete, p is q's parent */
-  if (q->avl.right == NULL)
-  {
-    r = q->avl.left;
-    if (r != NULL)
-    {
-      r->avl.bal = 0;
-    }
-    q = r;
+    i = (i + 1) & shard->hash_mask;
   }
-  else
-  {
-    rtems_bdbuf_buffer **t;
 
-    r = q->avl.right;
+  *index = i;
 
-    if (r->avl.left == NULL)
-    {
-      r->avl.left = q->avl.left;
-      r->avl.bal = q->avl.bal;
-      r->avl.cache = 1;
-      *buf_prev++ = q = r;
-    }
-    else
-    {
-      t = buf_prev++;
-      s = r;
+  return 0;
+}
 
-      while (s->avl.left != NULL)
-      {
-        *buf_prev++ = r = s;
-        s = r->avl.left;
-        r->avl.cache = -1;
-      }
+/**
+ * Removes the BD from the hash table.
+ *
+ * @param shard The shard of the BD.
+ * @param bd The BD to remove.
+ * @retval 0 BD removed
+ * @retval -1 No such BD found
+ */
+static int
+rtems_bdbuf_hash_remove (rtems_bdbuf_shard *shard, const rtems_bdbuf_buffer *bd)
+{
+  size_t index;
 
-      s->avl.left = q->avl.left;
-      r->avl.left = s->avl.right;
-      s->avl.right = q->avl.right;
-      s->avl.bal = q->avl.bal;
-      s->avl.cache = 1;
+  if (rtems_bdbuf_hash_find (shard, bd, &index) != 0)
+    return -1;
 
-      *t = q = s;
-    }
-  }
+  rtems_bdbuf_hash_remove_slot (shard, index);
 
-  if (p != NULL)
-  {
-    if (p->avl.cache == -1)
-    {
-      p->avl.left = q;
-    }
-    else
-    {
-      p->avl.right = q;
-    }
-  }
-  else
-  {
-    *root = q;
-  }
+  return 0;
+}
 
-  modified = true;
+/**
+ * Removes the ghost entry with the specified dd/block from the hash table. A
+ * BD which took over the entry is not removed.
+ *
+ * @param shard The shard of the ghost entry.
+ * @param ghost The ghost entry key.
+ */
+static void
+rtems_bdbuf_hash_remove_ghost (rtems_bdbuf_shard       *shard,
+                               const rtems_bdbuf_ghost *ghost)
+{
+  size_t index = rtems_bdbuf_hash_index (shard, ghost->dd, ghost->block);
 
-  while (modified)
+  while (true)
   {
-    if (buf_prev > buf_stack)
-    {
-      p = *--buf_prev;
-    }
-    else
-    {
-      break;
-    }
-
-    if (p->avl.cache == -1)
-    {
-      /* rebalance left branch */
-      switch (p->avl.bal)
-      {
-        case -1:
-          p->avl.bal = 0;
-          break;
-        case  0:
-          p->avl.bal = 1;
-          modified = false;
-          break;
+    const rtems_bdbuf_hash_slot *slot = &shard->hash[index];
 
-        case +1:
-          p1 = p->avl.right;
+    if (slot->dd == NULL)
+      return;
 
-          if (p1->avl.bal >= 0) /* simple RR-turn */
-          {
-            p->avl.right = p1->avl.left;
-            p1->avl.left = p;
-
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = -1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double RL-turn */
-          {
-            p2 = p1->avl.left;
-
-            p1->avl.left = p2->avl.right;
-            p2->avl.right = p1;
-            p->avl.right = p2->avl.left;
-            p2->avl.left = p;
-
-            if (p2->avl.bal == +1) p->avl.bal = -1; else p->avl.bal = 0;
-            if (p2->avl.bal == -1) p1->avl.bal = 1; else p1->avl.bal = 0;
-
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
-
-        default:
-          break;
-      }
-    }
-    else
+    if (slot->dd == ghost->dd && slot->block == ghost->block)
     {
-      /* rebalance right branch */
-      switch (p->avl.bal)
-      {
-        case +1:
-          p->avl.bal = 0;
-          break;
-
-        case  0:
-          p->avl.bal = -1;
-          modified = false;
-          break;
-
-        case -1:
-          p1 = p->avl.left;
-
-          if (p1->avl.bal <= 0) /* simple LL-turn */
-          {
-            p->avl.left = p1->avl.right;
-            p1->avl.right = p;
-            if (p1->avl.bal == 0)
-            {
-              p1->avl.bal = 1;
-              modified = false;
-            }
-            else
-            {
-              p->avl.bal = 0;
-              p1->avl.bal = 0;
-            }
-            p = p1;
-          }
-          else /* double LR-turn */
-          {
-            p2 = p1->avl.right;
-
-            p1->avl.right = p2->avl.left;
-            p2->avl.left = p1;
-            p->avl.left = p2->avl.right;
-            p2->avl.right = p;
+      if (slot->bd == NULL)
+        rtems_bdbuf_hash_remove_slot (shard, index);
 
-            if (p2->avl.bal == -1) p->avl.bal = 1; else p->avl.bal = 0;
-            if (p2->avl.bal == +1) p1->avl.bal = -1; else p1->avl.bal = 0;
+      return;
+    }
 
-            p = p2;
-            p2->avl.bal = 0;
-          }
-          break;
+    index = (index + 1) & shard->hash_mask;
+  }
+}
 
-        default:
-          break;
-      }
-    }
+/**
+ * Turns the hash table entry of the BD into a ghost entry and appends its key
+ * to the ghost ring. If the ring is full, then the oldest ghost entry is
+ * removed.
+ *
+ * @param shard The shard of the BD.
+ * @param bd The BD evicted from the probationary list.
+ * @retval 0 Ghost entry added
+ * @retval -1 No such BD found
+ */
+static int
+rtems_bdbuf_hash_make_ghost (rtems_bdbuf_shard *shard,
+                             const rtems_bdbuf_buffer *bd)
+{
+  rtems_bdbuf_ghost *ghost;
+  size_t             index;
 
-    if (buf_prev > buf_stack)
-    {
-      q = *(buf_prev - 1);
+  if (rtems_bdbuf_hash_find (shard, bd, &index) != 0)
+    return -1;
 
-      if (q->avl.cache == -1)
-      {
-        q->avl.left = p;
-      }
-      else
-      {
-        q->avl.right = p;
-      }
-    }
-    else
-    {
-      *root = p;
-      break;
-    }
+  shard->hash[index].bd = NULL;
 
+  if (shard->ghost_count == shard->ghost_max)
+  {
+    rtems_bdbuf_hash_remove_ghost (shard, &shard->ghosts[shard->ghost_head]);
+    shard->ghost_head = (shard->ghost_head + 1) % shard->ghost_max;
+    --shard->ghost_count;
   }
 
+  ghost = &shard->ghosts[(shard->ghost_head + shard->ghost_count)
+                         % shard->ghost_max];
+  ghost->dd = bd->dd;
+  ghost->block = bd->block;
+  ++shard->ghost_count;
+
   return 0;
 }
 
@@ -825,12 +697,97 @@ rtems_bdbuf_unlock (rtems_mutex *lock)
 }
 
 /**
- * Lock the cache. A single task can nest calls.
+ * Get the shard of a block of a device. Runs of consecutive blocks map to the
+ * same shard, so that multiple block transfers of the read-ahead and swapout
+ * tasks stay within one shard.
+ *
+ * @param dd The disk device.
+ * @param block The block number relative to the disk device.
+ * @return The shard.
+ */
+static rtems_bdbuf_shard*
+rtems_bdbuf_shard_for (const rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  uint32_t key;
+
+  key = (uint32_t) (((uintptr_t) dd) >> 4)
+    ^ (block >> RTEMS_BDBUF_SHARD_BLOCK_SHIFT);
+  key *= UINT32_C (0x9e3779b1);
+
+  return &bdbuf_cache.shards[(key >> 16) & (bdbuf_cache.shard_count - 1)];
+}
+
+/**
+ * Get the shard which owns the BD.
+ *
+ * @param bd The BD.
+ * @return The shard.
+ */
+static rtems_bdbuf_shard*
+rtems_bdbuf_shard_of (const rtems_bdbuf_buffer *bd)
+{
+  size_t index =
+    (size_t) (bd->group - bdbuf_cache.groups) / bdbuf_cache.groups_per_shard;
+
+  if (index >= bdbuf_cache.shard_count)
+    index = bdbuf_cache.shard_count - 1;
+
+  return &bdbuf_cache.shards[index];
+}
+
+/**
+ * Get the count of blocks starting with the block which map to the same shard
+ * as the block. With a single shard all blocks map to the same shard and the
+ * count is not limited.
+ *
+ * @param block The block number relative to the disk device.
+ * @return The block count.
+ */
+static uint32_t
+rtems_bdbuf_shard_blocks_left (rtems_blkdev_bnum block)
+{
+  rtems_blkdev_bnum run_size = (rtems_blkdev_bnum) 1
+    << RTEMS_BDBUF_SHARD_BLOCK_SHIFT;
+
+  if (bdbuf_cache.shard_count == 1)
+    return UINT32_MAX;
+
+  return run_size - (block & (run_size - 1));
+}
+
+/**
+ * Lock the shard.
+ *
+ * @param shard The shard to lock.
+ */
+static void
+rtems_bdbuf_lock_shard (rtems_bdbuf_shard *shard)
+{
+  rtems_bdbuf_lock (&shard->lock);
+}
+
+/**
+ * Unlock the shard.
+ *
+ * @param shard The shard to unlock.
+ */
+static void
+rtems_bdbuf_unlock_shard (rtems_bdbuf_shard *shard)
+{
+  rtems_bdbuf_unlock (&shard->lock);
+}
+
+/**
+ * Lock the cache. This locks all shards in ascending order. While a shard is
+ * locked, no other shard with a lower index may be locked.
  */
 static void
 rtems_bdbuf_lock_cache (void)
 {
-  rtems_bdbuf_lock (&bdbuf_cache.lock);
+  size_t s;
+
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+    rtems_bdbuf_lock_shard (&bdbuf_cache.shards[s]);
 }
 
 /**
@@ -839,7 +796,55 @@ rtems_bdbuf_lock_cache (void)
 static void
 rtems_bdbuf_unlock_cache (void)
 {
-  rtems_bdbuf_unlock (&bdbuf_cache.lock);
+  size_t s = bdbuf_cache.shard_count;
+
+  while (s > 0)
+  {
+    --s;
+    rtems_bdbuf_unlock_shard (&bdbuf_cache.shards[s]);
+  }
+}
+
+/**
+ * Lock the statistics and read-ahead control of the device. A shard may be
+ * locked by the caller.
+ *
+ * @param dd The disk device.
+ */
+static void
+rtems_bdbuf_lock_device (rtems_disk_device *dd)
+{
+  rtems_bdbuf_lock (&dd->lock);
+}
+
+/**
+ * Unlock the statistics and read-ahead control of the device.
+ *
+ * @param dd The disk device.
+ */
+static void
+rtems_bdbuf_unlock_device (rtems_disk_device *dd)
+{
+  rtems_bdbuf_unlock (&dd->lock);
+}
+
+/**
+ * Lock the read-ahead request chain. The device of the request may be locked
+ * by the caller.
+ */
+static void
+rtems_bdbuf_lock_read_ahead (void)
+{
+  rtems_bdbuf_lock (&bdbuf_cache.read_ahead_lock);
+}
+
+/**
+ * Unlock the read-ahead request chain.
+ */
+static void
+rtems_bdbuf_unlock_read_ahead (void)
+{
+  rtems_bdbuf_unlock (&bdbuf_cache.read_ahead_lock);
 }
 
 /**
@@ -884,28 +889,31 @@ rtems_bdbuf_group_release (rtems_bdbuf_buffer *bd)
  *
  * A counter is used to save the release call when no one is waiting.
  *
- * The function assumes the cache is locked on entry and it will be locked on
+ * The function assumes the shard is locked on entry and it will be locked on
  * exit.
  */
 static void
-rtems_bdbuf_anonymous_wait (rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_anonymous_wait (rtems_bdbuf_shard   *shard,
+                            rtems_bdbuf_waiters *waiters)
 {
   /*
    * Indicate we are waiting.
    */
   ++waiters->count;
 
-  rtems_condition_variable_wait (&waiters->cond_var, &bdbuf_cache.lock);
+  rtems_condition_variable_wait (&waiters->cond_var, &shard->lock);
 
   --waiters->count;
 }
 
 static void
-rtems_bdbuf_wait (rtems_bdbuf_buffer *bd, rtems_bdbuf_waiters *waiters)
+rtems_bdbuf_wait (rtems_bdbuf_shard   *shard,
+                  rtems_bdbuf_buffer  *bd,
+                  rtems_bdbuf_waiters *waiters)
 {
   rtems_bdbuf_group_obtain (bd);
   ++bd->waiters;
-  rtems_bdbuf_anonymous_wait (waiters);
+  rtems_bdbuf_anonymous_wait (shard, waiters);
   --bd->waiters;
   rtems_bdbuf_group_release (bd);
 }
@@ -933,21 +941,65 @@ rtems_bdbuf_wake_swapper (void)
 }
 
 static bool
-rtems_bdbuf_has_buffer_waiters (void)
+rtems_bdbuf_has_buffer_waiters (const rtems_bdbuf_shard *shard)
+{
+  return shard->buffer_waiters.count;
+}
+
+/**
+ * Count a block read by a read-ahead transfer which is removed from the cache
+ * or overwritten without a read access. The device shall not be locked by the
+ * caller.
+ */
+static void
+rtems_bdbuf_read_ahead_wasted (rtems_bdbuf_buffer *bd)
 {
-  return bdbuf_cache.buffer_waiters.count;
+  rtems_disk_device *dd = bd->dd;
+
+  bd->read_ahead = false;
+
+  rtems_bdbuf_lock_device (dd);
+  ++dd->stats.read_ahead_waste;
+  rtems_bdbuf_unlock_device (dd);
 }
 
 static void
 rtems_bdbuf_remove_from_tree (rtems_bdbuf_buffer *bd)
 {
-  if (rtems_bdbuf_avl_remove (&bdbuf_cache.tree, bd) != 0)
+  if (bd->read_ahead)
+    rtems_bdbuf_read_ahead_wasted (bd);
+
+  if (rtems_bdbuf_hash_remove (rtems_bdbuf_shard_of (bd), bd) != 0)
     rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
 }
 
+/**
+ * Mark the BD hot. It moves to the hot list of the 2Q replacement policy once
+ * it is cached.
+ */
+static void
+rtems_bdbuf_set_hot (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
+{
+  bd->hot = true;
+  ++shard->hot_count;
+  ++shard->stats.promotions;
+}
+
+static void
+rtems_bdbuf_clear_hot (rtems_bdbuf_buffer *bd)
+{
+  if (bd->hot)
+  {
+    bd->hot = false;
+    --rtems_bdbuf_shard_of (bd)->hot_count;
+  }
+}
+
 static void
 rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_clear_hot (bd);
+
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_FREE:
@@ -962,11 +1014,42 @@ rtems_bdbuf_remove_from_tree_and_lru_list (rtems_bdbuf_buffer *bd)
   rtems_chain_extract_unprotected (&bd->link);
 }
 
+/**
+ * Evict a CACHED or FREE BD from its list so that it can be recycled. With
+ * the 2Q replacement policy the key of a cached BD evicted from the
+ * probationary list is remembered as a ghost entry. A BD read ahead but never
+ * accessed leaves no ghost entry, so that a stream read once does not
+ * promote its blocks.
+ *
+ * @param shard The shard of the BD.
+ * @param bd The BD to evict.
+ */
+static void
+rtems_bdbuf_evict (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
+{
+  if (bd->state == RTEMS_BDBUF_STATE_CACHED)
+  {
+    ++shard->stats.evictions;
+
+    if (shard->ghosts != NULL && !bd->hot && !bd->read_ahead)
+    {
+      if (rtems_bdbuf_hash_make_ghost (shard, bd) != 0)
+        rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_TREE_RM);
+
+      rtems_chain_extract_unprotected (&bd->link);
+      return;
+    }
+  }
+
+  rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+}
+
 static void
 rtems_bdbuf_make_free_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_clear_hot (bd);
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_FREE);
-  rtems_chain_prepend_unprotected (&bdbuf_cache.lru, &bd->link);
+  rtems_chain_prepend_unprotected (&rtems_bdbuf_shard_of (bd)->lru, &bd->link);
 }
 
 static void
@@ -975,11 +1058,33 @@ rtems_bdbuf_make_empty (rtems_bdbuf_buffer *bd)
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_EMPTY);
 }
 
+/**
+ * Make the BD cached. A hot BD is appended to the hot list, otherwise it is
+ * appended to the LRU list. If the hot list exceeds its share of the shard,
+ * then its least recently used BD is demoted to the LRU list.
+ */
 static void
 rtems_bdbuf_make_cached_and_add_to_lru_list (rtems_bdbuf_buffer *bd)
 {
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_of (bd);
+
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_CACHED);
-  rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+
+  if (bd->hot)
+  {
+    rtems_chain_append_unprotected (&shard->hot, &bd->link);
+
+    if (shard->hot_count > shard->hot_max)
+    {
+      rtems_bdbuf_buffer *cold =
+        (rtems_bdbuf_buffer *) rtems_chain_get_first_unprotected (&shard->hot);
+
+      rtems_bdbuf_clear_hot (cold);
+      rtems_chain_append_unprotected (&shard->lru, &cold->link);
+    }
+  }
+  else
+    rtems_chain_append_unprotected (&shard->lru, &bd->link);
 }
 
 static void
@@ -995,11 +1100,12 @@ rtems_bdbuf_discard_buffer (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_shard  *shard,
+                                               rtems_bdbuf_buffer *bd)
 {
   if (bdbuf_cache.sync_active && bdbuf_cache.sync_device == bd->dd)
   {
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock_shard (shard);
 
     /*
      * Wait for the sync lock.
@@ -1007,7 +1113,7 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     rtems_bdbuf_lock_sync ();
 
     rtems_bdbuf_unlock_sync ();
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock_shard (shard);
   }
 
   /*
@@ -1026,24 +1132,25 @@ rtems_bdbuf_add_to_modified_list_after_access (rtems_bdbuf_buffer *bd)
     bd->hold_timer = bdbuf_config.swap_block_hold;
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_MODIFIED);
-  rtems_chain_append_unprotected (&bdbuf_cache.modified, &bd->link);
+  rtems_chain_append_unprotected (&shard->modified, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
-  else if (rtems_bdbuf_has_buffer_waiters ())
+    rtems_bdbuf_wake (&shard->access_waiters);
+  else if (rtems_bdbuf_has_buffer_waiters (shard))
     rtems_bdbuf_wake_swapper ();
 }
 
 static void
-rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_add_to_lru_list_after_access (rtems_bdbuf_shard  *shard,
+                                          rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_group_release (bd);
   rtems_bdbuf_make_cached_and_add_to_lru_list (bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 /**
@@ -1071,28 +1178,32 @@ rtems_bdbuf_bds_per_group (size_t size)
 }
 
 static void
-rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_discard_buffer_after_access (rtems_bdbuf_shard  *shard,
+                                         rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_group_release (bd);
   rtems_bdbuf_discard_buffer (bd);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
   else
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 /**
  * Reallocate a group. The BDs currently allocated in the group are removed
- * from the ALV tree and any lists then the new BD's are prepended to the ready
+ * from the hash table and any lists then the new BD's are prepended to the ready
  * list of the cache.
  *
+ * @param shard The shard of the group.
  * @param group The group to reallocate.
  * @param new_bds_per_group The new count of BDs per group.
  * @return A buffer of this group.
  */
 static rtems_bdbuf_buffer *
-rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
+rtems_bdbuf_group_realloc (rtems_bdbuf_shard* shard,
+                           rtems_bdbuf_group* group,
+                           size_t             new_bds_per_group)
 {
   rtems_bdbuf_buffer* bd;
   size_t              b;
@@ -1119,35 +1230,49 @@ rtems_bdbuf_group_realloc (rtems_bdbuf_group* group, size_t new_bds_per_group)
     rtems_bdbuf_make_free_and_add_to_lru_list (bd);
 
   if (b > 1)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 
   return group->bdbuf;
 }
 
 static void
-rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_buffer *bd,
+rtems_bdbuf_setup_empty_buffer (rtems_bdbuf_shard  *shard,
+                                rtems_bdbuf_buffer *bd,
                                 rtems_disk_device  *dd,
                                 rtems_blkdev_bnum   block)
 {
   bd->dd        = dd ;
   bd->block     = block;
-  bd->avl.left  = NULL;
-  bd->avl.right = NULL;
   bd->waiters   = 0;
+  bd->read_ahead = false;
 
-  if (rtems_bdbuf_avl_insert (&bdbuf_cache.tree, bd) != 0)
-    rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
+  switch (rtems_bdbuf_hash_insert (shard, bd))
+  {
+    case 0:
+      break;
+    case 1:
+      /*
+       * The block was evicted from the probationary list a short time ago, so
+       * it is referenced again and promoted to the hot list.
+       */
+      rtems_bdbuf_set_hot (shard, bd);
+      break;
+    default:
+      rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RECYCLE);
+  }
 
   rtems_bdbuf_make_empty (bd);
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
-                                      rtems_blkdev_bnum  block)
+rtems_bdbuf_get_buffer_from_list (rtems_bdbuf_shard   *shard,
+                                  rtems_chain_control *list,
+                                  rtems_disk_device   *dd,
+                                  rtems_blkdev_bnum    block)
 {
-  rtems_chain_node *node = rtems_chain_first (&bdbuf_cache.lru);
+  rtems_chain_node *node = rtems_chain_first (list);
 
-  while (!rtems_chain_is_tail (&bdbuf_cache.lru, node))
+  while (!rtems_chain_is_tail (list, node))
   {
     rtems_bdbuf_buffer *bd = (rtems_bdbuf_buffer *) node;
     rtems_bdbuf_buffer *empty_bd = NULL;
@@ -1165,17 +1290,18 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
     {
       if (bd->group->bds_per_group == dd->bds_per_group)
       {
-        rtems_bdbuf_remove_from_tree_and_lru_list (bd);
+        rtems_bdbuf_evict (shard, bd);
 
         empty_bd = bd;
       }
       else if (bd->group->users == 0)
-        empty_bd = rtems_bdbuf_group_realloc (bd->group, dd->bds_per_group);
+        empty_bd = rtems_bdbuf_group_realloc (shard, bd->group,
+                                              dd->bds_per_group);
     }
 
     if (empty_bd != NULL)
     {
-      rtems_bdbuf_setup_empty_buffer (empty_bd, dd, block);
+      rtems_bdbuf_setup_empty_buffer (shard, empty_bd, dd, block);
 
       return empty_bd;
     }
@@ -1186,6 +1312,26 @@ rtems_bdbuf_get_buffer_from_lru_list (rtems_disk_device *dd,
   return NULL;
 }
 
+/**
+ * Get a BD for the block. The LRU list is searched first. With the 2Q
+ * replacement policy the hot list is searched if no BD of the LRU list can be
+ * recycled.
+ */
+static rtems_bdbuf_buffer *
+rtems_bdbuf_get_buffer_from_lru_list (rtems_bdbuf_shard *shard,
+                                      rtems_disk_device *dd,
+                                      rtems_blkdev_bnum  block)
+{
+  rtems_bdbuf_buffer *bd;
+
+  bd = rtems_bdbuf_get_buffer_from_list (shard, &shard->lru, dd, block);
+
+  if (bd == NULL && shard->ghosts != NULL)
+    bd = rtems_bdbuf_get_buffer_from_list (shard, &shard->hot, dd, block);
+
+  return bd;
+}
+
 static rtems_status_code
 rtems_bdbuf_create_task(
   rtems_name name,
@@ -1233,6 +1379,7 @@ rtems_bdbuf_swapout_transfer_init (rtems_bdbuf_swapout_transfer* transfer,
 {
   rtems_chain_initialize_empty (&transfer->bds);
   transfer->dd = BDBUF_INVALID_DEV;
+  transfer->shard = NULL;
   transfer->syncing = false;
   transfer->write_req.req = RTEMS_BLKDEV_REQ_WRITE;
   transfer->write_req.done = rtems_bdbuf_transfer_done;
@@ -1296,6 +1443,92 @@ rtems_bdbuf_read_request_size (uint32_t transfer_count)
     + sizeof (rtems_blkdev_sg_buffer) * transfer_count;
 }
 
+static size_t
+rtems_bdbuf_read_ahead_request_size (uint32_t transfer_count)
+{
+  return RTEMS_ALIGN_UP (sizeof (rtems_bdbuf_read_ahead_request)
+                           + sizeof (rtems_blkdev_sg_buffer) * transfer_count,
+                         RTEMS_ALIGNOF (rtems_bdbuf_read_ahead_request));
+}
+
+/**
+ * Compute the number of shards. It is the configured shard count rounded down
+ * to a power of two, so that each shard has at least one group.
+ *
+ * @param group_count The number of groups of the cache.
+ */
+static size_t
+rtems_bdbuf_shard_count (size_t group_count)
+{
+  size_t shard_count = 1;
+
+  while (shard_count * 2 <= bdbuf_config.shard_count
+         && shard_count * 2 <= group_count)
+    shard_count *= 2;
+
+  return shard_count;
+}
+
+static void
+rtems_bdbuf_shard_init (rtems_bdbuf_shard *shard)
+{
+  rtems_mutex_init (&shard->lock, "bdbuf lock");
+  rtems_chain_initialize_empty (&shard->lru);
+  rtems_chain_initialize_empty (&shard->hot);
+  rtems_chain_initialize_empty (&shard->modified);
+  rtems_chain_initialize_empty (&shard->sync);
+  rtems_condition_variable_init (&shard->access_waiters.cond_var,
+                                 "bdbuf access");
+  rtems_condition_variable_init (&shard->transfer_waiters.cond_var,
+                                 "bdbuf transfer");
+  rtems_condition_variable_init (&shard->buffer_waiters.cond_var,
+                                 "bdbuf buffer");
+}
+
+/**
+ * Allocate the lookup hash table of the shard. The slot count is a power of
+ * two and at least twice the count of buffer descriptors and ghost entries in
+ * the shard, so that the load factor of the table stays at or below one half.
+ * With the 2Q replacement policy, the ghost ring remembers up to half as many
+ * evicted blocks as the shard has buffer descriptors and the hot list may
+ * take three quarters of the buffer descriptors.
+ *
+ * @param shard The shard.
+ * @param bd_count The maximum count of buffer descriptors in the shard.
+ *
+ * @retval true Successful operation.
+ * @retval false Out of memory.
+ */
+static bool
+rtems_bdbuf_shard_hash_alloc (rtems_bdbuf_shard *shard, size_t bd_count)
+{
+  size_t slot_count = 2;
+
+  if (bdbuf_config.replacement_policy == RTEMS_BDBUF_POLICY_2Q)
+  {
+    shard->ghost_max = bd_count / 2;
+    if (shard->ghost_max == 0)
+      shard->ghost_max = 1;
+
+    shard->ghosts = calloc (sizeof (rtems_bdbuf_ghost), shard->ghost_max);
+    if (shard->ghosts == NULL)
+      return false;
+
+    shard->hot_max = bd_count - bd_count / 4;
+  }
+
+  while (slot_count < 2 * (bd_count + shard->ghost_max))
+    slot_count *= 2;
+
+  shard->hash = calloc (sizeof (rtems_bdbuf_hash_slot), slot_count);
+  if (shard->hash == NULL)
+    return false;
+
+  shard->hash_mask = slot_count - 1;
+
+  return true;
+}
+
 static rtems_status_code
 rtems_bdbuf_do_init (void)
 {
@@ -1303,6 +1536,7 @@ rtems_bdbuf_do_init (void)
   rtems_bdbuf_buffer* bd;
   uint8_t*            buffer;
   size_t              b;
+  size_t              shard_count;
   rtems_status_code   sc;
 
   if (rtems_bdbuf_tracer)
@@ -1325,21 +1559,11 @@ rtems_bdbuf_do_init (void)
   bdbuf_cache.sync_device = BDBUF_INVALID_DEV;
 
   rtems_chain_initialize_empty (&bdbuf_cache.swapout_free_workers);
-  rtems_chain_initialize_empty (&bdbuf_cache.lru);
-  rtems_chain_initialize_empty (&bdbuf_cache.modified);
-  rtems_chain_initialize_empty (&bdbuf_cache.sync);
   rtems_chain_initialize_empty (&bdbuf_cache.read_ahead_chain);
 
-  rtems_mutex_set_name (&bdbuf_cache.lock, "bdbuf lock");
+  rtems_mutex_set_name (&bdbuf_cache.swapout_lock, "bdbuf swapout lock");
   rtems_mutex_set_name (&bdbuf_cache.sync_lock, "bdbuf sync lock");
-  rtems_condition_variable_set_name (&bdbuf_cache.access_waiters.cond_var,
-                                     "bdbuf access");
-  rtems_condition_variable_set_name (&bdbuf_cache.transfer_waiters.cond_var,
-                                     "bdbuf transfer");
-  rtems_condition_variable_set_name (&bdbuf_cache.buffer_waiters.cond_var,
-                                     "bdbuf buffer");
-
-  rtems_bdbuf_lock_cache ();
+  rtems_mutex_set_name (&bdbuf_cache.read_ahead_lock, "bdbuf read-ahead lock");
 
   /*
    * Compute the various number of elements in the cache.
@@ -1351,6 +1575,42 @@ rtems_bdbuf_do_init (void)
   bdbuf_cache.group_count =
     bdbuf_cache.buffer_min_count / bdbuf_cache.max_bds_per_group;
 
+  /*
+   * Allocate and initialise the shards. The groups are evenly distributed to
+   * the shards.
+   */
+  shard_count = rtems_bdbuf_shard_count (bdbuf_cache.group_count);
+  bdbuf_cache.shards = calloc (sizeof (rtems_bdbuf_shard), shard_count);
+  if (!bdbuf_cache.shards)
+    goto error;
+
+  for (b = 0; b < shard_count; b++)
+    rtems_bdbuf_shard_init (&bdbuf_cache.shards[b]);
+
+  bdbuf_cache.shard_count = shard_count;
+  bdbuf_cache.groups_per_shard = bdbuf_cache.group_count / shard_count;
+  if (bdbuf_cache.groups_per_shard == 0)
+    bdbuf_cache.groups_per_shard = 1;
+
+  rtems_bdbuf_lock_cache ();
+
+  /*
+   * Allocate the lookup hash tables. The last shard takes the remainder of
+   * the groups.
+   */
+  for (b = 0; b < shard_count; b++)
+  {
+    size_t group_count = bdbuf_cache.groups_per_shard;
+
+    if (b == shard_count - 1)
+      group_count = bdbuf_cache.group_count - b * bdbuf_cache.groups_per_shard;
+
+    if (!rtems_bdbuf_shard_hash_alloc (&bdbuf_cache.shards[b],
+                                       group_count
+                                       * bdbuf_cache.max_bds_per_group))
+      goto error;
+  }
+
   /*
    * Allocate the memory for the buffer descriptors.
    */
@@ -1390,7 +1650,8 @@ rtems_bdbuf_do_init (void)
     bd->group  = group;
     bd->buffer = buffer;
 
-    rtems_chain_append_unprotected (&bdbuf_cache.lru, &bd->link);
+    rtems_chain_append_unprotected (&rtems_bdbuf_shard_of (bd)->lru,
+                                    &bd->link);
 
     if ((b % bdbuf_cache.max_bds_per_group) ==
         (bdbuf_cache.max_bds_per_group - 1))
@@ -1443,6 +1704,13 @@ rtems_bdbuf_do_init (void)
 
   if (bdbuf_config.max_read_ahead_blocks > 0)
   {
+    bdbuf_cache.read_ahead_requests_size = RTEMS_BDBUF_READ_AHEAD_REQUESTS
+      * rtems_bdbuf_read_ahead_request_size (bdbuf_config.max_read_ahead_blocks);
+    bdbuf_cache.read_ahead_requests =
+      calloc (1, bdbuf_cache.read_ahead_requests_size);
+    if (!bdbuf_cache.read_ahead_requests)
+      goto error;
+
     bdbuf_cache.read_ahead_enabled = true;
     sc = rtems_bdbuf_create_task (rtems_build_name('B', 'R', 'D', 'A'),
                                   bdbuf_config.read_ahead_priority,
@@ -1488,6 +1756,7 @@ error:
     }
   }
 
+  free (bdbuf_cache.read_ahead_requests);
   free (bdbuf_cache.buffers);
   free (bdbuf_cache.groups);
   free (bdbuf_cache.bds);
@@ -1496,6 +1765,16 @@ error:
 
   rtems_bdbuf_unlock_cache ();
 
+  for (b = 0; b < bdbuf_cache.shard_count; b++)
+  {
+    free (bdbuf_cache.shards[b].hash);
+    free (bdbuf_cache.shards[b].ghosts);
+  }
+
+  free (bdbuf_cache.shards);
+  bdbuf_cache.shards = NULL;
+  bdbuf_cache.shard_count = 0;
+
   return RTEMS_UNSATISFIED;
 }
 
@@ -1543,7 +1822,7 @@ rtems_bdbuf_wait_for_transient_event (void)
 }
 
 static void
-rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_access (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
 {
   while (true)
   {
@@ -1561,12 +1840,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_7);
@@ -1575,11 +1854,12 @@ rtems_bdbuf_wait_for_access (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_shard  *shard,
+                                              rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
   rtems_chain_extract_unprotected (&bd->link);
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&shard->sync, &bd->link);
   rtems_bdbuf_wake_swapper ();
 }
 
@@ -1590,7 +1870,7 @@ rtems_bdbuf_request_sync_for_modified_buffer (rtems_bdbuf_buffer *bd)
  * @retval @c false Buffer is invalid and has to searched again.
  */
 static bool
-rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_recycle (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
 {
   while (true)
   {
@@ -1599,7 +1879,7 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_FREE:
         return true;
       case RTEMS_BDBUF_STATE_MODIFIED:
-        rtems_bdbuf_request_sync_for_modified_buffer (bd);
+        rtems_bdbuf_request_sync_for_modified_buffer (shard, bd);
         break;
       case RTEMS_BDBUF_STATE_CACHED:
       case RTEMS_BDBUF_STATE_EMPTY:
@@ -1613,19 +1893,19 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
            * pong with another recycle waiter.  The state of the buffer is
            * arbitrary afterwards.
            */
-          rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_anonymous_wait (shard, &shard->buffer_waiters);
           return false;
         }
       case RTEMS_BDBUF_STATE_ACCESS_CACHED:
       case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
       case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
       case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.access_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->access_waiters);
         break;
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_8);
@@ -1634,7 +1914,8 @@ rtems_bdbuf_wait_for_recycle (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_shard *shard,
+                                rtems_bdbuf_buffer *bd)
 {
   while (true)
   {
@@ -1651,7 +1932,7 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
       case RTEMS_BDBUF_STATE_SYNC:
       case RTEMS_BDBUF_STATE_TRANSFER:
       case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
-        rtems_bdbuf_wait (bd, &bdbuf_cache.transfer_waiters);
+        rtems_bdbuf_wait (shard, bd, &shard->transfer_waiters);
         break;
       default:
         rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_9);
@@ -1660,26 +1941,26 @@ rtems_bdbuf_wait_for_sync_done (rtems_bdbuf_buffer *bd)
 }
 
 static void
-rtems_bdbuf_wait_for_buffer (void)
+rtems_bdbuf_wait_for_buffer (rtems_bdbuf_shard *shard)
 {
-  if (!rtems_chain_is_empty (&bdbuf_cache.modified))
+  if (!rtems_chain_is_empty (&shard->modified))
     rtems_bdbuf_wake_swapper ();
 
-  rtems_bdbuf_anonymous_wait (&bdbuf_cache.buffer_waiters);
+  rtems_bdbuf_anonymous_wait (shard, &shard->buffer_waiters);
 }
 
 static void
-rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
+rtems_bdbuf_sync_after_access (rtems_bdbuf_shard *shard, rtems_bdbuf_buffer *bd)
 {
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_SYNC);
 
-  rtems_chain_append_unprotected (&bdbuf_cache.sync, &bd->link);
+  rtems_chain_append_unprotected (&shard->sync, &bd->link);
 
   if (bd->waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.access_waiters);
+    rtems_bdbuf_wake (&shard->access_waiters);
 
   rtems_bdbuf_wake_swapper ();
-  rtems_bdbuf_wait_for_sync_done (bd);
+  rtems_bdbuf_wait_for_sync_done (shard, bd);
 
   /*
    * We may have created a cached or empty buffer which may be recycled.
@@ -1693,24 +1974,28 @@ rtems_bdbuf_sync_after_access (rtems_bdbuf_buffer *bd)
       rtems_bdbuf_remove_from_tree (bd);
       rtems_bdbuf_make_free_and_add_to_lru_list (bd);
     }
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
   }
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_for_read_ahead (rtems_bdbuf_shard *shard,
+                                       rtems_disk_device *dd,
                                        rtems_blkdev_bnum  block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
-  bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+  bd = rtems_bdbuf_hash_search (shard, dd, block);
 
   if (bd == NULL)
   {
-    bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+    bd = rtems_bdbuf_get_buffer_from_lru_list (shard, dd, block);
 
     if (bd != NULL)
+    {
       rtems_bdbuf_group_obtain (bd);
+      bd->read_ahead = true;
+    }
   }
   else
     /*
@@ -1723,39 +2008,40 @@ rtems_bdbuf_get_buffer_for_read_ahead (rtems_disk_device *dd,
 }
 
 static rtems_bdbuf_buffer *
-rtems_bdbuf_get_buffer_for_access (rtems_disk_device *dd,
+rtems_bdbuf_get_buffer_for_access (rtems_bdbuf_shard *shard,
+                                   rtems_disk_device *dd,
                                    rtems_blkdev_bnum  block)
 {
   rtems_bdbuf_buffer *bd = NULL;
 
   do
   {
-    bd = rtems_bdbuf_avl_search (&bdbuf_cache.tree, dd, block);
+    bd = rtems_bdbuf_hash_search (shard, dd, block);
 
     if (bd != NULL)
     {
       if (bd->group->bds_per_group != dd->bds_per_group)
       {
-        if (rtems_bdbuf_wait_for_recycle (bd))
+        if (rtems_bdbuf_wait_for_recycle (shard, bd))
         {
           rtems_bdbuf_remove_from_tree_and_lru_list (bd);
           rtems_bdbuf_make_free_and_add_to_lru_list (bd);
-          rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+          rtems_bdbuf_wake (&shard->buffer_waiters);
         }
         bd = NULL;
       }
     }
     else
     {
-      bd = rtems_bdbuf_get_buffer_from_lru_list (dd, block);
+      bd = rtems_bdbuf_get_buffer_from_lru_list (shard, dd, block);
 
       if (bd == NULL)
-        rtems_bdbuf_wait_for_buffer ();
+        rtems_bdbuf_wait_for_buffer (shard);
     }
   }
   while (bd == NULL);
 
-  rtems_bdbuf_wait_for_access (bd);
+  rtems_bdbuf_wait_for_access (shard, bd);
   rtems_bdbuf_group_obtain (bd);
 
   return bd;
@@ -1792,9 +2078,10 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
 {
   rtems_status_code   sc = RTEMS_SUCCESSFUL;
   rtems_bdbuf_buffer *bd = NULL;
+  rtems_bdbuf_shard  *shard = rtems_bdbuf_shard_for (dd, block);
   rtems_blkdev_bnum   media_block;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_shard (shard);
 
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
@@ -1806,17 +2093,23 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
       printf ("bdbuf:get: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (shard, dd, media_block);
+
+    if (bd->read_ahead)
+      rtems_bdbuf_read_ahead_wasted (bd);
 
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
+        ++shard->stats.hits;
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
+        ++shard->stats.misses;
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_EMPTY);
         break;
       case RTEMS_BDBUF_STATE_MODIFIED:
+        ++shard->stats.hits;
         /*
          * To get a modified buffer could be considered a bug in the caller
          * because you should not be getting an already modified buffer but
@@ -1838,7 +2131,7 @@ rtems_bdbuf_get (rtems_disk_device   *dd,
     }
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   *bd_ptr = bd;
 
@@ -1862,27 +2155,22 @@ rtems_bdbuf_transfer_done (rtems_blkdev_request* req, rtems_status_code status)
   rtems_event_transient_send (req->io_task);
 }
 
-static rtems_status_code
-rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
-                                      rtems_blkdev_request *req,
-                                      bool                  cache_locked)
+/**
+ * Finish a completed transfer request. The statistics are updated and the
+ * buffers of the request are cached or discarded. The shard of the buffers
+ * shall be locked by the caller.
+ */
+static void
+rtems_bdbuf_finish_transfer_request (rtems_bdbuf_shard    *shard,
+                                     rtems_disk_device    *dd,
+                                     rtems_blkdev_request *req)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_status_code sc = req->status;
   uint32_t transfer_index = 0;
   bool wake_transfer_waiters = false;
   bool wake_buffer_waiters = false;
 
-  if (cache_locked)
-    rtems_bdbuf_unlock_cache ();
-
-  /* The return value will be ignored for transfer requests */
-  dd->ioctl (dd->phys_dev, RTEMS_BLKIO_REQUEST, req);
-
-  /* Wait for transfer request completion */
-  rtems_bdbuf_wait_for_transient_event ();
-  sc = req->status;
-
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_device (dd);
 
   /* Statistics */
   if (req->req == RTEMS_BLKDEV_REQ_READ)
@@ -1899,6 +2187,8 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
       ++dd->stats.write_errors;
   }
 
+  rtems_bdbuf_unlock_device (dd);
+
   for (transfer_index = 0; transfer_index < req->bufnum; ++transfer_index)
   {
     rtems_bdbuf_buffer *bd = req->bufs [transfer_index].user;
@@ -1921,13 +2211,39 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
   }
 
   if (wake_transfer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+    rtems_bdbuf_wake (&shard->transfer_waiters);
 
   if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
+}
 
-  if (!cache_locked)
-    rtems_bdbuf_unlock_cache ();
+/**
+ * Execute a transfer request and wait for its completion. All buffers of the
+ * request shall belong to the shard.
+ */
+static rtems_status_code
+rtems_bdbuf_execute_transfer_request (rtems_bdbuf_shard    *shard,
+                                      rtems_disk_device    *dd,
+                                      rtems_blkdev_request *req,
+                                      bool                  shard_locked)
+{
+  rtems_status_code sc;
+
+  if (shard_locked)
+    rtems_bdbuf_unlock_shard (shard);
+
+  rtems_blkdev_submit_request (dd, req);
+  rtems_blkdev_unplug (dd);
+
+  /* Wait for transfer request completion */
+  rtems_bdbuf_wait_for_transient_event ();
+  sc = req->status;
+
+  rtems_bdbuf_lock_shard (shard);
+  rtems_bdbuf_finish_transfer_request (shard, dd, req);
+
+  if (!shard_locked)
+    rtems_bdbuf_unlock_shard (shard);
 
   if (sc == RTEMS_SUCCESSFUL || sc == RTEMS_UNSATISFIED)
     return sc;
@@ -1935,27 +2251,25 @@ rtems_bdbuf_execute_transfer_request (rtems_disk_device    *dd,
     return RTEMS_IO_ERROR;
 }
 
-static rtems_status_code
-rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
-                                  rtems_bdbuf_buffer *bd,
-                                  uint32_t            transfer_count)
+/**
+ * Set up a read request for the buffer and the following blocks. The
+ * following blocks are added as long as they are not cached. The transfer
+ * count shall not exceed the count of blocks left in the shard of the buffer.
+ * The request done callback is set up by the caller.
+ */
+static void
+rtems_bdbuf_prepare_read_request (rtems_bdbuf_shard    *shard,
+                                  rtems_disk_device    *dd,
+                                  rtems_bdbuf_buffer   *bd,
+                                  uint32_t              transfer_count,
+                                  rtems_blkdev_request *req)
 {
-  rtems_blkdev_request *req = NULL;
   rtems_blkdev_bnum media_block = bd->block;
   uint32_t media_blocks_per_block = dd->media_blocks_per_block;
   uint32_t block_size = dd->block_size;
   uint32_t transfer_index = 1;
 
-  /*
-   * TODO: This type of request structure is wrong and should be removed.
-   */
-#define bdbuf_alloc(size) __builtin_alloca (size)
-
-  req = bdbuf_alloc (rtems_bdbuf_read_request_size (transfer_count));
-
   req->req = RTEMS_BLKDEV_REQ_READ;
-  req->done = rtems_bdbuf_transfer_done;
-  req->io_task = rtems_task_self ();
   req->bufnum = 0;
 
   rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_TRANSFER);
@@ -1972,7 +2286,7 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
   {
     media_block += media_blocks_per_block;
 
-    bd = rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
 
     if (bd == NULL)
       break;
@@ -1991,10 +2305,130 @@ rtems_bdbuf_execute_read_request (rtems_disk_device  *dd,
   }
 
   req->bufnum = transfer_index;
+}
+
+/**
+ * Execute a read request for the buffer and the following blocks and wait for
+ * its completion. The transfer count shall not exceed the count of blocks left
+ * in the shard of the buffer.
+ */
+static rtems_status_code
+rtems_bdbuf_execute_read_request (rtems_bdbuf_shard  *shard,
+                                  rtems_disk_device  *dd,
+                                  rtems_bdbuf_buffer *bd,
+                                  uint32_t            transfer_count)
+{
+  rtems_blkdev_request *req = NULL;
+
+  /*
+   * TODO: This type of request structure is wrong and should be removed.
+   */
+#define bdbuf_alloc(size) __builtin_alloca (size)
+
+  req = bdbuf_alloc (rtems_bdbuf_read_request_size (transfer_count));
+
+  req->done = rtems_bdbuf_transfer_done;
+  req->io_task = rtems_task_self ();
+  rtems_bdbuf_prepare_read_request (shard, dd, bd, transfer_count, req);
+
+  return rtems_bdbuf_execute_transfer_request (shard, dd, req, true);
+}
+
+/**
+ * Notification of a read-ahead transfer request. This function may be invoked
+ * from interrupt context.
+ */
+static void
+rtems_bdbuf_read_ahead_transfer_done (rtems_blkdev_request *req,
+                                      rtems_status_code     status)
+{
+  rtems_bdbuf_read_ahead_request *ra = req->done_arg;
+
+  req->status = status;
+
+  rtems_binary_semaphore_post (&ra->done);
+}
+
+/**
+ * Wait for the completion of the read-ahead transfer requests in progress and
+ * finish them in submission order. The requests may complete in any order. No
+ * shard shall be locked by the caller. Only the read-ahead task may call this
+ * function.
+ */
+static void
+rtems_bdbuf_read_ahead_flush (void)
+{
+  size_t offset = 0;
 
-  return rtems_bdbuf_execute_transfer_request (dd, req, true);
+  while (offset < bdbuf_cache.read_ahead_requests_used)
+  {
+    rtems_bdbuf_read_ahead_request *ra = (rtems_bdbuf_read_ahead_request *)
+      (bdbuf_cache.read_ahead_requests + offset);
+
+    rtems_blkdev_unplug (ra->dd);
+    rtems_binary_semaphore_wait (&ra->done);
+    rtems_binary_semaphore_destroy (&ra->done);
+
+    rtems_bdbuf_lock_shard (ra->shard);
+    rtems_bdbuf_finish_transfer_request (ra->shard, ra->dd, &ra->req);
+    rtems_bdbuf_unlock_shard (ra->shard);
+
+    offset += ra->size;
+  }
+
+  bdbuf_cache.read_ahead_requests_used = 0;
+}
+
+/**
+ * Make room for a read-ahead transfer request of up to the transfer count
+ * blocks. The read-ahead requests in progress are finished if necessary. No
+ * shard shall be locked by the caller.
+ */
+static void
+rtems_bdbuf_read_ahead_reserve (uint32_t transfer_count)
+{
+  if (bdbuf_cache.read_ahead_requests_used
+      + rtems_bdbuf_read_ahead_request_size (transfer_count)
+      > bdbuf_cache.read_ahead_requests_size)
+    rtems_bdbuf_read_ahead_flush ();
+}
+
+/**
+ * Submit a read-ahead request for the buffer and the following blocks without
+ * waiting for its completion. Room for the request shall be reserved by
+ * rtems_bdbuf_read_ahead_reserve() before the shard was locked. The shard is
+ * unlocked while the request is submitted.
+ */
+static void
+rtems_bdbuf_submit_read_ahead_request (rtems_bdbuf_shard  *shard,
+                                       rtems_disk_device  *dd,
+                                       rtems_bdbuf_buffer *bd,
+                                       uint32_t            transfer_count)
+{
+  rtems_bdbuf_read_ahead_request *ra = (rtems_bdbuf_read_ahead_request *)
+    (bdbuf_cache.read_ahead_requests + bdbuf_cache.read_ahead_requests_used);
+
+  ra->size = rtems_bdbuf_read_ahead_request_size (transfer_count);
+  bdbuf_cache.read_ahead_requests_used += ra->size;
+
+  ra->shard = shard;
+  ra->dd = dd;
+  rtems_binary_semaphore_init (&ra->done, "bdbuf read-ahead");
+  ra->req.done = rtems_bdbuf_read_ahead_transfer_done;
+  ra->req.done_arg = ra;
+  rtems_bdbuf_prepare_read_request (shard, dd, bd, transfer_count, &ra->req);
+
+  rtems_bdbuf_unlock_shard (shard);
+  rtems_blkdev_submit_request (dd, &ra->req);
+  rtems_bdbuf_lock_shard (shard);
 }
 
+/*
+ * The read-ahead control of a device is protected by the device lock.  The
+ * read-ahead request chain and the chain node of the device are protected by
+ * the read-ahead lock.
+ */
+
 static bool
 rtems_bdbuf_is_read_ahead_active (const rtems_disk_device *dd)
 {
@@ -2004,20 +2438,37 @@ rtems_bdbuf_is_read_ahead_active (const rtems_disk_device *dd)
 static void
 rtems_bdbuf_read_ahead_cancel (rtems_disk_device *dd)
 {
+  rtems_bdbuf_lock_read_ahead ();
+
   if (rtems_bdbuf_is_read_ahead_active (dd))
   {
     rtems_chain_extract_unprotected (&dd->read_ahead.node);
     rtems_chain_set_off_chain (&dd->read_ahead.node);
   }
+
+  rtems_bdbuf_unlock_read_ahead ();
 }
 
 static void
 rtems_bdbuf_read_ahead_reset (rtems_disk_device *dd)
 {
+  size_t s;
+
   rtems_bdbuf_read_ahead_cancel (dd);
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  dd->read_ahead.nr_blocks = RTEMS_DISK_READ_AHEAD_SIZE_AUTO;
+  dd->read_ahead.pending = 0;
+
+  for (s = 0; s < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++s)
+  {
+    dd->read_ahead.streams[s].last = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+    dd->read_ahead.streams[s].trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  }
 }
 
+/**
+ * Add the device to the read-ahead request chain. The read-ahead lock shall
+ * be held by the caller.
+ */
 static void
 rtems_bdbuf_read_ahead_add_to_chain (rtems_disk_device *dd)
 {
@@ -2032,32 +2483,185 @@ rtems_bdbuf_read_ahead_add_to_chain (rtems_disk_device *dd)
       rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_RA_WAKE_UP);
   }
 
-  rtems_chain_append_unprotected (chain, &dd->read_ahead.node);
-}
+  rtems_chain_append_unprotected (chain, &dd->read_ahead.node);
+}
+
+/**
+ * Add the device to the read-ahead request chain if it is not already on the
+ * chain.
+ */
+static void
+rtems_bdbuf_read_ahead_activate (rtems_disk_device *dd)
+{
+  rtems_bdbuf_lock_read_ahead ();
+
+  if (!rtems_bdbuf_is_read_ahead_active (dd))
+    rtems_bdbuf_read_ahead_add_to_chain (dd);
+
+  rtems_bdbuf_unlock_read_ahead ();
+}
+
+/**
+ * Select the stream to track a new access pattern. An unused stream or
+ * otherwise the least recently used stream is replaced. The device shall be
+ * locked by the caller.
+ */
+static rtems_blkdev_read_ahead_stream *
+rtems_bdbuf_read_ahead_new_stream (rtems_disk_device *dd)
+{
+  rtems_blkdev_read_ahead        *read_ahead = &dd->read_ahead;
+  rtems_blkdev_read_ahead_stream *stream;
+  size_t                          victim = 0;
+  size_t                          s;
+
+  for (s = 0; s < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++s)
+  {
+    stream = &read_ahead->streams[s];
+
+    if (stream->last == RTEMS_DISK_READ_AHEAD_NO_TRIGGER)
+    {
+      victim = s;
+      break;
+    }
+
+    if (read_ahead->stamp - stream->stamp
+        > read_ahead->stamp - read_ahead->streams[victim].stamp)
+      victim = s;
+  }
+
+  stream = &read_ahead->streams[victim];
+  stream->window = bdbuf_config.max_read_ahead_blocks;
+  stream->candidate_stride = 0;
+
+  return stream;
+}
+
+/**
+ * Continue the stream with an access to the block. Request a read-ahead if the
+ * access reached the trigger of the stream. The window of the stream shrinks
+ * if the block was read ahead but is no longer in the cache, and it grows if
+ * the trigger block was read ahead and is still in the cache. The device
+ * shall be locked by the caller.
+ */
+static void
+rtems_bdbuf_read_ahead_continue (rtems_disk_device *dd,
+                                 size_t             s,
+                                 rtems_blkdev_bnum  block,
+                                 bool               hit)
+{
+  rtems_blkdev_read_ahead_stream *stream = &dd->read_ahead.streams[s];
+
+  stream->last = block;
+  stream->stamp = dd->read_ahead.stamp;
+
+  if (!hit && block >= stream->begin && block < stream->next
+      && stream->window > 1)
+    stream->window /= 2;
+
+  if (block == stream->trigger)
+  {
+    if (hit && stream->window < bdbuf_config.max_read_ahead_blocks)
+    {
+      stream->window *= 2;
+
+      if (stream->window > bdbuf_config.max_read_ahead_blocks)
+        stream->window = bdbuf_config.max_read_ahead_blocks;
+    }
+
+    dd->read_ahead.pending |= UINT32_C (1) << s;
+    rtems_bdbuf_read_ahead_activate (dd);
+  }
+}
+
+/**
+ * Update the read-ahead streams of the device for a read access to the block.
+ * An access which continues a stream with its stride, reaches its trigger, or
+ * repeats the distance of its last two accesses advances the stream. A miss which does not continue a
+ * stream moves a stream with a last access close before the block or replaces
+ * the least recently used stream. The device shall be locked by the caller.
+ *
+ * @param dd The disk device.
+ * @param block The block of the read access.
+ * @param hit The block was in the cache.
+ */
+static void
+rtems_bdbuf_read_ahead_access (rtems_disk_device *dd,
+                               rtems_blkdev_bnum  block,
+                               bool               hit)
+{
+  rtems_blkdev_read_ahead        *read_ahead = &dd->read_ahead;
+  rtems_blkdev_read_ahead_stream *stream;
+  rtems_blkdev_read_ahead_stream *near = NULL;
+  size_t                          s;
+
+  if (bdbuf_cache.read_ahead_task == 0)
+    return;
+
+  ++read_ahead->stamp;
+
+  for (s = 0; s < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++s)
+  {
+    rtems_blkdev_bnum distance;
+
+    stream = &read_ahead->streams[s];
+
+    if (stream->last == RTEMS_DISK_READ_AHEAD_NO_TRIGGER)
+      continue;
+
+    if (stream->last == block)
+    {
+      stream->stamp = read_ahead->stamp;
+      return;
+    }
+
+    if (stream->last > block)
+      continue;
+
+    distance = block - stream->last;
+
+    if (distance == stream->stride || block == stream->trigger)
+    {
+      rtems_bdbuf_read_ahead_continue (dd, s, block, hit);
+      return;
+    }
+
+    if (distance == stream->candidate_stride)
+    {
+      /*
+       * The last three accesses have the same distance, so this is a strided
+       * stream.  Issue the read-ahead immediately.
+       */
+      read_ahead->pending &= ~(UINT32_C (1) << s);
+      stream->stride = distance;
+      stream->trigger = block;
+      stream->next = block + distance;
+      stream->begin = stream->next;
+      rtems_bdbuf_read_ahead_continue (dd, s, block, hit);
+      return;
+    }
+
+    if (near == NULL && distance <= RTEMS_DISK_READ_AHEAD_MAX_STRIDE)
+      near = stream;
+  }
+
+  if (hit)
+    return;
 
-static void
-rtems_bdbuf_check_read_ahead_trigger (rtems_disk_device *dd,
-                                      rtems_blkdev_bnum  block)
-{
-  if (bdbuf_cache.read_ahead_task != 0
-      && dd->read_ahead.trigger == block
-      && !rtems_bdbuf_is_read_ahead_active (dd))
+  if (near != NULL)
   {
-    dd->read_ahead.nr_blocks = RTEMS_DISK_READ_AHEAD_SIZE_AUTO;
-    rtems_bdbuf_read_ahead_add_to_chain(dd);
+    stream = near;
+    stream->candidate_stride = block - stream->last;
   }
-}
+  else
+    stream = rtems_bdbuf_read_ahead_new_stream (dd);
 
-static void
-rtems_bdbuf_set_read_ahead_trigger (rtems_disk_device *dd,
-                                    rtems_blkdev_bnum  block)
-{
-  if (dd->read_ahead.trigger != block)
-  {
-    rtems_bdbuf_read_ahead_cancel (dd);
-    dd->read_ahead.trigger = block + 1;
-    dd->read_ahead.next = block + 2;
-  }
+  read_ahead->pending &= ~(UINT32_C (1) << (stream - &read_ahead->streams[0]));
+  stream->last = block;
+  stream->stamp = read_ahead->stamp;
+  stream->stride = 1;
+  stream->trigger = block + 1;
+  stream->next = block + 2;
+  stream->begin = stream->next;
 }
 
 rtems_status_code
@@ -2067,9 +2671,11 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
 {
   rtems_status_code     sc = RTEMS_SUCCESSFUL;
   rtems_bdbuf_buffer   *bd = NULL;
+  rtems_bdbuf_shard    *shard = rtems_bdbuf_shard_for (dd, block);
   rtems_blkdev_bnum     media_block;
+  bool                  hit = false;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_shard (shard);
 
   sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
   if (sc == RTEMS_SUCCESSFUL)
@@ -2078,21 +2684,25 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
       printf ("bdbuf:read: %" PRIu32 " (%" PRIu32 ") (dev = %08x)\n",
               media_block, block, (unsigned) dd->dev);
 
-    bd = rtems_bdbuf_get_buffer_for_access (dd, media_block);
+    bd = rtems_bdbuf_get_buffer_for_access (shard, dd, media_block);
     switch (bd->state)
     {
       case RTEMS_BDBUF_STATE_CACHED:
-        ++dd->stats.read_hits;
+        ++shard->stats.hits;
+        hit = true;
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
         break;
       case RTEMS_BDBUF_STATE_MODIFIED:
-        ++dd->stats.read_hits;
+        ++shard->stats.hits;
+        hit = true;
         rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_MODIFIED);
         break;
       case RTEMS_BDBUF_STATE_EMPTY:
+        ++shard->stats.misses;
+        rtems_bdbuf_lock_device (dd);
         ++dd->stats.read_misses;
-        rtems_bdbuf_set_read_ahead_trigger (dd, block);
-        sc = rtems_bdbuf_execute_read_request (dd, bd, 1);
+        rtems_bdbuf_unlock_device (dd);
+        sc = rtems_bdbuf_execute_read_request (shard, dd, bd, 1);
         if (sc == RTEMS_SUCCESSFUL)
         {
           rtems_bdbuf_set_state (bd, RTEMS_BDBUF_STATE_ACCESS_CACHED);
@@ -2109,10 +2719,24 @@ rtems_bdbuf_read (rtems_disk_device   *dd,
         break;
     }
 
-    rtems_bdbuf_check_read_ahead_trigger (dd, block);
+    rtems_bdbuf_lock_device (dd);
+
+    if (hit)
+    {
+      ++dd->stats.read_hits;
+
+      if (bd->read_ahead)
+      {
+        bd->read_ahead = false;
+        ++dd->stats.read_ahead_hits;
+      }
+    }
+
+    rtems_bdbuf_read_ahead_access (dd, block, hit);
+    rtems_bdbuf_unlock_device (dd);
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   *bd_ptr = bd;
 
@@ -2124,54 +2748,59 @@ rtems_bdbuf_peek (rtems_disk_device *dd,
                   rtems_blkdev_bnum block,
                   uint32_t nr_blocks)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_device (dd);
 
   if (bdbuf_cache.read_ahead_enabled && nr_blocks > 0)
   {
     rtems_bdbuf_read_ahead_reset(dd);
     dd->read_ahead.next = block;
     dd->read_ahead.nr_blocks = nr_blocks;
+    rtems_bdbuf_lock_read_ahead ();
     rtems_bdbuf_read_ahead_add_to_chain(dd);
+    rtems_bdbuf_unlock_read_ahead ();
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_device (dd);
 }
 
-static rtems_status_code
-rtems_bdbuf_check_bd_and_lock_cache (rtems_bdbuf_buffer *bd, const char *kind)
+static rtems_bdbuf_shard *
+rtems_bdbuf_check_bd_and_lock_shard (rtems_bdbuf_buffer *bd, const char *kind)
 {
+  rtems_bdbuf_shard *shard;
+
   if (bd == NULL)
-    return RTEMS_INVALID_ADDRESS;
+    return NULL;
   if (rtems_bdbuf_tracer)
   {
     printf ("bdbuf:%s: %" PRIu32 "\n", kind, bd->block);
     rtems_bdbuf_show_users (kind, bd);
   }
-  rtems_bdbuf_lock_cache();
+  shard = rtems_bdbuf_shard_of (bd);
+  rtems_bdbuf_lock_shard (shard);
 
-  return RTEMS_SUCCESSFUL;
+  return shard;
 }
 
 rtems_status_code
 rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release");
-  if (sc != RTEMS_SUCCESSFUL)
-    return sc;
+  shard = rtems_bdbuf_check_bd_and_lock_shard (bd, "release");
+  if (shard == NULL)
+    return RTEMS_INVALID_ADDRESS;
 
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
-      rtems_bdbuf_add_to_lru_list_after_access (bd);
+      rtems_bdbuf_add_to_lru_list_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_list_after_access (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_0);
@@ -2181,7 +2810,7 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2189,21 +2818,21 @@ rtems_bdbuf_release (rtems_bdbuf_buffer *bd)
 rtems_status_code
 rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "release modified");
-  if (sc != RTEMS_SUCCESSFUL)
-    return sc;
+  shard = rtems_bdbuf_check_bd_and_lock_shard (bd, "release modified");
+  if (shard == NULL)
+    return RTEMS_INVALID_ADDRESS;
 
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_add_to_modified_list_after_access (bd);
+      rtems_bdbuf_add_to_modified_list_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_6);
@@ -2213,7 +2842,7 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2221,21 +2850,21 @@ rtems_bdbuf_release_modified (rtems_bdbuf_buffer *bd)
 rtems_status_code
 rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
 {
-  rtems_status_code sc = RTEMS_SUCCESSFUL;
+  rtems_bdbuf_shard *shard;
 
-  sc = rtems_bdbuf_check_bd_and_lock_cache (bd, "sync");
-  if (sc != RTEMS_SUCCESSFUL)
-    return sc;
+  shard = rtems_bdbuf_check_bd_and_lock_shard (bd, "sync");
+  if (shard == NULL)
+    return RTEMS_INVALID_ADDRESS;
 
   switch (bd->state)
   {
     case RTEMS_BDBUF_STATE_ACCESS_CACHED:
     case RTEMS_BDBUF_STATE_ACCESS_EMPTY:
     case RTEMS_BDBUF_STATE_ACCESS_MODIFIED:
-      rtems_bdbuf_sync_after_access (bd);
+      rtems_bdbuf_sync_after_access (shard, bd);
       break;
     case RTEMS_BDBUF_STATE_ACCESS_PURGED:
-      rtems_bdbuf_discard_buffer_after_access (bd);
+      rtems_bdbuf_discard_buffer_after_access (shard, bd);
       break;
     default:
       rtems_bdbuf_fatal_with_state (bd->state, RTEMS_BDBUF_FATAL_STATE_5);
@@ -2245,7 +2874,7 @@ rtems_bdbuf_sync (rtems_bdbuf_buffer *bd)
   if (rtems_bdbuf_tracer)
     rtems_bdbuf_show_usage ();
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   return RTEMS_SUCCESSFUL;
 }
@@ -2373,7 +3002,8 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
 
       if (write)
       {
-        rtems_bdbuf_execute_transfer_request (dd, &transfer->write_req, false);
+        rtems_bdbuf_execute_transfer_request (transfer->shard, dd,
+                                              &transfer->write_req, false);
 
         transfer->write_req.status = RTEMS_RESOURCE_IN_USE;
         transfer->write_req.bufnum = 0;
@@ -2397,6 +3027,7 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  * Process the modified list of buffers. There is a sync or modified list that
  * needs to be handled so we have a common function to do the work.
  *
+ * @param shard The shard of the modified chain.
  * @param dd_ptr Pointer to the device to handle. If BDBUF_INVALID_DEV no
  * device is selected so select the device of the first buffer to be written to
  * disk.
@@ -2408,7 +3039,8 @@ rtems_bdbuf_swapout_write (rtems_bdbuf_swapout_transfer* transfer)
  *                    amount.
  */
 static void
-rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
+rtems_bdbuf_swapout_modified_processing (rtems_bdbuf_shard   *shard,
+                                         rtems_disk_device  **dd_ptr,
                                          rtems_chain_control* chain,
                                          rtems_chain_control* transfer,
                                          bool                 sync_active,
@@ -2442,7 +3074,7 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
        *       on TOD to be accurate. Does it matter ?
        */
       if (sync_all || (sync_active && (*dd_ptr == bd->dd))
-          || rtems_bdbuf_has_buffer_waiters ())
+          || rtems_bdbuf_has_buffer_waiters (shard))
         bd->hold_timer = 0;
 
       if (bd->hold_timer)
@@ -2515,13 +3147,14 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
 }
 
 /**
- * Process the cache's modified buffers. Check the sync list first then the
+ * Process the modified buffers of a shard. Check the sync list first then the
  * modified list extracting the buffers suitable to be written to disk. We have
  * a device at a time. The task level loop will repeat this operation while
  * there are buffers to be written. If the transfer fails place the buffers
- * back on the modified list and try again later. The cache is unlocked while
+ * back on the modified list and try again later. The shard is unlocked while
  * the buffers are being written to disk.
  *
+ * @param shard The shard to process.
  * @param timer_delta It update_timers is true update the timers by this
  *                    amount.
  * @param update_timers If true update the timers.
@@ -2531,18 +3164,19 @@ rtems_bdbuf_swapout_modified_processing (rtems_disk_device  **dd_ptr,
  * @retval false No buffers where written to disk.
  */
 static bool
-rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
-                                bool                          update_timers,
-                                rtems_bdbuf_swapout_transfer* transfer)
+rtems_bdbuf_swapout_shard_processing (rtems_bdbuf_shard*            shard,
+                                      unsigned long                 timer_delta,
+                                      bool                          update_timers,
+                                      rtems_bdbuf_swapout_transfer* transfer)
 {
   rtems_bdbuf_swapout_worker* worker;
   bool                        transfered_buffers = false;
   bool                        sync_active;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_shard (shard);
 
   /*
-   * To set this to true you need the cache and the sync lock.
+   * To set this to true you need all shards and the sync lock.
    */
   sync_active = bdbuf_cache.sync_active;
 
@@ -2559,14 +3193,17 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
     worker = NULL;
   else
   {
+    rtems_bdbuf_lock (&bdbuf_cache.swapout_lock);
     worker = (rtems_bdbuf_swapout_worker*)
       rtems_chain_get_unprotected (&bdbuf_cache.swapout_free_workers);
+    rtems_bdbuf_unlock (&bdbuf_cache.swapout_lock);
     if (worker)
       transfer = &worker->transfer;
   }
 
   rtems_chain_initialize_empty (&transfer->bds);
   transfer->dd = BDBUF_INVALID_DEV;
+  transfer->shard = shard;
   transfer->syncing = sync_active;
 
   /*
@@ -2581,17 +3218,19 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
    * If we have any buffers in the sync queue move them to the modified
    * list. The first sync buffer will select the device we use.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.sync,
+  rtems_bdbuf_swapout_modified_processing (shard,
+                                           &transfer->dd,
+                                           &shard->sync,
                                            &transfer->bds,
                                            true, false,
                                            timer_delta);
 
   /*
-   * Process the cache's modified list.
+   * Process the shard's modified list.
    */
-  rtems_bdbuf_swapout_modified_processing (&transfer->dd,
-                                           &bdbuf_cache.modified,
+  rtems_bdbuf_swapout_modified_processing (shard,
+                                           &transfer->dd,
+                                           &shard->modified,
                                            &transfer->bds,
                                            sync_active,
                                            update_timers,
@@ -2599,10 +3238,10 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
 
   /*
    * We have all the buffers that have been modified for this device so the
-   * cache can be unlocked because the state of each buffer has been set to
+   * shard can be unlocked because the state of each buffer has been set to
    * TRANSFER.
    */
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
 
   /*
    * If there are buffers to transfer to the media transfer them.
@@ -2623,6 +3262,52 @@ rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
 
     transfered_buffers = true;
   }
+  else if (worker)
+  {
+    rtems_bdbuf_lock (&bdbuf_cache.swapout_lock);
+    rtems_chain_prepend_unprotected (&bdbuf_cache.swapout_free_workers,
+                                     &worker->link);
+    rtems_bdbuf_unlock (&bdbuf_cache.swapout_lock);
+  }
+
+  return transfered_buffers;
+}
+
+/**
+ * Process the modified buffers of all shards. The sync is done if no buffers
+ * were written to disk in a pass over all shards.
+ *
+ * @param timer_delta It update_timers is true update the timers by this
+ *                    amount.
+ * @param update_timers If true update the timers.
+ * @param transfer The transfer transaction data.
+ *
+ * @retval true Buffers where written to disk so scan again.
+ * @retval false No buffers where written to disk.
+ */
+static bool
+rtems_bdbuf_swapout_processing (unsigned long                 timer_delta,
+                                bool                          update_timers,
+                                rtems_bdbuf_swapout_transfer* transfer)
+{
+  bool   transfered_buffers = false;
+  bool   sync_active;
+  size_t s;
+
+  rtems_bdbuf_lock_shard (&bdbuf_cache.shards[0]);
+  sync_active = bdbuf_cache.sync_active;
+  rtems_bdbuf_unlock_shard (&bdbuf_cache.shards[0]);
+
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    if (rtems_bdbuf_swapout_shard_processing (&bdbuf_cache.shards[s],
+                                              timer_delta,
+                                              update_timers,
+                                              transfer))
+    {
+      transfered_buffers = true;
+    }
+  }
 
   if (sync_active && !transfered_buffers)
   {
@@ -2656,14 +3341,15 @@ rtems_bdbuf_swapout_worker_task (rtems_task_argument arg)
 
     rtems_bdbuf_swapout_write (&worker->transfer);
 
-    rtems_bdbuf_lock_cache ();
+    rtems_bdbuf_lock (&bdbuf_cache.swapout_lock);
 
     rtems_chain_initialize_empty (&worker->transfer.bds);
     worker->transfer.dd = BDBUF_INVALID_DEV;
+    worker->transfer.shard = NULL;
 
     rtems_chain_append_unprotected (&bdbuf_cache.swapout_free_workers, &worker->link);
 
-    rtems_bdbuf_unlock_cache ();
+    rtems_bdbuf_unlock (&bdbuf_cache.swapout_lock);
   }
 
   free (worker);
@@ -2679,7 +3365,7 @@ rtems_bdbuf_swapout_workers_close (void)
 {
   rtems_chain_node* node;
 
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock (&bdbuf_cache.swapout_lock);
 
   node = rtems_chain_first (&bdbuf_cache.swapout_free_workers);
   while (!rtems_chain_is_tail (&bdbuf_cache.swapout_free_workers, node))
@@ -2690,7 +3376,7 @@ rtems_bdbuf_swapout_workers_close (void)
     node = rtems_chain_next (node);
   }
 
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock (&bdbuf_cache.swapout_lock);
 }
 
 /**
@@ -2775,7 +3461,8 @@ rtems_bdbuf_swapout_task (rtems_task_argument arg)
 }
 
 static void
-rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
+rtems_bdbuf_purge_list (rtems_bdbuf_shard   *shard,
+                        rtems_chain_control *purge_list)
 {
   bool wake_buffer_waiters = false;
   rtems_chain_node *node = NULL;
@@ -2791,22 +3478,25 @@ rtems_bdbuf_purge_list (rtems_chain_control *purge_list)
   }
 
   if (wake_buffer_waiters)
-    rtems_bdbuf_wake (&bdbuf_cache.buffer_waiters);
+    rtems_bdbuf_wake (&shard->buffer_waiters);
 }
 
 static void
-rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
+rtems_bdbuf_gather_for_purge (rtems_bdbuf_shard *shard,
+                              rtems_chain_control *purge_list,
                               const rtems_disk_device *dd)
 {
-  rtems_bdbuf_buffer *stack [RTEMS_BDBUF_AVL_MAX_HEIGHT];
-  rtems_bdbuf_buffer **prev = stack;
-  rtems_bdbuf_buffer *cur = bdbuf_cache.tree;
+  size_t index;
 
-  *prev = NULL;
-
-  while (cur != NULL)
+  for (index = 0; index <= shard->hash_mask; ++index)
   {
-    if (cur->dd == dd)
+    const rtems_bdbuf_hash_slot *slot = &shard->hash[index];
+    rtems_bdbuf_buffer *cur = slot->bd;
+
+    /*
+     * Ghost entries of the device stay in the hash table until they expire.
+     */
+    if (slot->dd == dd && cur != NULL)
     {
       switch (cur->state)
       {
@@ -2816,7 +3506,7 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
         case RTEMS_BDBUF_STATE_TRANSFER_PURGED:
           break;
         case RTEMS_BDBUF_STATE_SYNC:
-          rtems_bdbuf_wake (&bdbuf_cache.transfer_waiters);
+          rtems_bdbuf_wake (&shard->transfer_waiters);
           /* Fall through */
         case RTEMS_BDBUF_STATE_MODIFIED:
           rtems_bdbuf_group_release (cur);
@@ -2837,49 +3527,30 @@ rtems_bdbuf_gather_for_purge (rtems_chain_control *purge_list,
           rtems_bdbuf_fatal (RTEMS_BDBUF_FATAL_STATE_11);
       }
     }
-
-    if (cur->avl.left != NULL)
-    {
-      /* Left */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.left;
-    }
-    else if (cur->avl.right != NULL)
-    {
-      /* Right */
-      ++prev;
-      *prev = cur;
-      cur = cur->avl.right;
-    }
-    else
-    {
-      while (*prev != NULL
-             && (cur == (*prev)->avl.right || (*prev)->avl.right == NULL))
-      {
-        /* Up */
-        cur = *prev;
-        --prev;
-      }
-      if (*prev != NULL)
-        /* Right */
-        cur = (*prev)->avl.right;
-      else
-        /* Finished */
-        cur = NULL;
-    }
   }
 }
 
+/**
+ * Purge the buffers of the device. All shards shall be locked by the caller.
+ */
 static void
 rtems_bdbuf_do_purge_dev (rtems_disk_device *dd)
 {
   rtems_chain_control purge_list;
+  size_t              s;
 
-  rtems_chain_initialize_empty (&purge_list);
+  rtems_bdbuf_lock_device (dd);
   rtems_bdbuf_read_ahead_reset (dd);
-  rtems_bdbuf_gather_for_purge (&purge_list, dd);
-  rtems_bdbuf_purge_list (&purge_list);
+  rtems_bdbuf_unlock_device (dd);
+
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards[s];
+
+    rtems_chain_initialize_empty (&purge_list);
+    rtems_bdbuf_gather_for_purge (shard, &purge_list, dd);
+    rtems_bdbuf_purge_list (shard, &purge_list);
+  }
 }
 
 void
@@ -2947,76 +3618,306 @@ rtems_bdbuf_set_block_size (rtems_disk_device *dd,
   return sc;
 }
 
-static rtems_task
-rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
+/**
+ * Get the next device of the read-ahead request chain.
+ *
+ * @return The device or NULL if the chain is empty.
+ */
+static rtems_disk_device *
+rtems_bdbuf_read_ahead_get_next (void)
 {
-  rtems_chain_control *chain = &bdbuf_cache.read_ahead_chain;
+  rtems_chain_node  *node;
+  rtems_disk_device *dd = NULL;
 
-  while (bdbuf_cache.read_ahead_enabled)
+  rtems_bdbuf_lock_read_ahead ();
+
+  node = rtems_chain_get_unprotected (&bdbuf_cache.read_ahead_chain);
+  if (node != NULL)
   {
-    rtems_chain_node *node;
+    rtems_chain_set_off_chain (node);
+    dd = RTEMS_CONTAINER_OF (node, rtems_disk_device, read_ahead.node);
+  }
 
-    rtems_bdbuf_wait_for_event (RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
-    rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_unlock_read_ahead ();
+
+  return dd;
+}
+
+/**
+ * Compute the transfer count of a peek request. The transfer is limited to
+ * the blocks of the shard of the first block. The remainder of the peek
+ * request is queued again. The device shall be locked by the caller.
+ *
+ * @param dd The disk device.
+ * @param block The first block of the peek request.
+ * @param nr_blocks The block count of the peek request.
+ * @return The transfer count.
+ */
+static uint32_t
+rtems_bdbuf_read_ahead_peek_count (rtems_disk_device *dd,
+                                   rtems_blkdev_bnum  block,
+                                   uint32_t           nr_blocks)
+{
+  uint32_t transfer_count = nr_blocks;
+  uint32_t blocks_until_end_of_disk = dd->block_count - block;
+  uint32_t blocks_until_end_of_shard = rtems_bdbuf_shard_blocks_left (block);
+  uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
+
+  if (transfer_count > blocks_until_end_of_disk) {
+    transfer_count = blocks_until_end_of_disk;
+  }
+
+  if (transfer_count > max_transfer_count) {
+    transfer_count = max_transfer_count;
+  }
+
+  if (transfer_count > blocks_until_end_of_shard) {
+    dd->read_ahead.next = block + blocks_until_end_of_shard;
+    dd->read_ahead.nr_blocks = transfer_count - blocks_until_end_of_shard;
+    transfer_count = blocks_until_end_of_shard;
+  }
+
+  ++dd->stats.read_ahead_peeks;
 
-    while ((node = rtems_chain_get_unprotected (chain)) != NULL)
+  return transfer_count;
+}
+
+/**
+ * Compute the block count of a read-ahead request of the stream and update
+ * the trigger and next block of the stream. The request reads at most the
+ * window of the stream. A sequential request is limited to the blocks of the
+ * shard of the first block. The device shall be locked by the caller.
+ *
+ * @param dd The disk device.
+ * @param stream The read-ahead stream.
+ * @param block The first block of the read-ahead request.
+ * @return The block count.
+ */
+static uint32_t
+rtems_bdbuf_read_ahead_stream_count (rtems_disk_device              *dd,
+                                     rtems_blkdev_read_ahead_stream *stream,
+                                     rtems_blkdev_bnum               block)
+{
+  uint32_t stride = stream->stride;
+  uint32_t transfer_count;
+  bool     more = false;
+
+  if (block >= dd->block_count)
+  {
+    stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+    return 0;
+  }
+
+  transfer_count = (dd->block_count - block - 1) / stride + 1;
+
+  if (transfer_count >= stream->window)
+  {
+    transfer_count = stream->window;
+    more = true;
+  }
+
+  if (stride == 1)
+  {
+    uint32_t blocks_until_end_of_shard = rtems_bdbuf_shard_blocks_left (block);
+
+    if (transfer_count > blocks_until_end_of_shard)
     {
-      rtems_disk_device *dd =
-        RTEMS_CONTAINER_OF (node, rtems_disk_device, read_ahead.node);
-      rtems_blkdev_bnum block = dd->read_ahead.next;
-      rtems_blkdev_bnum media_block = 0;
-      rtems_status_code sc =
-        rtems_bdbuf_get_media_block (dd, block, &media_block);
+      transfer_count = blocks_until_end_of_shard;
+      more = true;
+    }
+  }
 
-      rtems_chain_set_off_chain (&dd->read_ahead.node);
+  stream->begin = block;
 
-      if (sc == RTEMS_SUCCESSFUL)
-      {
-        rtems_bdbuf_buffer *bd =
-          rtems_bdbuf_get_buffer_for_read_ahead (dd, media_block);
+  if (more)
+  {
+    stream->trigger = block + (transfer_count / 2) * stride;
+    stream->next = block + transfer_count * stride;
+  }
+  else
+  {
+    stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  }
 
-        if (bd != NULL)
-        {
-          uint32_t transfer_count = dd->read_ahead.nr_blocks;
-          uint32_t blocks_until_end_of_disk = dd->block_count - block;
-          uint32_t max_transfer_count = bdbuf_config.max_read_ahead_blocks;
-
-          if (transfer_count == RTEMS_DISK_READ_AHEAD_SIZE_AUTO) {
-            transfer_count = blocks_until_end_of_disk;
-
-            if (transfer_count >= max_transfer_count)
-            {
-              transfer_count = max_transfer_count;
-              dd->read_ahead.trigger = block + transfer_count / 2;
-              dd->read_ahead.next = block + transfer_count;
-            }
-            else
-            {
-              dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
-            }
-          } else {
-            if (transfer_count > blocks_until_end_of_disk) {
-              transfer_count = blocks_until_end_of_disk;
-            }
-
-            if (transfer_count > max_transfer_count) {
-              transfer_count = max_transfer_count;
-            }
-
-            ++dd->stats.read_ahead_peeks;
-          }
+  ++dd->stats.read_ahead_transfers;
 
-          ++dd->stats.read_ahead_transfers;
-          rtems_bdbuf_execute_read_request (dd, bd, transfer_count);
-        }
-      }
-      else
+  return transfer_count;
+}
+
+/**
+ * Read ahead consecutive blocks starting at the block for a peek request or a
+ * sequential stream.
+ *
+ * @param dd The disk device.
+ * @param stream The read-ahead stream or NULL for a peek request.
+ * @param block The first block.
+ * @param nr_blocks The block count of the peek request.
+ */
+static void
+rtems_bdbuf_read_ahead_consecutive (rtems_disk_device              *dd,
+                                    rtems_blkdev_read_ahead_stream *stream,
+                                    rtems_blkdev_bnum               block,
+                                    uint32_t                        nr_blocks)
+{
+  rtems_bdbuf_shard *shard = rtems_bdbuf_shard_for (dd, block);
+  rtems_blkdev_bnum  media_block = 0;
+  rtems_status_code  sc;
+
+  rtems_bdbuf_read_ahead_reserve (bdbuf_config.max_read_ahead_blocks);
+  rtems_bdbuf_lock_shard (shard);
+
+  sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
+  if (sc == RTEMS_SUCCESSFUL)
+  {
+    rtems_bdbuf_buffer *bd =
+      rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
+
+    if (bd != NULL)
+    {
+      uint32_t transfer_count;
+
+      rtems_bdbuf_lock_device (dd);
+
+      if (stream == NULL)
       {
-        dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+        transfer_count = rtems_bdbuf_read_ahead_peek_count (dd, block,
+                                                           nr_blocks);
+        ++dd->stats.read_ahead_transfers;
       }
+      else
+        transfer_count = rtems_bdbuf_read_ahead_stream_count (dd, stream,
+                                                             block);
+
+      rtems_bdbuf_unlock_device (dd);
+
+      rtems_bdbuf_submit_read_ahead_request (shard, dd, bd, transfer_count);
     }
+  }
+  else if (stream != NULL)
+  {
+    rtems_bdbuf_lock_device (dd);
+    stream->trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+    rtems_bdbuf_unlock_device (dd);
+  }
 
-    rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_shard (shard);
+}
+
+/**
+ * Read ahead the blocks of a strided stream. Each block is read by a transfer
+ * of its own, since the blocks in between are not part of the stream. The
+ * transfers are submitted without waiting for the completion of the previous
+ * ones.
+ *
+ * @param dd The disk device.
+ * @param stream The read-ahead stream.
+ * @param block The first block.
+ */
+static void
+rtems_bdbuf_read_ahead_strided (rtems_disk_device              *dd,
+                                rtems_blkdev_read_ahead_stream *stream,
+                                rtems_blkdev_bnum               block)
+{
+  uint32_t stride;
+  uint32_t transfer_count;
+  uint32_t i;
+
+  rtems_bdbuf_lock_device (dd);
+  stride = stream->stride;
+  transfer_count = rtems_bdbuf_read_ahead_stream_count (dd, stream, block);
+  rtems_bdbuf_unlock_device (dd);
+
+  for (i = 0; i < transfer_count; ++i, block += stride)
+  {
+    rtems_bdbuf_shard *shard = rtems_bdbuf_shard_for (dd, block);
+    rtems_blkdev_bnum  media_block = 0;
+    rtems_status_code  sc;
+
+    rtems_bdbuf_read_ahead_reserve (1);
+    rtems_bdbuf_lock_shard (shard);
+
+    sc = rtems_bdbuf_get_media_block (dd, block, &media_block);
+    if (sc == RTEMS_SUCCESSFUL)
+    {
+      rtems_bdbuf_buffer *bd =
+        rtems_bdbuf_get_buffer_for_read_ahead (shard, dd, media_block);
+
+      if (bd != NULL)
+        rtems_bdbuf_submit_read_ahead_request (shard, dd, bd, 1);
+    }
+
+    rtems_bdbuf_unlock_shard (shard);
+  }
+}
+
+/**
+ * Carry out one pending read-ahead request of the device. A pending peek
+ * request is carried out before the stream requests. The device is queued
+ * again if it has further pending requests.
+ *
+ * @param dd The disk device.
+ */
+static void
+rtems_bdbuf_read_ahead (rtems_disk_device *dd)
+{
+  rtems_blkdev_read_ahead_stream *stream = NULL;
+  rtems_blkdev_bnum               block;
+  uint32_t                        nr_blocks;
+  uint32_t                        stride = 1;
+
+  rtems_bdbuf_lock_device (dd);
+
+  nr_blocks = dd->read_ahead.nr_blocks;
+
+  if (nr_blocks != RTEMS_DISK_READ_AHEAD_SIZE_AUTO)
+  {
+    block = dd->read_ahead.next;
+    dd->read_ahead.nr_blocks = RTEMS_DISK_READ_AHEAD_SIZE_AUTO;
+  }
+  else if (dd->read_ahead.pending != 0)
+  {
+    size_t s = (size_t) __builtin_ctz (dd->read_ahead.pending);
+
+    dd->read_ahead.pending &= ~(UINT32_C (1) << s);
+    stream = &dd->read_ahead.streams[s];
+    block = stream->next;
+    stride = stream->stride;
+  }
+  else
+  {
+    rtems_bdbuf_unlock_device (dd);
+    return;
+  }
+
+  rtems_bdbuf_unlock_device (dd);
+
+  if (stride > 1)
+    rtems_bdbuf_read_ahead_strided (dd, stream, block);
+  else
+    rtems_bdbuf_read_ahead_consecutive (dd, stream, block, nr_blocks);
+
+  rtems_bdbuf_lock_device (dd);
+
+  if (dd->read_ahead.pending != 0
+      || dd->read_ahead.nr_blocks != RTEMS_DISK_READ_AHEAD_SIZE_AUTO)
+    rtems_bdbuf_read_ahead_activate (dd);
+
+  rtems_bdbuf_unlock_device (dd);
+}
+
+static rtems_task
+rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
+{
+  while (bdbuf_cache.read_ahead_enabled)
+  {
+    rtems_disk_device *dd;
+
+    rtems_bdbuf_wait_for_event (RTEMS_BDBUF_READ_AHEAD_WAKE_UP);
+
+    while ((dd = rtems_bdbuf_read_ahead_get_next ()) != NULL)
+      rtems_bdbuf_read_ahead (dd);
+
+    rtems_bdbuf_read_ahead_flush ();
   }
 
   rtems_task_exit();
@@ -3025,14 +3926,49 @@ rtems_bdbuf_read_ahead_task (rtems_task_argument arg)
 void rtems_bdbuf_get_device_stats (const rtems_disk_device *dd,
                                    rtems_blkdev_stats      *stats)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_disk_device *lock_dd = RTEMS_DECONST (rtems_disk_device *, dd);
+
+  rtems_bdbuf_lock_device (lock_dd);
   *stats = dd->stats;
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_device (lock_dd);
 }
 
 void rtems_bdbuf_reset_device_stats (rtems_disk_device *dd)
 {
-  rtems_bdbuf_lock_cache ();
+  rtems_bdbuf_lock_device (dd);
   memset (&dd->stats, 0, sizeof(dd->stats));
-  rtems_bdbuf_unlock_cache ();
+  rtems_bdbuf_unlock_device (dd);
+}
+
+void rtems_bdbuf_get_cache_stats (rtems_bdbuf_cache_stats *stats)
+{
+  size_t s;
+
+  memset (stats, 0, sizeof(*stats));
+
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards[s];
+
+    rtems_bdbuf_lock_shard (shard);
+    stats->hits += shard->stats.hits;
+    stats->misses += shard->stats.misses;
+    stats->evictions += shard->stats.evictions;
+    stats->promotions += shard->stats.promotions;
+    rtems_bdbuf_unlock_shard (shard);
+  }
+}
+
+void rtems_bdbuf_reset_cache_stats (void)
+{
+  size_t s;
+
+  for (s = 0; s < bdbuf_cache.shard_count; s++)
+  {
+    rtems_bdbuf_shard *shard = &bdbuf_cache.shards[s];
+
+    rtems_bdbuf_lock_shard (shard);
+    memset (&shard->stats, 0, sizeof(shard->stats));
+    rtems_bdbuf_unlock_shard (shard);
+  }
 }
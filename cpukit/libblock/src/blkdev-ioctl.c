@@ -72,6 +72,17 @@ rtems_blkdev_ioctl(rtems_disk_device *dd, uint32_t req, void *argp)
             rtems_bdbuf_reset_device_stats(dd);
             break;
 
+        case RTEMS_BLKIO_UNPLUG:
+            break;
+
+        case RTEMS_BLKIO_GETQUEUEDEPTH:
+            *(uint32_t *) argp = rtems_disk_get_queue_depth(dd);
+            break;
+
+        case RTEMS_BLKIO_SETQUEUEDEPTH:
+            rtems_blkdev_set_queue_depth(dd, *(uint32_t *) argp);
+            break;
+
         default:
             errno = EINVAL;
             rc = -1;
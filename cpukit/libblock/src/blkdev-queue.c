@@ -0,0 +1,88 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup rtems_blkdev
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_blkdev_submit_request(), rtems_blkdev_unplug(), and
+ *   rtems_blkdev_set_queue_depth().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/blkdev.h>
+
+void rtems_blkdev_submit_request(
+  rtems_disk_device *dd,
+  rtems_blkdev_request *req
+)
+{
+  rtems_disk_device *phys_dd = dd->phys_dev;
+
+  if (phys_dd->queue_depth != RTEMS_DISK_QUEUE_DEPTH_UNLIMITED) {
+    rtems_counting_semaphore_wait(&phys_dd->queue_slots);
+    req->dd = phys_dd;
+  } else {
+    req->dd = NULL;
+  }
+
+  /* The return value will be ignored for transfer requests */
+  (*dd->ioctl)(phys_dd, RTEMS_BLKIO_REQUEST, req);
+}
+
+void rtems_blkdev_unplug(rtems_disk_device *dd)
+{
+  rtems_disk_device *phys_dd = dd->phys_dev;
+
+  if (phys_dd->queue_depth != RTEMS_DISK_QUEUE_DEPTH_UNLIMITED) {
+    (*dd->ioctl)(phys_dd, RTEMS_BLKIO_UNPLUG, NULL);
+  }
+}
+
+void rtems_blkdev_set_queue_depth(rtems_disk_device *dd, uint32_t queue_depth)
+{
+  rtems_disk_device *phys_dd = dd->phys_dev;
+
+  if (phys_dd->queue_depth != RTEMS_DISK_QUEUE_DEPTH_UNLIMITED) {
+    rtems_counting_semaphore_destroy(&phys_dd->queue_slots);
+  }
+
+  if (queue_depth != RTEMS_DISK_QUEUE_DEPTH_UNLIMITED) {
+    rtems_counting_semaphore_init(
+      &phys_dd->queue_slots,
+      "disk queue",
+      queue_depth
+    );
+  }
+
+  phys_dd->queue_depth = queue_depth;
+}
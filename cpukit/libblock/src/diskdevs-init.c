@@ -42,6 +42,16 @@
 
 #include <string.h>
 
+static void init_read_ahead(rtems_blkdev_read_ahead *read_ahead)
+{
+  size_t i;
+
+  for (i = 0; i < RTEMS_DISK_READ_AHEAD_STREAM_COUNT; ++i) {
+    read_ahead->streams[i].last = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+    read_ahead->streams[i].trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  }
+}
+
 rtems_status_code rtems_disk_init_phys(
   rtems_disk_device *dd,
   uint32_t block_size,
@@ -59,7 +69,8 @@ rtems_status_code rtems_disk_init_phys(
   dd->media_block_size = block_size;
   dd->ioctl = handler;
   dd->driver_data = driver_data;
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  init_read_ahead(&dd->read_ahead);
+  rtems_mutex_init(&dd->lock, "disk");
 
   if (block_count > 0) {
     if ((*handler)(dd, RTEMS_BLKIO_CAPABILITIES, &dd->capabilities) != 0) {
@@ -91,7 +102,8 @@ rtems_status_code rtems_disk_init_log(
   dd->media_block_size = phys_dd->media_block_size;
   dd->ioctl = phys_dd->ioctl;
   dd->driver_data = phys_dd->driver_data;
-  dd->read_ahead.trigger = RTEMS_DISK_READ_AHEAD_NO_TRIGGER;
+  init_read_ahead(&dd->read_ahead);
+  rtems_mutex_init(&dd->lock, "disk");
 
   if (phys_dd->phys_dev == phys_dd) {
     rtems_blkdev_bnum phys_block_count = phys_dd->size;
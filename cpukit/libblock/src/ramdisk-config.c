@@ -48,6 +48,8 @@ ramdisk_initialize(
         name [sizeof(RAMDISK_DEVICE_BASE_NAME) - 1] += i;
         r->block_size = c->block_size;
         r->block_num = c->block_num;
+        rtems_mutex_init(&r->lock, "RAM Disk");
+        rtems_chain_initialize_empty(&r->pending);
         if (c->location == NULL)
         {
             r->malloced = true;
@@ -95,6 +95,69 @@ ramdisk_write(struct ramdisk *rd, rtems_blkdev_request *req)
     return 0;
 }
 
+static int
+ramdisk_transfer(struct ramdisk *rd, rtems_blkdev_request *req)
+{
+    if (req->req == RTEMS_BLKDEV_REQ_READ)
+        return ramdisk_read(rd, req);
+    else
+        return ramdisk_write(rd, req);
+}
+
+/*
+ * Completes the held back requests.  The most recent request is completed
+ * first, so the requests complete out of order.  The requests are completed
+ * without the lock, since a request done callback may submit a new request.
+ */
+static void
+ramdisk_complete_pending(struct ramdisk *rd)
+{
+    rtems_chain_control pending;
+    rtems_chain_node *node;
+
+    rtems_chain_initialize_empty(&pending);
+
+    rtems_mutex_lock(&rd->lock);
+    while ((node = rtems_chain_get_first_unprotected(&rd->pending)) != NULL)
+    {
+        rtems_chain_prepend_unprotected(&pending, node);
+    }
+    rd->pending_count = 0;
+    rtems_mutex_unlock(&rd->lock);
+
+    while ((node = rtems_chain_get_first_unprotected(&pending)) != NULL)
+    {
+        ramdisk_transfer(rd, RTEMS_CONTAINER_OF(node, rtems_blkdev_request,
+                                                link));
+    }
+}
+
+/*
+ * Holds back the request if the queue depth of the disk is limited.  The held
+ * back requests are completed once the queue is full or the disk is unplugged.
+ */
+static int
+ramdisk_submit(rtems_disk_device *dd, struct ramdisk *rd,
+               rtems_blkdev_request *req)
+{
+    uint32_t queue_depth = rtems_disk_get_queue_depth(dd);
+    bool full;
+
+    if (queue_depth == RTEMS_DISK_QUEUE_DEPTH_UNLIMITED)
+        return ramdisk_transfer(rd, req);
+
+    rtems_mutex_lock(&rd->lock);
+    rtems_chain_append_unprotected(&rd->pending, &req->link);
+    ++rd->pending_count;
+    full = rd->pending_count >= queue_depth;
+    rtems_mutex_unlock(&rd->lock);
+
+    if (full)
+        ramdisk_complete_pending(rd);
+
+    return 0;
+}
+
 int
 ramdisk_ioctl(rtems_disk_device *dd, uint32_t req, void *argp)
 {
@@ -109,10 +172,8 @@ ramdisk_ioctl(rtems_disk_device *dd, uint32_t req, void *argp)
             switch (r->req)
             {
                 case RTEMS_BLKDEV_REQ_READ:
-                    return ramdisk_read(rd, r);
-
                 case RTEMS_BLKDEV_REQ_WRITE:
-                    return ramdisk_write(rd, r);
+                    return ramdisk_submit(dd, rd, r);
 
                 default:
                     errno = EINVAL;
@@ -121,6 +182,10 @@ ramdisk_ioctl(rtems_disk_device *dd, uint32_t req, void *argp)
             break;
         }
 
+        case RTEMS_BLKIO_UNPLUG:
+            ramdisk_complete_pending(rd);
+            return 0;
+
         case RTEMS_BLKIO_DELETED:
             if (rd->free_at_delete_request) {
               ramdisk_free(rd);
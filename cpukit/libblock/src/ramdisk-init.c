@@ -71,6 +71,8 @@ ramdisk *ramdisk_allocate(
   rd->area = area_begin;
   rd->trace = trace;
   rd->initialized = true;
+  rtems_mutex_init(&rd->lock, "RAM Disk");
+  rtems_chain_initialize_empty(&rd->pending);
 
   return rd;
 }
@@ -91,6 +91,7 @@ static rtems_status_code sparse_disk_initialize( rtems_sparse_disk *sd,
   sd->delete_handler = sparse_disk_delete;
 
   rtems_mutex_init( &sd->mutex, "Sparse Disk" );
+  rtems_chain_initialize_empty( &sd->pending );
 
   data                  += sizeof( rtems_sparse_disk );
 
@@ -280,6 +281,65 @@ static int sparse_disk_read_write(
   return 0;
 }
 
+/*
+ * Complete the held back requests.  The most recent request is completed
+ * first, so the requests complete out of order.
+ */
+static void sparse_disk_complete_pending( rtems_sparse_disk *sparse_disk )
+{
+  rtems_chain_control   pending;
+  rtems_chain_node     *node;
+  rtems_blkdev_request *req;
+
+  rtems_chain_initialize_empty( &pending );
+
+  rtems_mutex_lock( &sparse_disk->mutex );
+
+  while ( NULL != ( node = rtems_chain_get_first_unprotected(
+                             &sparse_disk->pending ) ) ) {
+    rtems_chain_prepend_unprotected( &pending, node );
+  }
+
+  sparse_disk->pending_count = 0;
+  rtems_mutex_unlock( &sparse_disk->mutex );
+
+  while ( NULL != ( node = rtems_chain_get_first_unprotected( &pending ) ) ) {
+    req = RTEMS_CONTAINER_OF( node, rtems_blkdev_request, link );
+    sparse_disk_read_write( sparse_disk,
+                            req,
+                            req->req == RTEMS_BLKDEV_REQ_READ );
+  }
+}
+
+/*
+ * Hold back the request if the queue depth of the disk is limited until the
+ * queue is full or the disk is unplugged
+ */
+static int sparse_disk_submit(
+  rtems_disk_device    *dd,
+  rtems_sparse_disk    *sparse_disk,
+  rtems_blkdev_request *req )
+{
+  uint32_t queue_depth = rtems_disk_get_queue_depth( dd );
+  bool     full;
+
+  if ( RTEMS_DISK_QUEUE_DEPTH_UNLIMITED == queue_depth )
+    return sparse_disk_read_write( sparse_disk,
+                                   req,
+                                   req->req == RTEMS_BLKDEV_REQ_READ );
+
+  rtems_mutex_lock( &sparse_disk->mutex );
+  rtems_chain_append_unprotected( &sparse_disk->pending, &req->link );
+  ++sparse_disk->pending_count;
+  full = sparse_disk->pending_count >= queue_depth;
+  rtems_mutex_unlock( &sparse_disk->mutex );
+
+  if ( full )
+    sparse_disk_complete_pending( sparse_disk );
+
+  return 0;
+}
+
 /*
  * ioctl handler to be passed to the block device handler
  */
@@ -293,10 +353,14 @@ static int sparse_disk_ioctl( rtems_disk_device *dd, uint32_t req, void *argp )
     switch ( r->req ) {
       case RTEMS_BLKDEV_REQ_READ:
       case RTEMS_BLKDEV_REQ_WRITE:
-        return sparse_disk_read_write( sd, r, r->req == RTEMS_BLKDEV_REQ_READ );
+        return sparse_disk_submit( dd, sd, r );
       default:
         break;
     }
+  } else if ( RTEMS_BLKIO_UNPLUG == req ) {
+    sparse_disk_complete_pending( sd );
+
+    return 0;
   } else if ( RTEMS_BLKIO_DELETED == req ) {
     rtems_mutex_destroy( &sd->mutex );
 
@@ -89,17 +89,32 @@ void free(
   void *ptr
 )
 {
+  Malloc_System_state state;
+
   if ( !ptr )
     return;
 
+  state = _Malloc_System_state();
+
   /*
    *  Do not attempt to free memory if in a critical section or ISR.
    */
-  if ( _Malloc_System_state() != MALLOC_SYSTEM_STATE_NORMAL ) {
+  if ( state != MALLOC_SYSTEM_STATE_NORMAL ) {
+      if (
+        state == MALLOC_SYSTEM_STATE_NO_ALLOCATION
+          && _Malloc_Cache_free( ptr, true )
+      ) {
+        return;
+      }
+
       _Malloc_Deferred_free(ptr);
       return;
   }
 
+  if ( _Malloc_Cache_free( ptr, false ) ) {
+    return;
+  }
+
   if ( !_Protected_heap_Free( RTEMS_Malloc_Heap, ptr ) ) {
     rtems_fatal( RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE, (rtems_fatal_code) ptr );
   }
@@ -85,6 +85,14 @@ void *rtems_heap_allocate_aligned_with_boundary(
 
   switch ( _Malloc_System_state() ) {
     case MALLOC_SYSTEM_STATE_NORMAL:
+      if ( alignment == 0 && boundary == 0 ) {
+        p = _Malloc_Cache_allocate( size );
+
+        if ( p != NULL ) {
+          break;
+        }
+      }
+
       _RTEMS_Lock_allocator();
       _Malloc_Process_deferred_frees();
       p = _Heap_Allocate_aligned_with_boundary(
@@ -123,6 +131,15 @@ void *rtems_heap_allocate_aligned_with_boundary(
   return p;
 }
 
+void rtems_malloc_cache_flush( void )
+{
+  const rtems_malloc_cache_operations *cache = rtems_malloc_cache;
+
+  if ( cache != NULL ) {
+    ( *cache->flush )();
+  }
+}
+
 void *rtems_malloc( size_t size )
 {
   if ( size == 0 ) {
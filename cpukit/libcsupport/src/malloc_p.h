@@ -46,6 +46,39 @@ Malloc_System_state _Malloc_System_state( void );
 
 void _Malloc_Process_deferred_frees( void );
 
+static inline void *_Malloc_Cache_allocate( size_t size )
+{
+  const rtems_malloc_cache_operations *cache = rtems_malloc_cache;
+
+  if ( cache == NULL ) {
+    return NULL;
+  }
+
+  return ( *cache->allocate )( size );
+}
+
+static inline bool _Malloc_Cache_free( void *ptr, bool deferred )
+{
+  const rtems_malloc_cache_operations *cache = rtems_malloc_cache;
+
+  if ( cache == NULL ) {
+    return false;
+  }
+
+  return ( *cache->free )( ptr, deferred );
+}
+
+static inline size_t _Malloc_Cache_usable_size( void *ptr )
+{
+  const rtems_malloc_cache_operations *cache = rtems_malloc_cache;
+
+  if ( cache == NULL ) {
+    return 0;
+  }
+
+  return ( *cache->usable_size )( ptr );
+}
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
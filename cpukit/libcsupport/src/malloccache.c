@@ -0,0 +1,731 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup MallocSupport
+ *
+ * @brief This source file contains the implementation of the per-processor C
+ *   Program Heap cache.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#ifdef RTEMS_NEWLIB
+#include "malloc_p.h"
+
+#include <rtems/sysinit.h>
+#include <rtems/score/apimutex.h>
+#include <rtems/score/assert.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/heapimpl.h>
+#include <rtems/score/isrlock.h>
+#include <rtems/score/percpudata.h>
+
+/*
+ * The cache has a magazine for each power of two size class from 16 bytes up
+ * to 512 bytes.  Each processor has its own set of magazines protected by a
+ * processor-specific lock, so in the common case the lock is not contended.
+ * An empty magazine is refilled from the heap and a full magazine is drained
+ * to the heap in batches, so that the heap is only modified once per batch.
+ *
+ * Each memory area handed out by the cache is preceded by a tag which
+ * contains the size class, the heap block size, and the index of the owner
+ * processor.  The owner is the processor which handed out the memory area.
+ * The tag is protected by a check value derived from the memory area address,
+ * so that the free path can classify a memory area without obtaining the
+ * allocator lock.  A memory area which was not handed out by the cache is
+ * preceded by its heap block header or alignment padding and fails the check.
+ * The cache invalidates the tag before it returns a memory area to the heap.
+ *
+ * A memory area freed on another processor or in a context which may not
+ * obtain the allocator lock (for example interrupt context) is pushed to the
+ * lock-free remote free list of the owner, so that memory areas circulate
+ * between producers and consumers running on different processors without
+ * going through the heap.
+ */
+
+#define MALLOC_CACHE_MIN_SIZE_LOG2 4
+
+#define MALLOC_CACHE_CLASS_COUNT 6
+
+#define MALLOC_CACHE_MAX_SIZE \
+  ( (size_t) 1 << ( MALLOC_CACHE_MIN_SIZE_LOG2 + MALLOC_CACHE_CLASS_COUNT - 1 ) )
+
+#define MALLOC_CACHE_MAGAZINE_CAPACITY 32
+
+#define MALLOC_CACHE_BATCH_COUNT 16
+
+#define MALLOC_CACHE_TAG_CLASS_BITS 3
+
+#define MALLOC_CACHE_TAG_OWNER_BITS 13
+
+#define MALLOC_CACHE_TAG_BLOCK_SIZE_SHIFT \
+  ( MALLOC_CACHE_TAG_CLASS_BITS + MALLOC_CACHE_TAG_OWNER_BITS )
+
+#define MALLOC_CACHE_TAG_CHECK 0x6d63c0deU
+
+typedef struct {
+  uint32_t info;
+  uint32_t check;
+} Malloc_Cache_tag;
+
+#define MALLOC_CACHE_HEADER_SIZE \
+  RTEMS_ALIGN_UP( sizeof( Malloc_Cache_tag ), CPU_HEAP_ALIGNMENT )
+
+RTEMS_STATIC_ASSERT(
+  MALLOC_CACHE_CLASS_COUNT <= ( 1 << MALLOC_CACHE_TAG_CLASS_BITS ),
+  Malloc_Cache_tag_class
+);
+
+RTEMS_STATIC_ASSERT(
+  CPU_MAXIMUM_PROCESSORS <= ( 1 << MALLOC_CACHE_TAG_OWNER_BITS ),
+  Malloc_Cache_tag_owner
+);
+
+/*
+ * A memory area held by the cache begins at the heap allocation area which
+ * contains the tag and the size class area.
+ */
+typedef struct Malloc_Cache_object {
+  struct Malloc_Cache_object *next;
+  uint32_t                    block_size;
+  uint32_t                    cache_class;
+} Malloc_Cache_object;
+
+RTEMS_STATIC_ASSERT(
+  sizeof( Malloc_Cache_object ) <=
+    MALLOC_CACHE_HEADER_SIZE + ( (size_t) 1 << MALLOC_CACHE_MIN_SIZE_LOG2 ),
+  Malloc_Cache_object
+);
+
+typedef struct {
+  Malloc_Cache_object *first;
+  uint32_t             count;
+} Malloc_Cache_magazine;
+
+typedef struct {
+  ISR_lock_Control      Lock;
+  Malloc_Cache_magazine Magazines[ MALLOC_CACHE_CLASS_COUNT ];
+  uintptr_t             cached_count;
+  uintptr_t             cached_size;
+  Atomic_Uintptr        remote_free;
+} Malloc_Cache;
+
+PER_CPU_DATA_NEED_INITIALIZATION();
+
+static PER_CPU_DATA_ITEM( Malloc_Cache, _Malloc_Cache );
+
+static Malloc_Cache *_Malloc_Cache_get( const Per_CPU_Control *cpu )
+{
+  Malloc_Cache *cache;
+
+  cache = PER_CPU_DATA_GET( cpu, Malloc_Cache, _Malloc_Cache );
+
+  return cache;
+}
+
+static Malloc_Cache *_Malloc_Cache_acquire( ISR_lock_Context *lock_context )
+{
+  Malloc_Cache *cache;
+
+  _ISR_lock_ISR_disable( lock_context );
+  cache = _Malloc_Cache_get( _Per_CPU_Get() );
+  _ISR_lock_Acquire( &cache->Lock, lock_context );
+
+  return cache;
+}
+
+static void _Malloc_Cache_release(
+  Malloc_Cache     *cache,
+  ISR_lock_Context *lock_context
+)
+{
+  _ISR_lock_Release_and_ISR_enable( &cache->Lock, lock_context );
+}
+
+static size_t _Malloc_Cache_class_size( size_t cache_class )
+{
+  return (size_t) 1 << ( MALLOC_CACHE_MIN_SIZE_LOG2 + cache_class );
+}
+
+static size_t _Malloc_Cache_allocation_class( size_t size )
+{
+  if ( size <= _Malloc_Cache_class_size( 0 ) ) {
+    return 0;
+  }
+
+  return (size_t) ( 8 * sizeof( unsigned long ) )
+    - (size_t) __builtin_clzl( (unsigned long) ( size - 1 ) )
+    - MALLOC_CACHE_MIN_SIZE_LOG2;
+}
+
+static Malloc_Cache_tag *_Malloc_Cache_tag( const void *ptr )
+{
+  return (Malloc_Cache_tag *) ptr - 1;
+}
+
+static uint32_t _Malloc_Cache_tag_check( const void *ptr, uint32_t info )
+{
+  return info ^ (uint32_t) (uintptr_t) ptr ^ MALLOC_CACHE_TAG_CHECK;
+}
+
+static size_t _Malloc_Cache_tag_class( uint32_t info )
+{
+  return info & ( ( 1U << MALLOC_CACHE_TAG_CLASS_BITS ) - 1 );
+}
+
+static uint32_t _Malloc_Cache_tag_owner( uint32_t info )
+{
+  return ( info >> MALLOC_CACHE_TAG_CLASS_BITS )
+    & ( ( 1U << MALLOC_CACHE_TAG_OWNER_BITS ) - 1 );
+}
+
+static uint32_t _Malloc_Cache_tag_block_size( uint32_t info )
+{
+  return info >> MALLOC_CACHE_TAG_BLOCK_SIZE_SHIFT;
+}
+
+static void *_Malloc_Cache_hand_out( Malloc_Cache_object *object )
+{
+  void             *ptr;
+  Malloc_Cache_tag *tag;
+  uint32_t          info;
+
+  ptr = (void *) ( (uintptr_t) object + MALLOC_CACHE_HEADER_SIZE );
+  info = object->cache_class
+    | ( _Per_CPU_Get_index( _Per_CPU_Get_snapshot() )
+      << MALLOC_CACHE_TAG_CLASS_BITS )
+    | ( object->block_size << MALLOC_CACHE_TAG_BLOCK_SIZE_SHIFT );
+  tag = _Malloc_Cache_tag( ptr );
+  tag->info = info;
+  tag->check = _Malloc_Cache_tag_check( ptr, info );
+
+  return ptr;
+}
+
+/*
+ * Checks that the memory area was handed out by the cache.  This function
+ * does not obtain the allocator lock.  The tag of a memory area handed out by
+ * the cache is only modified by the cache after the memory area was freed.
+ */
+static bool _Malloc_Cache_get_tag( const void *ptr, uint32_t *info )
+{
+  const Heap_Control     *heap;
+  const Malloc_Cache_tag *tag;
+  uint32_t                tag_info;
+  size_t                  cache_class;
+
+  heap = RTEMS_Malloc_Heap;
+
+  if (
+    (uintptr_t) ptr < heap->area_begin + MALLOC_CACHE_HEADER_SIZE
+      || (uintptr_t) ptr >= heap->area_end
+      || ( (uintptr_t) ptr % CPU_HEAP_ALIGNMENT ) != 0
+  ) {
+    return false;
+  }
+
+  tag = _Malloc_Cache_tag( ptr );
+  tag_info = tag->info;
+
+  if ( tag->check != _Malloc_Cache_tag_check( ptr, tag_info ) ) {
+    return false;
+  }
+
+  cache_class = _Malloc_Cache_tag_class( tag_info );
+
+  if (
+    cache_class >= MALLOC_CACHE_CLASS_COUNT
+      || _Malloc_Cache_tag_owner( tag_info )
+        >= rtems_configuration_get_maximum_processors()
+      || _Malloc_Cache_tag_block_size( tag_info )
+        < MALLOC_CACHE_HEADER_SIZE + _Malloc_Cache_class_size( cache_class )
+  ) {
+    return false;
+  }
+
+  *info = tag_info;
+  return true;
+}
+
+static void _Malloc_Cache_invalidate_tag( Malloc_Cache_object *object )
+{
+  void             *ptr;
+  Malloc_Cache_tag *tag;
+
+  ptr = (void *) ( (uintptr_t) object + MALLOC_CACHE_HEADER_SIZE );
+  tag = _Malloc_Cache_tag( ptr );
+  tag->check = ~_Malloc_Cache_tag_check( ptr, tag->info );
+}
+
+static void _Malloc_Cache_push(
+  Malloc_Cache          *cache,
+  Malloc_Cache_magazine *magazine,
+  Malloc_Cache_object   *object
+)
+{
+  object->next = magazine->first;
+  magazine->first = object;
+  ++magazine->count;
+  ++cache->cached_count;
+  cache->cached_size += object->block_size;
+}
+
+static Malloc_Cache_object *_Malloc_Cache_pop(
+  Malloc_Cache          *cache,
+  Malloc_Cache_magazine *magazine
+)
+{
+  Malloc_Cache_object *object;
+
+  object = magazine->first;
+  magazine->first = object->next;
+  --magazine->count;
+  --cache->cached_count;
+  cache->cached_size -= object->block_size;
+
+  return object;
+}
+
+static void _Malloc_Cache_push_remote(
+  Malloc_Cache        *cache,
+  Malloc_Cache_object *object
+)
+{
+  uintptr_t first;
+
+  first = _Atomic_Load_uintptr( &cache->remote_free, ATOMIC_ORDER_RELAXED );
+
+  do {
+    object->next = (Malloc_Cache_object *) first;
+  } while (
+    !_Atomic_Compare_exchange_uintptr(
+      &cache->remote_free,
+      &first,
+      (uintptr_t) object,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    )
+  );
+}
+
+static void _Malloc_Cache_free_to_heap( Malloc_Cache_object *object )
+{
+  if ( object == NULL ) {
+    return;
+  }
+
+  _RTEMS_Lock_allocator();
+
+  do {
+    Malloc_Cache_object *next;
+
+    next = object->next;
+    _Malloc_Cache_invalidate_tag( object );
+
+    if ( !_Heap_Free( RTEMS_Malloc_Heap, object ) ) {
+      _RTEMS_Unlock_allocator();
+      rtems_fatal(
+        RTEMS_FATAL_SOURCE_INVALID_HEAP_FREE,
+        (rtems_fatal_code) object
+      );
+    }
+
+    object = next;
+  } while ( object != NULL );
+
+  _RTEMS_Unlock_allocator();
+}
+
+/*
+ * Moves the memory areas to the magazines.  Returns the memory areas which do
+ * not fit into the magazines.  They shall be freed to the heap by the caller
+ * after the cache lock is released.
+ */
+static Malloc_Cache_object *_Malloc_Cache_put(
+  Malloc_Cache        *cache,
+  Malloc_Cache_object *object
+)
+{
+  Malloc_Cache_object *overflow;
+
+  overflow = NULL;
+
+  while ( object != NULL ) {
+    Malloc_Cache_magazine *magazine;
+    Malloc_Cache_object   *next;
+
+    next = object->next;
+    magazine = &cache->Magazines[ object->cache_class ];
+
+    if ( magazine->count < MALLOC_CACHE_MAGAZINE_CAPACITY ) {
+      _Malloc_Cache_push( cache, magazine, object );
+    } else {
+      object->next = overflow;
+      overflow = object;
+    }
+
+    object = next;
+  }
+
+  return overflow;
+}
+
+/*
+ * Moves the memory areas of the remote free list to the magazines.  Returns
+ * the memory areas which do not fit into the magazines.
+ */
+static Malloc_Cache_object *_Malloc_Cache_take_remote_frees(
+  Malloc_Cache *cache
+)
+{
+  Malloc_Cache_object *object;
+
+  if (
+    _Atomic_Load_uintptr( &cache->remote_free, ATOMIC_ORDER_RELAXED ) == 0
+  ) {
+    return NULL;
+  }
+
+  object = (Malloc_Cache_object *) _Atomic_Exchange_uintptr(
+    &cache->remote_free,
+    0,
+    ATOMIC_ORDER_ACQUIRE
+  );
+
+  return _Malloc_Cache_put( cache, object );
+}
+
+static void *_Malloc_Cache_refill( size_t cache_class )
+{
+  Heap_Control        *heap;
+  size_t               size;
+  Malloc_Cache_object *first;
+  Malloc_Cache_object *objects;
+  Malloc_Cache_object *overflow;
+  Malloc_Cache        *cache;
+  ISR_lock_Context     lock_context;
+  int                  i;
+
+  heap = RTEMS_Malloc_Heap;
+  size = MALLOC_CACHE_HEADER_SIZE + _Malloc_Cache_class_size( cache_class );
+  objects = NULL;
+
+  _RTEMS_Lock_allocator();
+  _Malloc_Process_deferred_frees();
+
+  for ( i = 0; i < MALLOC_CACHE_BATCH_COUNT; ++i ) {
+    Malloc_Cache_object *object;
+    uintptr_t            block_size;
+
+    object = _Heap_Allocate( heap, size );
+
+    if ( object == NULL ) {
+      break;
+    }
+
+    /*
+     * The C Program Heap uses the CPU alignment as the page size, so the
+     * block size of a cached memory area fits into the tag.
+     */
+    block_size = _Heap_Block_size(
+      _Heap_Block_of_alloc_area( (uintptr_t) object, heap->page_size )
+    );
+    _Assert(
+      ( block_size >> ( 32 - MALLOC_CACHE_TAG_BLOCK_SIZE_SHIFT ) ) == 0
+    );
+
+    object->block_size = (uint32_t) block_size;
+    object->cache_class = (uint32_t) cache_class;
+    object->next = objects;
+    objects = object;
+  }
+
+  _RTEMS_Unlock_allocator();
+
+  if ( objects == NULL ) {
+    return NULL;
+  }
+
+  first = objects;
+  objects = first->next;
+
+  if ( objects != NULL ) {
+    cache = _Malloc_Cache_acquire( &lock_context );
+    overflow = _Malloc_Cache_put( cache, objects );
+    _Malloc_Cache_release( cache, &lock_context );
+    _Malloc_Cache_free_to_heap( overflow );
+  }
+
+  return _Malloc_Cache_hand_out( first );
+}
+
+static void *_Malloc_Cache_allocate_per_cpu( size_t size )
+{
+  Malloc_Cache          *cache;
+  Malloc_Cache_magazine *magazine;
+  Malloc_Cache_object   *object;
+  Malloc_Cache_object   *overflow;
+  ISR_lock_Context       lock_context;
+  size_t                 cache_class;
+
+  if ( size > MALLOC_CACHE_MAX_SIZE ) {
+    return NULL;
+  }
+
+  cache_class = _Malloc_Cache_allocation_class( size );
+  cache = _Malloc_Cache_acquire( &lock_context );
+  overflow = _Malloc_Cache_take_remote_frees( cache );
+  magazine = &cache->Magazines[ cache_class ];
+
+  if ( magazine->first != NULL ) {
+    object = _Malloc_Cache_pop( cache, magazine );
+  } else {
+    object = NULL;
+  }
+
+  _Malloc_Cache_release( cache, &lock_context );
+  _Malloc_Cache_free_to_heap( overflow );
+
+  if ( object != NULL ) {
+    return _Malloc_Cache_hand_out( object );
+  }
+
+  return _Malloc_Cache_refill( cache_class );
+}
+
+static bool _Malloc_Cache_free_per_cpu( void *ptr, bool deferred )
+{
+  Malloc_Cache          *cache;
+  Malloc_Cache_magazine *magazine;
+  Malloc_Cache_object   *object;
+  Malloc_Cache_object   *overflow;
+  ISR_lock_Context       lock_context;
+  uint32_t               info;
+  uint32_t               owner;
+  uint32_t               i;
+
+  if ( !_Malloc_Cache_get_tag( ptr, &info ) ) {
+    return false;
+  }
+
+  owner = _Malloc_Cache_tag_owner( info );
+  object = (Malloc_Cache_object *)
+    ( (uintptr_t) ptr - MALLOC_CACHE_HEADER_SIZE );
+  object->block_size = _Malloc_Cache_tag_block_size( info );
+  object->cache_class = (uint32_t) _Malloc_Cache_tag_class( info );
+
+  if ( deferred ) {
+    _Malloc_Cache_push_remote(
+      _Malloc_Cache_get( _Per_CPU_Get_by_index( owner ) ),
+      object
+    );
+
+    return true;
+  }
+
+  cache = _Malloc_Cache_acquire( &lock_context );
+
+  if ( owner != _Per_CPU_Get_index( _Per_CPU_Get() ) ) {
+    _Malloc_Cache_release( cache, &lock_context );
+    _Malloc_Cache_push_remote(
+      _Malloc_Cache_get( _Per_CPU_Get_by_index( owner ) ),
+      object
+    );
+
+    return true;
+  }
+
+  overflow = _Malloc_Cache_take_remote_frees( cache );
+  magazine = &cache->Magazines[ object->cache_class ];
+
+  if ( magazine->count >= MALLOC_CACHE_MAGAZINE_CAPACITY ) {
+    /* Drain a batch of the full magazine to the heap */
+    for ( i = 0; i < MALLOC_CACHE_BATCH_COUNT; ++i ) {
+      Malloc_Cache_object *drained;
+
+      drained = _Malloc_Cache_pop( cache, magazine );
+      drained->next = overflow;
+      overflow = drained;
+    }
+  }
+
+  _Malloc_Cache_push( cache, magazine, object );
+  _Malloc_Cache_release( cache, &lock_context );
+  _Malloc_Cache_free_to_heap( overflow );
+
+  return true;
+}
+
+static size_t _Malloc_Cache_usable_size_per_cpu( void *ptr )
+{
+  uint32_t info;
+
+  if ( !_Malloc_Cache_get_tag( ptr, &info ) ) {
+    return 0;
+  }
+
+  return _Malloc_Cache_class_size( _Malloc_Cache_tag_class( info ) );
+}
+
+static void _Malloc_Cache_flush_per_cpu( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Cache        *cache;
+    Malloc_Cache_object *objects;
+    Malloc_Cache_object *remote;
+    ISR_lock_Context     lock_context;
+    size_t               cache_class;
+
+    cache = _Malloc_Cache_get( _Per_CPU_Get_by_index( cpu_index ) );
+    objects = NULL;
+
+    _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+
+    for (
+      cache_class = 0;
+      cache_class < MALLOC_CACHE_CLASS_COUNT;
+      ++cache_class
+    ) {
+      Malloc_Cache_magazine *magazine;
+
+      magazine = &cache->Magazines[ cache_class ];
+
+      while ( magazine->first != NULL ) {
+        Malloc_Cache_object *object;
+
+        object = magazine->first;
+        magazine->first = object->next;
+        object->next = objects;
+        objects = object;
+      }
+
+      magazine->count = 0;
+    }
+
+    cache->cached_count = 0;
+    cache->cached_size = 0;
+
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+
+    remote = (Malloc_Cache_object *) _Atomic_Exchange_uintptr(
+      &cache->remote_free,
+      0,
+      ATOMIC_ORDER_ACQUIRE
+    );
+
+    _Malloc_Cache_free_to_heap( objects );
+    _Malloc_Cache_free_to_heap( remote );
+  }
+}
+
+static void _Malloc_Cache_get_information_per_cpu( Heap_Information *info )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  info->number = 0;
+  info->largest = 0;
+  info->total = 0;
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Cache     *cache;
+    ISR_lock_Context  lock_context;
+    size_t            cache_class;
+
+    cache = _Malloc_Cache_get( _Per_CPU_Get_by_index( cpu_index ) );
+
+    _ISR_lock_ISR_disable_and_acquire( &cache->Lock, &lock_context );
+    info->number += cache->cached_count;
+    info->total += cache->cached_size;
+
+    /* The largest block is in the largest non-empty size class */
+    cache_class = MALLOC_CACHE_CLASS_COUNT;
+
+    while ( cache_class > 0 ) {
+      const Malloc_Cache_object *object;
+
+      --cache_class;
+      object = cache->Magazines[ cache_class ].first;
+
+      if ( object != NULL ) {
+        do {
+          if ( object->block_size > info->largest ) {
+            info->largest = object->block_size;
+          }
+
+          object = object->next;
+        } while ( object != NULL );
+
+        break;
+      }
+    }
+
+    _ISR_lock_Release_and_ISR_enable( &cache->Lock, &lock_context );
+  }
+}
+
+const rtems_malloc_cache_operations rtems_malloc_per_cpu_cache = {
+  .allocate = _Malloc_Cache_allocate_per_cpu,
+  .free = _Malloc_Cache_free_per_cpu,
+  .usable_size = _Malloc_Cache_usable_size_per_cpu,
+  .flush = _Malloc_Cache_flush_per_cpu,
+  .get_information = _Malloc_Cache_get_information_per_cpu
+};
+
+static void _Malloc_Cache_initialize( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = rtems_configuration_get_maximum_processors();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Malloc_Cache *cache;
+
+    cache = _Malloc_Cache_get( _Per_CPU_Get_by_index( cpu_index ) );
+    _ISR_lock_Initialize( &cache->Lock, "Malloc Cache" );
+  }
+}
+
+RTEMS_SYSINIT_ITEM(
+  _Malloc_Cache_initialize,
+  RTEMS_SYSINIT_MALLOC,
+  RTEMS_SYSINIT_ORDER_FIRST
+);
+#endif
@@ -48,5 +48,24 @@ int malloc_info(
     return -1;
 
   _Protected_heap_Get_information( RTEMS_Malloc_Heap, the_info );
+
+  if ( rtems_malloc_cache != NULL ) {
+    Heap_Information *cached = &the_info->Cached;
+
+    ( *rtems_malloc_cache->get_information )( cached );
+
+    /*
+     * The blocks held by the cache are used blocks from the view of the heap.
+     * The cache may change concurrently, so make sure to not underflow.
+     */
+    if ( cached->number <= the_info->Used.number ) {
+      the_info->Used.number -= cached->number;
+    }
+
+    if ( cached->total <= the_info->Used.total ) {
+      the_info->Used.total -= cached->total;
+    }
+  }
+
   return 0;
 }
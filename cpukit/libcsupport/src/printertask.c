@@ -143,7 +143,7 @@ static void printer_task( rtems_task_argument arg )
     rtems_event_receive(
       PRINT_TASK_WAKE_UP,
       RTEMS_EVENT_ALL | RTEMS_WAIT,
-      RTEMS_NO_TIMEOUT,
+      ctx->poll_interval,
       &unused
     );
 
@@ -156,6 +156,10 @@ static void printer_task( rtems_task_argument arg )
           printer_task_append_buffer( ctx, &ctx->free_buffers, buffer );
           break;
         case ACTION_DRAIN:
+          if ( ctx->poll_handler != NULL ) {
+            ( *ctx->poll_handler )( fd );
+          }
+
           err = fsync(fd);
           _Assert_Unused_variable_equals(err, 0);
           sc = rtems_event_transient_send( buffer->action_data.task );
@@ -163,6 +167,10 @@ static void printer_task( rtems_task_argument arg )
           break;
       }
     }
+
+    if ( ctx->poll_handler != NULL ) {
+      ( *ctx->poll_handler )( fd );
+    }
   }
 }
 
@@ -0,0 +1,159 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIKernelCharIO
+ *
+ * @brief This source file contains the producer side of the printk() ring
+ *   buffers.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "printkring_p.h"
+
+#include <rtems/score/io.h>
+#include <rtems/score/isrlevel.h>
+#include <rtems/score/percpudata.h>
+
+#include <string.h>
+
+typedef struct {
+  size_t size;
+  char   data[ PRINTK_RING_RECORD_DATA_SIZE ];
+} Printk_ring_buffer;
+
+bool _Printk_ring_is_active;
+
+unsigned int _Printk_ring_mask;
+
+static Atomic_Uint _Printk_ring_sequence;
+
+PER_CPU_DATA_NEED_INITIALIZATION();
+
+static PER_CPU_DATA_ITEM( Printk_ring, _Printk_ring );
+
+Printk_ring *_Printk_ring_get( const Per_CPU_Control *cpu )
+{
+  return PER_CPU_DATA_GET( cpu, Printk_ring, _Printk_ring );
+}
+
+static void _Printk_ring_copy_in(
+  Printk_ring *ring,
+  unsigned int position,
+  const void  *data,
+  size_t       size
+)
+{
+  unsigned int offset;
+  size_t       first;
+
+  offset = position & _Printk_ring_mask;
+  first = (size_t) _Printk_ring_mask + 1 - offset;
+
+  if ( first > size ) {
+    first = size;
+  }
+
+  memcpy( &ring->data[ offset ], data, first );
+  memcpy( &ring->data[ 0 ], (const char *) data + first, size - first );
+}
+
+static void _Printk_ring_write( const char *data, size_t size )
+{
+  ISR_Level           level;
+  Printk_ring        *ring;
+  unsigned int        head;
+  unsigned int        tail;
+  unsigned int        needed;
+  Printk_ring_record  record;
+
+  needed = (unsigned int) ( sizeof( record ) + size );
+
+  /*
+   * Only the producers of the current processor write to the head of the
+   * ring.  They are serialized by disabling the interrupts.  The consumer
+   * only writes to the tail of the ring.
+   */
+  _ISR_Local_disable( level );
+  ring = _Printk_ring_get( _Per_CPU_Get() );
+  head = _Atomic_Load_uint( &ring->head, ATOMIC_ORDER_RELAXED );
+  tail = _Atomic_Load_uint( &ring->tail, ATOMIC_ORDER_ACQUIRE );
+
+  if ( needed <= _Printk_ring_mask + 1 - ( head - tail ) ) {
+    record.sequence = _Atomic_Fetch_add_uint(
+      &_Printk_ring_sequence,
+      1,
+      ATOMIC_ORDER_RELAXED
+    );
+    record.size = (uint32_t) size;
+    _Printk_ring_copy_in( ring, head, &record, sizeof( record ) );
+    _Printk_ring_copy_in( ring, head + sizeof( record ), data, size );
+    _Atomic_Store_uint( &ring->head, head + needed, ATOMIC_ORDER_RELEASE );
+  } else {
+    _Atomic_Fetch_add_uint( &ring->dropped, 1, ATOMIC_ORDER_RELAXED );
+  }
+
+  _ISR_Local_enable( level );
+}
+
+static void _Printk_ring_put_char( int c, void *arg )
+{
+  Printk_ring_buffer *buffer;
+
+  buffer = arg;
+  buffer->data[ buffer->size ] = (char) c;
+  ++buffer->size;
+
+  if ( buffer->size == sizeof( buffer->data ) ) {
+    _Printk_ring_write( &buffer->data[ 0 ], buffer->size );
+    buffer->size = 0;
+  }
+}
+
+int _Printk_ring_vprintf( const char *fmt, va_list ap )
+{
+  Printk_ring_buffer buffer;
+  int                n;
+
+  /*
+   * The record is formatted with interrupts enabled on the stack and then
+   * copied into the ring.
+   */
+  buffer.size = 0;
+  n = _IO_Vprintf( _Printk_ring_put_char, &buffer, fmt, ap );
+
+  if ( buffer.size > 0 ) {
+    _Printk_ring_write( &buffer.data[ 0 ], buffer.size );
+  }
+
+  return n;
+}
@@ -0,0 +1,89 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIKernelCharIO
+ *
+ * @brief This header file provides the interfaces of the printk() ring
+ *   buffers used by printk(), vprintk(), and putk().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef _PRINTKRING_P_H
+#define _PRINTKRING_P_H
+
+#include <rtems/score/atomic.h>
+#include <rtems/score/percpu.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * The maximum size of the data of one record.  Longer outputs are split into
+ * several records.
+ */
+#define PRINTK_RING_RECORD_DATA_SIZE 128
+
+typedef struct {
+  uint32_t sequence;
+  uint32_t size;
+} Printk_ring_record;
+
+typedef struct {
+  Atomic_Uint  head;
+  Atomic_Uint  tail;
+  Atomic_Uint  dropped;
+  unsigned int reported;
+  char        *data;
+} Printk_ring;
+
+typedef void ( *Printk_ring_output )(
+  void       *arg,
+  const char *data,
+  size_t      size
+);
+
+extern bool _Printk_ring_is_active;
+
+extern unsigned int _Printk_ring_mask;
+
+Printk_ring *_Printk_ring_get( const Per_CPU_Control *cpu );
+
+int _Printk_ring_vprintf( const char *fmt, va_list ap );
+
+void _Printk_ring_drain( Printk_ring_output output, void *arg );
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _PRINTKRING_P_H */
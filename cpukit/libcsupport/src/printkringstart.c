@@ -0,0 +1,358 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSPrintSupport
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_printk_ring_start() and the consumer side of the printk() ring
+ *   buffers.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "printkring_p.h"
+
+#include <rtems/printer.h>
+#include <rtems/bspIo.h>
+#include <rtems.h>
+#include <rtems/score/interr.h>
+#include <rtems/score/io.h>
+
+#include <errno.h>
+#include <inttypes.h>
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+typedef struct {
+  size_t size;
+  char   data[ 64 ];
+} Printk_ring_notice;
+
+/*
+ * The rings have a single consumer, the printer task.  In case of a fatal
+ * error, the rings are taken over by _Terminate() through this indicator and
+ * the printer task stops to consume records.
+ */
+static Atomic_Uint _Printk_ring_taken_over;
+
+static void _Printk_ring_copy_out(
+  const Printk_ring *ring,
+  unsigned int       position,
+  void              *data,
+  size_t             size
+)
+{
+  unsigned int offset;
+  size_t       first;
+
+  offset = position & _Printk_ring_mask;
+  first = (size_t) _Printk_ring_mask + 1 - offset;
+
+  if ( first > size ) {
+    first = size;
+  }
+
+  memcpy( data, &ring->data[ offset ], first );
+  memcpy( (char *) data + first, &ring->data[ 0 ], size - first );
+}
+
+static void _Printk_ring_notice_put_char( int c, void *arg )
+{
+  Printk_ring_notice *notice;
+
+  notice = arg;
+
+  if ( notice->size < sizeof( notice->data ) ) {
+    notice->data[ notice->size ] = (char) c;
+    ++notice->size;
+  }
+}
+
+static void _Printk_ring_report_dropped(
+  Printk_ring        *ring,
+  uint32_t            cpu_index,
+  Printk_ring_output  output,
+  void               *arg
+)
+{
+  unsigned int       dropped;
+  Printk_ring_notice notice;
+
+  dropped = _Atomic_Load_uint( &ring->dropped, ATOMIC_ORDER_RELAXED );
+
+  if ( dropped == ring->reported ) {
+    return;
+  }
+
+  notice.size = 0;
+  _IO_Printf(
+    _Printk_ring_notice_put_char,
+    &notice,
+    "\n*** PRINTK: %u RECORDS DROPPED ON PROCESSOR %" PRIu32 " ***\n",
+    dropped - ring->reported,
+    cpu_index
+  );
+  ring->reported = dropped;
+  ( *output )( arg, &notice.data[ 0 ], notice.size );
+}
+
+static void _Printk_ring_do_drain(
+  Printk_ring_output  output,
+  void               *arg,
+  bool                take_over
+)
+{
+  uint32_t cpu_max;
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  while ( true ) {
+    Printk_ring        *oldest;
+    Printk_ring_record  oldest_record;
+    unsigned int        oldest_tail;
+    unsigned int        offset;
+    size_t              first;
+    uint32_t            cpu_index;
+
+    if (
+      !take_over
+        && _Atomic_Load_uint( &_Printk_ring_taken_over, ATOMIC_ORDER_RELAXED )
+          != 0
+    ) {
+      break;
+    }
+
+    oldest = NULL;
+    oldest_record.sequence = 0;
+    oldest_record.size = 0;
+    oldest_tail = 0;
+
+    /*
+     * Output the records of all processors in the order of their creation.
+     */
+    for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+      Printk_ring        *ring;
+      Printk_ring_record  record;
+      unsigned int        head;
+      unsigned int        tail;
+
+      ring = _Printk_ring_get( _Per_CPU_Get_by_index( cpu_index ) );
+
+      if ( ring->data == NULL ) {
+        continue;
+      }
+
+      _Printk_ring_report_dropped( ring, cpu_index, output, arg );
+
+      tail = _Atomic_Load_uint( &ring->tail, ATOMIC_ORDER_RELAXED );
+      head = _Atomic_Load_uint( &ring->head, ATOMIC_ORDER_ACQUIRE );
+
+      if ( head == tail ) {
+        continue;
+      }
+
+      _Printk_ring_copy_out( ring, tail, &record, sizeof( record ) );
+
+      if (
+        oldest == NULL
+          || (int32_t) ( record.sequence - oldest_record.sequence ) < 0
+      ) {
+        oldest = ring;
+        oldest_record = record;
+        oldest_tail = tail;
+      }
+    }
+
+    if ( oldest == NULL ) {
+      break;
+    }
+
+    offset = ( oldest_tail + sizeof( oldest_record ) ) & _Printk_ring_mask;
+    first = (size_t) _Printk_ring_mask + 1 - offset;
+
+    if ( first > oldest_record.size ) {
+      first = oldest_record.size;
+    }
+
+    ( *output )( arg, &oldest->data[ offset ], first );
+
+    if ( first < oldest_record.size ) {
+      ( *output )( arg, &oldest->data[ 0 ], oldest_record.size - first );
+    }
+
+    /*
+     * After a take over, the printer task and the fatal error flush may
+     * consume the same record.  The record is then output twice, however,
+     * the tail never moves backward.
+     */
+    (void) _Atomic_Compare_exchange_uint(
+      &oldest->tail,
+      &oldest_tail,
+      oldest_tail + sizeof( oldest_record ) + oldest_record.size,
+      ATOMIC_ORDER_RELEASE,
+      ATOMIC_ORDER_RELAXED
+    );
+  }
+}
+
+void _Printk_ring_drain( Printk_ring_output output, void *arg )
+{
+  _Printk_ring_do_drain( output, arg, false );
+}
+
+static void _Printk_ring_write_to_file(
+  void       *arg,
+  const char *data,
+  size_t      size
+)
+{
+  const int *fd;
+
+  fd = arg;
+  (void) write( *fd, data, size );
+}
+
+static void _Printk_ring_poll( int fd )
+{
+  _Printk_ring_drain( _Printk_ring_write_to_file, &fd );
+}
+
+static void _Printk_ring_put_chars(
+  void       *arg,
+  const char *data,
+  size_t      size
+)
+{
+  size_t i;
+
+  (void) arg;
+
+  for ( i = 0; i < size; ++i ) {
+    rtems_putc( data[ i ] );
+  }
+}
+
+/*
+ * This is the synchronous fallback for fatal errors.  It is called by
+ * _Terminate() before the fatal extensions, since an initial extension of the
+ * BSP may reset the system or output a fatal error report.  The printer task
+ * may never run again, so the rings are taken over even if the printer task
+ * consumes records at this point.
+ */
+static void _Printk_ring_flush( void )
+{
+  _Printk_ring_is_active = false;
+  _Atomic_Store_uint( &_Printk_ring_taken_over, 1, ATOMIC_ORDER_RELAXED );
+  _Printk_ring_do_drain( _Printk_ring_put_chars, NULL, true );
+}
+
+static void _Printk_ring_free( uint32_t cpu_max )
+{
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Printk_ring *ring;
+
+    ring = _Printk_ring_get( _Per_CPU_Get_by_index( cpu_index ) );
+    free( ring->data );
+    ring->data = NULL;
+  }
+}
+
+int rtems_printk_ring_start(
+  rtems_printer              *printer,
+  rtems_printer_task_context *context,
+  size_t                      ring_size
+)
+{
+  rtems_printer task_printer;
+  uint32_t      cpu_max;
+  uint32_t      cpu_index;
+  int           eno;
+
+  if ( _Printk_ring_is_active ) {
+    return EBUSY;
+  }
+
+  if (
+    ring_size < sizeof( Printk_ring_record ) + PRINTK_RING_RECORD_DATA_SIZE
+      || ring_size > UINT_MAX / 2 + 1
+      || ( ring_size & ( ring_size - 1 ) ) != 0
+  ) {
+    return EINVAL;
+  }
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Printk_ring *ring;
+
+    ring = _Printk_ring_get( _Per_CPU_Get_by_index( cpu_index ) );
+    ring->data = malloc( ring_size );
+
+    if ( ring->data == NULL ) {
+      _Printk_ring_free( cpu_max );
+      return ENOMEM;
+    }
+  }
+
+  _Printk_ring_mask = (unsigned int) ( ring_size - 1 );
+
+  if ( context->poll_interval == 0 ) {
+    context->poll_interval = RTEMS_MILLISECONDS_TO_TICKS( 10 );
+
+    if ( context->poll_interval == 0 ) {
+      context->poll_interval = 1;
+    }
+  }
+
+  context->poll_handler = _Printk_ring_poll;
+  eno = rtems_print_printer_task( &task_printer, context );
+
+  if ( eno != 0 ) {
+    context->poll_handler = NULL;
+    _Printk_ring_free( cpu_max );
+    return eno;
+  }
+
+  _Terminate_Flush_handler = _Printk_ring_flush;
+
+  /* Make the rings visible to the producers before they use them */
+  _Atomic_Fence( ATOMIC_ORDER_RELEASE );
+  _Printk_ring_is_active = true;
+
+  rtems_print_printer_printk( printer );
+
+  return 0;
+}
@@ -38,6 +38,8 @@
 #include "config.h"
 #endif
 
+#include "printkring_p.h"
+
 #include <rtems/bspIo.h>
 
 /**
@@ -48,6 +50,9 @@ int putk(const char *s)
   const char *p;
   int len_out = 0;
 
+  if (_Printk_ring_is_active)
+    return printk("%s\n", s);
+
   for (p=s ; *p ; p++, len_out++ )
     rtems_putc(*p);
   rtems_putc('\n');
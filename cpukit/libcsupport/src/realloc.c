@@ -81,6 +81,20 @@ void *realloc( void *ptr, size_t size )
     return NULL;
   }
 
+  /*
+   *  A memory area handed out by the cache is not a heap block of its own
+   *  and cannot be resized by the heap.
+   */
+  old_size = _Malloc_Cache_usable_size( ptr );
+
+  if ( old_size != 0 ) {
+    if ( size <= old_size ) {
+      return ptr;
+    }
+
+    return new_alloc( ptr, size, old_size );
+  }
+
   heap = RTEMS_Malloc_Heap;
 
   switch ( _Malloc_System_state() ) {
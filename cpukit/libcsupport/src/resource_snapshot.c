@@ -37,6 +37,7 @@
 #include <rtems/malloc.h>
 #include <rtems/score/rbtreeimpl.h>
 #include <rtems/score/protectedheap.h>
+#include <rtems/score/stackpool.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/wkspace.h>
 #include <rtems/posix/keyimpl.h>
@@ -117,9 +118,12 @@ void rtems_resource_snapshot_take(rtems_resource_snapshot *snapshot)
 
   memset(snapshot, 0, sizeof(*snapshot));
 
+  rtems_malloc_cache_flush();
+
   _RTEMS_Lock_allocator();
 
   _Thread_Kill_zombies();
+  _Stack_Pool_Flush();
 
   get_heap_info(RTEMS_Malloc_Heap, &snapshot->heap_info);
   get_heap_info(&_Workspace_Area, &snapshot->workspace_info);
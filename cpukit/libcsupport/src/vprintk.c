@@ -37,10 +37,16 @@
 #include "config.h"
 #endif
 
+#include "printkring_p.h"
+
 #include <rtems/bspIo.h>
 #include <rtems/score/io.h>
 
 int vprintk( const char *fmt, va_list ap )
 {
+  if ( _Printk_ring_is_active ) {
+    return _Printk_ring_vprintf( fmt, ap );
+  }
+
   return _IO_Vprintf( rtems_put_char, NULL, fmt, ap );
 }
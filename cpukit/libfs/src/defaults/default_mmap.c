@@ -3,7 +3,7 @@
 /**
  * @file
  *
- * @brief Default MMAP Handler
+ * @brief Default MMAP and MUNMAP Handlers
  *
  * @ingroup LibIOFSHandler
  */
@@ -57,3 +57,12 @@ int rtems_termios_mmap(
   int             prot,
   off_t           off
 ) RTEMS_WEAK_ALIAS( rtems_filesystem_default_mmap );
+
+void rtems_filesystem_default_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void                                   *addr,
+  size_t                                  len
+)
+{
+  /* Nothing to do */
+}
@@ -46,6 +46,9 @@ IMFS_jnode_t *IMFS_node_initialize_directory(
   IMFS_directory_t *dir = (IMFS_directory_t *) node;
 
   rtems_chain_initialize_empty( &dir->Entries );
+  dir->entry_count = 0;
+  dir->index = NULL;
+  dir->index_mask = 0;
 
   return node;
 }
@@ -113,18 +113,9 @@ static ssize_t IMFS_dir_read(
 
 static size_t IMFS_directory_size( const IMFS_jnode_t *node )
 {
-  size_t size = 0;
   const IMFS_directory_t *dir = (const IMFS_directory_t *) node;
-  const rtems_chain_control *chain = &dir->Entries;
-  const rtems_chain_node *current = rtems_chain_immutable_first( chain );
-  const rtems_chain_node *tail = rtems_chain_immutable_tail( chain );
 
-  while ( current != tail ) {
-    size += sizeof( struct dirent );
-    current = rtems_chain_immutable_next( current );
-  }
-
-  return size;
+  return dir->entry_count * sizeof( struct dirent );
 }
 
 static int IMFS_stat_directory(
@@ -153,6 +144,7 @@ static const rtems_filesystem_file_handlers_r IMFS_dir_default_handlers = {
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
   .mmap_h = rtems_filesystem_default_mmap,
+  .munmap_h = rtems_filesystem_default_munmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
@@ -0,0 +1,208 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief This source file contains the implementation of
+ *   IMFS_search_directory(), IMFS_directory_index_insert(), and
+ *   IMFS_directory_index_remove().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfs.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+static size_t IMFS_directory_index_bucket(
+  const IMFS_directory_t *dir,
+  const char *name,
+  size_t namelen
+)
+{
+  uint32_t hash = 2166136261U;
+  size_t i;
+
+  /* FNV-1a */
+  for ( i = 0; i < namelen; ++i ) {
+    hash ^= (uint8_t) name[ i ];
+    hash *= 16777619U;
+  }
+
+  return hash & dir->index_mask;
+}
+
+static void IMFS_directory_index_add(
+  IMFS_directory_t *dir,
+  IMFS_jnode_t *node
+)
+{
+  size_t bucket;
+
+  bucket = IMFS_directory_index_bucket( dir, node->name, node->namelen );
+  node->index_next = dir->index[ bucket ];
+  dir->index[ bucket ] = node;
+}
+
+static bool IMFS_directory_index_build(
+  IMFS_directory_t *dir,
+  size_t bucket_count
+)
+{
+  IMFS_jnode_t **index;
+  rtems_chain_node *current;
+  rtems_chain_node *tail;
+
+  index = calloc( bucket_count, sizeof( *index ) );
+  if ( index == NULL ) {
+    return false;
+  }
+
+  free( dir->index );
+  dir->index = index;
+  dir->index_mask = bucket_count - 1;
+
+  current = rtems_chain_first( &dir->Entries );
+  tail = rtems_chain_tail( &dir->Entries );
+
+  while ( current != tail ) {
+    IMFS_directory_index_add( dir, (IMFS_jnode_t *) current );
+    current = rtems_chain_next( current );
+  }
+
+  return true;
+}
+
+static size_t IMFS_directory_index_bucket_count( size_t entry_count )
+{
+  size_t bucket_count = IMFS_DIRECTORY_INDEX_THRESHOLD;
+
+  while ( bucket_count < entry_count ) {
+    bucket_count *= 2;
+  }
+
+  return bucket_count;
+}
+
+IMFS_jnode_t *IMFS_search_directory(
+  IMFS_directory_t *dir,
+  const char *name,
+  size_t namelen
+)
+{
+  if (
+    dir->index == NULL
+      && dir->entry_count >= IMFS_DIRECTORY_INDEX_THRESHOLD
+  ) {
+    (void) IMFS_directory_index_build(
+      dir,
+      IMFS_directory_index_bucket_count( dir->entry_count )
+    );
+  }
+
+  if ( dir->index != NULL ) {
+    IMFS_jnode_t *entry;
+
+    entry = dir->index[ IMFS_directory_index_bucket( dir, name, namelen ) ];
+
+    while ( entry != NULL ) {
+      bool match = entry->namelen == namelen
+        && memcmp( entry->name, name, namelen ) == 0;
+
+      if ( match ) {
+        return entry;
+      }
+
+      entry = entry->index_next;
+    }
+  } else {
+    rtems_chain_control *entries = &dir->Entries;
+    rtems_chain_node *current = rtems_chain_first( entries );
+    rtems_chain_node *tail = rtems_chain_tail( entries );
+
+    while ( current != tail ) {
+      IMFS_jnode_t *entry = (IMFS_jnode_t *) current;
+      bool match = entry->namelen == namelen
+        && memcmp( entry->name, name, namelen ) == 0;
+
+      if ( match ) {
+        return entry;
+      }
+
+      current = rtems_chain_next( current );
+    }
+  }
+
+  return NULL;
+}
+
+void IMFS_directory_index_insert( IMFS_directory_t *dir, IMFS_jnode_t *node )
+{
+  size_t bucket_count = dir->index_mask + 1;
+
+  /*
+   * The node is already on the entry chain.  Keep the average bucket length
+   * below two.  If the larger index cannot be allocated, then keep the
+   * current one.
+   */
+  if (
+    dir->entry_count <= 2 * bucket_count
+      || !IMFS_directory_index_build( dir, 2 * bucket_count )
+  ) {
+    IMFS_directory_index_add( dir, node );
+  }
+}
+
+void IMFS_directory_index_remove( IMFS_directory_t *dir, IMFS_jnode_t *node )
+{
+  IMFS_jnode_t **link;
+  size_t bucket;
+
+  if ( dir->entry_count > 0 ) {
+    bucket = IMFS_directory_index_bucket( dir, node->name, node->namelen );
+    link = &dir->index[ bucket ];
+
+    while ( *link != node ) {
+      IMFS_assert( *link != NULL );
+      link = &( *link )->index_next;
+    }
+
+    *link = node->index_next;
+  } else {
+    free( dir->index );
+    dir->index = NULL;
+    dir->index_mask = 0;
+  }
+
+  node->index_next = NULL;
+}
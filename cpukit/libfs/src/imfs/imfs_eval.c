@@ -43,8 +43,6 @@
 
 #include <rtems/imfs.h>
 
-#include <string.h>
-
 static bool IMFS_eval_is_directory(
   rtems_filesystem_eval_path_context_t *ctx,
   void *arg
@@ -69,23 +67,7 @@ static IMFS_jnode_t *IMFS_search_in_directory(
     if ( rtems_filesystem_is_parent_directory( token, tokenlen ) ) {
       return dir->Node.Parent;
     } else {
-      rtems_chain_control *entries = &dir->Entries;
-      rtems_chain_node *current = rtems_chain_first( entries );
-      rtems_chain_node *tail = rtems_chain_tail( entries );
-
-      while ( current != tail ) {
-        IMFS_jnode_t *entry = (IMFS_jnode_t *) current;
-        bool match = entry->namelen == tokenlen
-          && memcmp( entry->name, token, tokenlen ) == 0;
-
-        if ( match ) {
-          return entry;
-        }
-
-        current = rtems_chain_next( current );
-      }
-
-      return NULL;
+      return IMFS_search_directory( dir, token, tokenlen );
     }
   }
 }
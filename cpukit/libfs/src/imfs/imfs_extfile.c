@@ -0,0 +1,550 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup IMFS
+ *
+ * @brief This source file contains the implementation of the IMFS extent
+ *   file nodes.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/imfsimpl.h>
+
+#include <limits.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define IMFS_EXTFILE_MAXIMUM_EXTENT_SIZE \
+  ( IMFS_EXTFILE_FIRST_EXTENT_SIZE << IMFS_EXTFILE_MAXIMUM_EXTENT_SHIFT )
+
+/* Begin of the first extent with the maximum extent size */
+#define IMFS_EXTFILE_LINEAR_BEGIN \
+  ( 2 * IMFS_EXTFILE_MAXIMUM_EXTENT_SIZE - IMFS_EXTFILE_FIRST_EXTENT_SIZE )
+
+static size_t IMFS_extfile_extent_size( size_t index )
+{
+  if ( index < IMFS_EXTFILE_MAXIMUM_EXTENT_SHIFT ) {
+    return (size_t) IMFS_EXTFILE_FIRST_EXTENT_SIZE << index;
+  }
+
+  return IMFS_EXTFILE_MAXIMUM_EXTENT_SIZE;
+}
+
+static size_t IMFS_extfile_extent_begin( size_t index )
+{
+  if ( index <= IMFS_EXTFILE_MAXIMUM_EXTENT_SHIFT ) {
+    return IMFS_EXTFILE_FIRST_EXTENT_SIZE * ( ( (size_t) 1 << index ) - 1 );
+  }
+
+  index -= IMFS_EXTFILE_MAXIMUM_EXTENT_SHIFT + 1;
+
+  return IMFS_EXTFILE_LINEAR_BEGIN + index * IMFS_EXTFILE_MAXIMUM_EXTENT_SIZE;
+}
+
+static size_t IMFS_extfile_extent_index( size_t position )
+{
+  size_t index;
+  size_t q;
+
+  if ( position >= IMFS_EXTFILE_LINEAR_BEGIN ) {
+    return IMFS_EXTFILE_MAXIMUM_EXTENT_SHIFT + 1
+      + ( position - IMFS_EXTFILE_LINEAR_BEGIN )
+        / IMFS_EXTFILE_MAXIMUM_EXTENT_SIZE;
+  }
+
+  /*
+   * The extent with index i begins at FIRST * ( 2^i - 1 ), so the index is
+   * the binary logarithm of position / FIRST + 1.
+   */
+  q = position / IMFS_EXTFILE_FIRST_EXTENT_SIZE + 1;
+  index = 0;
+
+  while ( q > 1 ) {
+    q >>= 1;
+    ++index;
+  }
+
+  return index;
+}
+
+/*
+ *  Returns the address of the byte at the position and the count of bytes
+ *  available in its extent from there.  The position shall be less than the
+ *  capacity of the file.
+ */
+static uint8_t *IMFS_extfile_locate(
+  const IMFS_extfile_t *extfile,
+  size_t                position,
+  size_t               *available
+)
+{
+  size_t index;
+  size_t offset;
+
+  index = IMFS_extfile_extent_index( position );
+  IMFS_assert( index < extfile->extent_count );
+  offset = position - IMFS_extfile_extent_begin( index );
+  *available = IMFS_extfile_extent_size( index ) - offset;
+
+  return &extfile->extents[ index ][ offset ];
+}
+
+static size_t IMFS_extfile_capacity( const IMFS_extfile_t *extfile )
+{
+  return IMFS_extfile_extent_begin( extfile->extent_count );
+}
+
+/*
+ *  Allocates extents until the capacity of the file is at least the new
+ *  length.  New extents are filled with zeros.
+ */
+static int IMFS_extfile_grow( IMFS_extfile_t *extfile, size_t new_length )
+{
+  while ( IMFS_extfile_capacity( extfile ) < new_length ) {
+    size_t   count;
+    uint8_t *extent;
+
+    count = extfile->extent_count;
+
+    if ( count == extfile->extent_slots ) {
+      size_t    slots;
+      uint8_t **extents;
+
+      slots = count > 0 ? 2 * count : 8;
+      extents = realloc( extfile->extents, slots * sizeof( *extents ) );
+      if ( extents == NULL ) {
+        return -1;
+      }
+
+      extfile->extents = extents;
+      extfile->extent_slots = slots;
+    }
+
+    extent = calloc( 1, IMFS_extfile_extent_size( count ) );
+    if ( extent == NULL ) {
+      return -1;
+    }
+
+    extfile->extents[ count ] = extent;
+    extfile->extent_count = count + 1;
+  }
+
+  return 0;
+}
+
+/*
+ *  Frees all extents which begin at or after the new length.  The leading
+ *  contiguous extents are only freed all together.
+ */
+static void IMFS_extfile_shrink( IMFS_extfile_t *extfile, size_t new_length )
+{
+  size_t count;
+
+  count = extfile->extent_count;
+
+  while (
+    count > extfile->contiguous_count
+      && IMFS_extfile_extent_begin( count - 1 ) >= new_length
+  ) {
+    --count;
+    free( extfile->extents[ count ] );
+  }
+
+  if ( count > 0 && count == extfile->contiguous_count && new_length == 0 ) {
+    free( extfile->extents[ 0 ] );
+    count = 0;
+    extfile->contiguous_count = 0;
+  }
+
+  extfile->extent_count = count;
+
+  if ( count == 0 ) {
+    free( extfile->extents );
+    extfile->extents = NULL;
+    extfile->extent_slots = 0;
+  }
+}
+
+/*
+ *  Extends the file to the new length.  The area between the current file
+ *  size and the zero end is filled with zeros.  Newly allocated extents are
+ *  already zero, so only data left behind by a previous truncation needs to
+ *  be cleared.
+ */
+static int IMFS_extfile_extend(
+  IMFS_extfile_t *extfile,
+  size_t          new_length,
+  size_t          zero_end
+)
+{
+  size_t position;
+  size_t old_capacity;
+
+  if ( new_length > SSIZE_MAX ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  old_capacity = IMFS_extfile_capacity( extfile );
+
+  if ( IMFS_extfile_grow( extfile, new_length ) != 0 ) {
+    rtems_set_errno_and_return_minus_one( ENOSPC );
+  }
+
+  position = extfile->File.size;
+
+  if ( zero_end > old_capacity ) {
+    zero_end = old_capacity;
+  }
+
+  while ( position < zero_end ) {
+    uint8_t *p;
+    size_t   n;
+
+    p = IMFS_extfile_locate( extfile, position, &n );
+
+    if ( n > zero_end - position ) {
+      n = zero_end - position;
+    }
+
+    memset( p, 0, n );
+    position += n;
+  }
+
+  extfile->File.size = new_length;
+
+  return 0;
+}
+
+/*
+ *  Shared mappings refer directly to the extents.  While the file is mapped,
+ *  the extents must not be freed or moved.
+ */
+static bool IMFS_extfile_is_pinned( const IMFS_extfile_t *extfile )
+{
+  return extfile->map_count > 0;
+}
+
+/*
+ *  Moves the extents up to the end position into one allocation.
+ */
+static int IMFS_extfile_make_contiguous( IMFS_extfile_t *extfile, size_t end )
+{
+  uint8_t *contiguous;
+  uint8_t *previous;
+  size_t   count;
+  size_t   i;
+
+  count = IMFS_extfile_extent_index( end - 1 ) + 1;
+  IMFS_assert( count <= extfile->extent_count );
+
+  if ( count <= extfile->contiguous_count ) {
+    return 0;
+  }
+
+  if ( IMFS_extfile_is_pinned( extfile ) ) {
+    rtems_set_errno_and_return_minus_one( EBUSY );
+  }
+
+  contiguous = malloc( IMFS_extfile_extent_begin( count ) );
+  if ( contiguous == NULL ) {
+    rtems_set_errno_and_return_minus_one( ENOMEM );
+  }
+
+  previous = extfile->contiguous_count > 0 ? extfile->extents[ 0 ] : NULL;
+
+  for ( i = 0; i < count; ++i ) {
+    memcpy(
+      &contiguous[ IMFS_extfile_extent_begin( i ) ],
+      extfile->extents[ i ],
+      IMFS_extfile_extent_size( i )
+    );
+
+    if ( i >= extfile->contiguous_count ) {
+      free( extfile->extents[ i ] );
+    }
+
+    extfile->extents[ i ] = &contiguous[ IMFS_extfile_extent_begin( i ) ];
+  }
+
+  free( previous );
+  extfile->contiguous_count = count;
+
+  return 0;
+}
+
+static ssize_t IMFS_extfile_read(
+  rtems_libio_t *iop,
+  void          *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile;
+  uint8_t        *dest;
+  size_t          position;
+  size_t          size;
+  size_t          remaining;
+
+  extfile = IMFS_iop_to_extfile( iop );
+  size = extfile->File.size;
+
+  if ( iop->offset >= (off_t) size ) {
+    return 0;
+  }
+
+  position = (size_t) iop->offset;
+
+  if ( count > size - position ) {
+    count = size - position;
+  }
+
+  dest = buffer;
+  remaining = count;
+
+  while ( remaining > 0 ) {
+    const uint8_t *p;
+    size_t         n;
+
+    p = IMFS_extfile_locate( extfile, position, &n );
+
+    if ( n > remaining ) {
+      n = remaining;
+    }
+
+    memcpy( dest, p, n );
+    dest += n;
+    position += n;
+    remaining -= n;
+  }
+
+  IMFS_update_atime( &extfile->File.Node );
+  iop->offset += (off_t) count;
+
+  return (ssize_t) count;
+}
+
+static ssize_t IMFS_extfile_write(
+  rtems_libio_t *iop,
+  const void    *buffer,
+  size_t         count
+)
+{
+  IMFS_extfile_t *extfile;
+  const uint8_t  *src;
+  size_t          position;
+  size_t          remaining;
+  off_t           end;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  if ( rtems_libio_iop_is_append( iop ) ) {
+    iop->offset = (off_t) extfile->File.size;
+  }
+
+  if ( iop->offset > SSIZE_MAX || count > SSIZE_MAX - iop->offset ) {
+    rtems_set_errno_and_return_minus_one( EFBIG );
+  }
+
+  position = (size_t) iop->offset;
+  end = iop->offset + (off_t) count;
+
+  if ( end > (off_t) extfile->File.size ) {
+    int rv;
+
+    rv = IMFS_extfile_extend( extfile, (size_t) end, position );
+    if ( rv != 0 ) {
+      return rv;
+    }
+  }
+
+  src = buffer;
+  remaining = count;
+
+  while ( remaining > 0 ) {
+    uint8_t *p;
+    size_t   n;
+
+    p = IMFS_extfile_locate( extfile, position, &n );
+
+    if ( n > remaining ) {
+      n = remaining;
+    }
+
+    memcpy( p, src, n );
+    src += n;
+    position += n;
+    remaining -= n;
+  }
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+  iop->offset = end;
+
+  return (ssize_t) count;
+}
+
+static int IMFS_extfile_ftruncate( rtems_libio_t *iop, off_t length )
+{
+  IMFS_extfile_t *extfile;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  /*
+   *  Like for the memfiles a truncate to a greater length extends the file.
+   *  In contrast to the memfiles, the extents beyond the new length are
+   *  freed, unless the file is pinned by a mapping.
+   */
+  if ( length > (off_t) extfile->File.size ) {
+    int rv;
+
+    if ( length > SSIZE_MAX ) {
+      rtems_set_errno_and_return_minus_one( EFBIG );
+    }
+
+    rv = IMFS_extfile_extend( extfile, (size_t) length, (size_t) length );
+    if ( rv != 0 ) {
+      return rv;
+    }
+  } else {
+    if ( !IMFS_extfile_is_pinned( extfile ) ) {
+      IMFS_extfile_shrink( extfile, (size_t) length );
+    }
+
+    extfile->File.size = (size_t) length;
+  }
+
+  IMFS_mtime_ctime_update( &extfile->File.Node );
+
+  return 0;
+}
+
+static int IMFS_extfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_extfile_t *extfile;
+  int             rv;
+
+  extfile = IMFS_iop_to_extfile( iop );
+
+  rtems_filesystem_instance_lock( &iop->pathinfo );
+
+  if (
+    off < 0
+      || off >= (off_t) extfile->File.size
+      || len > extfile->File.size - (size_t) off
+  ) {
+    errno = ENXIO;
+    rv = -1;
+  } else {
+    size_t   begin = (size_t) off;
+    size_t   available;
+    uint8_t *p;
+
+    p = IMFS_extfile_locate( extfile, begin, &available );
+    rv = 0;
+
+    /* An area within one extent is already contiguous */
+    if ( len > available ) {
+      rv = IMFS_extfile_make_contiguous( extfile, begin + len );
+      p = &extfile->extents[ 0 ][ begin ];
+    }
+
+    /*
+     *  Pin the extents under the same lock, so that they are not freed or
+     *  moved before the mapping is established.
+     */
+    if ( rv == 0 ) {
+      ++extfile->map_count;
+      *addr = p;
+    }
+  }
+
+  rtems_filesystem_instance_unlock( &iop->pathinfo );
+
+  return rv;
+}
+
+static void IMFS_extfile_munmap(
+  const rtems_filesystem_location_info_t *loc,
+  void                                   *addr,
+  size_t                                  len
+)
+{
+  IMFS_extfile_t *extfile;
+
+  extfile = loc->node_access;
+
+  rtems_filesystem_instance_lock( loc );
+  IMFS_assert( extfile->map_count > 0 );
+  --extfile->map_count;
+  rtems_filesystem_instance_unlock( loc );
+}
+
+static void IMFS_extfile_destroy( IMFS_jnode_t *node )
+{
+  IMFS_extfile_shrink( (IMFS_extfile_t *) node, 0 );
+  IMFS_node_destroy_default( node );
+}
+
+static const rtems_filesystem_file_handlers_r IMFS_extfile_handlers = {
+  .open_h = rtems_filesystem_default_open,
+  .close_h = rtems_filesystem_default_close,
+  .read_h = IMFS_extfile_read,
+  .write_h = IMFS_extfile_write,
+  .ioctl_h = rtems_filesystem_default_ioctl,
+  .lseek_h = rtems_filesystem_default_lseek_file,
+  .fstat_h = IMFS_stat_file,
+  .ftruncate_h = IMFS_extfile_ftruncate,
+  .fsync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
+  .fcntl_h = rtems_filesystem_default_fcntl,
+  .kqfilter_h = rtems_filesystem_default_kqfilter,
+  .mmap_h = IMFS_extfile_mmap,
+  .munmap_h = IMFS_extfile_munmap,
+  .poll_h = rtems_filesystem_default_poll,
+  .readv_h = rtems_filesystem_default_readv,
+  .writev_h = rtems_filesystem_default_writev
+};
+
+const IMFS_mknod_control IMFS_mknod_control_extfile = {
+  {
+    .handlers = &IMFS_extfile_handlers,
+    .node_initialize = IMFS_node_initialize_default,
+    .node_remove = IMFS_node_remove_default,
+    .node_destroy = IMFS_extfile_destroy
+  },
+  .node_size = sizeof( IMFS_file_t )
+};
@@ -36,6 +36,7 @@
 #include "config.h"
 #endif
 
+#include <sys/mman.h>
 #include <string.h>
 
 #include <rtems/imfsimpl.h>
@@ -61,6 +62,33 @@ static ssize_t IMFS_linfile_read(
   return (ssize_t) count;
 }
 
+static int IMFS_linfile_mmap(
+  rtems_libio_t *iop,
+  void         **addr,
+  size_t         len,
+  int            prot,
+  off_t          off
+)
+{
+  IMFS_file_t *file = IMFS_iop_to_file( iop );
+  size_t size = file->File.size;
+
+  /*
+   * The file image may reside in read-only memory.  Files opened for writing
+   * are converted to memfiles, see IMFS_linfile_open().
+   */
+  if ((prot & PROT_WRITE) != 0)
+    rtems_set_errno_and_return_minus_one( EACCES );
+
+  if (off < 0 || off >= (off_t) size || len > size - (size_t) off)
+    rtems_set_errno_and_return_minus_one( ENXIO );
+
+  *addr = &file->Linearfile.direct[off];
+  IMFS_update_atime( &file->Node );
+
+  return 0;
+}
+
 static int IMFS_linfile_open(
   rtems_libio_t *iop,
   const char    *pathname,
@@ -108,7 +136,8 @@ static const rtems_filesystem_file_handlers_r IMFS_linfile_handlers = {
   .fdatasync_h = rtems_filesystem_default_fsync_or_fdatasync_success,
   .fcntl_h = rtems_filesystem_default_fcntl,
   .kqfilter_h = rtems_filesystem_default_kqfilter,
-  .mmap_h = rtems_filesystem_default_mmap,
+  .mmap_h = IMFS_linfile_mmap,
+  .munmap_h = rtems_filesystem_default_munmap,
   .poll_h = rtems_filesystem_default_poll,
   .readv_h = rtems_filesystem_default_readv,
   .writev_h = rtems_filesystem_default_writev
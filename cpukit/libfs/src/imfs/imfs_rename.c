@@ -109,10 +109,11 @@ int IMFS_rename(
   control->Base.node_destroy = IMFS_renamed_destroy;
   control->replaced = node->control;
   node->control = &control->Base;
-  node->name = control->name;
-  node->namelen = namelen;
 
+  /* The hash index of the old parent uses the old name */
   IMFS_remove_from_directory( node );
+  node->name = control->name;
+  node->namelen = namelen;
   IMFS_add_to_directory( new_parent, node );
   IMFS_update_ctime( node );
 
@@ -602,6 +602,7 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_directory_handlers = {
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
 	.writev_h = rtems_filesystem_default_writev
@@ -745,6 +746,7 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_file_handlers = {
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
 	.writev_h = rtems_filesystem_default_writev
@@ -764,6 +766,7 @@ static const rtems_filesystem_file_handlers_r rtems_jffs2_link_handlers = {
 	.fcntl_h = rtems_filesystem_default_fcntl,
 	.kqfilter_h = rtems_filesystem_default_kqfilter,
 	.mmap_h = rtems_filesystem_default_mmap,
+	.munmap_h = rtems_filesystem_default_munmap,
 	.poll_h = rtems_filesystem_default_poll,
 	.readv_h = rtems_filesystem_default_readv,
 	.writev_h = rtems_filesystem_default_writev
@@ -307,7 +307,8 @@ rtems_rfs_bitmap_map_test (rtems_rfs_bitmap_control* control,
   if (bit >= control->size)
     return EINVAL;
   index = rtems_rfs_bitmap_map_index (bit);
-  *state = rtems_rfs_bitmap_test (map[index], bit);
+  *state = rtems_rfs_bitmap_test (map[index],
+                                  rtems_rfs_bitmap_map_offset (bit));
   return 0;
 }
 
@@ -110,6 +110,494 @@ rtems_rfs_block_get_size (rtems_rfs_file_system* fs,
   return (((uint64_t) (size->count - 1)) * block_size) + offset;
 }
 
+/**
+ * Return the number of extents an extent table holds.
+ */
+#define rtems_rfs_block_extents_per_table(_fs) ((_fs)->blocks_per_block / 2)
+
+/**
+ * Get an extent from an extent map.
+ *
+ * @param fs The file system.
+ * @param map The extent map.
+ * @param index The index of the extent.
+ * @param extent Pointer to the extent returned.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_extent_get (rtems_rfs_file_system*  fs,
+                            rtems_rfs_block_map*    map,
+                            uint32_t                index,
+                            rtems_rfs_block_extent* extent)
+{
+  if (rtems_rfs_block_map_extents (map) <= RTEMS_RFS_BLOCK_INODE_EXTENTS)
+  {
+    extent->start = map->blocks[index * 2];
+    extent->count = map->blocks[(index * 2) + 1];
+  }
+  else
+  {
+    uint32_t per_table = rtems_rfs_block_extents_per_table (fs);
+    uint32_t entry = index % per_table;
+    int      rc;
+
+    rc = rtems_rfs_buffer_handle_request (fs, &map->singly_buffer,
+                                          map->blocks[index / per_table],
+                                          true);
+    if (rc > 0)
+      return rc;
+
+    extent->start = rtems_rfs_block_get_number (&map->singly_buffer,
+                                                entry * 2);
+    extent->count = rtems_rfs_block_get_number (&map->singly_buffer,
+                                                (entry * 2) + 1);
+  }
+
+  if ((extent->count == 0) ||
+      (extent->start >= rtems_rfs_fs_blocks (fs)) ||
+      (extent->count > (rtems_rfs_fs_blocks (fs) - extent->start)))
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_BLOCK_FIND))
+      printf ("rtems-rfs: block-extent: invalid extent: index=%" PRIu32
+              " start=%" PRIu32 " count=%" PRIu32 "\n",
+              index, extent->start, extent->count);
+    return EIO;
+  }
+
+  return 0;
+}
+
+/**
+ * Set an extent in an extent map. The extent must exist in the map.
+ *
+ * @param fs The file system.
+ * @param map The extent map.
+ * @param index The index of the extent.
+ * @param extent Pointer to the extent to set.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_extent_set (rtems_rfs_file_system*        fs,
+                            rtems_rfs_block_map*          map,
+                            uint32_t                      index,
+                            const rtems_rfs_block_extent* extent)
+{
+  if (rtems_rfs_block_map_extents (map) <= RTEMS_RFS_BLOCK_INODE_EXTENTS)
+  {
+    map->blocks[index * 2] = extent->start;
+    map->blocks[(index * 2) + 1] = extent->count;
+    map->dirty = true;
+  }
+  else
+  {
+    uint32_t per_table = rtems_rfs_block_extents_per_table (fs);
+    uint32_t entry = index % per_table;
+    int      rc;
+
+    rc = rtems_rfs_buffer_handle_request (fs, &map->singly_buffer,
+                                          map->blocks[index / per_table],
+                                          true);
+    if (rc > 0)
+      return rc;
+
+    rtems_rfs_block_set_number (&map->singly_buffer, entry * 2, extent->start);
+    rtems_rfs_block_set_number (&map->singly_buffer, (entry * 2) + 1,
+                                extent->count);
+  }
+
+  return 0;
+}
+
+/**
+ * Allocate an extent table. The table is left in the singly buffer.
+ *
+ * @param fs The file system.
+ * @param map The extent map.
+ * @param table The block number of the table allocated.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_extent_table_alloc (rtems_rfs_file_system* fs,
+                                    rtems_rfs_block_map*   map,
+                                    rtems_rfs_block_no*    table)
+{
+  rtems_rfs_bitmap_bit new_block;
+  int                  rc;
+
+  rc = rtems_rfs_group_bitmap_alloc (fs, map->last_map_block, false,
+                                     &new_block);
+  if (rc > 0)
+    return rc;
+  rc = rtems_rfs_buffer_handle_request (fs, &map->singly_buffer, new_block,
+                                        false);
+  if (rc > 0)
+  {
+    rtems_rfs_group_bitmap_free (fs, false, new_block);
+    return rc;
+  }
+  memset (rtems_rfs_buffer_data (&map->singly_buffer), 0,
+          rtems_rfs_fs_block_size (fs));
+  rtems_rfs_buffer_mark_dirty (&map->singly_buffer);
+  *table = new_block;
+  map->last_map_block = new_block;
+  return 0;
+}
+
+/**
+ * Append an extent to an extent map. The extents move from the inode to a
+ * table when the inode is full.
+ *
+ * @param fs The file system.
+ * @param map The extent map.
+ * @param extent Pointer to the extent to append.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_extent_append (rtems_rfs_file_system*        fs,
+                               rtems_rfs_block_map*          map,
+                               const rtems_rfs_block_extent* extent)
+{
+  uint32_t extents = rtems_rfs_block_map_extents (map);
+  uint32_t per_table = rtems_rfs_block_extents_per_table (fs);
+  int      rc;
+
+  if (extents >= (per_table * RTEMS_RFS_BLOCK_EXTENT_TABLES))
+    return EFBIG;
+
+  if (extents == RTEMS_RFS_BLOCK_INODE_EXTENTS)
+  {
+    rtems_rfs_block_no table;
+    int                b;
+
+    rc = rtems_rfs_block_extent_table_alloc (fs, map, &table);
+    if (rc > 0)
+      return rc;
+
+    for (b = 0; b < RTEMS_RFS_BLOCK_EXTENT_COUNT; b++)
+    {
+      rtems_rfs_block_set_number (&map->singly_buffer, b, map->blocks[b]);
+      map->blocks[b] = 0;
+    }
+
+    map->blocks[0] = table;
+  }
+  else if ((extents > RTEMS_RFS_BLOCK_INODE_EXTENTS) &&
+           ((extents % per_table) == 0))
+  {
+    rtems_rfs_block_no* table = &map->blocks[extents / per_table];
+
+    rc = rtems_rfs_block_extent_table_alloc (fs, map, table);
+    if (rc > 0)
+      return rc;
+  }
+
+  map->blocks[RTEMS_RFS_BLOCK_EXTENT_COUNT] = extents + 1;
+  map->dirty = true;
+
+  return rtems_rfs_block_extent_set (fs, map, extents, extent);
+}
+
+/**
+ * Remove the last extent from an extent map. The extents move back to the
+ * inode when they fit.
+ *
+ * @param fs The file system.
+ * @param map The extent map.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_extent_remove (rtems_rfs_file_system* fs,
+                               rtems_rfs_block_map*   map)
+{
+  uint32_t           extents = rtems_rfs_block_map_extents (map);
+  uint32_t           per_table = rtems_rfs_block_extents_per_table (fs);
+  rtems_rfs_block_no table = 0;
+  int                rc;
+
+  if (extents == (RTEMS_RFS_BLOCK_INODE_EXTENTS + 1))
+  {
+    int b;
+
+    table = map->blocks[0];
+
+    rc = rtems_rfs_buffer_handle_request (fs, &map->singly_buffer, table,
+                                          true);
+    if (rc > 0)
+      return rc;
+
+    for (b = 0; b < RTEMS_RFS_BLOCK_EXTENT_COUNT; b++)
+      map->blocks[b] = rtems_rfs_block_get_number (&map->singly_buffer, b);
+  }
+  else if ((extents > RTEMS_RFS_BLOCK_INODE_EXTENTS) &&
+           (((extents - 1) % per_table) == 0))
+  {
+    table = map->blocks[(extents - 1) / per_table];
+    map->blocks[(extents - 1) / per_table] = 0;
+  }
+  else if (extents <= RTEMS_RFS_BLOCK_INODE_EXTENTS)
+  {
+    map->blocks[(extents - 1) * 2] = 0;
+    map->blocks[((extents - 1) * 2) + 1] = 0;
+  }
+
+  map->blocks[RTEMS_RFS_BLOCK_EXTENT_COUNT] = extents - 1;
+  map->dirty = true;
+
+  if (table != 0)
+  {
+    rc = rtems_rfs_group_bitmap_free (fs, false, table);
+    if (rc > 0)
+      return rc;
+    map->last_map_block = table;
+  }
+
+  return 0;
+}
+
+/**
+ * Find a block in an extent map. The search starts at the extent last found
+ * if the block is not before it.
+ *
+ * @param fs The file system.
+ * @param map The extent map.
+ * @param bno The block position in the map.
+ * @param block Pointer to the block number found.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_extent_find (rtems_rfs_file_system* fs,
+                             rtems_rfs_block_map*   map,
+                             rtems_rfs_block_no     bno,
+                             rtems_rfs_block_no*    block)
+{
+  uint32_t           index = 0;
+  rtems_rfs_block_no base = 0;
+
+  if ((map->extent.count != 0) && (bno >= map->extent_bno))
+  {
+    if (bno < (map->extent_bno + map->extent.count))
+    {
+      *block = map->extent.start + (bno - map->extent_bno);
+      return 0;
+    }
+
+    index = map->extent_index + 1;
+    base = map->extent_bno + map->extent.count;
+  }
+
+  while (index < rtems_rfs_block_map_extents (map))
+  {
+    rtems_rfs_block_extent extent;
+    int                    rc;
+
+    rc = rtems_rfs_block_extent_get (fs, map, index, &extent);
+    if (rc > 0)
+      return rc;
+
+    if (bno < (base + extent.count))
+    {
+      map->extent_index = index;
+      map->extent_bno = base;
+      map->extent = extent;
+      *block = extent.start + (bno - base);
+      return 0;
+    }
+
+    base += extent.count;
+    index++;
+  }
+
+  /*
+   * The size of the map says the block exists so the extents are corrupt.
+   */
+  return EIO;
+}
+
+/**
+ * Free the blocks reserved for an extent map.
+ *
+ * @param fs The file system.
+ * @param map The extent map.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_map_release_reserved (rtems_rfs_file_system* fs,
+                                      rtems_rfs_block_map*   map)
+{
+  while (map->reserved_count > 0)
+  {
+    int rc;
+
+    map->reserved_count--;
+    rc = rtems_rfs_group_bitmap_free (fs, false, map->reserved_start +
+                                      map->reserved_count);
+    if (rc > 0)
+      return rc;
+  }
+
+  return 0;
+}
+
+/**
+ * Grow an extent map. The blocks are taken from the reservation and a new
+ * reservation is made when it is empty. A block that follows the last extent
+ * extends it.
+ *
+ * @param fs The file system.
+ * @param map The extent map.
+ * @param blocks The number of blocks to grow the map by.
+ * @param new_block Pointer to the first block added.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_extent_grow (rtems_rfs_file_system* fs,
+                             rtems_rfs_block_map*   map,
+                             size_t                 blocks,
+                             rtems_rfs_block_no*    new_block)
+{
+  size_t b;
+
+  map->extent.count = 0;
+
+  for (b = 0; b < blocks; b++)
+  {
+    rtems_rfs_block_extent extent;
+    rtems_rfs_block_no     block;
+    uint32_t               extents;
+    int                    rc;
+
+    if (map->reserved_count == 0)
+    {
+      rtems_rfs_bitmap_bit start;
+      size_t               count;
+
+      /*
+       * Reserve as many blocks as the map holds so the runs grow with the
+       * file, bounded by the maximum reservation.
+       */
+      count = map->size.count;
+      if (count < (blocks - b))
+        count = blocks - b;
+      if (count > RTEMS_RFS_BLOCK_MAP_RESERVE)
+        count = RTEMS_RFS_BLOCK_MAP_RESERVE;
+
+      rc = rtems_rfs_group_bitmap_alloc_run (fs, map->last_data_block, count,
+                                             &start, &map->reserved_count);
+      if (rc > 0)
+        return rc;
+
+      map->reserved_start = start;
+    }
+
+    block = map->reserved_start;
+    extents = rtems_rfs_block_map_extents (map);
+    extent.count = 0;
+
+    if (extents > 0)
+    {
+      rc = rtems_rfs_block_extent_get (fs, map, extents - 1, &extent);
+      if (rc > 0)
+        return rc;
+    }
+
+    if ((extent.count != 0) && ((extent.start + extent.count) == block))
+    {
+      extent.count++;
+      rc = rtems_rfs_block_extent_set (fs, map, extents - 1, &extent);
+    }
+    else
+    {
+      extent.start = block;
+      extent.count = 1;
+      rc = rtems_rfs_block_extent_append (fs, map, &extent);
+    }
+
+    if (rc > 0)
+      return rc;
+
+    map->reserved_start++;
+    map->reserved_count--;
+
+    map->size.count++;
+    map->size.offset = 0;
+
+    if (b == 0)
+      *new_block = block;
+    map->last_data_block = block;
+    map->dirty = true;
+  }
+
+  return 0;
+}
+
+/**
+ * Shrink an extent map. The reservation is freed first so the blocks return
+ * to the bitmaps in the order they were allocated.
+ *
+ * @param fs The file system.
+ * @param map The extent map.
+ * @param blocks The number of blocks to shrink the map by.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_block_extent_shrink (rtems_rfs_file_system* fs,
+                               rtems_rfs_block_map*   map,
+                               size_t                 blocks)
+{
+  int rc;
+
+  map->extent.count = 0;
+
+  rc = rtems_rfs_block_map_release_reserved (fs, map);
+  if (rc > 0)
+    return rc;
+
+  while (blocks)
+  {
+    rtems_rfs_block_extent extent;
+    uint32_t               extents;
+    uint32_t               count;
+
+    extents = rtems_rfs_block_map_extents (map);
+    if (extents == 0)
+      return EIO;
+
+    rc = rtems_rfs_block_extent_get (fs, map, extents - 1, &extent);
+    if (rc > 0)
+      return rc;
+
+    count = extent.count;
+    if (count > blocks)
+      count = blocks;
+
+    extent.count -= count;
+
+    if (extent.count == 0)
+      rc = rtems_rfs_block_extent_remove (fs, map);
+    else
+      rc = rtems_rfs_block_extent_set (fs, map, extents - 1, &extent);
+    if (rc > 0)
+      return rc;
+
+    map->size.count -= count;
+    map->size.offset = 0;
+    map->last_data_block = extent.start + extent.count;
+    map->dirty = true;
+    blocks -= count;
+
+    while (count > 0)
+    {
+      count--;
+      rc = rtems_rfs_group_bitmap_free (fs, false,
+                                        extent.start + extent.count + count);
+      if (rc > 0)
+        return rc;
+    }
+  }
+
+  return 0;
+}
+
 int
 rtems_rfs_block_map_open (rtems_rfs_file_system*  fs,
                           rtems_rfs_inode_handle* inode,
@@ -128,6 +616,9 @@ rtems_rfs_block_map_open (rtems_rfs_file_system*  fs,
   map->inode = NULL;
   rtems_rfs_block_set_size_zero (&map->size);
   rtems_rfs_block_set_bpos_zero (&map->bpos);
+  map->extents = false;
+  map->extent.count = 0;
+  map->reserved_count = 0;
 
   rc = rtems_rfs_buffer_handle_open (fs, &map->singly_buffer);
   if (rc > 0)
@@ -156,6 +647,17 @@ rtems_rfs_block_map_open (rtems_rfs_file_system*  fs,
   map->last_map_block = rtems_rfs_inode_get_last_map_block (inode);
   map->last_data_block = rtems_rfs_inode_get_last_data_block (inode);
 
+  /*
+   * The inode slots of an empty node can hold other data, for example a
+   * device number or a short symbolic link, so an empty map has no extents.
+   */
+  if ((rtems_rfs_inode_get_flags (inode) & RTEMS_RFS_INODE_FLAG_EXTENTS) != 0)
+  {
+    map->extents = true;
+    if (map->size.count == 0)
+      memset (map->blocks, 0, sizeof (map->blocks));
+  }
+
   rc = rtems_rfs_inode_unload (fs, inode, false);
 
   return rc;
@@ -168,6 +670,10 @@ rtems_rfs_block_map_close (rtems_rfs_file_system* fs,
   int rc = 0;
   int brc;
 
+  brc = rtems_rfs_block_map_release_reserved (fs, map);
+  if (brc > 0)
+    rc = brc;
+
   if (map->dirty && map->inode)
   {
     brc = rtems_rfs_inode_load (fs, map->inode);
@@ -278,7 +784,11 @@ rtems_rfs_block_map_find (rtems_rfs_file_system* fs,
      * is less than or equal to the number of slots in the inode the blocks are
      * directly accessed.
      */
-    if (map->size.count <= RTEMS_RFS_INODE_BLOCKS)
+    if (map->extents)
+    {
+      rc = rtems_rfs_block_extent_find (fs, map, bpos->bno, block);
+    }
+    else if (map->size.count <= RTEMS_RFS_INODE_BLOCKS)
     {
       *block = map->blocks[bpos->bno];
     }
@@ -433,6 +943,9 @@ rtems_rfs_block_map_grow (rtems_rfs_file_system* fs,
     printf ("rtems-rfs: block-map-grow: entry: blocks=%zd count=%" PRIu32 "\n",
             blocks, map->size.count);
 
+  if (map->extents)
+    return rtems_rfs_block_extent_grow (fs, map, blocks, new_block);
+
   if ((map->size.count + blocks) >= rtems_rfs_fs_max_block_map_blocks (fs))
     return EFBIG;
 
@@ -679,6 +1192,20 @@ rtems_rfs_block_map_shrink (rtems_rfs_file_system* fs,
   if (blocks > map->size.count)
     blocks = map->size.count;
 
+  if (map->extents)
+  {
+    int rc;
+
+    rc = rtems_rfs_block_extent_shrink (fs, map, blocks);
+    if (rc > 0)
+      return rc;
+
+    /*
+     * The extent shrink has removed all the blocks.
+     */
+    blocks = 0;
+  }
+
   while (blocks)
   {
     rtems_rfs_block_no block;
@@ -0,0 +1,1048 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup rtems_rfs
+ *
+ * @brief RTEMS File Systems Directory Index Routines
+ *
+ * These functions manage the hash index of a directory. The index blocks and
+ * the leaf blocks are blocks of the directory. A leaf that is full is split at
+ * a hash boundary into a new block at the end of the directory and the new
+ * block is added to the index. A full root moves its entries to a node and a
+ * full node is split. An index that cannot grow any further is dropped. The
+ * index blocks are erased and the directory is searched from the start.
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <rtems/rfs/rtems-rfs-block.h>
+#include <rtems/rfs/rtems-rfs-buffer.h>
+#include <rtems/rfs/rtems-rfs-file-system.h>
+#include <rtems/rfs/rtems-rfs-trace.h>
+#include <rtems/rfs/rtems-rfs-dir.h>
+#include <rtems/rfs/rtems-rfs-dir-hash.h>
+#include <rtems/rfs/rtems-rfs-dir-index.h>
+
+/**
+ * Return a pointer to an entry of an index block.
+ */
+#define rtems_rfs_dir_index_entry(_d, _e) \
+  ((_d) + RTEMS_RFS_DIR_INDEX_ENTRIES + ((_e) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE))
+
+/**
+ * Return the hash of an entry of an index block.
+ */
+#define rtems_rfs_dir_index_hash(_d, _e) \
+  rtems_rfs_read_u32 (rtems_rfs_dir_index_entry (_d, _e) + \
+                      RTEMS_RFS_DIR_INDEX_ENTRY_HASH)
+
+/**
+ * Return the block position of an entry of an index block.
+ */
+#define rtems_rfs_dir_index_bno(_d, _e) \
+  rtems_rfs_read_u32 (rtems_rfs_dir_index_entry (_d, _e) + \
+                      RTEMS_RFS_DIR_INDEX_ENTRY_BNO)
+
+/**
+ * Return the number of entries in an index block.
+ */
+#define rtems_rfs_dir_index_count(_d) \
+  rtems_rfs_read_u16 ((_d) + RTEMS_RFS_DIR_INDEX_COUNT)
+
+/**
+ * Set the number of entries in an index block.
+ */
+#define rtems_rfs_dir_index_set_count(_d, _c) \
+  rtems_rfs_write_u16 ((_d) + RTEMS_RFS_DIR_INDEX_COUNT, _c)
+
+/**
+ * The path taken through the index to a leaf. Level 0 is the root.
+ */
+typedef struct _rtems_rfs_dir_index_path
+{
+  /**
+   * The depth of the index.
+   */
+  int depth;
+
+  /**
+   * The position of the index block at each level.
+   */
+  rtems_rfs_block_no bno[RTEMS_RFS_DIR_INDEX_MAX_DEPTH];
+
+  /**
+   * The entry taken in the index block at each level.
+   */
+  int entry[RTEMS_RFS_DIR_INDEX_MAX_DEPTH];
+
+  /**
+   * The position of the leaf.
+   */
+  rtems_rfs_block_no leaf;
+} rtems_rfs_dir_index_path;
+
+/**
+ * A directory entry of a leaf being split.
+ */
+typedef struct _rtems_rfs_dir_index_slot
+{
+  uint32_t hash;    /**< The hash of the entry. */
+  int      offset;  /**< The offset of the entry in the copy of the leaf. */
+  int      length;  /**< The length of the entry. */
+} rtems_rfs_dir_index_slot;
+
+/**
+ * Request the block at a position in the directory.
+ *
+ * @param fs The file system.
+ * @param map The block map of the directory.
+ * @param buffer The buffer handle to hold the block.
+ * @param bno The position of the block in the directory.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_dir_index_request (rtems_rfs_file_system*   fs,
+                             rtems_rfs_block_map*     map,
+                             rtems_rfs_buffer_handle* buffer,
+                             rtems_rfs_block_no       bno)
+{
+  rtems_rfs_block_pos bpos;
+  rtems_rfs_block_no  block;
+  int                 rc;
+
+  rtems_rfs_block_set_bpos_zero (&bpos);
+  bpos.bno = bno;
+
+  rc = rtems_rfs_block_map_find (fs, map, &bpos, &block);
+  if (rc > 0)
+  {
+    if (rc == ENXIO)
+      rc = EIO;
+    return rc;
+  }
+
+  return rtems_rfs_buffer_handle_request (fs, buffer, block, true);
+}
+
+/**
+ * Initialise an index block.
+ *
+ * @param fs The file system.
+ * @param data The data of the block.
+ * @param depth The depth of the index from this block.
+ */
+static void
+rtems_rfs_dir_index_init (rtems_rfs_file_system* fs,
+                          uint8_t*               data,
+                          int                    depth)
+{
+  memset (data, 0xff, rtems_rfs_fs_block_size (fs));
+  rtems_rfs_write_u32 (data + RTEMS_RFS_DIR_INDEX_ID,
+                       RTEMS_RFS_DIR_INDEX_MAGIC);
+  rtems_rfs_write_u16 (data + RTEMS_RFS_DIR_INDEX_DEPTH, depth);
+  rtems_rfs_dir_index_set_count (data, 0);
+}
+
+/**
+ * Insert an entry into an index block that has room for it.
+ *
+ * @param data The data of the index block.
+ * @param at The entry to insert at.
+ * @param hash The lowest hash held below the entry.
+ * @param bno The position of the block the entry references.
+ */
+static void
+rtems_rfs_dir_index_insert_entry (uint8_t*           data,
+                                  int                at,
+                                  uint32_t           hash,
+                                  rtems_rfs_block_no bno)
+{
+  uint8_t* entry = rtems_rfs_dir_index_entry (data, at);
+  int      count = rtems_rfs_dir_index_count (data);
+
+  memmove (entry + RTEMS_RFS_DIR_INDEX_ENTRY_SIZE, entry,
+           (count - at) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+  rtems_rfs_write_u32 (entry + RTEMS_RFS_DIR_INDEX_ENTRY_HASH, hash);
+  rtems_rfs_write_u32 (entry + RTEMS_RFS_DIR_INDEX_ENTRY_BNO, bno);
+  rtems_rfs_dir_index_set_count (data, count + 1);
+}
+
+/**
+ * Search an index block for the last entry with a hash that is not above the
+ * hash. The first entry holds the hashes below the second entry.
+ *
+ * @param data The data of the index block.
+ * @param hash The hash to search for.
+ * @return int The entry.
+ */
+static int
+rtems_rfs_dir_index_search (uint8_t* data, uint32_t hash)
+{
+  int low = 1;
+  int high = rtems_rfs_dir_index_count (data) - 1;
+  int found = 0;
+
+  while (low <= high)
+  {
+    int mid = (low + high) / 2;
+    if (rtems_rfs_dir_index_hash (data, mid) <= hash)
+    {
+      found = mid;
+      low = mid + 1;
+    }
+    else
+    {
+      high = mid - 1;
+    }
+  }
+
+  return found;
+}
+
+/**
+ * Walk the index from the root to the leaf for the hash.
+ *
+ * @param fs The file system.
+ * @param map The block map of the directory.
+ * @param buffer The buffer handle to use.
+ * @param hash The hash to look up.
+ * @param path The path taken to the leaf.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_dir_index_walk (rtems_rfs_file_system*    fs,
+                          rtems_rfs_block_map*      map,
+                          rtems_rfs_buffer_handle*  buffer,
+                          uint32_t                  hash,
+                          rtems_rfs_dir_index_path* path)
+{
+  rtems_rfs_block_no bno = 0;
+  int                depth = 1;
+  int                level;
+
+  for (level = 0; level < depth; level++)
+  {
+    uint8_t* data;
+    int      count;
+    int      entry;
+    int      rc;
+
+    rc = rtems_rfs_dir_index_request (fs, map, buffer, bno);
+    if (rc > 0)
+      return rc;
+
+    data = rtems_rfs_buffer_data (buffer);
+
+    if (level == 0)
+      depth = rtems_rfs_read_u16 (data + RTEMS_RFS_DIR_INDEX_DEPTH);
+
+    count = rtems_rfs_dir_index_count (data);
+
+    if ((rtems_rfs_dir_entry_length (data) != RTEMS_RFS_DIR_ENTRY_EMPTY) ||
+        (rtems_rfs_read_u32 (data + RTEMS_RFS_DIR_INDEX_ID) !=
+         RTEMS_RFS_DIR_INDEX_MAGIC) ||
+        (depth < 1) || (depth > RTEMS_RFS_DIR_INDEX_MAX_DEPTH) ||
+        (rtems_rfs_read_u16 (data + RTEMS_RFS_DIR_INDEX_DEPTH) !=
+         (depth - level)) ||
+        (count == 0) || (count > rtems_rfs_dir_index_limit (fs)))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+        printf ("rtems-rfs: dir-index: bad index block: bno=%" PRIu32 "\n",
+                bno);
+      return EIO;
+    }
+
+    entry = rtems_rfs_dir_index_search (data, hash);
+
+    path->bno[level] = bno;
+    path->entry[level] = entry;
+
+    bno = rtems_rfs_dir_index_bno (data, entry);
+    if ((bno == 0) || (bno >= rtems_rfs_block_map_count (map)))
+    {
+      if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+        printf ("rtems-rfs: dir-index: bad index entry: bno=%" PRIu32
+                " entry=%d\n", path->bno[level], entry);
+      return EIO;
+    }
+  }
+
+  path->depth = depth;
+  path->leaf = bno;
+
+  return 0;
+}
+
+/**
+ * Insert an entry into a leaf if there is space.
+ *
+ * @param fs The file system.
+ * @param buffer The buffer handle holding the leaf.
+ * @param name The name of the entry.
+ * @param length The length of the name.
+ * @param ino The ino of the entry.
+ * @param hash The hash of the name.
+ * @param inserted Set to true if the entry is inserted.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_dir_index_leaf_insert (rtems_rfs_file_system*   fs,
+                                 rtems_rfs_buffer_handle* buffer,
+                                 const char*              name,
+                                 size_t                   length,
+                                 rtems_rfs_ino            ino,
+                                 uint32_t                 hash,
+                                 bool*                    inserted)
+{
+  uint8_t* entry = rtems_rfs_buffer_data (buffer);
+  int      offset = 0;
+
+  *inserted = false;
+
+  while (offset < (rtems_rfs_fs_block_size (fs) - RTEMS_RFS_DIR_ENTRY_SIZE))
+  {
+    rtems_rfs_ino eino;
+    int           elength;
+
+    elength = rtems_rfs_dir_entry_length (entry);
+    eino    = rtems_rfs_dir_entry_ino (entry);
+
+    if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+    {
+      if ((length + RTEMS_RFS_DIR_ENTRY_SIZE) <
+          (rtems_rfs_fs_block_size (fs) - offset))
+      {
+        rtems_rfs_dir_set_entry_hash (entry, hash);
+        rtems_rfs_dir_set_entry_ino (entry, ino);
+        rtems_rfs_dir_set_entry_length (entry,
+                                        RTEMS_RFS_DIR_ENTRY_SIZE + length);
+        memcpy (entry + RTEMS_RFS_DIR_ENTRY_SIZE, name, length);
+        rtems_rfs_buffer_mark_dirty (buffer);
+        *inserted = true;
+      }
+      break;
+    }
+
+    if (rtems_rfs_dir_entry_valid (fs, elength, eino))
+      return EIO;
+
+    entry  += elength;
+    offset += elength;
+  }
+
+  return 0;
+}
+
+/**
+ * Sort function for the entries of a leaf.
+ */
+static int
+rtems_rfs_dir_index_slot_compare (const void* a, const void* b)
+{
+  const rtems_rfs_dir_index_slot* sa = a;
+  const rtems_rfs_dir_index_slot* sb = b;
+
+  if (sa->hash < sb->hash)
+    return -1;
+  if (sa->hash > sb->hash)
+    return 1;
+  return sa->offset - sb->offset;
+}
+
+/**
+ * Copy a leaf and sort its entries by hash. The copy and the slots are
+ * allocated as a single block of memory the caller frees with the copy.
+ *
+ * @param fs The file system.
+ * @param data The data of the leaf.
+ * @param copy The copy of the leaf.
+ * @param slots The entries of the leaf sorted by hash.
+ * @param count The number of entries.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_dir_index_sort (rtems_rfs_file_system*     fs,
+                          const uint8_t*             data,
+                          uint8_t**                  copy,
+                          rtems_rfs_dir_index_slot** slots,
+                          int*                       count)
+{
+  size_t   size = rtems_rfs_fs_block_size (fs);
+  size_t   max_slots = (size / (RTEMS_RFS_DIR_ENTRY_SIZE + 1)) + 1;
+  uint8_t* entry;
+  int      offset = 0;
+
+  *copy = malloc (size + (max_slots * sizeof (rtems_rfs_dir_index_slot)));
+  if (!*copy)
+    return ENOMEM;
+
+  memcpy (*copy, data, size);
+  *slots = (rtems_rfs_dir_index_slot*) (*copy + size);
+  *count = 0;
+
+  entry = *copy;
+
+  while (offset < (size - RTEMS_RFS_DIR_ENTRY_SIZE))
+  {
+    rtems_rfs_ino eino;
+    int           elength;
+
+    elength = rtems_rfs_dir_entry_length (entry);
+    eino    = rtems_rfs_dir_entry_ino (entry);
+
+    if (elength == RTEMS_RFS_DIR_ENTRY_EMPTY)
+      break;
+
+    if (rtems_rfs_dir_entry_valid (fs, elength, eino))
+    {
+      free (*copy);
+      return EIO;
+    }
+
+    (*slots)[*count].hash = rtems_rfs_dir_entry_hash (entry);
+    (*slots)[*count].offset = offset;
+    (*slots)[*count].length = elength;
+    ++(*count);
+
+    entry  += elength;
+    offset += elength;
+  }
+
+  qsort (*slots, *count, sizeof (rtems_rfs_dir_index_slot),
+         rtems_rfs_dir_index_slot_compare);
+
+  return 0;
+}
+
+/**
+ * Find the slot to split sorted entries at. Entries with the same hash are not
+ * split so a look up only searches one leaf.
+ *
+ * @param slots The entries sorted by hash.
+ * @param count The number of entries.
+ * @return int The first slot of the upper half. If 0 the entries cannot be
+ *             split.
+ */
+static int
+rtems_rfs_dir_index_split_point (const rtems_rfs_dir_index_slot* slots,
+                                 int                             count)
+{
+  int s;
+
+  for (s = count / 2; s < count; s++)
+    if (slots[s].hash != slots[s - 1].hash)
+      return s;
+
+  for (s = (count / 2) - 1; s > 0; s--)
+    if (slots[s].hash != slots[s - 1].hash)
+      return s;
+
+  return 0;
+}
+
+/**
+ * Pack a range of sorted entries into a leaf.
+ *
+ * @param fs The file system.
+ * @param data The data of the leaf.
+ * @param copy The copy of the leaf the entries are in.
+ * @param slots The entries sorted by hash.
+ * @param first The first slot to pack.
+ * @param last The slot after the last slot to pack.
+ */
+static void
+rtems_rfs_dir_index_pack (rtems_rfs_file_system*          fs,
+                          uint8_t*                        data,
+                          const uint8_t*                  copy,
+                          const rtems_rfs_dir_index_slot* slots,
+                          int                             first,
+                          int                             last)
+{
+  int s;
+
+  memset (data, 0xff, rtems_rfs_fs_block_size (fs));
+
+  for (s = first; s < last; s++)
+  {
+    memcpy (data, copy + slots[s].offset, slots[s].length);
+    data += slots[s].length;
+  }
+}
+
+/**
+ * Add a block to the end of the directory.
+ *
+ * @param fs The file system.
+ * @param map The block map of the directory.
+ * @param buffer The buffer handle to hold the new block.
+ * @param bno The position of the new block in the directory.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_dir_index_grow (rtems_rfs_file_system*   fs,
+                          rtems_rfs_block_map*     map,
+                          rtems_rfs_buffer_handle* buffer,
+                          rtems_rfs_block_no*      bno)
+{
+  rtems_rfs_block_no block;
+  int                rc;
+
+  rc = rtems_rfs_block_map_grow (fs, map, 1, &block);
+  if (rc > 0)
+    return rc;
+
+  *bno = rtems_rfs_block_map_count (map) - 1;
+
+  return rtems_rfs_buffer_handle_request (fs, buffer, block, false);
+}
+
+/**
+ * Split a full leaf at a hash boundary. The upper half of the hashes move to a
+ * new block at the end of the directory.
+ *
+ * @param fs The file system.
+ * @param map The block map of the directory.
+ * @param buffer The buffer handle to use.
+ * @param leaf The position of the leaf.
+ * @param split_hash The lowest hash in the new leaf.
+ * @param new_leaf The position of the new leaf.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_dir_index_split (rtems_rfs_file_system*   fs,
+                           rtems_rfs_block_map*     map,
+                           rtems_rfs_buffer_handle* buffer,
+                           rtems_rfs_block_no       leaf,
+                           uint32_t*                split_hash,
+                           rtems_rfs_block_no*      new_leaf)
+{
+  rtems_rfs_dir_index_slot* slots;
+  uint8_t*                  copy;
+  int                       count;
+  int                       split;
+  int                       rc;
+
+  *new_leaf = 0;
+
+  rc = rtems_rfs_dir_index_request (fs, map, buffer, leaf);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_dir_index_sort (fs, rtems_rfs_buffer_data (buffer),
+                                 &copy, &slots, &count);
+  if (rc > 0)
+    return rc;
+
+  split = rtems_rfs_dir_index_split_point (slots, count);
+  if (split == 0)
+  {
+    free (copy);
+    return EFBIG;
+  }
+
+  rc = rtems_rfs_dir_index_grow (fs, map, buffer, new_leaf);
+  if (rc == 0)
+  {
+    rtems_rfs_dir_index_pack (fs, rtems_rfs_buffer_data (buffer),
+                              copy, slots, split, count);
+    rtems_rfs_buffer_mark_dirty (buffer);
+
+    rc = rtems_rfs_dir_index_request (fs, map, buffer, leaf);
+    if (rc == 0)
+    {
+      rtems_rfs_dir_index_pack (fs, rtems_rfs_buffer_data (buffer),
+                                copy, slots, 0, split);
+      rtems_rfs_buffer_mark_dirty (buffer);
+      *split_hash = slots[split].hash;
+    }
+  }
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: split: leaf=%" PRIu32 " new=%" PRIu32
+            " entries=%d/%d: %d: %s\n", leaf, *new_leaf, split, count,
+            rc, strerror (rc));
+
+  free (copy);
+  return rc;
+}
+
+/**
+ * Add an entry for a new leaf to the index block above the leaf in the path.
+ * A full root moves its entries to a new node and a full node is split.
+ *
+ * @param fs The file system.
+ * @param map The block map of the directory.
+ * @param buffer The buffer handle to use.
+ * @param path The path to the leaf that was split.
+ * @param hash The lowest hash in the new leaf.
+ * @param bno The position of the new leaf.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_dir_index_insert (rtems_rfs_file_system*    fs,
+                            rtems_rfs_block_map*      map,
+                            rtems_rfs_buffer_handle*  buffer,
+                            rtems_rfs_dir_index_path* path,
+                            uint32_t                  hash,
+                            rtems_rfs_block_no        bno)
+{
+  size_t             size = rtems_rfs_fs_block_size (fs);
+  int                limit = rtems_rfs_dir_index_limit (fs);
+  rtems_rfs_block_no node = 0;
+  uint8_t*           copy;
+  uint8_t*           data;
+  int                count;
+  int                half;
+  int                at;
+  int                rc;
+
+  rc = rtems_rfs_dir_index_request (fs, map, buffer,
+                                    path->bno[path->depth - 1]);
+  if (rc > 0)
+    return rc;
+
+  data = rtems_rfs_buffer_data (buffer);
+  count = rtems_rfs_dir_index_count (data);
+
+  if (count < limit)
+  {
+    rtems_rfs_dir_index_insert_entry (data, path->entry[path->depth - 1] + 1,
+                                      hash, bno);
+    rtems_rfs_buffer_mark_dirty (buffer);
+    return 0;
+  }
+
+  copy = malloc (size);
+  if (!copy)
+    return ENOMEM;
+
+  memcpy (copy, data, size);
+
+  if (path->depth == 1)
+  {
+    /*
+     * The root is full. Move the entries to a node and point the root at the
+     * node. The node is full so it is split below.
+     */
+    rc = rtems_rfs_dir_index_grow (fs, map, buffer, &node);
+    if (rc > 0)
+    {
+      free (copy);
+      return rc;
+    }
+
+    memcpy (rtems_rfs_buffer_data (buffer), copy, size);
+    rtems_rfs_buffer_mark_dirty (buffer);
+
+    rc = rtems_rfs_dir_index_request (fs, map, buffer, 0);
+    if (rc > 0)
+    {
+      free (copy);
+      return rc;
+    }
+
+    data = rtems_rfs_buffer_data (buffer);
+    rtems_rfs_dir_index_init (fs, data, 2);
+    rtems_rfs_dir_index_insert_entry (data, 0, 0, node);
+    rtems_rfs_buffer_mark_dirty (buffer);
+
+    path->depth = 2;
+    path->bno[1] = node;
+    path->entry[1] = path->entry[0];
+    path->entry[0] = 0;
+  }
+  else
+  {
+    rc = rtems_rfs_dir_index_request (fs, map, buffer, 0);
+    if ((rc == 0) &&
+        (rtems_rfs_dir_index_count (rtems_rfs_buffer_data (buffer)) >= limit))
+      rc = EFBIG;
+    if (rc > 0)
+    {
+      free (copy);
+      return rc;
+    }
+  }
+
+  /*
+   * Split the node. The upper half of the entries move to a new node that is
+   * added to the root.
+   */
+  half = count / 2;
+
+  rc = rtems_rfs_dir_index_grow (fs, map, buffer, &node);
+  if (rc == 0)
+  {
+    data = rtems_rfs_buffer_data (buffer);
+    rtems_rfs_dir_index_init (fs, data, 1);
+    memcpy (rtems_rfs_dir_index_entry (data, 0),
+            rtems_rfs_dir_index_entry (copy, half),
+            (count - half) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+    rtems_rfs_dir_index_set_count (data, count - half);
+    rtems_rfs_buffer_mark_dirty (buffer);
+
+    rc = rtems_rfs_dir_index_request (fs, map, buffer, path->bno[1]);
+  }
+
+  if (rc == 0)
+  {
+    data = rtems_rfs_buffer_data (buffer);
+    memset (rtems_rfs_dir_index_entry (data, half), 0xff,
+            (count - half) * RTEMS_RFS_DIR_INDEX_ENTRY_SIZE);
+    rtems_rfs_dir_index_set_count (data, half);
+    rtems_rfs_buffer_mark_dirty (buffer);
+
+    rc = rtems_rfs_dir_index_request (fs, map, buffer, 0);
+  }
+
+  if (rc == 0)
+  {
+    rtems_rfs_dir_index_insert_entry (rtems_rfs_buffer_data (buffer),
+                                      path->entry[0] + 1,
+                                      rtems_rfs_dir_index_hash (copy, half),
+                                      node);
+    rtems_rfs_buffer_mark_dirty (buffer);
+
+    /*
+     * Add the new leaf to the node that holds the leaf that was split.
+     */
+    at = path->entry[1] + 1;
+    if (at > half)
+    {
+      at -= half;
+      rc = rtems_rfs_dir_index_request (fs, map, buffer, node);
+    }
+    else
+    {
+      rc = rtems_rfs_dir_index_request (fs, map, buffer, path->bno[1]);
+    }
+
+    if (rc == 0)
+    {
+      rtems_rfs_dir_index_insert_entry (rtems_rfs_buffer_data (buffer),
+                                        at, hash, bno);
+      rtems_rfs_buffer_mark_dirty (buffer);
+    }
+  }
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: node split: node=%" PRIu32
+            " new=%" PRIu32 ": %d: %s\n", path->bno[1], node,
+            rc, strerror (rc));
+
+  free (copy);
+  return rc;
+}
+
+bool
+rtems_rfs_dir_index_enabled (rtems_rfs_file_system*  fs,
+                             rtems_rfs_inode_handle* dir)
+{
+  uint16_t flags;
+
+  if (rtems_rfs_inode_load (fs, dir) > 0)
+    return false;
+
+  flags = rtems_rfs_inode_get_flags (dir);
+  rtems_rfs_inode_unload (fs, dir, false);
+
+  return (flags & RTEMS_RFS_INODE_FLAG_DIR_INDEX) != 0;
+}
+
+/**
+ * Set or clear the index flag of the directory inode.
+ *
+ * @param fs The file system.
+ * @param dir The directory inode.
+ * @param indexed The directory is indexed.
+ * @return int The error number (errno). No error if 0.
+ */
+static int
+rtems_rfs_dir_index_set (rtems_rfs_file_system*  fs,
+                         rtems_rfs_inode_handle* dir,
+                         bool                    indexed)
+{
+  uint16_t flags;
+  int      rc;
+
+  rc = rtems_rfs_inode_load (fs, dir);
+  if (rc > 0)
+    return rc;
+
+  flags = rtems_rfs_inode_get_flags (dir);
+  if (indexed)
+    flags |= RTEMS_RFS_INODE_FLAG_DIR_INDEX;
+  else
+    flags &= ~RTEMS_RFS_INODE_FLAG_DIR_INDEX;
+  rtems_rfs_inode_set_flags (dir, flags);
+
+  return rtems_rfs_inode_unload (fs, dir, false);
+}
+
+int
+rtems_rfs_dir_index_lookup (rtems_rfs_file_system* fs,
+                            rtems_rfs_block_map*   map,
+                            uint32_t               hash,
+                            rtems_rfs_block_no*    leaf)
+{
+  rtems_rfs_dir_index_path path;
+  rtems_rfs_buffer_handle  buffer;
+  int                      rc;
+
+  rc = rtems_rfs_buffer_handle_open (fs, &buffer);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_dir_index_walk (fs, map, &buffer, hash, &path);
+  if (rc == 0)
+    *leaf = path.leaf;
+
+  rtems_rfs_buffer_handle_close (fs, &buffer);
+  return rc;
+}
+
+int
+rtems_rfs_dir_index_add_entry (rtems_rfs_file_system* fs,
+                               rtems_rfs_block_map*   map,
+                               const char*            name,
+                               size_t                 length,
+                               rtems_rfs_ino          ino)
+{
+  rtems_rfs_dir_index_path path;
+  rtems_rfs_buffer_handle  buffer;
+  rtems_rfs_block_no       leaf;
+  uint32_t                 hash;
+  uint32_t                 split_hash;
+  bool                     inserted = false;
+  int                      rc;
+
+  hash = rtems_rfs_dir_hash (name, length);
+
+  rc = rtems_rfs_buffer_handle_open (fs, &buffer);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_dir_index_walk (fs, map, &buffer, hash, &path);
+  if (rc == 0)
+    rc = rtems_rfs_dir_index_request (fs, map, &buffer, path.leaf);
+  if (rc == 0)
+    rc = rtems_rfs_dir_index_leaf_insert (fs, &buffer, name, length, ino,
+                                          hash, &inserted);
+
+  if ((rc == 0) && !inserted)
+  {
+    rc = rtems_rfs_dir_index_split (fs, map, &buffer, path.leaf,
+                                    &split_hash, &leaf);
+    if (rc == 0)
+      rc = rtems_rfs_dir_index_insert (fs, map, &buffer, &path,
+                                       split_hash, leaf);
+    if (rc == 0)
+    {
+      if (hash < split_hash)
+        leaf = path.leaf;
+      rc = rtems_rfs_dir_index_request (fs, map, &buffer, leaf);
+    }
+    if (rc == 0)
+      rc = rtems_rfs_dir_index_leaf_insert (fs, &buffer, name, length, ino,
+                                            hash, &inserted);
+    if ((rc == 0) && !inserted)
+      rc = EFBIG;
+  }
+
+  rtems_rfs_buffer_handle_close (fs, &buffer);
+  return rc;
+}
+
+int
+rtems_rfs_dir_index_create (rtems_rfs_file_system*  fs,
+                            rtems_rfs_inode_handle* dir,
+                            rtems_rfs_block_map*    map)
+{
+  rtems_rfs_buffer_handle   buffer;
+  rtems_rfs_dir_index_slot* slots;
+  rtems_rfs_block_no        leaves[2] = { 0, 0 };
+  rtems_rfs_block_no        blocks[2] = { 0, 0 };
+  uint8_t*                  copy;
+  uint8_t*                  data;
+  int                       count;
+  int                       split;
+  int                       rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: create: dir=%" PRIu32 "\n",
+            rtems_rfs_inode_ino (dir));
+
+  rc = rtems_rfs_buffer_handle_open (fs, &buffer);
+  if (rc > 0)
+    return rc;
+
+  rc = rtems_rfs_dir_index_request (fs, map, &buffer, 0);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, &buffer);
+    return rc;
+  }
+
+  rc = rtems_rfs_dir_index_sort (fs, rtems_rfs_buffer_data (&buffer),
+                                 &copy, &slots, &count);
+  if (rc > 0)
+  {
+    rtems_rfs_buffer_handle_close (fs, &buffer);
+    return rc;
+  }
+
+  /*
+   * Move the entries to one or two leaves split at a hash boundary. Allocate
+   * every block before an entry is copied so a failure leaves the entries in
+   * the first block only.
+   */
+  split = rtems_rfs_dir_index_split_point (slots, count);
+
+  rc = rtems_rfs_block_map_grow (fs, map, 1, &blocks[0]);
+  if (rc == 0)
+  {
+    leaves[0] = rtems_rfs_block_map_count (map) - 1;
+
+    if (split)
+    {
+      rc = rtems_rfs_block_map_grow (fs, map, 1, &blocks[1]);
+      leaves[1] = rtems_rfs_block_map_count (map) - 1;
+    }
+  }
+
+  if (rc == 0)
+    rc = rtems_rfs_buffer_handle_request (fs, &buffer, blocks[0], false);
+
+  if (rc == 0)
+  {
+    rtems_rfs_dir_index_pack (fs, rtems_rfs_buffer_data (&buffer), copy,
+                              slots, 0, split ? split : count);
+    rtems_rfs_buffer_mark_dirty (&buffer);
+
+    if (split)
+    {
+      rc = rtems_rfs_buffer_handle_request (fs, &buffer, blocks[1], false);
+      if (rc == 0)
+      {
+        rtems_rfs_dir_index_pack (fs, rtems_rfs_buffer_data (&buffer), copy,
+                                  slots, split, count);
+        rtems_rfs_buffer_mark_dirty (&buffer);
+      }
+    }
+  }
+
+  /*
+   * The first block becomes the root. Mark the directory as indexed before
+   * the entries in the first block are replaced.
+   */
+  if (rc == 0)
+    rc = rtems_rfs_dir_index_request (fs, map, &buffer, 0);
+
+  if (rc == 0)
+    rc = rtems_rfs_dir_index_set (fs, dir, true);
+
+  if (rc == 0)
+  {
+    data = rtems_rfs_buffer_data (&buffer);
+    rtems_rfs_dir_index_init (fs, data, 1);
+    rtems_rfs_dir_index_insert_entry (data, 0, 0, leaves[0]);
+    if (split)
+      rtems_rfs_dir_index_insert_entry (data, 1, slots[split].hash,
+                                        leaves[1]);
+    rtems_rfs_buffer_mark_dirty (&buffer);
+  }
+  else
+  {
+    /*
+     * Return the leaves. The first block still holds every entry.
+     */
+    rtems_rfs_buffer_handle_release (fs, &buffer);
+    rtems_rfs_block_map_shrink (fs, map, rtems_rfs_block_map_count (map) - 1);
+  }
+
+  free (copy);
+  rtems_rfs_buffer_handle_close (fs, &buffer);
+  return rc;
+}
+
+int
+rtems_rfs_dir_index_drop (rtems_rfs_file_system*  fs,
+                          rtems_rfs_inode_handle* dir,
+                          rtems_rfs_block_map*    map)
+{
+  rtems_rfs_buffer_handle buffer;
+  rtems_rfs_block_no      bno;
+  int                     rc;
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_INDEX))
+    printf ("rtems-rfs: dir-index: drop: dir=%" PRIu32 "\n",
+            rtems_rfs_inode_ino (dir));
+
+  rc = rtems_rfs_buffer_handle_open (fs, &buffer);
+  if (rc > 0)
+    return rc;
+
+  /*
+   * Erase every index block so the space can hold entries. This includes any
+   * block left by a split that failed.
+   */
+  for (bno = 0; bno < rtems_rfs_block_map_count (map); bno++)
+  {
+    uint8_t* data;
+
+    rc = rtems_rfs_dir_index_request (fs, map, &buffer, bno);
+    if (rc > 0)
+      break;
+
+    data = rtems_rfs_buffer_data (&buffer);
+
+    if ((rtems_rfs_dir_entry_length (data) == RTEMS_RFS_DIR_ENTRY_EMPTY) &&
+        (rtems_rfs_read_u32 (data + RTEMS_RFS_DIR_INDEX_ID) ==
+         RTEMS_RFS_DIR_INDEX_MAGIC))
+    {
+      memset (data, 0xff, rtems_rfs_fs_block_size (fs));
+      rtems_rfs_buffer_mark_dirty (&buffer);
+    }
+  }
+
+  rtems_rfs_buffer_handle_close (fs, &buffer);
+
+  if (rc > 0)
+    return rc;
+
+  return rtems_rfs_dir_index_set (fs, dir, false);
+}
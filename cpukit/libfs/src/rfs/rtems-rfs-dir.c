@@ -57,13 +57,7 @@
 #include <rtems/rfs/rtems-rfs-trace.h>
 #include <rtems/rfs/rtems-rfs-dir.h>
 #include <rtems/rfs/rtems-rfs-dir-hash.h>
-
-/**
- * Validate the directory entry data.
- */
-#define rtems_rfs_dir_entry_valid(_f, _l, _i) \
-  (((_l) <= RTEMS_RFS_DIR_ENTRY_SIZE) || ((_l) >= rtems_rfs_fs_max_name (_f)) \
-   || (_i < RTEMS_RFS_ROOT_INO) || (_i > rtems_rfs_fs_inodes (_f)))
+#include <rtems/rfs/rtems-rfs-dir-index.h>
 
 int
 rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
@@ -110,8 +104,10 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
   }
   else
   {
-    rtems_rfs_block_no block;
-    uint32_t           hash;
+    rtems_rfs_block_pos bpos;
+    rtems_rfs_block_no  block;
+    uint32_t            hash;
+    bool                indexed;
 
     /*
      * Calculate the hash of the look up string.
@@ -119,10 +115,27 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
     hash = rtems_rfs_dir_hash (name, length);
 
     /*
-     * Locate the first block. The map points to the start after open so just
-     * seek 0. If an error the block will be 0.
+     * Locate the first block to search. An indexed directory holds all the
+     * entries with the hash in a single leaf. If the index is not valid search
+     * from the start. If an error the block will be 0.
      */
-    rc = rtems_rfs_block_map_seek (fs, &map, 0, &block);
+    rtems_rfs_block_set_bpos_zero (&bpos);
+
+    indexed = rtems_rfs_dir_index_enabled (fs, inode);
+    if (indexed)
+    {
+      rc = rtems_rfs_dir_index_lookup (fs, &map, hash, &bpos.bno);
+      if (rc > 0)
+      {
+        if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
+          printf ("rtems-rfs: dir-lookup-ino: index lookup failed: %d: %s\n",
+                  rc, strerror (rc));
+        bpos.bno = 0;
+        indexed = false;
+      }
+    }
+
+    rc = rtems_rfs_block_map_find (fs, &map, &bpos, &block);
     if (rc > 0)
     {
       if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_LOOKUP_INO))
@@ -211,6 +224,9 @@ rtems_rfs_dir_lookup_ino (rtems_rfs_file_system*  fs,
         entry += elength;
       }
 
+      if ((rc == 0) && indexed)
+        rc = ENOENT;
+
       if (rc == 0)
       {
         rc = rtems_rfs_block_map_next_block (fs, &map, &block);
@@ -250,6 +266,7 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
   rtems_rfs_block_map     map;
   rtems_rfs_block_pos     bpos;
   rtems_rfs_buffer_handle buffer;
+  bool                    try_index;
   int                     rc;
 
   if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
@@ -273,6 +290,41 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
     return rc;
   }
 
+  /*
+   * Add the entry to the leaf the index selects. If the index cannot hold the
+   * entry stop using it. The leaves are normal directory blocks so the
+   * directory is still valid when searched from the start. If the file system
+   * has no free block keep the index.
+   */
+  try_index = rtems_rfs_fs_dir_index (fs);
+
+  if (rtems_rfs_dir_index_enabled (fs, dir))
+  {
+    try_index = false;
+
+    rc = rtems_rfs_dir_index_add_entry (fs, &map, name, length, ino);
+    if (rc == 0)
+    {
+      rtems_rfs_buffer_handle_close (fs, &buffer);
+      rtems_rfs_block_map_close (fs, &map);
+      return 0;
+    }
+
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
+      printf ("rtems-rfs: dir-add-entry: "
+              "index add failed for ino %" PRIu32 ": %d: %s\n",
+              rtems_rfs_inode_ino (dir), rc, strerror (rc));
+
+    if (rc != ENOSPC)
+      rc = rtems_rfs_dir_index_drop (fs, dir, &map);
+    if (rc > 0)
+    {
+      rtems_rfs_buffer_handle_close (fs, &buffer);
+      rtems_rfs_block_map_close (fs, &map);
+      return rc;
+    }
+  }
+
   /*
    * Search the map from the beginning to find any empty space.
    */
@@ -302,6 +354,49 @@ rtems_rfs_dir_add_entry (rtems_rfs_file_system*  fs,
         break;
       }
 
+      /*
+       * A directory held in a single full block is indexed if the file system
+       * supports it. A failed create leaves the directory in the single block
+       * so grow it instead. If the index cannot hold the entry search from the
+       * start.
+       */
+      if (try_index && (rtems_rfs_block_map_count (&map) == 1))
+      {
+        try_index = false;
+
+        rc = rtems_rfs_dir_index_create (fs, dir, &map);
+        if (rc == 0)
+        {
+          rc = rtems_rfs_dir_index_add_entry (fs, &map, name, length, ino);
+          if (rc == 0)
+          {
+            rtems_rfs_buffer_handle_close (fs, &buffer);
+            rtems_rfs_block_map_close (fs, &map);
+            return 0;
+          }
+
+          if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
+            printf ("rtems-rfs: dir-add-entry: "
+                    "index add failed for ino %" PRIu32 ": %d: %s\n",
+                    rtems_rfs_inode_ino (dir), rc, strerror (rc));
+
+          if (rc == ENOSPC)
+            break;
+
+          rc = rtems_rfs_dir_index_drop (fs, dir, &map);
+          if (rc > 0)
+            break;
+
+          rtems_rfs_block_set_bpos_zero (&bpos);
+          continue;
+        }
+
+        if (rtems_rfs_trace (RTEMS_RFS_TRACE_DIR_ADD_ENTRY))
+          printf ("rtems-rfs: dir-add-entry: "
+                  "index create failed for ino %" PRIu32 ": %d: %s\n",
+                  rtems_rfs_inode_ino (dir), rc, strerror (rc));
+      }
+
       /*
        * We have reached the end of the directory so add a block.
        */
@@ -485,7 +580,8 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
 
         /*
          * If the remainder of the block is empty and this is the start of the
-         * block and it is the last block in the map shrink the map.
+         * block and it is the last block in the map shrink the map. The blocks
+         * of an indexed directory are held by the index and are not removed.
          *
          * @note We could check again to see if the new end block in the map is
          *       also empty. This way we could clean up an empty directory.
@@ -500,7 +596,8 @@ rtems_rfs_dir_del_entry (rtems_rfs_file_system*  fs,
                   rtems_rfs_block_map_last (&map) ? "yes" : "no");
 
         if ((elength == RTEMS_RFS_DIR_ENTRY_EMPTY) &&
-            (eoffset == 0) && rtems_rfs_block_map_last (&map))
+            (eoffset == 0) && rtems_rfs_block_map_last (&map) &&
+            !rtems_rfs_dir_index_enabled (fs, dir))
         {
           rc = rtems_rfs_block_map_shrink (fs, &map, 1);
           if (rc > 0)
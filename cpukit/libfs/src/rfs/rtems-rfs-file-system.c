@@ -131,6 +131,20 @@ rtems_rfs_fs_read_superblock (rtems_rfs_file_system* fs)
     return EIO;
   }
 
+  fs->features = read_sb (RTEMS_RFS_SB_OFFSET_FEATURES);
+  if (fs->features == RTEMS_RFS_FEATURE_NONE)
+    fs->features = 0;
+
+  if ((fs->features & RTEMS_RFS_FEATURE_INCOMPAT_MASK &
+       ~RTEMS_RFS_FEATURE_SUPPORTED) != 0)
+  {
+    if (rtems_rfs_trace (RTEMS_RFS_TRACE_OPEN))
+      printf ("rtems-rfs: read-superblock: unsupported features: %08" PRIx32 "\n",
+              fs->features);
+    rtems_rfs_buffer_handle_close (fs, &handle);
+    return EIO;
+  }
+
   fs->bad_blocks      = read_sb (RTEMS_RFS_SB_OFFSET_BAD_BLOCKS);
   fs->max_name_length = read_sb (RTEMS_RFS_SB_OFFSET_MAX_NAME_LENGTH);
   fs->group_count     = read_sb (RTEMS_RFS_SB_OFFSET_GROUPS);
@@ -200,6 +200,12 @@ rtems_rfs_check_config (rtems_rfs_file_system*         fs,
     fs->max_name_length = 512;
   }
 
+  fs->features = 0;
+  if (config->extents)
+    fs->features |= RTEMS_RFS_FEATURE_EXTENTS;
+  if (config->dir_index)
+    fs->features |= RTEMS_RFS_FEATURE_DIR_INDEX;
+
   return true;
 }
 
@@ -450,6 +456,7 @@ rtems_rfs_write_superblock (rtems_rfs_file_system* fs)
   write_sb (RTEMS_RFS_SB_OFFSET_GROUP_BLOCKS, fs->group_blocks);
   write_sb (RTEMS_RFS_SB_OFFSET_GROUP_INODES, fs->group_inodes);
   write_sb (RTEMS_RFS_SB_OFFSET_INODE_SIZE, RTEMS_RFS_INODE_SIZE);
+  write_sb (RTEMS_RFS_SB_OFFSET_FEATURES, rtems_rfs_fs_features (fs));
 
   rtems_rfs_buffer_mark_dirty (&handle);
 
@@ -637,6 +644,8 @@ rtems_rfs_format (const char* name, const rtems_rfs_format_config* config)
     printf ("rtems-rfs: format: groups = %u\n", fs.group_count);
     printf ("rtems-rfs: format: group blocks = %zu\n", fs.group_blocks);
     printf ("rtems-rfs: format: group inodes = %zu\n", fs.group_inodes);
+    printf ("rtems-rfs: format: features = %08" PRIx32 "\n",
+            rtems_rfs_fs_features (&fs));
   }
 
   rc = rtems_rfs_buffer_setblksize (&fs, rtems_rfs_fs_block_size (&fs));
@@ -288,6 +288,60 @@ rtems_rfs_group_bitmap_alloc (rtems_rfs_file_system* fs,
   return ENOSPC;
 }
 
+int
+rtems_rfs_group_bitmap_alloc_run (rtems_rfs_file_system* fs,
+                                  rtems_rfs_bitmap_bit   goal,
+                                  size_t                 count,
+                                  rtems_rfs_bitmap_bit*  result,
+                                  size_t*                allocated)
+{
+  rtems_rfs_bitmap_control* bitmap;
+  unsigned int              group;
+  rtems_rfs_bitmap_bit      bit;
+  rtems_rfs_bitmap_bit      no;
+  int                       rc;
+
+  rc = rtems_rfs_group_bitmap_alloc (fs, goal, false, result);
+  if (rc > 0)
+    return rc;
+
+  *allocated = 1;
+
+  no = *result - RTEMS_RFS_SUPERBLOCK_SIZE;
+  group = no / fs->group_blocks;
+  bit = (rtems_rfs_bitmap_bit) (no % fs->group_blocks);
+  bitmap = &fs->groups[group].block_bitmap;
+
+  /*
+   * Extend the run while the next block in the group is free. A failure stops
+   * the run and is not an error because the first block is allocated.
+   */
+  while ((*allocated < count) &&
+         ((bit + *allocated) < rtems_rfs_bitmap_map_size (bitmap)))
+  {
+    bool state;
+
+    rc = rtems_rfs_bitmap_map_test (bitmap, bit + *allocated, &state);
+    if ((rc > 0) || state)
+      break;
+
+    rc = rtems_rfs_bitmap_map_set (bitmap, bit + *allocated);
+    if (rc > 0)
+      break;
+
+    (*allocated)++;
+  }
+
+  if (rtems_rfs_fs_release_bitmaps (fs))
+    rtems_rfs_bitmap_release_buffer (fs, bitmap);
+
+  if (rtems_rfs_trace (RTEMS_RFS_TRACE_GROUP_BITMAPS))
+    printf ("rtems-rfs: group-bitmap-alloc-run: block=%" PRId32 " count=%zu\n",
+            *result, *allocated);
+
+  return 0;
+}
+
 int
 rtems_rfs_group_bitmap_free (rtems_rfs_file_system* fs,
                              bool                   inode,
@@ -263,6 +263,9 @@ rtems_rfs_inode_create (rtems_rfs_file_system*  fs,
     return rc;
   }
 
+  if (rtems_rfs_fs_extents (fs))
+    rtems_rfs_inode_set_flags (&inode, RTEMS_RFS_INODE_FLAG_EXTENTS);
+
   /*
    * Only handle the specifics of a directory. Let caller handle the others.
    *
@@ -105,8 +105,9 @@ rtems_monitor_sema_canonical(
         /* Fall through */
       case SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY:
       case SEMAPHORE_VARIANT_MUTEX_NO_PROTOCOL:
-        owner = _CORE_mutex_Get_owner(
-          &rtems_sema->Core_control.Mutex.Recursive.Mutex
+        owner = _Semaphore_Get_mutex_owner(
+          rtems_sema,
+          _Semaphore_Get_variant( flags )
         );
 
         if (owner != NULL) {
@@ -126,11 +127,11 @@ rtems_monitor_sema_canonical(
         break;
 #endif
       case SEMAPHORE_VARIANT_SIMPLE_BINARY:
-        canonical_sema->cur_count = rtems_sema->Core_control.Semaphore.count;
+        canonical_sema->cur_count = _Semaphore_Get_count( rtems_sema );
         canonical_sema->max_count = 1;
         break;
       case SEMAPHORE_VARIANT_COUNTING:
-        canonical_sema->cur_count = rtems_sema->Core_control.Semaphore.count;
+        canonical_sema->cur_count = _Semaphore_Get_count( rtems_sema );
         canonical_sema->max_count = UINT32_MAX;
         break;
     }
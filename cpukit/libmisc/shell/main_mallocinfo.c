@@ -37,6 +37,11 @@ static int rtems_shell_main_malloc_info(
     malloc_info( &info );
     rtems_shell_print_heap_info( "free", &info.Free );
     rtems_shell_print_heap_info( "used", &info.Used );
+
+    if ( rtems_malloc_cache != NULL ) {
+      rtems_shell_print_heap_info( "cached", &info.Cached );
+    }
+
     rtems_shell_print_heap_stats( &info.Stats );
   }
 
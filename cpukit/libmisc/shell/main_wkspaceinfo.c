@@ -18,7 +18,9 @@
 #include <rtems.h>
 #include <rtems/malloc.h>
 #include <rtems/shell.h>
+#include <rtems/score/apimutex.h>
 #include <rtems/score/protectedheap.h>
+#include <rtems/score/stackpool.h>
 #include <rtems/score/wkspace.h>
 #include "internal.h"
 
@@ -43,6 +45,34 @@ static int rtems_shell_main_wkspace_info(
   rtems_shell_print_heap_info( "used", &info.Used );
   rtems_shell_print_heap_stats( &info.Stats );
 
+  if ( _Stack_Pool != NULL ) {
+    Stack_Pool_Information pool_info;
+    uint32_t               requests;
+
+    _RTEMS_Lock_allocator();
+    _Stack_Pool_Get_information( &pool_info );
+    _RTEMS_Unlock_allocator();
+
+    requests = pool_info.hits + pool_info.misses;
+    printf(
+      "Number of stack pool hits:                %12" PRIu32 "\n"
+      "Number of stack pool misses:              %12" PRIu32 "\n"
+      "Stack pool hit ratio in percent:          %12" PRIu32 "\n"
+      "Number of oversized stack allocations:    %12" PRIu32 "\n"
+      "Number of stack pool flushes:             %12" PRIu32 "\n"
+      "Number of cached stack areas:             %12" PRIu32 "\n"
+      "Total bytes of cached stack areas:        %12" PRIuPTR "\n",
+      pool_info.hits,
+      pool_info.misses,
+      requests != 0 ?
+        (uint32_t) ( (uint64_t) pool_info.hits * 100 / requests ) : 0,
+      pool_info.oversized,
+      pool_info.flushes,
+      pool_info.cached,
+      pool_info.cached_size
+    );
+  }
+
   return 0;
 }
 
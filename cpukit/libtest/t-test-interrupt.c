@@ -113,11 +113,11 @@ T_interrupt_time_close_to_tick(void)
 
 	ns_per_tick = (int32_t)_Watchdog_Nanoseconds_per_tick;
 	n = RTEMS_ARRAY_SIZE(ct);
-	c0 = _Watchdog_Ticks_since_boot;
+	c0 = _Watchdog_Get_ticks_since_boot();
 
 	for (i = 0; i < n; ++i) {
 		do {
-			c1 = _Watchdog_Ticks_since_boot;
+			c1 = _Watchdog_Get_ticks_since_boot();
 			t = _Timecounter_Sbinuptime();
 		} while (c0 == c1);
 
@@ -51,6 +51,7 @@ T_heap_run_initialize(void)
 	T_resource_heap_context *ctx;
 
 	ctx = &T_resource_heap_instance;
+	rtems_malloc_cache_flush();
 	T_get_heap_info(&_Workspace_Area, &ctx->workspace_info);
 
 	if (!rtems_configuration_get_unified_work_area()) {
@@ -67,6 +68,7 @@ T_heap_case_end(void)
 
 	ctx = &T_resource_heap_instance;
 
+	rtems_malloc_cache_flush();
 	T_get_heap_info(&_Workspace_Area, &info);
 	ok = memcmp(&info, &ctx->workspace_info, sizeof(info)) == 0;
 
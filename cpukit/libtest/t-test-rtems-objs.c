@@ -58,6 +58,7 @@ T_get_thread_timer_state(uint32_t id)
 	switch (_Watchdog_Get_state(&the_thread->Timer.Watchdog)) {
 		case WATCHDOG_SCHEDULED_BLACK:
 		case WATCHDOG_SCHEDULED_RED:
+		case WATCHDOG_SCHEDULED_WHEEL:
 			state = T_THREAD_TIMER_SCHEDULED;
 			break;
 		case WATCHDOG_PENDING:
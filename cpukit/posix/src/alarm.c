@@ -94,7 +94,7 @@ unsigned int alarm(
 
   cpu = _Watchdog_Get_CPU( the_watchdog );
   _Watchdog_Per_CPU_acquire_critical( cpu, &lock_context2 );
-  now = cpu->Watchdog.ticks;
+  now = _Watchdog_Per_CPU_get_ticks( cpu );
 
   remaining = (unsigned long) _Watchdog_Cancel(
     &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
@@ -67,6 +67,7 @@ void *mmap(
   bool            map_anonymous;
   bool            map_shared;
   bool            map_private;
+  bool            map_read_only;
   bool            is_shared_shm;
   int             err;
 
@@ -74,6 +75,7 @@ void *mmap(
   map_anonymous = (flags & MAP_ANON) == MAP_ANON;
   map_shared = (flags & MAP_SHARED) == MAP_SHARED;
   map_private = (flags & MAP_PRIVATE) == MAP_PRIVATE;
+  map_read_only = (prot & PROT_WRITE) != PROT_WRITE;
 
   /* Clear errno. */
   errno = 0;
@@ -96,9 +98,11 @@ void *mmap(
   /*
    * We can not normally provide restriction of write access. Reject any
    * attempt to map without write permission, since we are not able to
-   * prevent a write from succeeding.
+   * prevent a write from succeeding.  Shared mappings of regular files are an
+   * exception, since they refer directly to the file contents.  The check for
+   * the file type follows below.
    */
-  if ( PROT_WRITE != (prot & PROT_WRITE) ) {
+  if ( map_read_only && ( map_anonymous || !map_shared ) ) {
     errno = ENOTSUP;
     return MAP_FAILED;
   }
@@ -170,6 +174,12 @@ void *mmap(
     /* fstat ensures we have a good file descriptor. Hold on to iop. */
     iop = rtems_libio_iop( fildes );
 
+    /* Only shared mappings of regular files may be read-only. */
+    if ( map_read_only && !S_ISREG( sb.st_mode ) ) {
+      errno = ENOTSUP;
+      return MAP_FAILED;
+    }
+
     /* Check the type of file we have and make sure it is supported. */
     if ( S_ISDIR( sb.st_mode ) || S_ISLNK( sb.st_mode )) {
       errno = ENODEV;
@@ -178,13 +188,18 @@ void *mmap(
 
     /* Check to see if the mapping is valid for a regular file. */
     if ( S_ISREG( sb.st_mode )
-    /* FIXME: Should this be using strict inequality (>) comparisons? It would
-     * be valid to map a region exactly equal to the st_size, e.g. see below. */
-         && (( off >= sb.st_size ) || (( off + len ) >= sb.st_size ))) {
+         && (( off >= sb.st_size ) || (( off + len ) > sb.st_size ))) {
       errno = EOVERFLOW;
       return MAP_FAILED;
     }
 
+    /* Writable shared mappings of regular files need write access. */
+    if ( S_ISREG( sb.st_mode ) && map_shared && !map_read_only
+         && !rtems_libio_iop_is_writeable( iop ) ) {
+      errno = EACCES;
+      return MAP_FAILED;
+    }
+
     /* Check to see if the mapping is valid for other file/object types. */
     if ( !S_ISCHR( sb.st_mode ) && sb.st_size < off + len ) {
       errno = ENXIO;
@@ -311,6 +326,20 @@ void *mmap(
       free( mapping );
       return MAP_FAILED;
     }
+
+    /*
+     * The mapping refers directly to the file memory.  Keep a reference to
+     * the file node until munmap(), so that the node is not destroyed if the
+     * file is closed and removed.  A file system which has to keep the memory
+     * of the node in place pins it in the MMAP handler and releases it in the
+     * MUNMAP handler.
+     */
+    if ( S_ISREG( sb.st_mode ) ) {
+      rtems_filesystem_instance_lock( &iop->pathinfo );
+      rtems_filesystem_location_clone( &mapping->location, &iop->pathinfo );
+      rtems_filesystem_instance_unlock( &iop->pathinfo );
+      mapping->has_location = true;
+    }
   }
 
   rtems_chain_append_unprotected( &mmap_mappings, &mapping->node );
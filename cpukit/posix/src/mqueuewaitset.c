@@ -0,0 +1,145 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup POSIXAPI
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_wait_set_add_posix_message_queue().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/posix/mqueueimpl.h>
+#include <rtems/rtems/waitsetimpl.h>
+
+static Status_Control _POSIX_Message_queue_Wait_set_attach(
+  Wait_set_Member *member
+)
+{
+  POSIX_Message_queue_Control *the_mq;
+  Thread_queue_Context         queue_context;
+  Status_Control               status;
+
+  the_mq = _POSIX_Message_queue_Get( member->id, &queue_context );
+
+  if ( the_mq == NULL ) {
+    return STATUS_INVALID_ID;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_mq->Message_queue,
+    &queue_context
+  );
+
+  if ( the_mq->open_count == 0 ) {
+    status = STATUS_INVALID_ID;
+  } else {
+    status = _Wait_set_Member_attach_to(
+      &the_mq->Message_queue.wait_set_member,
+      member
+    );
+  }
+
+  _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
+  return status;
+}
+
+static bool _POSIX_Message_queue_Wait_set_is_ready(
+  const Wait_set_Member *member
+)
+{
+  POSIX_Message_queue_Control *the_mq;
+  Thread_queue_Context         queue_context;
+  bool                         is_ready;
+
+  the_mq = _POSIX_Message_queue_Get( member->id, &queue_context );
+
+  if ( the_mq == NULL ) {
+    return true;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_mq->Message_queue,
+    &queue_context
+  );
+  is_ready = the_mq->open_count == 0
+    || the_mq->Message_queue.number_of_pending_messages != 0;
+  _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
+  return is_ready;
+}
+
+static void _POSIX_Message_queue_Wait_set_detach( Wait_set_Member *member )
+{
+  POSIX_Message_queue_Control *the_mq;
+  Thread_queue_Context         queue_context;
+
+  the_mq = _POSIX_Message_queue_Get( member->id, &queue_context );
+
+  if ( the_mq == NULL ) {
+    return;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_mq->Message_queue,
+    &queue_context
+  );
+  _Wait_set_Member_detach_from(
+    &the_mq->Message_queue.wait_set_member,
+    member
+  );
+  _CORE_message_queue_Release( &the_mq->Message_queue, &queue_context );
+}
+
+static const Wait_set_Member_operations
+_POSIX_Message_queue_Wait_set_operations = {
+  .attach = _POSIX_Message_queue_Wait_set_attach,
+  .is_ready = _POSIX_Message_queue_Wait_set_is_ready,
+  .detach = _POSIX_Message_queue_Wait_set_detach
+};
+
+rtems_status_code rtems_wait_set_add_posix_message_queue(
+  rtems_wait_set *wait_set,
+  uint32_t        index,
+  rtems_id        mqdes
+)
+{
+  Status_Control status;
+
+  status = _Wait_set_Add(
+    wait_set,
+    index,
+    &_POSIX_Message_queue_Wait_set_operations,
+    (Objects_Id) mqdes,
+    0
+  );
+  return _Status_Get( status );
+}
@@ -41,6 +41,7 @@
 int munmap(void *addr, size_t len)
 {
   mmap_mapping     *mapping;
+  mmap_mapping     *found;
   rtems_chain_node *node;
 
   /*
@@ -64,32 +65,54 @@ int munmap(void *addr, size_t len)
 
   mmap_mappings_lock_obtain();
 
+  /*
+   * Shared mappings may overlap, so prefer the mapping which starts at the
+   * address.
+   */
+  found = NULL;
   node = rtems_chain_first (&mmap_mappings);
   while ( !rtems_chain_is_tail( &mmap_mappings, node )) {
     mapping = (mmap_mapping*) node;
     if ( ( addr >= mapping->addr ) &&
          ( addr < ( mapping->addr + mapping->len )) ) {
-      rtems_chain_extract_unprotected( node );
+      found = mapping;
 
-      /* FIXME: generally need a way to clean-up the backing object, but
-       * currently it only matters for MAP_SHARED shm objects. */
-      if ( mapping->shm != NULL ) {
-        POSIX_Shm_Attempt_delete(mapping->shm);
+      if ( addr == mapping->addr ) {
+        break;
       }
+    }
+    node = rtems_chain_next( node );
+  }
+
+  if ( found != NULL ) {
+    mapping = found;
+    rtems_chain_extract_unprotected( &mapping->node );
 
-      /* only free the mapping address for non-fixed mapping */
-      if (( mapping->flags & MAP_FIXED ) != MAP_FIXED ) {
-        /* only free the mapping address for non-shared mapping, because we
-         * re-use the mapping address across all of the shared mappings, and
-         * it is memory managed independently... */
-        if (( mapping->flags & MAP_SHARED ) != MAP_SHARED ) {
-          free( mapping->addr );
-        }
+    /* Release the shared memory object of a shared mapping */
+    if ( mapping->shm != NULL ) {
+      POSIX_Shm_Attempt_delete(mapping->shm);
+    }
+
+    /* Release the file node of a shared mapping of a regular file */
+    if ( mapping->has_location ) {
+      (*mapping->location.handlers->munmap_h)(
+        &mapping->location,
+        mapping->addr,
+        mapping->len
+      );
+      rtems_filesystem_location_free( &mapping->location );
+    }
+
+    /* only free the mapping address for non-fixed mapping */
+    if (( mapping->flags & MAP_FIXED ) != MAP_FIXED ) {
+      /* only free the mapping address for non-shared mapping, because we
+       * re-use the mapping address across all of the shared mappings, and
+       * it is memory managed independently... */
+      if (( mapping->flags & MAP_SHARED ) != MAP_SHARED ) {
+        free( mapping->addr );
       }
-      free( mapping );
-      break;
     }
-    node = rtems_chain_next( node );
+    free( mapping );
   }
 
   mmap_mappings_lock_release( );
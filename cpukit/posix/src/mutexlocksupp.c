@@ -40,6 +40,7 @@
 
 #include <rtems/posix/muteximpl.h>
 #include <rtems/posix/posixapi.h>
+#include <rtems/score/mutexspinimpl.h>
 
 Status_Control _POSIX_Mutex_Seize_slow(
   POSIX_Mutex_Control           *the_mutex,
@@ -50,6 +51,38 @@ Status_Control _POSIX_Mutex_Seize_slow(
 )
 {
   if ( (uintptr_t) abstime != POSIX_MUTEX_ABSTIME_TRY_LOCK ) {
+#if defined(RTEMS_SMP)
+    Thread_Control *owner;
+
+    owner = _POSIX_Mutex_Get_owner( the_mutex );
+
+    if (
+      operations == POSIX_MUTEX_PRIORITY_INHERIT_TQ_OPERATIONS
+        && _Mutex_Spin_is_worthwhile( owner )
+    ) {
+      bool success;
+
+      _POSIX_Mutex_Release( the_mutex, queue_context );
+      _Mutex_Spin_wait( &the_mutex->Recursive.Mutex.Queue.Queue, owner );
+      _ISR_lock_ISR_disable( &queue_context->Lock_context.Lock_context );
+      _Thread_queue_Queue_acquire_critical(
+        &the_mutex->Recursive.Mutex.Queue.Queue,
+        &executing->Potpourri_stats,
+        &queue_context->Lock_context.Lock_context
+      );
+
+      success = !_POSIX_Mutex_Is_locked( the_mutex );
+      _Mutex_Spin_account( success );
+
+      if ( success ) {
+        _POSIX_Mutex_Set_owner( the_mutex, executing );
+        _Thread_Resource_count_increment( executing );
+        _POSIX_Mutex_Release( the_mutex, queue_context );
+        return STATUS_SUCCESSFUL;
+      }
+    }
+#endif
+
     _Thread_queue_Context_set_thread_state(
       queue_context,
       STATES_WAITING_FOR_MUTEX
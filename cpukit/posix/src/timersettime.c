@@ -63,7 +63,7 @@ static void _POSIX_Timer_Insert(
   _Watchdog_Insert(
     &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
     &ptimer->Timer,
-    cpu->Watchdog.ticks + ticks
+    _Watchdog_Per_CPU_get_ticks( cpu ) + ticks
   );
 }
 
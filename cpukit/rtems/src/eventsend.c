@@ -42,6 +42,7 @@
 #include <rtems/rtems/eventimpl.h>
 #include <rtems/rtems/tasksdata.h>
 #include <rtems/score/threadimpl.h>
+#include <rtems/score/waitsetimpl.h>
 
 rtems_status_code rtems_event_send(
   rtems_id        id,
@@ -51,6 +52,8 @@ rtems_status_code rtems_event_send(
   Thread_Control    *the_thread;
   RTEMS_API_Control *api;
   ISR_lock_Context   lock_context;
+  Wait_set_Member   *wait_set_member;
+  rtems_status_code  sc;
 
   the_thread = _Thread_Get( id, &lock_context );
 
@@ -63,11 +66,30 @@ rtems_status_code rtems_event_send(
   }
 
   api = the_thread->API_Extensions[ THREAD_API_RTEMS ];
-  return _Event_Surrender(
+  _Thread_Wait_acquire_default_critical( the_thread, &lock_context );
+  wait_set_member = api->Event.wait_set_member;
+
+  if (
+    wait_set_member != NULL
+      && ( event_in & wait_set_member->option ) != 0
+  ) {
+    wait_set_member = _Wait_set_Member_obtain(
+      wait_set_member,
+      &lock_context
+    );
+  } else {
+    wait_set_member = NULL;
+  }
+
+  _Thread_Wait_release_default_critical( the_thread, &lock_context );
+  sc = _Event_Surrender(
     the_thread,
     event_in,
     &api->Event,
     THREAD_WAIT_CLASS_EVENT,
     &lock_context
   );
+
+  _Wait_set_Member_notify( wait_set_member );
+  return sc;
 }
@@ -0,0 +1,128 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplClassicMessage
+ *
+ * @brief This source file contains the implementation of
+ *   _Message_queue_Submit_many() and rtems_message_queue_send_many().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/messageimpl.h>
+#include <rtems/rtems/statusimpl.h>
+
+rtems_status_code _Message_queue_Submit_many(
+  rtems_id                         id,
+  const void                      *buffer,
+  const size_t                    *sizes,
+  uint32_t                         count,
+  uint32_t                        *submitted,
+  CORE_message_queue_Submit_types  submit_type
+)
+{
+  Message_queue_Control            *the_message_queue;
+  CORE_message_queue_Batch_context  context;
+  Status_Control                    status;
+
+  if ( buffer == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( sizes == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( submitted == NULL ) {
+    return RTEMS_INVALID_ADDRESS;
+  }
+
+  if ( count == 0 ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  the_message_queue = _Message_queue_Get( id, &context.Base );
+
+  if ( the_message_queue == NULL ) {
+#if defined(RTEMS_MULTIPROCESSING)
+    if ( _Message_queue_MP_Is_remote( id ) ) {
+      return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+    }
+#endif
+
+    return RTEMS_INVALID_ID;
+  }
+
+#if defined(RTEMS_MULTIPROCESSING)
+  /*
+   * The receivers are unblocked through _Thread_queue_Flush_critical() which
+   * does not support thread proxies of remote receivers.
+   */
+  if ( the_message_queue->is_global ) {
+    _ISR_lock_ISR_enable( &context.Base.Lock_context.Lock_context );
+    return RTEMS_ILLEGAL_ON_REMOTE_OBJECT;
+  }
+#endif
+
+  _CORE_message_queue_Acquire_critical(
+    &the_message_queue->message_queue,
+    &context.Base
+  );
+  status = _CORE_message_queue_Submit_many(
+    &the_message_queue->message_queue,
+    buffer,
+    sizes,
+    count,
+    submitted,
+    submit_type,
+    &context
+  );
+  return _Status_Get( status );
+}
+
+rtems_status_code rtems_message_queue_send_many(
+  rtems_id      id,
+  const void   *buffer,
+  const size_t *sizes,
+  uint32_t      count,
+  uint32_t     *sent
+)
+{
+  return _Message_queue_Submit_many(
+    id,
+    buffer,
+    sizes,
+    count,
+    sent,
+    CORE_MESSAGE_QUEUE_SEND_REQUEST
+  );
+}
@@ -180,6 +180,7 @@ rtems_status_code rtems_semaphore_create(
         _Thread_Resource_count_increment( executing );
       }
 
+      _Semaphore_Fast_path_thaw( the_semaphore, variant );
       status = STATUS_SUCCESSFUL;
       break;
     case SEMAPHORE_VARIANT_MUTEX_PRIORITY_CEILING:
@@ -248,6 +249,7 @@ rtems_status_code rtems_semaphore_create(
         &the_semaphore->Core_control.Semaphore,
         count
       );
+      _Semaphore_Fast_path_thaw( the_semaphore, variant );
       status = STATUS_SUCCESSFUL;
       break;
   }
@@ -258,6 +260,8 @@ rtems_status_code rtems_semaphore_create(
     return _Status_Get( status );
   }
 
+  the_semaphore->wait_set_member = NULL;
+
   /*
    *  Whether we initialized it as a mutex or counting semaphore, it is
    *  now ready to be "offered" for use as a Classic API Semaphore.
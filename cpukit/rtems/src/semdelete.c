@@ -51,6 +51,7 @@ rtems_status_code rtems_semaphore_delete(
   uintptr_t             flags;
   Semaphore_Variant     variant;
   Status_Control        status;
+  Wait_set_Member      *wait_set_member;
 
   _Objects_Allocator_lock();
   the_semaphore = _Semaphore_Get( id, &queue_context );
@@ -73,6 +74,7 @@ rtems_status_code rtems_semaphore_delete(
   );
   flags = _Semaphore_Get_flags( the_semaphore );
   variant = _Semaphore_Get_variant( flags );
+  _Semaphore_Fast_path_freeze( the_semaphore, variant );
 
   switch ( variant ) {
     case SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY:
@@ -104,6 +106,7 @@ rtems_status_code rtems_semaphore_delete(
   }
 
   if ( status != STATUS_SUCCESSFUL ) {
+    _Semaphore_Fast_path_thaw( the_semaphore, variant );
     _Thread_queue_Release(
       &the_semaphore->Core_control.Wait_queue,
       &queue_context
@@ -114,6 +117,12 @@ rtems_status_code rtems_semaphore_delete(
 
   _Objects_Close( &_Semaphore_Information, &the_semaphore->Object );
 
+  wait_set_member = _Wait_set_Member_obtain(
+    the_semaphore->wait_set_member,
+    &queue_context.Lock_context.Lock_context
+  );
+  the_semaphore->wait_set_member = NULL;
+
   switch ( variant ) {
 #if defined(RTEMS_SMP)
     case SEMAPHORE_VARIANT_MRSP:
@@ -138,6 +147,9 @@ rtems_status_code rtems_semaphore_delete(
       break;
   }
 
+  /* Let the threads waiting on the wait set observe the deletion */
+  _Wait_set_Member_notify( wait_set_member );
+
 #if defined(RTEMS_MULTIPROCESSING)
   if ( _Semaphore_Is_global( flags ) ) {
 
@@ -42,6 +42,8 @@
 #include <rtems/rtems/semimpl.h>
 #include <rtems/rtems/optionsimpl.h>
 #include <rtems/rtems/statusimpl.h>
+#include <rtems/score/mutexspinimpl.h>
+#include <rtems/score/statesimpl.h>
 
 THREAD_QUEUE_OBJECT_ASSERT(
   Semaphore_Control,
@@ -61,6 +63,12 @@ THREAD_QUEUE_OBJECT_ASSERT(
   SEMAPHORE_CONTROL_SEMAPHORE
 );
 
+THREAD_QUEUE_OBJECT_ASSERT(
+  Semaphore_Control,
+  Core_control.Fast_path.Wait_queue,
+  SEMAPHORE_CONTROL_FAST_PATH
+);
+
 #if defined(RTEMS_SMP)
 THREAD_QUEUE_OBJECT_ASSERT(
   Semaphore_Control,
@@ -69,6 +77,143 @@ THREAD_QUEUE_OBJECT_ASSERT(
 );
 #endif
 
+RTEMS_STATIC_ASSERT(
+  offsetof( Semaphore_Control, Core_control.Fast_path.state )
+    >= offsetof( Semaphore_Control, Core_control.Semaphore.count )
+      + sizeof( uint32_t ),
+  SEMAPHORE_CONTROL_FAST_PATH_COUNT
+);
+
+RTEMS_STATIC_ASSERT(
+  offsetof( Semaphore_Control, Core_control.Fast_path.state )
+    >= offsetof( Semaphore_Control, Core_control.Mutex.Recursive.nest_level )
+      + sizeof( unsigned int ),
+  SEMAPHORE_CONTROL_FAST_PATH_NEST_LEVEL
+);
+
+static Status_Control _Semaphore_Seize_mutex(
+  Semaphore_Control             *the_semaphore,
+  Semaphore_Variant              variant,
+  const Thread_queue_Operations *operations,
+  Thread_Control                *executing,
+  bool                           wait,
+  Thread_queue_Context          *queue_context
+)
+{
+  CORE_recursive_mutex_Control *the_mutex;
+  Thread_Control               *owner;
+
+  the_mutex = &the_semaphore->Core_control.Mutex.Recursive;
+  _CORE_mutex_Acquire_critical( &the_mutex->Mutex, queue_context );
+  _Semaphore_Fast_path_freeze( the_semaphore, variant );
+
+  owner = _CORE_mutex_Get_owner( &the_mutex->Mutex );
+
+  if ( owner == NULL ) {
+    _CORE_mutex_Set_owner( &the_mutex->Mutex, executing );
+    _Thread_Resource_count_increment( executing );
+    _Semaphore_Fast_path_thaw( the_semaphore, variant );
+    _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( owner == executing ) {
+    Status_Control status;
+
+    status = _CORE_recursive_mutex_Seize_nested( the_mutex );
+    _Semaphore_Fast_path_thaw( the_semaphore, variant );
+    _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
+    return status;
+  }
+
+  if ( !wait ) {
+    _Semaphore_Fast_path_thaw( the_semaphore, variant );
+    _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
+    return STATUS_UNAVAILABLE;
+  }
+
+#if defined(RTEMS_SMP)
+  if (
+    variant == SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY
+      && _Mutex_Spin_is_worthwhile( owner )
+  ) {
+    bool success;
+
+    /*
+     * The fast path stays frozen during the spinning, so that the owner
+     * releases the mutex through the thread queue lock protected owner.
+     */
+    _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
+    _Mutex_Spin_wait( &the_mutex->Mutex.Wait_queue.Queue, owner );
+    _ISR_lock_ISR_disable( &queue_context->Lock_context.Lock_context );
+    _CORE_mutex_Acquire_critical( &the_mutex->Mutex, queue_context );
+    _Semaphore_Fast_path_freeze( the_semaphore, variant );
+
+    success = !_CORE_mutex_Is_locked( &the_mutex->Mutex );
+    _Mutex_Spin_account( success );
+
+    if ( success ) {
+      _CORE_mutex_Set_owner( &the_mutex->Mutex, executing );
+      _Thread_Resource_count_increment( executing );
+      _Semaphore_Fast_path_thaw( the_semaphore, variant );
+      _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
+      return STATUS_SUCCESSFUL;
+    }
+  }
+#endif
+
+  /* The fast path stays frozen while threads wait for the mutex */
+  return _CORE_mutex_Seize_slow(
+    &the_mutex->Mutex,
+    operations,
+    executing,
+    true,
+    queue_context
+  );
+}
+
+static Status_Control _Semaphore_Seize_counting(
+  Semaphore_Control             *the_semaphore,
+  Semaphore_Variant              variant,
+  const Thread_queue_Operations *operations,
+  Thread_Control                *executing,
+  bool                           wait,
+  Thread_queue_Context          *queue_context
+)
+{
+  CORE_semaphore_Control *core_semaphore;
+
+  core_semaphore = &the_semaphore->Core_control.Semaphore;
+  _CORE_semaphore_Acquire_critical( core_semaphore, queue_context );
+  _Semaphore_Fast_path_freeze( the_semaphore, variant );
+
+  if ( core_semaphore->count != 0 ) {
+    core_semaphore->count -= 1;
+    _Semaphore_Fast_path_thaw( the_semaphore, variant );
+    _CORE_semaphore_Release( core_semaphore, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _Semaphore_Fast_path_thaw( the_semaphore, variant );
+    _CORE_semaphore_Release( core_semaphore, queue_context );
+    return STATUS_UNSATISFIED;
+  }
+
+  /* The fast path stays frozen while threads wait for the semaphore */
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_SEMAPHORE
+  );
+  _Thread_queue_Enqueue(
+    &core_semaphore->Wait_queue.Queue,
+    operations,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
 rtems_status_code rtems_semaphore_obtain(
   rtems_id        id,
   rtems_option    option_set,
@@ -94,6 +239,14 @@ rtems_status_code rtems_semaphore_obtain(
   }
 
   executing = _Thread_Executing;
+  flags = _Semaphore_Get_flags( the_semaphore );
+  variant = _Semaphore_Get_variant( flags );
+
+  if ( _Semaphore_Fast_path_obtain( the_semaphore, variant, executing ) ) {
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    return RTEMS_SUCCESSFUL;
+  }
+
   wait = !_Options_Is_no_wait( option_set );
 
   if ( wait ) {
@@ -102,17 +255,14 @@ rtems_status_code rtems_semaphore_obtain(
     _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
   }
 
-  flags = _Semaphore_Get_flags( the_semaphore );
-  variant = _Semaphore_Get_variant( flags );
-
   switch ( variant ) {
     case SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY:
-      status = _CORE_recursive_mutex_Seize(
-        &the_semaphore->Core_control.Mutex.Recursive,
+      status = _Semaphore_Seize_mutex(
+        the_semaphore,
+        variant,
         CORE_MUTEX_TQ_PRIORITY_INHERIT_OPERATIONS,
         executing,
         wait,
-        _CORE_recursive_mutex_Seize_nested,
         &queue_context
       );
       break;
@@ -126,12 +276,12 @@ rtems_status_code rtems_semaphore_obtain(
       );
       break;
     case SEMAPHORE_VARIANT_MUTEX_NO_PROTOCOL:
-      status = _CORE_recursive_mutex_Seize(
-        &the_semaphore->Core_control.Mutex.Recursive,
+      status = _Semaphore_Seize_mutex(
+        the_semaphore,
+        variant,
         _Semaphore_Get_operations( flags ),
         executing,
         wait,
-        _CORE_recursive_mutex_Seize_nested,
         &queue_context
       );
       break;
@@ -150,8 +300,9 @@ rtems_status_code rtems_semaphore_obtain(
         variant == SEMAPHORE_VARIANT_SIMPLE_BINARY
           || variant == SEMAPHORE_VARIANT_COUNTING
       );
-      status = _CORE_semaphore_Seize(
-        &the_semaphore->Core_control.Semaphore,
+      status = _Semaphore_Seize_counting(
+        the_semaphore,
+        variant,
         _Semaphore_Get_operations( flags ),
         executing,
         wait,
@@ -42,6 +42,102 @@
 #include <rtems/rtems/semimpl.h>
 #include <rtems/rtems/statusimpl.h>
 
+static Status_Control _Semaphore_Surrender_mutex(
+  Semaphore_Control             *the_semaphore,
+  Semaphore_Variant              variant,
+  const Thread_queue_Operations *operations,
+  Thread_Control                *executing,
+  Thread_queue_Context          *queue_context
+)
+{
+  CORE_recursive_mutex_Control *the_mutex;
+  unsigned int                  nest_level;
+  Thread_queue_Heads           *heads;
+
+  the_mutex = &the_semaphore->Core_control.Mutex.Recursive;
+  _CORE_mutex_Acquire_critical( &the_mutex->Mutex, queue_context );
+  _Semaphore_Fast_path_freeze( the_semaphore, variant );
+
+  if ( !_CORE_mutex_Is_owner( &the_mutex->Mutex, executing ) ) {
+    _Semaphore_Fast_path_thaw( the_semaphore, variant );
+    _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
+    return STATUS_NOT_OWNER;
+  }
+
+  nest_level = the_mutex->nest_level;
+
+  if ( nest_level > 0 ) {
+    the_mutex->nest_level = nest_level - 1;
+    _Semaphore_Fast_path_thaw( the_semaphore, variant );
+    _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  _Thread_Resource_count_decrement( executing );
+  _CORE_mutex_Set_owner( &the_mutex->Mutex, NULL );
+
+  heads = the_mutex->Mutex.Wait_queue.Queue.heads;
+
+  if ( heads == NULL ) {
+    _Semaphore_Fast_path_thaw( the_semaphore, variant );
+    _CORE_mutex_Release( &the_mutex->Mutex, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  /*
+   * The fast path stays frozen.  The next owner thaws it in the slow path of
+   * its release.
+   */
+  _Thread_queue_Surrender(
+    &the_mutex->Mutex.Wait_queue.Queue,
+    heads,
+    executing,
+    queue_context,
+    operations
+  );
+  return STATUS_SUCCESSFUL;
+}
+
+static Status_Control _Semaphore_Surrender_counting(
+  Semaphore_Control             *the_semaphore,
+  Semaphore_Variant              variant,
+  const Thread_queue_Operations *operations,
+  uint32_t                       maximum_count,
+  Thread_queue_Context          *queue_context
+)
+{
+  CORE_semaphore_Control *core_semaphore;
+  Status_Control          status;
+  Thread_queue_Heads     *heads;
+
+  core_semaphore = &the_semaphore->Core_control.Semaphore;
+  _CORE_semaphore_Acquire_critical( core_semaphore, queue_context );
+  _Semaphore_Fast_path_freeze( the_semaphore, variant );
+
+  heads = core_semaphore->Wait_queue.Queue.heads;
+
+  if ( heads != NULL ) {
+    _Thread_queue_Surrender_no_priority(
+      &core_semaphore->Wait_queue.Queue,
+      heads,
+      queue_context,
+      operations
+    );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( core_semaphore->count < maximum_count ) {
+    core_semaphore->count += 1;
+    status = STATUS_SUCCESSFUL;
+  } else {
+    status = STATUS_MAXIMUM_COUNT_EXCEEDED;
+  }
+
+  _Semaphore_Fast_path_thaw( the_semaphore, variant );
+  _CORE_semaphore_Release( core_semaphore, queue_context );
+  return status;
+}
+
 rtems_status_code rtems_semaphore_release( rtems_id id )
 {
   Semaphore_Control    *the_semaphore;
@@ -50,6 +146,7 @@ rtems_status_code rtems_semaphore_release( rtems_id id )
   uintptr_t             flags;
   Semaphore_Variant     variant;
   Status_Control        status;
+  Wait_set_Member      *wait_set_member;
 
   the_semaphore = _Semaphore_Get( id, &queue_context );
 
@@ -62,18 +159,34 @@ rtems_status_code rtems_semaphore_release( rtems_id id )
   }
 
   executing = _Thread_Executing;
+  flags = _Semaphore_Get_flags( the_semaphore );
+  variant = _Semaphore_Get_variant( flags );
+
+  if ( _Semaphore_Fast_path_release( the_semaphore, variant, executing ) ) {
+    wait_set_member = _Semaphore_Obtain_wait_set_member(
+      the_semaphore,
+      &queue_context
+    );
+    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    _Wait_set_Member_notify( wait_set_member );
+    return RTEMS_SUCCESSFUL;
+  }
+
+  wait_set_member = _Semaphore_Obtain_wait_set_member(
+    the_semaphore,
+    &queue_context
+  );
 
   _Thread_queue_Context_set_MP_callout(
     &queue_context,
     _Semaphore_Core_mutex_mp_support
   );
-  flags = _Semaphore_Get_flags( the_semaphore );
-  variant = _Semaphore_Get_variant( flags );
 
   switch ( variant ) {
     case SEMAPHORE_VARIANT_MUTEX_INHERIT_PRIORITY:
-      status = _CORE_recursive_mutex_Surrender(
-        &the_semaphore->Core_control.Mutex.Recursive,
+      status = _Semaphore_Surrender_mutex(
+        the_semaphore,
+        variant,
         CORE_MUTEX_TQ_PRIORITY_INHERIT_OPERATIONS,
         executing,
         &queue_context
@@ -87,16 +200,18 @@ rtems_status_code rtems_semaphore_release( rtems_id id )
       );
       break;
     case SEMAPHORE_VARIANT_MUTEX_NO_PROTOCOL:
-      status = _CORE_recursive_mutex_Surrender(
-        &the_semaphore->Core_control.Mutex.Recursive,
+      status = _Semaphore_Surrender_mutex(
+        the_semaphore,
+        variant,
         _Semaphore_Get_operations( flags ),
         executing,
         &queue_context
       );
       break;
     case SEMAPHORE_VARIANT_SIMPLE_BINARY:
-      status = _CORE_semaphore_Surrender(
-        &the_semaphore->Core_control.Semaphore,
+      status = _Semaphore_Surrender_counting(
+        the_semaphore,
+        variant,
         _Semaphore_Get_operations( flags ),
         1,
         &queue_context
@@ -119,8 +234,9 @@ rtems_status_code rtems_semaphore_release( rtems_id id )
 #endif
     default:
       _Assert( variant == SEMAPHORE_VARIANT_COUNTING );
-      status = _CORE_semaphore_Surrender(
-        &the_semaphore->Core_control.Semaphore,
+      status = _Semaphore_Surrender_counting(
+        the_semaphore,
+        variant,
         _Semaphore_Get_operations( flags ),
         UINT32_MAX,
         &queue_context
@@ -128,5 +244,6 @@ rtems_status_code rtems_semaphore_release( rtems_id id )
       break;
   }
 
+  _Wait_set_Member_notify( wait_set_member );
   return _Status_Get( status );
 }
@@ -100,7 +100,7 @@ rtems_status_code _Timer_Fire(
       _Watchdog_Insert(
         &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
         &the_timer->Ticker,
-        cpu->Watchdog.ticks + interval
+        _Watchdog_Per_CPU_get_ticks( cpu ) + interval
       );
     } else {
       _Watchdog_Insert(
@@ -60,7 +60,7 @@ rtems_status_code rtems_timer_reset(
       _Watchdog_Insert(
         &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ],
         &the_timer->Ticker,
-        cpu->Watchdog.ticks + the_timer->initial
+        _Watchdog_Per_CPU_get_ticks( cpu ) + the_timer->initial
       );
       status = RTEMS_SUCCESSFUL;
     } else {
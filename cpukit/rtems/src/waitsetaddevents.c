@@ -0,0 +1,129 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplClassicWaitSet
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_wait_set_add_events().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/waitsetimpl.h>
+#include <rtems/rtems/tasksdata.h>
+#include <rtems/score/threadimpl.h>
+
+static Status_Control _Wait_set_Events_attach( Wait_set_Member *member )
+{
+  Thread_Control    *the_thread;
+  RTEMS_API_Control *api;
+  ISR_lock_Context   lock_context;
+  Status_Control     status;
+
+  the_thread = _Thread_Get( member->id, &lock_context );
+
+  if ( the_thread == NULL ) {
+    return STATUS_INVALID_ID;
+  }
+
+  api = the_thread->API_Extensions[ THREAD_API_RTEMS ];
+  _Thread_Wait_acquire_default_critical( the_thread, &lock_context );
+  status = _Wait_set_Member_attach_to( &api->Event.wait_set_member, member );
+  _Thread_Wait_release_default( the_thread, &lock_context );
+  return status;
+}
+
+static bool _Wait_set_Events_is_ready( const Wait_set_Member *member )
+{
+  Thread_Control    *the_thread;
+  RTEMS_API_Control *api;
+  ISR_lock_Context   lock_context;
+  bool               is_ready;
+
+  the_thread = _Thread_Get( member->id, &lock_context );
+
+  if ( the_thread == NULL ) {
+    return true;
+  }
+
+  api = the_thread->API_Extensions[ THREAD_API_RTEMS ];
+  _Thread_Wait_acquire_default_critical( the_thread, &lock_context );
+  is_ready = ( api->Event.pending_events & member->option ) != 0;
+  _Thread_Wait_release_default( the_thread, &lock_context );
+  return is_ready;
+}
+
+static void _Wait_set_Events_detach( Wait_set_Member *member )
+{
+  Thread_Control    *the_thread;
+  RTEMS_API_Control *api;
+  ISR_lock_Context   lock_context;
+
+  the_thread = _Thread_Get( member->id, &lock_context );
+
+  if ( the_thread == NULL ) {
+    return;
+  }
+
+  api = the_thread->API_Extensions[ THREAD_API_RTEMS ];
+  _Thread_Wait_acquire_default_critical( the_thread, &lock_context );
+  _Wait_set_Member_detach_from( &api->Event.wait_set_member, member );
+  _Thread_Wait_release_default( the_thread, &lock_context );
+}
+
+static const Wait_set_Member_operations _Wait_set_Events_operations = {
+  .attach = _Wait_set_Events_attach,
+  .is_ready = _Wait_set_Events_is_ready,
+  .detach = _Wait_set_Events_detach
+};
+
+rtems_status_code rtems_wait_set_add_events(
+  rtems_wait_set  *wait_set,
+  uint32_t         index,
+  rtems_event_set  event_in
+)
+{
+  Status_Control status;
+
+  if ( event_in == 0 ) {
+    return RTEMS_INVALID_NUMBER;
+  }
+
+  status = _Wait_set_Add(
+    wait_set,
+    index,
+    &_Wait_set_Events_operations,
+    _Thread_Get_executing()->Object.id,
+    event_in
+  );
+  return _Status_Get( status );
+}
@@ -0,0 +1,144 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplClassicWaitSet
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_wait_set_add_message_queue().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/waitsetimpl.h>
+#include <rtems/rtems/messageimpl.h>
+
+static Status_Control _Wait_set_Message_queue_attach( Wait_set_Member *member )
+{
+  Message_queue_Control *the_message_queue;
+  Thread_queue_Context   queue_context;
+  Status_Control         status;
+
+  the_message_queue = _Message_queue_Get( member->id, &queue_context );
+
+  if ( the_message_queue == NULL ) {
+    return STATUS_INVALID_ID;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+  status = _Wait_set_Member_attach_to(
+    &the_message_queue->message_queue.wait_set_member,
+    member
+  );
+  _CORE_message_queue_Release(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+  return status;
+}
+
+static bool _Wait_set_Message_queue_is_ready( const Wait_set_Member *member )
+{
+  Message_queue_Control *the_message_queue;
+  Thread_queue_Context   queue_context;
+  bool                   is_ready;
+
+  the_message_queue = _Message_queue_Get( member->id, &queue_context );
+
+  if ( the_message_queue == NULL ) {
+    return true;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+  is_ready =
+    the_message_queue->message_queue.number_of_pending_messages != 0;
+  _CORE_message_queue_Release(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+  return is_ready;
+}
+
+static void _Wait_set_Message_queue_detach( Wait_set_Member *member )
+{
+  Message_queue_Control *the_message_queue;
+  Thread_queue_Context   queue_context;
+
+  the_message_queue = _Message_queue_Get( member->id, &queue_context );
+
+  if ( the_message_queue == NULL ) {
+    return;
+  }
+
+  _CORE_message_queue_Acquire_critical(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+  _Wait_set_Member_detach_from(
+    &the_message_queue->message_queue.wait_set_member,
+    member
+  );
+  _CORE_message_queue_Release(
+    &the_message_queue->message_queue,
+    &queue_context
+  );
+}
+
+static const Wait_set_Member_operations
+_Wait_set_Message_queue_operations = {
+  .attach = _Wait_set_Message_queue_attach,
+  .is_ready = _Wait_set_Message_queue_is_ready,
+  .detach = _Wait_set_Message_queue_detach
+};
+
+rtems_status_code rtems_wait_set_add_message_queue(
+  rtems_wait_set *wait_set,
+  uint32_t        index,
+  rtems_id        id
+)
+{
+  Status_Control status;
+
+  status = _Wait_set_Add(
+    wait_set,
+    index,
+    &_Wait_set_Message_queue_operations,
+    id,
+    0
+  );
+  return _Status_Get( status );
+}
@@ -0,0 +1,143 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSImplClassicWaitSet
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_wait_set_add_semaphore().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/rtems/waitsetimpl.h>
+#include <rtems/rtems/semimpl.h>
+
+static Status_Control _Wait_set_Semaphore_attach( Wait_set_Member *member )
+{
+  Semaphore_Control    *the_semaphore;
+  Thread_queue_Context  queue_context;
+  Semaphore_Variant     variant;
+  Status_Control        status;
+
+  the_semaphore = _Semaphore_Get( member->id, &queue_context );
+
+  if ( the_semaphore == NULL ) {
+    return STATUS_INVALID_ID;
+  }
+
+  _Thread_queue_Acquire_critical(
+    &the_semaphore->Core_control.Wait_queue,
+    &queue_context
+  );
+  variant = _Semaphore_Get_variant( _Semaphore_Get_flags( the_semaphore ) );
+
+  if (
+    variant == SEMAPHORE_VARIANT_SIMPLE_BINARY
+      || variant == SEMAPHORE_VARIANT_COUNTING
+  ) {
+    status = _Wait_set_Member_attach_to(
+      &the_semaphore->wait_set_member,
+      member
+    );
+  } else {
+    status = STATUS_NOT_DEFINED;
+  }
+
+  _Thread_queue_Release(
+    &the_semaphore->Core_control.Wait_queue,
+    &queue_context
+  );
+  return status;
+}
+
+static bool _Wait_set_Semaphore_is_ready( const Wait_set_Member *member )
+{
+  Semaphore_Control    *the_semaphore;
+  Thread_queue_Context  queue_context;
+  bool                  is_ready;
+
+  the_semaphore = _Semaphore_Get( member->id, &queue_context );
+
+  if ( the_semaphore == NULL ) {
+    return true;
+  }
+
+  is_ready = _Semaphore_Get_count( the_semaphore ) > 0;
+  _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+  return is_ready;
+}
+
+static void _Wait_set_Semaphore_detach( Wait_set_Member *member )
+{
+  Semaphore_Control    *the_semaphore;
+  Thread_queue_Context  queue_context;
+
+  the_semaphore = _Semaphore_Get( member->id, &queue_context );
+
+  if ( the_semaphore == NULL ) {
+    return;
+  }
+
+  _Thread_queue_Acquire_critical(
+    &the_semaphore->Core_control.Wait_queue,
+    &queue_context
+  );
+  _Wait_set_Member_detach_from( &the_semaphore->wait_set_member, member );
+  _Thread_queue_Release(
+    &the_semaphore->Core_control.Wait_queue,
+    &queue_context
+  );
+}
+
+static const Wait_set_Member_operations _Wait_set_Semaphore_operations = {
+  .attach = _Wait_set_Semaphore_attach,
+  .is_ready = _Wait_set_Semaphore_is_ready,
+  .detach = _Wait_set_Semaphore_detach
+};
+
+rtems_status_code rtems_wait_set_add_semaphore(
+  rtems_wait_set *wait_set,
+  uint32_t        index,
+  rtems_id        id
+)
+{
+  Status_Control status;
+
+  status = _Wait_set_Add(
+    wait_set,
+    index,
+    &_Wait_set_Semaphore_operations,
+    id,
+    0
+  );
+  return _Status_Get( status );
+}
@@ -41,6 +41,7 @@
 #include <rtems/profiling.h>
 #include <rtems/counter.h>
 #include <rtems/score/percpu.h>
+#include <rtems/score/schedulerimpl.h>
 #include <rtems/score/smplock.h>
 #include <rtems.h>
 
@@ -100,6 +101,72 @@ static void per_cpu_stats_iterate(
 #endif
 }
 
+#ifdef RTEMS_PROFILING
+RTEMS_STATIC_ASSERT(
+  RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BANDS
+    == PER_CPU_WAKEUP_LATENCY_PRIORITY_BANDS,
+  wakeup_latency_priority_bands
+);
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BAND_WIDTH
+    == PER_CPU_WAKEUP_LATENCY_PRIORITY_BAND_WIDTH,
+  wakeup_latency_priority_band_width
+);
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_PROFILING_WAKEUP_LATENCY_BUCKETS == PER_CPU_WAKEUP_LATENCY_BUCKETS,
+  wakeup_latency_buckets
+);
+#endif
+
+static void wakeup_latency_iterate(
+  rtems_profiling_visitor visitor,
+  void *visitor_arg,
+  rtems_profiling_data *data
+)
+{
+#ifdef RTEMS_PROFILING
+  uint32_t n = rtems_scheduler_get_processor_maximum();
+  uint32_t i;
+  uint32_t j;
+
+  memset(data, 0, sizeof(*data));
+  data->header.type = RTEMS_PROFILING_WAKEUP_LATENCY;
+
+  for (j = 0; j < RTEMS_PROFILING_WAKEUP_LATENCY_BUCKETS; ++j) {
+    data->wakeup_latency.bucket_lower_bounds[j] = j > 0 ?
+      rtems_counter_ticks_to_nanoseconds((rtems_counter_ticks) 1 << j) : 0;
+  }
+
+  for (i = 0; i < n; ++i) {
+    const Per_CPU_Control *per_cpu = _Per_CPU_Get_by_index(i);
+    const Per_CPU_Stats *stats = &per_cpu->Stats;
+    const Scheduler_Control *scheduler = _Scheduler_Get_by_CPU(per_cpu);
+    rtems_profiling_wakeup_latency *wakeup_latency_data =
+      &data->wakeup_latency;
+
+    wakeup_latency_data->processor_index = i;
+    wakeup_latency_data->scheduler_name =
+      scheduler != NULL ? scheduler->name : 0;
+    wakeup_latency_data->max_wakeup_latency =
+      rtems_counter_ticks_to_nanoseconds(stats->max_wakeup_latency);
+
+    memcpy(
+      &wakeup_latency_data->histograms[0][0],
+      &stats->wakeup_latency_histogram[0][0],
+      sizeof(wakeup_latency_data->histograms)
+    );
+
+    (*visitor)(visitor_arg, data);
+  }
+#else
+  (void) visitor;
+  (void) visitor_arg;
+  (void) data;
+#endif
+}
+
 #if defined(RTEMS_PROFILING) && defined(RTEMS_SMP)
 RTEMS_STATIC_ASSERT(
   RTEMS_PROFILING_SMP_LOCK_CONTENTION_COUNTS
@@ -169,4 +236,5 @@ void rtems_profiling_iterate(
 
   per_cpu_stats_iterate(visitor, visitor_arg, &data);
   smp_lock_stats_iterate(visitor, visitor_arg, &data);
+  wakeup_latency_iterate(visitor, visitor_arg, &data);
 }
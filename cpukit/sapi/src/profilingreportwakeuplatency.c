@@ -0,0 +1,149 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSAPIProfiling
+ *
+ * @brief This source file contains the implementation of
+ *   rtems_profiling_report_wakeup_latency().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/profiling.h>
+
+#ifdef RTEMS_PROFILING
+
+#include <ctype.h>
+#include <inttypes.h>
+
+typedef struct {
+  const rtems_printer *printer;
+  int retval;
+} context;
+
+static void update_retval(context *ctx, int rv)
+{
+  if (rv > 0 && ctx->retval >= 0) {
+    ctx->retval += rv;
+  }
+}
+
+static void scheduler_name_to_string(uint32_t name, char *s)
+{
+  uint32_t i;
+
+  for (i = 0; i < 4; ++i) {
+    char c = (char) (name >> (24 - 8 * i));
+
+    s[i] = isprint((unsigned char) c) ? c : '?';
+  }
+
+  s[4] = '\0';
+}
+
+static void report(void *arg, const rtems_profiling_data *data)
+{
+  context *ctx = arg;
+  const rtems_profiling_wakeup_latency *wakeup_latency;
+  char scheduler_name[5];
+  uint32_t i;
+  uint32_t j;
+  int rv;
+
+  if (data->header.type != RTEMS_PROFILING_WAKEUP_LATENCY) {
+    return;
+  }
+
+  wakeup_latency = &data->wakeup_latency;
+  scheduler_name_to_string(wakeup_latency->scheduler_name, scheduler_name);
+
+  rv = rtems_printf(
+    ctx->printer,
+    "PROCESSOR %" PRIu32 " | SCHEDULER \"%s\" | MAX %" PRIu32 "ns\n"
+    " PRIORITY BAND | LOWER BOUND [ns] | COUNT\n",
+    wakeup_latency->processor_index,
+    scheduler_name,
+    wakeup_latency->max_wakeup_latency
+  );
+  update_retval(ctx, rv);
+
+  for (i = 0; i < RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BANDS; ++i) {
+    uint32_t first = i * RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BAND_WIDTH;
+
+    for (j = 0; j < RTEMS_PROFILING_WAKEUP_LATENCY_BUCKETS; ++j) {
+      if (wakeup_latency->histograms[i][j] == 0) {
+        continue;
+      }
+
+      if (i + 1 < RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BANDS) {
+        rv = rtems_printf(
+          ctx->printer,
+          " %5" PRIu32 "..%-6" PRIu32 "| %16" PRIu32 " | %" PRIu32 "\n",
+          first,
+          first + RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BAND_WIDTH - 1,
+          wakeup_latency->bucket_lower_bounds[j],
+          wakeup_latency->histograms[i][j]
+        );
+      } else {
+        rv = rtems_printf(
+          ctx->printer,
+          " %5" PRIu32 "..     | %16" PRIu32 " | %" PRIu32 "\n",
+          first,
+          wakeup_latency->bucket_lower_bounds[j],
+          wakeup_latency->histograms[i][j]
+        );
+      }
+
+      update_retval(ctx, rv);
+    }
+  }
+}
+
+#endif /* RTEMS_PROFILING */
+
+int rtems_profiling_report_wakeup_latency(const rtems_printer *printer)
+{
+#ifdef RTEMS_PROFILING
+  context ctx = {
+    .printer = printer,
+    .retval = 0
+  };
+
+  rtems_profiling_iterate(report, &ctx);
+
+  return ctx.retval;
+#else /* RTEMS_PROFILING */
+  (void) printer;
+
+  return 0;
+#endif /* RTEMS_PROFILING */
+}
@@ -42,6 +42,7 @@
 
 #ifdef RTEMS_PROFILING
 
+#include <ctype.h>
 #include <inttypes.h>
 
 typedef struct {
@@ -275,6 +276,81 @@ static void report_smp_lock(context *ctx, const rtems_profiling_smp_lock *smp_lo
   update_retval(ctx, rv);
 }
 
+static void scheduler_name_to_string(uint32_t name, char *s)
+{
+  uint32_t i;
+
+  for (i = 0; i < 4; ++i) {
+    char c = (char) (name >> (24 - 8 * i));
+
+    if (!isprint((unsigned char) c) || c == '<' || c == '>' || c == '&'
+      || c == '"') {
+      c = '?';
+    }
+
+    s[i] = c;
+  }
+
+  s[4] = '\0';
+}
+
+static void report_wakeup_latency(
+  context *ctx,
+  const rtems_profiling_wakeup_latency *wakeup_latency
+)
+{
+  int rv;
+  uint32_t i;
+  uint32_t j;
+  char scheduler_name[5];
+
+  scheduler_name_to_string(wakeup_latency->scheduler_name, scheduler_name);
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "<WakeupLatencyProfilingReport processorIndex=\"%" PRIu32
+      "\" scheduler=\"%s\">\n",
+    wakeup_latency->processor_index,
+    scheduler_name
+  );
+  update_retval(ctx, rv);
+
+  indent(ctx, 2);
+  rv = rtems_printf(
+    ctx->printer,
+    "<MaxWakeupLatency unit=\"ns\">%" PRIu32 "</MaxWakeupLatency>\n",
+    wakeup_latency->max_wakeup_latency
+  );
+  update_retval(ctx, rv);
+
+  for (i = 0; i < RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BANDS; ++i) {
+    for (j = 0; j < RTEMS_PROFILING_WAKEUP_LATENCY_BUCKETS; ++j) {
+      if (wakeup_latency->histograms[i][j] == 0) {
+        continue;
+      }
+
+      indent(ctx, 2);
+      rv = rtems_printf(
+        ctx->printer,
+        "<WakeupLatencyCount priorityBand=\"%" PRIu32 "\" lowerBound=\"%"
+          PRIu32 "\" unit=\"ns\">%" PRIu32 "</WakeupLatencyCount>\n",
+        i,
+        wakeup_latency->bucket_lower_bounds[j],
+        wakeup_latency->histograms[i][j]
+      );
+      update_retval(ctx, rv);
+    }
+  }
+
+  indent(ctx, 1);
+  rv = rtems_printf(
+    ctx->printer,
+    "</WakeupLatencyProfilingReport>\n"
+  );
+  update_retval(ctx, rv);
+}
+
 static void report(void *arg, const rtems_profiling_data *data)
 {
   context *ctx = arg;
@@ -286,6 +362,9 @@ static void report(void *arg, const rtems_profiling_data *data)
     case RTEMS_PROFILING_SMP_LOCK:
       report_smp_lock(ctx, &data->smp_lock);
       break;
+    case RTEMS_PROFILING_WAKEUP_LATENCY:
+      report_wakeup_latency(ctx, &data->wakeup_latency);
+      break;
   }
 }
 
@@ -93,6 +93,7 @@ Status_Control _CORE_message_queue_Initialize(
   the_message_queue->maximum_message_size       = maximum_message_size;
 
   _CORE_message_queue_Set_notify( the_message_queue, NULL );
+  the_message_queue->wait_set_member = NULL;
   _Chain_Initialize_empty( &the_message_queue->Pending_messages );
   _Thread_queue_Object_initialize( &the_message_queue->Wait_queue );
 
@@ -64,6 +64,7 @@ Status_Control _CORE_message_queue_Broadcast(
   while (
     _CORE_message_queue_Dequeue_receiver(
       the_message_queue,
+      NULL,
       buffer,
       size,
       0,
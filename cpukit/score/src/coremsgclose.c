@@ -40,6 +40,7 @@
 #endif
 
 #include <rtems/score/coremsgimpl.h>
+#include <rtems/score/waitsetimpl.h>
 
 static Thread_Control *_CORE_message_queue_Was_deleted(
   Thread_Control       *the_thread,
@@ -57,6 +58,13 @@ void _CORE_message_queue_Close(
   Thread_queue_Context       *queue_context
 )
 {
+  Wait_set_Member *wait_set_member;
+
+  wait_set_member = _Wait_set_Member_obtain(
+    the_message_queue->wait_set_member,
+    &queue_context->Lock_context.Lock_context
+  );
+  the_message_queue->wait_set_member = NULL;
 
   /*
    *  This will flush blocked threads whether they were blocked on
@@ -70,6 +78,11 @@ void _CORE_message_queue_Close(
     queue_context
   );
 
+  /*
+   *  Let the threads waiting on the wait set observe the deletion.
+   */
+  _Wait_set_Member_notify( wait_set_member );
+
   ( *the_message_queue->free_message_buffers )(
     the_message_queue->message_buffers
   );
@@ -6,6 +6,7 @@
  * @ingroup RTEMSScoreMessageQueue
  *
  * @brief This source file contains the implementation of
+ *   _CORE_message_queue_Enqueue_message() and
  *   _CORE_message_queue_Insert_message().
  */
 
@@ -60,10 +61,9 @@ static bool _CORE_message_queue_Order(
 }
 #endif
 
-void _CORE_message_queue_Insert_message(
+void _CORE_message_queue_Enqueue_message(
   CORE_message_queue_Control      *the_message_queue,
   CORE_message_queue_Buffer       *the_message,
-  const void                      *content_source,
   size_t                           content_size,
   CORE_message_queue_Submit_types  submit_type
 )
@@ -72,12 +72,6 @@ void _CORE_message_queue_Insert_message(
 
   the_message->size = content_size;
 
-  _CORE_message_queue_Copy_buffer(
-    content_source,
-    the_message->buffer,
-    content_size
-  );
-
 #if defined(RTEMS_SCORE_COREMSG_ENABLE_MESSAGE_PRIORITY)
   the_message->priority = submit_type;
 #endif
@@ -103,3 +97,24 @@ void _CORE_message_queue_Insert_message(
     _Chain_Prepend_unprotected( pending_messages, &the_message->Node );
   }
 }
+
+void _CORE_message_queue_Insert_message(
+  CORE_message_queue_Control      *the_message_queue,
+  CORE_message_queue_Buffer       *the_message,
+  const void                      *content_source,
+  size_t                           content_size,
+  CORE_message_queue_Submit_types  submit_type
+)
+{
+  _CORE_message_queue_Copy_buffer(
+    content_source,
+    the_message->buffer,
+    content_size
+  );
+  _CORE_message_queue_Enqueue_message(
+    the_message_queue,
+    the_message,
+    content_size,
+    submit_type
+  );
+}
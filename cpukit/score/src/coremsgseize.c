@@ -6,7 +6,7 @@
  * @ingroup RTEMSScoreMessageQueue
  *
  * @brief This source file contains the implementation of
- *   _CORE_message_queue_Seize().
+ *   _CORE_message_queue_Seize() and _CORE_message_queue_Seize_buffer().
  */
 
 /*
@@ -42,6 +42,7 @@
 #include <rtems/score/chain.h>
 #include <rtems/score/isr.h>
 #include <rtems/score/coremsgimpl.h>
+#include <rtems/score/assert.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/statesimpl.h>
 
@@ -131,6 +132,7 @@ Status_Control _CORE_message_queue_Seize(
 
   executing->Wait.return_argument_second.mutable_object = buffer;
   executing->Wait.return_argument = size_p;
+  executing->Wait.option = CORE_MESSAGE_QUEUE_RECEIVE_COPY;
   /* Wait.count will be filled in with the message priority */
 
   _Thread_queue_Context_set_thread_state(
@@ -145,3 +147,165 @@ Status_Control _CORE_message_queue_Seize(
   );
   return _Thread_Wait_get_status( executing );
 }
+
+Status_Control _CORE_message_queue_Seize_buffer(
+  CORE_message_queue_Control  *the_message_queue,
+  Thread_Control              *executing,
+  void                       **buffer_p,
+  size_t                      *size_p,
+  bool                         wait,
+  Thread_queue_Context        *queue_context
+)
+{
+  CORE_message_queue_Buffer *the_message;
+
+  the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+  if ( the_message != NULL ) {
+    the_message_queue->number_of_pending_messages -= 1;
+    _Chain_Set_off_chain( &the_message->Node );
+
+    *buffer_p = the_message->buffer;
+    *size_p = the_message->size;
+    executing->Wait.count =
+      _CORE_message_queue_Get_message_priority( the_message );
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_SUCCESSFUL;
+  }
+
+  if ( !wait ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_UNSATISFIED;
+  }
+
+  executing->Wait.return_argument_second.mutable_object = buffer_p;
+  executing->Wait.return_argument = size_p;
+  executing->Wait.option = CORE_MESSAGE_QUEUE_RECEIVE_BORROW;
+  /* Wait.count will be filled in with the message priority */
+
+  _Thread_queue_Context_set_thread_state(
+    queue_context,
+    STATES_WAITING_FOR_MESSAGE
+  );
+  _Thread_queue_Enqueue(
+    &the_message_queue->Wait_queue.Queue,
+    the_message_queue->operations,
+    executing,
+    queue_context
+  );
+  return _Thread_Wait_get_status( executing );
+}
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+static Thread_Control *_CORE_message_queue_Sender_filter(
+  Thread_Control       *the_thread,
+  Thread_queue_Queue   *queue,
+  Thread_queue_Context *queue_context
+)
+{
+  CORE_message_queue_Batch_context *context;
+  CORE_message_queue_Buffer        *the_message;
+
+  (void) queue;
+  context = (CORE_message_queue_Batch_context *) queue_context;
+  the_message = _CORE_message_queue_Allocate_message_buffer(
+    context->the_message_queue
+  );
+
+  if ( the_message == NULL ) {
+    return NULL;
+  }
+
+  /*
+   *  This code puts the messages in the message queue on behalf of the
+   *  waiting task.
+   */
+  _CORE_message_queue_Insert_message(
+    context->the_message_queue,
+    the_message,
+    the_thread->Wait.return_argument_second.immutable_object,
+    (size_t) the_thread->Wait.option,
+    (CORE_message_queue_Submit_types) the_thread->Wait.count
+  );
+  return the_thread;
+}
+#endif
+
+Status_Control _CORE_message_queue_Seize_many(
+  CORE_message_queue_Control       *the_message_queue,
+  Thread_Control                   *executing,
+  void                             *buffer,
+  size_t                           *sizes,
+  uint32_t                          count,
+  uint32_t                         *seized,
+  bool                              wait,
+  CORE_message_queue_Batch_context *context
+)
+{
+  char     *destination;
+  uint32_t  n;
+
+  _Assert( count > 0 );
+
+  destination = buffer;
+  n = 0;
+
+  while ( n < count ) {
+    CORE_message_queue_Buffer *the_message;
+
+    the_message = _CORE_message_queue_Get_pending_message( the_message_queue );
+    if ( the_message == NULL ) {
+      break;
+    }
+
+    the_message_queue->number_of_pending_messages -= 1;
+
+    sizes[ n ] = the_message->size;
+    _CORE_message_queue_Copy_buffer(
+      the_message->buffer,
+      destination,
+      the_message->size
+    );
+    _CORE_message_queue_Free_message_buffer( the_message_queue, the_message );
+
+    destination += the_message_queue->maximum_message_size;
+    ++n;
+  }
+
+  if ( n == 0 ) {
+    Status_Control status;
+
+    status = _CORE_message_queue_Seize(
+      the_message_queue,
+      executing,
+      buffer,
+      &sizes[ 0 ],
+      wait,
+      &context->Base
+    );
+    *seized = status == STATUS_SUCCESSFUL ? 1 : 0;
+    return status;
+  }
+
+  *seized = n;
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_BLOCKING_SEND)
+  /*
+   *  There were pending messages, so the threads waiting on the message queue
+   *  wait to send a message.  Enqueue the messages on behalf of the waiting
+   *  threads and unblock them in one pass.
+   */
+  if ( the_message_queue->Wait_queue.Queue.heads != NULL ) {
+    context->the_message_queue = the_message_queue;
+    _Thread_queue_Flush_critical(
+      &the_message_queue->Wait_queue.Queue,
+      the_message_queue->operations,
+      _CORE_message_queue_Sender_filter,
+      &context->Base
+    );
+    return STATUS_SUCCESSFUL;
+  }
+#endif
+
+  _CORE_message_queue_Release( the_message_queue, &context->Base );
+  return STATUS_SUCCESSFUL;
+}
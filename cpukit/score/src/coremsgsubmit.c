@@ -6,7 +6,7 @@
  * @ingroup RTEMSScoreMessageQueue
  *
  * @brief This source file contains the implementation of
- *   _CORE_message_queue_Submit().
+ *   _CORE_message_queue_Submit() and _CORE_message_queue_Submit_buffer().
  */
 
 /*
@@ -40,10 +40,62 @@
 #endif
 
 #include <rtems/score/coremsgimpl.h>
+#include <rtems/score/assert.h>
 #include <rtems/score/objectimpl.h>
 #include <rtems/score/isr.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/statesimpl.h>
+#include <rtems/score/waitsetimpl.h>
+
+static void _CORE_message_queue_Enqueue_and_release(
+  CORE_message_queue_Control      *the_message_queue,
+  CORE_message_queue_Buffer       *the_message,
+  size_t                           size,
+  CORE_message_queue_Submit_types  submit_type,
+  Thread_queue_Context            *queue_context
+)
+{
+  Wait_set_Member *wait_set_member;
+
+  _CORE_message_queue_Enqueue_message(
+    the_message_queue,
+    the_message,
+    size,
+    submit_type
+  );
+
+  if ( the_message_queue->number_of_pending_messages == 1 ) {
+    wait_set_member = _Wait_set_Member_obtain(
+      the_message_queue->wait_set_member,
+      &queue_context->Lock_context.Lock_context
+    );
+  } else {
+    wait_set_member = NULL;
+  }
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+  /*
+   *  According to POSIX, does this happen before or after the message
+   *  is actually enqueued.  It is logical to think afterwards, because
+   *  the message is actually in the queue at this point.
+   */
+  if (
+    the_message_queue->number_of_pending_messages == 1
+      && the_message_queue->notify_handler != NULL
+  ) {
+    ( *the_message_queue->notify_handler )(
+      the_message_queue,
+      queue_context
+    );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, queue_context );
+#endif
+
+  _Wait_set_Member_notify( wait_set_member );
+}
 
 Status_Control _CORE_message_queue_Submit(
   CORE_message_queue_Control       *the_message_queue,
@@ -69,6 +121,7 @@ Status_Control _CORE_message_queue_Submit(
 
   the_thread = _CORE_message_queue_Dequeue_receiver(
     the_message_queue,
+    NULL,
     buffer,
     size,
     submit_type,
@@ -85,35 +138,14 @@ Status_Control _CORE_message_queue_Submit(
   the_message =
       _CORE_message_queue_Allocate_message_buffer( the_message_queue );
   if ( the_message ) {
-    _CORE_message_queue_Insert_message(
+    _CORE_message_queue_Copy_buffer( buffer, the_message->buffer, size );
+    _CORE_message_queue_Enqueue_and_release(
       the_message_queue,
       the_message,
-      buffer,
       size,
-      submit_type
+      submit_type,
+      queue_context
     );
-
-#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
-    /*
-     *  According to POSIX, does this happen before or after the message
-     *  is actually enqueued.  It is logical to think afterwards, because
-     *  the message is actually in the queue at this point.
-     */
-    if (
-      the_message_queue->number_of_pending_messages == 1
-        && the_message_queue->notify_handler != NULL
-    ) {
-      ( *the_message_queue->notify_handler )(
-        the_message_queue,
-        queue_context
-      );
-    } else {
-      _CORE_message_queue_Release( the_message_queue, queue_context );
-    }
-#else
-    _CORE_message_queue_Release( the_message_queue, queue_context );
-#endif
-
     return STATUS_SUCCESSFUL;
   }
 
@@ -163,3 +195,212 @@ Status_Control _CORE_message_queue_Submit(
   return _Thread_Wait_get_status( executing );
 #endif
 }
+
+Status_Control _CORE_message_queue_Submit_buffer(
+  CORE_message_queue_Control      *the_message_queue,
+  CORE_message_queue_Buffer       *the_message,
+  size_t                           size,
+  CORE_message_queue_Submit_types  submit_type,
+  Thread_queue_Context            *queue_context
+)
+{
+  Thread_Control *the_thread;
+
+  _Assert( _Chain_Is_node_off_chain( &the_message->Node ) );
+
+  if ( size > the_message_queue->maximum_message_size ) {
+    _CORE_message_queue_Release( the_message_queue, queue_context );
+    return STATUS_MESSAGE_INVALID_SIZE;
+  }
+
+  the_thread = _CORE_message_queue_Dequeue_receiver(
+    the_message_queue,
+    the_message,
+    the_message->buffer,
+    size,
+    submit_type,
+    queue_context
+  );
+  if ( the_thread != NULL ) {
+    return STATUS_SUCCESSFUL;
+  }
+
+  _CORE_message_queue_Enqueue_and_release(
+    the_message_queue,
+    the_message,
+    size,
+    submit_type,
+    queue_context
+  );
+  return STATUS_SUCCESSFUL;
+}
+
+static Thread_Control *_CORE_message_queue_Receiver_filter(
+  Thread_Control       *the_thread,
+  Thread_queue_Queue   *queue,
+  Thread_queue_Context *queue_context
+)
+{
+  CORE_message_queue_Batch_context *context;
+  CORE_message_queue_Control       *the_message_queue;
+  uint32_t                          done;
+
+  (void) queue;
+  context = (CORE_message_queue_Batch_context *) queue_context;
+  done = context->done;
+
+  if ( done == context->count ) {
+    return NULL;
+  }
+
+  the_message_queue = context->the_message_queue;
+
+  if (
+    !_CORE_message_queue_Deliver_to_receiver(
+      the_message_queue,
+      the_thread,
+      NULL,
+      context->source + done * the_message_queue->maximum_message_size,
+      context->sizes[ done ],
+      context->submit_type
+    )
+  ) {
+    return NULL;
+  }
+
+  context->done = done + 1;
+  return the_thread;
+}
+
+Status_Control _CORE_message_queue_Submit_many(
+  CORE_message_queue_Control       *the_message_queue,
+  const void                       *buffer,
+  const size_t                     *sizes,
+  uint32_t                          count,
+  uint32_t                         *submitted,
+  CORE_message_queue_Submit_types   submit_type,
+  CORE_message_queue_Batch_context *context
+)
+{
+  uint32_t         i;
+  uint32_t         pending;
+  Wait_set_Member *wait_set_member;
+
+  _Assert( count > 0 );
+
+  for ( i = 0; i < count; ++i ) {
+    if ( sizes[ i ] > the_message_queue->maximum_message_size ) {
+      _CORE_message_queue_Release( the_message_queue, &context->Base );
+      *submitted = 0;
+      return STATUS_MESSAGE_INVALID_SIZE;
+    }
+  }
+
+  context->the_message_queue = the_message_queue;
+  context->source = buffer;
+  context->sizes = sizes;
+  context->count = count;
+  context->done = 0;
+  context->submit_type = submit_type;
+
+  /*
+   *  If there are no pending messages, then the threads waiting on the
+   *  message queue wait to receive a message.  Deliver the messages to them
+   *  and unblock them in one pass.  New receivers may show up while the
+   *  message queue lock is not owned, so check again after each pass.
+   */
+  while (
+    the_message_queue->number_of_pending_messages == 0
+      && the_message_queue->Wait_queue.Queue.heads != NULL
+  ) {
+    uint32_t done;
+
+    done = context->done;
+    _Thread_queue_Flush_critical(
+      &the_message_queue->Wait_queue.Queue,
+      the_message_queue->operations,
+      _CORE_message_queue_Receiver_filter,
+      &context->Base
+    );
+
+    if ( context->done == count ) {
+      *submitted = count;
+      return STATUS_SUCCESSFUL;
+    }
+
+    _CORE_message_queue_Acquire( the_message_queue, &context->Base );
+
+    /*
+     *  A receiver borrowing message buffers stopped the pass.  Give up if
+     *  still no inactive message buffer is available.
+     */
+    if (
+      context->done == done
+        && _Chain_Is_empty( &the_message_queue->Inactive_messages )
+    ) {
+      break;
+    }
+  }
+
+  /*
+   *  Queue up the remaining messages for future receives.
+   */
+  pending = the_message_queue->number_of_pending_messages;
+
+  while ( context->done < count ) {
+    CORE_message_queue_Buffer *the_message;
+    uint32_t                   done;
+
+    the_message =
+      _CORE_message_queue_Allocate_message_buffer( the_message_queue );
+    if ( the_message == NULL ) {
+      break;
+    }
+
+    done = context->done;
+    _CORE_message_queue_Copy_buffer(
+      context->source + done * the_message_queue->maximum_message_size,
+      the_message->buffer,
+      sizes[ done ]
+    );
+    _CORE_message_queue_Enqueue_message(
+      the_message_queue,
+      the_message,
+      sizes[ done ],
+      submit_type
+    );
+    context->done = done + 1;
+  }
+
+  *submitted = context->done;
+
+  if ( pending == 0 && the_message_queue->number_of_pending_messages != 0 ) {
+    wait_set_member = _Wait_set_Member_obtain(
+      the_message_queue->wait_set_member,
+      &context->Base.Lock_context.Lock_context
+    );
+  } else {
+    wait_set_member = NULL;
+  }
+
+#if defined(RTEMS_SCORE_COREMSG_ENABLE_NOTIFICATION)
+  if (
+    pending == 0
+      && the_message_queue->number_of_pending_messages != 0
+      && the_message_queue->notify_handler != NULL
+  ) {
+    ( *the_message_queue->notify_handler )(
+      the_message_queue,
+      &context->Base
+    );
+  } else {
+    _CORE_message_queue_Release( the_message_queue, &context->Base );
+  }
+#else
+  _CORE_message_queue_Release( the_message_queue, &context->Base );
+#endif
+
+  _Wait_set_Member_notify( wait_set_member );
+
+  return context->done == count ? STATUS_SUCCESSFUL : STATUS_TOO_MANY;
+}
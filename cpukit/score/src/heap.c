@@ -364,12 +364,22 @@ static void _Heap_Block_split(
     stats->free_size += free_block_size;
 
     if ( _Heap_Is_prev_used( next_next_block ) ) {
-      _Heap_Free_list_insert_after( free_list_anchor, free_block );
+      _Heap_Free_list_insert_block(
+        heap,
+        free_list_anchor,
+        free_block,
+        free_block_size
+      );
 
       /* Statistics */
       ++stats->free_blocks;
     } else {
-      _Heap_Free_list_replace( next_block, free_block );
+      _Heap_Free_list_replace_block(
+        heap,
+        next_block,
+        free_block,
+        free_block_size + next_block_size
+      );
 
       free_block_size += next_block_size;
 
@@ -424,7 +434,12 @@ static Heap_Block *_Heap_Block_allocate_from_end(
   stats->free_size += block_size_adjusted;
 
   if ( _Heap_Is_prev_used( block ) ) {
-    _Heap_Free_list_insert_after( free_list_anchor, block );
+    _Heap_Free_list_insert_block(
+      heap,
+      free_list_anchor,
+      block,
+      block_size_adjusted
+    );
 
     free_list_anchor = block;
 
@@ -436,6 +451,8 @@ static Heap_Block *_Heap_Block_allocate_from_end(
 
     block = prev_block;
     block_size_adjusted += prev_block_size;
+
+    _Heap_Free_list_resize_block( heap, block, block_size_adjusted );
   }
 
   block->size_and_flag = block_size_adjusted | HEAP_PREV_BLOCK_USED;
@@ -471,7 +488,7 @@ Heap_Block *_Heap_Block_allocate(
   } else {
     free_list_anchor = block->prev;
 
-    _Heap_Free_list_remove( block );
+    _Heap_Free_list_remove_block( heap, block );
 
     /* Statistics */
     --stats->free_blocks;
@@ -218,6 +218,144 @@ static uintptr_t _Heap_Check_block(
   return 0;
 }
 
+static uintptr_t _Heap_Try_block(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t block_size_floor,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary
+)
+{
+  _HAssert( _Heap_Is_prev_used( block ) );
+
+  _Heap_Protection_block_check( heap, block );
+
+  /*
+   * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
+   * field.  Thus the value is about one unit larger than the real block
+   * size.  The greater than operator takes this into account.
+   */
+  if ( block->size_and_flag > block_size_floor ) {
+    if ( alignment == 0 ) {
+      return _Heap_Alloc_area_of_block( block );
+    }
+
+    return _Heap_Check_block( heap, block, alloc_size, alignment, boundary );
+  }
+
+  return 0;
+}
+
+static Heap_Block *_Heap_Search_free_list(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t block_size_floor,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uintptr_t *alloc_begin,
+  uint32_t *search_count
+)
+{
+  Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+
+  while ( block != free_list_tail ) {
+    *alloc_begin = _Heap_Try_block(
+      heap,
+      block,
+      block_size_floor,
+      alloc_size,
+      alignment,
+      boundary
+    );
+
+    /* Statistics */
+    ++( *search_count );
+
+    if ( *alloc_begin != 0 ) {
+      break;
+    }
+
+    block = block->next;
+  }
+
+  return block;
+}
+
+static Heap_Block *_Heap_Search_segregated_fit(
+  Heap_Control *heap,
+  uintptr_t block_size_floor,
+  uintptr_t alloc_size,
+  uintptr_t alignment,
+  uintptr_t boundary,
+  uintptr_t *alloc_begin,
+  uint32_t *search_count
+)
+{
+  Heap_Block *good_fit;
+  Heap_Block *block;
+
+  /*
+   * Try the first block of the first size class which contains exclusively
+   * blocks large enough for the allocation.  This is a constant time
+   * operation.
+   */
+  good_fit = _Heap_Segregated_fit_search( heap, block_size_floor, true );
+
+  if ( good_fit != NULL ) {
+    *alloc_begin = _Heap_Try_block(
+      heap,
+      good_fit,
+      block_size_floor,
+      alloc_size,
+      alignment,
+      boundary
+    );
+
+    /* Statistics */
+    ++( *search_count );
+
+    if ( *alloc_begin != 0 ) {
+      return good_fit;
+    }
+  }
+
+  /*
+   * Try the first block of each non-empty size class starting with the size
+   * class of the block size.  This is only necessary if alignment or boundary
+   * constraints are not satisfied by the good fit candidate or if only the
+   * size class of the block size is not empty.  The size classes are located
+   * through the bitmaps, so the search is bounded by the count of size classes
+   * and not by the count of free blocks.
+   */
+  block = _Heap_Segregated_fit_search( heap, block_size_floor, false );
+
+  while ( block != NULL ) {
+    if ( block != good_fit ) {
+      *alloc_begin = _Heap_Try_block(
+        heap,
+        block,
+        block_size_floor,
+        alloc_size,
+        alignment,
+        boundary
+      );
+
+      /* Statistics */
+      ++( *search_count );
+
+      if ( *alloc_begin != 0 ) {
+        return block;
+      }
+    }
+
+    block = _Heap_Segregated_fit_next( heap, block );
+  }
+
+  return _Heap_Free_list_tail( heap );
+}
+
 void *_Heap_Allocate_aligned_with_boundary(
   Heap_Control *heap,
   uintptr_t alloc_size,
@@ -250,41 +388,27 @@ void *_Heap_Allocate_aligned_with_boundary(
   }
 
   do {
-    Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
-
-    block = _Heap_Free_list_first( heap );
-    while ( block != free_list_tail ) {
-      _HAssert( _Heap_Is_prev_used( block ) );
-
-      _Heap_Protection_block_check( heap, block );
-
-      /*
-       * The HEAP_PREV_BLOCK_USED flag is always set in the block size_and_flag
-       * field.  Thus the value is about one unit larger than the real block
-       * size.  The greater than operator takes this into account.
-       */
-      if ( block->size_and_flag > block_size_floor ) {
-        if ( alignment == 0 ) {
-          alloc_begin = _Heap_Alloc_area_of_block( block );
-        } else {
-          alloc_begin = _Heap_Check_block(
-            heap,
-            block,
-            alloc_size,
-            alignment,
-            boundary
-          );
-        }
-      }
-
-      /* Statistics */
-      ++search_count;
-
-      if ( alloc_begin != 0 ) {
-        break;
-      }
-
-      block = block->next;
+    if ( _Heap_Is_segregated_fit( heap ) ) {
+      block = _Heap_Search_segregated_fit(
+        heap,
+        block_size_floor,
+        alloc_size,
+        alignment,
+        boundary,
+        &alloc_begin,
+        &search_count
+      );
+    } else {
+      block = _Heap_Search_free_list(
+        heap,
+        _Heap_Free_list_first( heap ),
+        block_size_floor,
+        alloc_size,
+        alignment,
+        boundary,
+        &alloc_begin,
+        &search_count
+      );
     }
 
     search_again = _Heap_Protection_free_delayed_blocks( heap, alloc_begin );
@@ -0,0 +1,281 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreHeap
+ *
+ * @brief This source file contains the implementation of
+ *   _Heap_Initialize_segregated_fit(), _Heap_Segregated_fit_insert(),
+ *   _Heap_Segregated_fit_remove(), _Heap_Segregated_fit_resize(), and
+ *   _Heap_Segregated_fit_search().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/heapimpl.h>
+
+#include <string.h>
+
+/*
+ * The free list of a heap in the segregated fit mode is sorted by the size
+ * class of the free blocks.  The blocks of one size class form a contiguous
+ * sequence in the free list.  The index contains the first block of each
+ * sequence.  The bitmaps indicate the non-empty size classes.  This keeps the
+ * free list usable by the heap walk, the heap iteration, and the free
+ * information functions which are shared with the first fit mode.
+ */
+
+static Heap_Block *_Heap_Segregated_fit_find(
+  const Heap_Segregated_fit_index *index,
+  unsigned int fl,
+  unsigned int sl
+)
+{
+  uint32_t sl_map;
+
+  if ( sl < HEAP_SEGREGATED_FIT_SL_COUNT ) {
+    sl_map = index->sl_bitmap[ fl ] & ( UINT32_MAX << sl );
+  } else {
+    sl_map = 0;
+  }
+
+  if ( sl_map == 0 ) {
+    uint32_t fl_map;
+
+    ++fl;
+
+    if ( fl >= HEAP_SEGREGATED_FIT_FL_COUNT ) {
+      return NULL;
+    }
+
+    fl_map = index->fl_bitmap & ( UINT32_MAX << fl );
+
+    if ( fl_map == 0 ) {
+      return NULL;
+    }
+
+    fl = (unsigned int) __builtin_ctz( fl_map );
+    sl_map = index->sl_bitmap[ fl ];
+    _HAssert( sl_map != 0 );
+  }
+
+  sl = (unsigned int) __builtin_ctz( sl_map );
+
+  return index->first[ fl ][ sl ];
+}
+
+static bool _Heap_Segregated_fit_is_same_class(
+  uintptr_t block_size,
+  unsigned int fl,
+  unsigned int sl
+)
+{
+  unsigned int other_fl;
+  unsigned int other_sl;
+
+  _Heap_Segregated_fit_mapping( block_size, &other_fl, &other_sl );
+
+  return other_fl == fl && other_sl == sl;
+}
+
+void _Heap_Segregated_fit_insert(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t block_size
+)
+{
+  Heap_Segregated_fit_index *const index = heap->segregated_fit;
+  Heap_Block *first;
+  unsigned int fl;
+  unsigned int sl;
+
+  _Heap_Segregated_fit_mapping( block_size, &fl, &sl );
+  first = index->first[ fl ][ sl ];
+
+  if ( first == NULL ) {
+    first = _Heap_Segregated_fit_find( index, fl, sl + 1 );
+
+    if ( first == NULL ) {
+      first = _Heap_Free_list_tail( heap );
+    }
+
+    index->fl_bitmap |= UINT32_C( 1 ) << fl;
+    index->sl_bitmap[ fl ] |= UINT32_C( 1 ) << sl;
+  }
+
+  _Heap_Free_list_insert_before( first, block );
+  index->first[ fl ][ sl ] = block;
+}
+
+void _Heap_Segregated_fit_remove(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t block_size
+)
+{
+  Heap_Segregated_fit_index *const index = heap->segregated_fit;
+  unsigned int fl;
+  unsigned int sl;
+
+  _Heap_Segregated_fit_mapping( block_size, &fl, &sl );
+
+  if ( index->first[ fl ][ sl ] == block ) {
+    Heap_Block *const next = block->next;
+
+    if (
+      next != _Heap_Free_list_tail( heap )
+        && _Heap_Segregated_fit_is_same_class(
+          _Heap_Block_size( next ),
+          fl,
+          sl
+        )
+    ) {
+      index->first[ fl ][ sl ] = next;
+    } else {
+      index->first[ fl ][ sl ] = NULL;
+      index->sl_bitmap[ fl ] &= ~( UINT32_C( 1 ) << sl );
+
+      if ( index->sl_bitmap[ fl ] == 0 ) {
+        index->fl_bitmap &= ~( UINT32_C( 1 ) << fl );
+      }
+    }
+  }
+
+  _Heap_Free_list_remove( block );
+}
+
+void _Heap_Segregated_fit_resize(
+  Heap_Control *heap,
+  Heap_Block *block,
+  uintptr_t new_block_size
+)
+{
+  uintptr_t const old_block_size = _Heap_Block_size( block );
+  unsigned int fl;
+  unsigned int sl;
+
+  _Heap_Segregated_fit_mapping( old_block_size, &fl, &sl );
+
+  if ( !_Heap_Segregated_fit_is_same_class( new_block_size, fl, sl ) ) {
+    _Heap_Segregated_fit_remove( heap, block, old_block_size );
+    _Heap_Segregated_fit_insert( heap, block, new_block_size );
+  }
+}
+
+Heap_Block *_Heap_Segregated_fit_search(
+  const Heap_Control *heap,
+  uintptr_t block_size,
+  bool good_fit
+)
+{
+  uint64_t value = block_size;
+  unsigned int fl;
+  unsigned int sl;
+
+  if ( good_fit && value >= HEAP_SEGREGATED_FIT_SL_COUNT ) {
+    unsigned int const msb = 63U - (unsigned int) __builtin_clzll( value );
+
+    /*
+     * Round up to the next size class boundary, so that all blocks of the
+     * size class are large enough.
+     */
+    value += ( UINT64_C( 1 ) << ( msb - HEAP_SEGREGATED_FIT_SL_LOG2 ) ) - 1;
+
+    if ( value > UINTPTR_MAX ) {
+      return NULL;
+    }
+  }
+
+  _Heap_Segregated_fit_mapping( (uintptr_t) value, &fl, &sl );
+
+  return _Heap_Segregated_fit_find( heap->segregated_fit, fl, sl );
+}
+
+Heap_Block *_Heap_Segregated_fit_next(
+  const Heap_Control *heap,
+  const Heap_Block *block
+)
+{
+  unsigned int fl;
+  unsigned int sl;
+
+  _Heap_Segregated_fit_mapping( _Heap_Block_size( block ), &fl, &sl );
+
+  return _Heap_Segregated_fit_find( heap->segregated_fit, fl, sl + 1 );
+}
+
+uintptr_t _Heap_Initialize_segregated_fit(
+  Heap_Control *heap,
+  void *heap_area_begin_ptr,
+  uintptr_t heap_area_size,
+  uintptr_t page_size
+)
+{
+  uintptr_t const heap_area_begin = (uintptr_t) heap_area_begin_ptr;
+  uintptr_t const index_begin =
+    _Heap_Align_up( heap_area_begin, CPU_ALIGNMENT );
+  uintptr_t const index_end =
+    index_begin + sizeof( Heap_Segregated_fit_index );
+  uintptr_t const overhead = index_end - heap_area_begin;
+  Heap_Segregated_fit_index *const index =
+    (Heap_Segregated_fit_index *) index_begin;
+  Heap_Block *first_block;
+  uintptr_t available_size;
+
+  if ( index_end < heap_area_begin || heap_area_size <= overhead ) {
+    /* Invalid area or area too small */
+    return 0;
+  }
+
+  available_size = _Heap_Initialize(
+    heap,
+    (void *) index_end,
+    heap_area_size - overhead,
+    page_size
+  );
+
+  if ( available_size == 0 ) {
+    return 0;
+  }
+
+  memset( index, 0, sizeof( *index ) );
+  heap->segregated_fit = index;
+
+  first_block = heap->first_block;
+  _Heap_Free_list_remove( first_block );
+  _Heap_Segregated_fit_insert(
+    heap,
+    first_block,
+    _Heap_Block_size( first_block )
+  );
+
+  return available_size;
+}
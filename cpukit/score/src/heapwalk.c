@@ -139,6 +139,104 @@ static bool _Heap_Walk_check_free_list(
   return true;
 }
 
+static bool _Heap_Walk_check_segregated_fit(
+  int source,
+  Heap_Walk_printer printer,
+  Heap_Control *heap
+)
+{
+  const Heap_Segregated_fit_index *const index = heap->segregated_fit;
+  const Heap_Block *const free_list_tail = _Heap_Free_list_tail( heap );
+  const Heap_Block *free_block = _Heap_Free_list_first( heap );
+  unsigned int prev_class = 0;
+  unsigned int fl;
+  unsigned int sl;
+
+  while ( free_block != free_list_tail ) {
+    unsigned int current_class;
+
+    _Heap_Segregated_fit_mapping( _Heap_Block_size( free_block ), &fl, &sl );
+    current_class = fl * HEAP_SEGREGATED_FIT_SL_COUNT + sl;
+
+    if ( current_class < prev_class ) {
+      (*printer)(
+        source,
+        true,
+        "free block 0x%08x: not sorted by size class\n",
+        free_block
+      );
+
+      return false;
+    }
+
+    if (
+      ( current_class != prev_class || free_block->prev == free_list_tail )
+        && index->first[ fl ][ sl ] != free_block
+    ) {
+      (*printer)(
+        source,
+        true,
+        "free block 0x%08x: not first block of size class %u\n",
+        free_block,
+        current_class
+      );
+
+      return false;
+    }
+
+    prev_class = current_class;
+    free_block = free_block->next;
+  }
+
+  for ( fl = 0; fl < HEAP_SEGREGATED_FIT_FL_COUNT; ++fl ) {
+    bool const fl_bit = ( index->fl_bitmap & ( UINT32_C( 1 ) << fl ) ) != 0;
+
+    if ( fl_bit != ( index->sl_bitmap[ fl ] != 0 ) ) {
+      (*printer)(
+        source,
+        true,
+        "first level bitmap inconsistent for index %u\n",
+        fl
+      );
+
+      return false;
+    }
+
+    for ( sl = 0; sl < HEAP_SEGREGATED_FIT_SL_COUNT; ++sl ) {
+      bool const sl_bit =
+        ( index->sl_bitmap[ fl ] & ( UINT32_C( 1 ) << sl ) ) != 0;
+      const Heap_Block *const first = index->first[ fl ][ sl ];
+
+      if ( sl_bit != ( first != NULL ) ) {
+        (*printer)(
+          source,
+          true,
+          "second level bitmap inconsistent for index %u, %u\n",
+          fl,
+          sl
+        );
+
+        return false;
+      }
+
+      if ( first != NULL && _Heap_Is_used( first ) ) {
+        (*printer)(
+          source,
+          true,
+          "first block 0x%08x of size class %u, %u is used\n",
+          first,
+          fl,
+          sl
+        );
+
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
 static bool _Heap_Walk_is_in_free_list(
   Heap_Control *heap,
   Heap_Block *block
@@ -256,7 +354,15 @@ static bool _Heap_Walk_check_control(
     return false;
   }
 
-  return _Heap_Walk_check_free_list( source, printer, heap );
+  if ( !_Heap_Walk_check_free_list( source, printer, heap ) ) {
+    return false;
+  }
+
+  if ( _Heap_Is_segregated_fit( heap ) ) {
+    return _Heap_Walk_check_segregated_fit( source, printer, heap );
+  }
+
+  return true;
 }
 
 static bool _Heap_Walk_check_free_block(
@@ -6,7 +6,8 @@
  * @ingroup RTEMSScoreIntErr
  *
  * @brief This source file contains the definition of ::_System_state_Current
- *   and the implementation of _Terminate() and _Internal_error().
+ *   and ::_Terminate_Flush_handler and the implementation of _Terminate() and
+ *   _Internal_error().
  */
 
 /*
@@ -47,11 +48,22 @@
 
 System_state_Codes _System_state_Current;
 
+Terminate_Flush_handler _Terminate_Flush_handler;
+
 void _Terminate(
   Internal_errors_Source the_source,
   Internal_errors_t      the_error
 )
 {
+  Terminate_Flush_handler flush;
+
+  flush = _Terminate_Flush_handler;
+
+  if ( flush != NULL ) {
+    _Terminate_Flush_handler = NULL;
+    ( *flush )();
+  }
+
   _User_extensions_Fatal( the_source, the_error );
   _System_state_Set( SYSTEM_STATE_TERMINATED );
   _SMP_Request_shutdown();
@@ -46,6 +46,7 @@
 
 #include <rtems/score/assert.h>
 #include <rtems/score/muteximpl.h>
+#include <rtems/score/mutexspinimpl.h>
 #include <rtems/score/threadimpl.h>
 #include <rtems/score/todimpl.h>
 
@@ -129,7 +130,7 @@ static void _Mutex_Queue_release(
   _ISR_Local_enable( level );
 }
 
-static void _Mutex_Acquire_slow(
+static Status_Control _Mutex_Acquire_slow(
   Mutex_Control        *mutex,
   Thread_Control       *owner,
   Thread_Control       *executing,
@@ -137,6 +138,29 @@ static void _Mutex_Acquire_slow(
   Thread_queue_Context *queue_context
 )
 {
+#if defined(RTEMS_SMP)
+  if ( _Mutex_Spin_is_worthwhile( owner ) ) {
+    bool success;
+
+    _Mutex_Queue_release( mutex, level, queue_context );
+    _Mutex_Spin_wait( &mutex->Queue.Queue, owner );
+    _Thread_queue_Context_ISR_disable( queue_context, level );
+    (void) _Mutex_Queue_acquire_critical( mutex, queue_context );
+
+    success = ( mutex->Queue.Queue.owner == NULL );
+    _Mutex_Spin_account( success );
+
+    if ( success ) {
+      mutex->Queue.Queue.owner = executing;
+      _Thread_Resource_count_increment( executing );
+      _Mutex_Queue_release( mutex, level, queue_context );
+      return STATUS_SUCCESSFUL;
+    }
+  }
+#else
+  (void) owner;
+#endif
+
   _Thread_queue_Context_set_thread_state(
     queue_context,
     STATES_WAITING_FOR_MUTEX
@@ -152,6 +176,7 @@ static void _Mutex_Acquire_slow(
     executing,
     queue_context
   );
+  return _Thread_Wait_get_status( executing );
 }
 
 static void _Mutex_Release_critical(
@@ -202,7 +227,13 @@ void _Mutex_Acquire( struct _Mutex_Control *_mutex )
     _Mutex_Queue_release( mutex, level, &queue_context );
   } else {
     _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
-    _Mutex_Acquire_slow( mutex, owner, executing, level, &queue_context );
+    (void) _Mutex_Acquire_slow(
+      mutex,
+      owner,
+      executing,
+      level,
+      &queue_context
+    );
   }
 }
 
@@ -216,6 +247,7 @@ int _Mutex_Acquire_timed(
   ISR_Level             level;
   Thread_Control       *executing;
   Thread_Control       *owner;
+  Status_Control        status;
 
   mutex = _Mutex_Get( _mutex );
   _Thread_queue_Context_initialize( &queue_context );
@@ -236,9 +268,15 @@ int _Mutex_Acquire_timed(
       abstime,
       true
     );
-    _Mutex_Acquire_slow( mutex, owner, executing, level, &queue_context );
+    status = _Mutex_Acquire_slow(
+      mutex,
+      owner,
+      executing,
+      level,
+      &queue_context
+    );
 
-    return STATUS_GET_POSIX( _Thread_Wait_get_status( executing ) );
+    return STATUS_GET_POSIX( status );
   }
 }
 
@@ -319,7 +357,13 @@ void _Mutex_recursive_Acquire( struct _Mutex_recursive_Control *_mutex )
     _Mutex_Queue_release( &mutex->Mutex, level, &queue_context );
   } else {
     _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
-    _Mutex_Acquire_slow( &mutex->Mutex, owner, executing, level, &queue_context );
+    (void) _Mutex_Acquire_slow(
+      &mutex->Mutex,
+      owner,
+      executing,
+      level,
+      &queue_context
+    );
   }
 }
 
@@ -333,6 +377,7 @@ int _Mutex_recursive_Acquire_timed(
   ISR_Level                level;
   Thread_Control          *executing;
   Thread_Control          *owner;
+  Status_Control           status;
 
   mutex = _Mutex_recursive_Get( _mutex );
   _Thread_queue_Context_initialize( &queue_context );
@@ -358,9 +403,15 @@ int _Mutex_recursive_Acquire_timed(
       abstime,
       true
     );
-    _Mutex_Acquire_slow( &mutex->Mutex, owner, executing, level, &queue_context );
+    status = _Mutex_Acquire_slow(
+      &mutex->Mutex,
+      owner,
+      executing,
+      level,
+      &queue_context
+    );
 
-    return STATUS_GET_POSIX( _Thread_Wait_get_status( executing ) );
+    return STATUS_GET_POSIX( status );
   }
 }
 
@@ -0,0 +1,102 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreMutexSpin
+ *
+ * @brief This source file contains the implementation of _Mutex_Spin_wait()
+ *   and _Mutex_Spin_get_statistics().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/mutexspinimpl.h>
+#include <rtems/score/smp.h>
+#include <rtems/counter.h>
+
+#include <string.h>
+
+#if defined(RTEMS_SMP)
+void _Mutex_Spin_wait(
+  const Thread_queue_Queue *queue,
+  const Thread_Control     *owner
+)
+{
+  rtems_counter_ticks ticks;
+  rtems_counter_ticks a;
+  rtems_counter_ticks delta;
+
+  ticks = rtems_counter_nanoseconds_to_ticks( _Mutex_Spin_nanoseconds );
+  a = rtems_counter_read();
+  delta = 0;
+
+  /*
+   * The owner and the executing indicator are read without the thread queue
+   * lock.  They are only used as a hint to stop the spinning.  The caller
+   * checks the owner under the protection of the thread queue lock.
+   */
+  while (
+    ticks > delta
+      && queue->owner == owner
+      && _Thread_Is_executing_on_a_processor( owner )
+  ) {
+    rtems_counter_ticks b;
+
+    ticks -= delta;
+    b = rtems_counter_read();
+    delta = rtems_counter_difference( b, a );
+    a = b;
+    RTEMS_COMPILER_MEMORY_BARRIER();
+  }
+}
+#endif
+
+void _Mutex_Spin_get_statistics( Mutex_Spin_statistics *statistics )
+{
+#if defined(RTEMS_SMP)
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+#endif
+
+  memset( statistics, 0, sizeof( *statistics ) );
+
+#if defined(RTEMS_SMP)
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    const Per_CPU_Control *cpu;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    statistics->successes += cpu->Mutex_spin.successes;
+    statistics->failures += cpu->Mutex_spin.failures;
+  }
+#endif
+}
@@ -125,14 +125,16 @@ Objects_Maximum _Objects_Extend_information(
    *  Do we need to grow the tables?
    */
   if ( do_extend ) {
-    ISR_lock_Context  lock_context;
-    Objects_Control **object_blocks;
-    Objects_Control **local_table;
-    Objects_Maximum  *inactive_per_block;
-    void             *old_tables;
-    size_t            table_size;
-    uintptr_t         object_blocks_size;
-    uintptr_t         local_table_size;
+    ISR_lock_Context    lock_context;
+    Objects_Control   **object_blocks;
+    Objects_Control   **local_table;
+    Objects_Maximum    *inactive_per_block;
+    Objects_Name_index *name_index;
+    Objects_Name_index *old_name_index;
+    void               *old_tables;
+    size_t              table_size;
+    uintptr_t           object_blocks_size;
+    uintptr_t           local_table_size;
 
     /*
      *  Growing the tables means allocating a new area, doing a copy and
@@ -232,20 +234,44 @@ Objects_Maximum _Objects_Extend_information(
       local_table[ index ] = NULL;
     }
 
+    /*
+     *  The name index is rebuilt for the new maximum.  The allocator lock
+     *  prevents concurrent changes of the object names.
+     */
+    old_name_index = information->name_index;
+
+    if ( old_name_index != NULL ) {
+      name_index = _Objects_Name_index_create(
+        information,
+        local_table,
+        (Objects_Maximum) new_maximum
+      );
+
+      if ( name_index == NULL ) {
+        _Workspace_Free( object_blocks );
+        _Workspace_Free( new_object_block );
+        return 0;
+      }
+    } else {
+      name_index = NULL;
+    }
+
     /* FIXME: https://devel.rtems.org/ticket/2280 */
-    _ISR_lock_ISR_disable( &lock_context );
+    _Objects_Name_index_acquire( &lock_context );
 
     old_tables = information->object_blocks;
 
     information->object_blocks = object_blocks;
     information->inactive_per_block = inactive_per_block;
     information->local_table = local_table;
+    information->name_index = name_index;
     information->maximum_id = api_class_and_node
       | (new_maximum << OBJECTS_INDEX_START_BIT);
 
-    _ISR_lock_ISR_enable( &lock_context );
+    _Objects_Name_index_release( &lock_context );
 
     _Workspace_Free( old_tables );
+    _Workspace_Free( old_name_index );
 
     block_count++;
   }
@@ -92,4 +92,23 @@ void _Objects_Initialize_information(
 
   current->next = tail;
   tail->previous = current;
+
+  /*
+   * The name index is only used by the object classes which support name
+   * lookups.
+   */
+  if (
+    _Objects_Name_index_is_enabled
+      && maximum > 0
+      && (
+        _Objects_Get_API( maximum_id ) == OBJECTS_CLASSIC_API
+          || _Objects_Has_string_name( information )
+      )
+  ) {
+    information->name_index = _Objects_Name_index_create(
+      information,
+      information->local_table,
+      maximum
+    );
+  }
 }
@@ -0,0 +1,379 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreObject
+ *
+ * @brief This source file contains the implementation of
+ *   _Objects_Name_index_acquire(), _Objects_Name_index_create(),
+ *   _Objects_Name_index_find_string(), _Objects_Name_index_find_u32(),
+ *   _Objects_Name_index_insert(), _Objects_Name_index_release(),
+ *   _Objects_Name_index_remove(), and _Objects_Name_index_set_name().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/objectimpl.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+ISR_LOCK_DEFINE( static, _Objects_Name_index_lock, "Object Name Index" )
+
+static uint32_t _Objects_Name_index_hash_u32( uint32_t name )
+{
+  return ( name * UINT32_C( 0x9e3779b1 ) ) >> 16;
+}
+
+static uint32_t _Objects_Name_index_hash_string(
+  const char *name,
+  size_t      max_name_length
+)
+{
+  uint32_t hash;
+  size_t   i;
+
+  /* FNV-1a */
+  hash = UINT32_C( 2166136261 );
+
+  for ( i = 0; i < max_name_length && name[ i ] != '\0'; ++i ) {
+    hash ^= (unsigned char) name[ i ];
+    hash *= UINT32_C( 16777619 );
+  }
+
+  return _Objects_Name_index_hash_u32( hash );
+}
+
+static bool _Objects_Name_index_hash_name(
+  const Objects_Information *information,
+  Objects_Name               name,
+  uint32_t                  *hash
+)
+{
+  if ( _Objects_Has_string_name( information ) ) {
+    if ( name.name_p == NULL ) {
+      return false;
+    }
+
+    *hash = _Objects_Name_index_hash_string(
+      name.name_p,
+      information->name_length
+    );
+  } else {
+    if ( name.name_u32 == 0 ) {
+      return false;
+    }
+
+    *hash = _Objects_Name_index_hash_u32( name.name_u32 );
+  }
+
+  return true;
+}
+
+static bool _Objects_Name_index_hash_object(
+  const Objects_Information *information,
+  const Objects_Control     *the_object,
+  uint32_t                  *hash
+)
+{
+  return _Objects_Name_index_hash_name( information, the_object->name, hash );
+}
+
+static void _Objects_Name_index_link(
+  Objects_Name_index *index,
+  uint32_t            hash,
+  Objects_Maximum     object_index
+)
+{
+  Objects_Maximum *bucket;
+
+  bucket = &index->buckets[ hash & index->bucket_mask ];
+  index->next[ object_index - OBJECTS_INDEX_MINIMUM ] = *bucket;
+  *bucket = object_index;
+}
+
+static void _Objects_Name_index_unlink(
+  Objects_Name_index *index,
+  uint32_t            hash,
+  Objects_Maximum     object_index
+)
+{
+  Objects_Maximum *link;
+
+  link = &index->buckets[ hash & index->bucket_mask ];
+
+  while ( *link != 0 ) {
+    if ( *link == object_index ) {
+      *link = index->next[ object_index - OBJECTS_INDEX_MINIMUM ];
+      break;
+    }
+
+    link = &index->next[ *link - OBJECTS_INDEX_MINIMUM ];
+  }
+}
+
+void _Objects_Name_index_acquire( ISR_lock_Context *lock_context )
+{
+  _ISR_lock_ISR_disable_and_acquire( &_Objects_Name_index_lock, lock_context );
+}
+
+void _Objects_Name_index_release( ISR_lock_Context *lock_context )
+{
+  _ISR_lock_Release_and_ISR_enable( &_Objects_Name_index_lock, lock_context );
+}
+
+Objects_Name_index *_Objects_Name_index_create(
+  const Objects_Information *information,
+  Objects_Control * const   *local_table,
+  Objects_Maximum            maximum
+)
+{
+  Objects_Name_index *index;
+  uint32_t            bucket_count;
+  size_t              buckets_size;
+  Objects_Maximum     object_index;
+
+  bucket_count = 1;
+
+  while ( bucket_count < maximum ) {
+    bucket_count <<= 1;
+  }
+
+  buckets_size = bucket_count * sizeof( index->buckets[ 0 ] );
+  index = _Workspace_Allocate(
+    sizeof( *index ) + buckets_size + maximum * sizeof( *index->next )
+  );
+
+  if ( index == NULL ) {
+    return NULL;
+  }
+
+  index->bucket_mask = bucket_count - 1;
+  index->next = &index->buckets[ bucket_count ];
+  memset( &index->buckets[ 0 ], 0, buckets_size );
+
+  for (
+    object_index = OBJECTS_INDEX_MINIMUM;
+    object_index <= maximum;
+    ++object_index
+  ) {
+    const Objects_Control *the_object;
+    uint32_t               hash;
+
+    the_object = local_table[ object_index - OBJECTS_INDEX_MINIMUM ];
+
+    if (
+      the_object != NULL
+        && _Objects_Name_index_hash_object( information, the_object, &hash )
+    ) {
+      _Objects_Name_index_link( index, hash, object_index );
+    }
+  }
+
+  return index;
+}
+
+void _Objects_Name_index_insert(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  uint32_t         hash;
+  ISR_lock_Context lock_context;
+
+  if ( !_Objects_Name_index_hash_object( information, the_object, &hash ) ) {
+    return;
+  }
+
+  _Objects_Name_index_acquire( &lock_context );
+  _Objects_Name_index_link(
+    information->name_index,
+    hash,
+    _Objects_Get_index( the_object->id )
+  );
+  _Objects_Name_index_release( &lock_context );
+}
+
+void _Objects_Name_index_remove(
+  const Objects_Information *information,
+  const Objects_Control     *the_object
+)
+{
+  uint32_t         hash;
+  ISR_lock_Context lock_context;
+
+  if ( !_Objects_Name_index_hash_object( information, the_object, &hash ) ) {
+    return;
+  }
+
+  _Objects_Name_index_acquire( &lock_context );
+  _Objects_Name_index_unlink(
+    information->name_index,
+    hash,
+    _Objects_Get_index( the_object->id )
+  );
+  _Objects_Name_index_release( &lock_context );
+}
+
+void _Objects_Name_index_set_name(
+  const Objects_Information *information,
+  Objects_Control           *the_object,
+  Objects_Name               name
+)
+{
+  Objects_Name_index *index;
+  Objects_Maximum     object_index;
+  uint32_t            old_hash;
+  uint32_t            new_hash;
+  bool                has_old_name;
+  bool                has_new_name;
+  ISR_lock_Context    lock_context;
+
+  index = information->name_index;
+  object_index = _Objects_Get_index( the_object->id );
+  has_old_name =
+    _Objects_Name_index_hash_object( information, the_object, &old_hash );
+  has_new_name =
+    _Objects_Name_index_hash_name( information, name, &new_hash );
+
+  /*
+   * Change the name and the index entry in one critical section, so that a
+   * concurrent lookup finds the object either by the old or the new name.
+   */
+  _Objects_Name_index_acquire( &lock_context );
+
+  if ( has_old_name ) {
+    _Objects_Name_index_unlink( index, old_hash, object_index );
+  }
+
+  the_object->name = name;
+
+  if ( has_new_name ) {
+    _Objects_Name_index_link( index, new_hash, object_index );
+  }
+
+  _Objects_Name_index_release( &lock_context );
+}
+
+bool _Objects_Name_index_find_u32(
+  const Objects_Information *information,
+  uint32_t                   name,
+  Objects_Id                *id
+)
+{
+  const Objects_Name_index *index;
+  Objects_Maximum           object_index;
+  const Objects_Control    *found;
+  ISR_lock_Context          lock_context;
+
+  found = NULL;
+
+  _Objects_Name_index_acquire( &lock_context );
+
+  index = information->name_index;
+  object_index =
+    index->buckets[ _Objects_Name_index_hash_u32( name ) & index->bucket_mask ];
+
+  while ( object_index != 0 ) {
+    const Objects_Control *the_object;
+
+    the_object = information->local_table[
+      object_index - OBJECTS_INDEX_MINIMUM
+    ];
+
+    /*
+     * The object is removed from the local table before it is removed from
+     * the name index, see _Objects_Close().
+     */
+    if (
+      the_object != NULL
+        && the_object->name.name_u32 == name
+        && ( found == NULL || the_object->id < found->id )
+    ) {
+      found = the_object;
+    }
+
+    object_index = index->next[ object_index - OBJECTS_INDEX_MINIMUM ];
+  }
+
+  if ( found != NULL ) {
+    *id = found->id;
+  }
+
+  _Objects_Name_index_release( &lock_context );
+
+  return found != NULL;
+}
+
+Objects_Control *_Objects_Name_index_find_string(
+  const Objects_Information *information,
+  const char                *name
+)
+{
+  const Objects_Name_index *index;
+  Objects_Maximum           object_index;
+  Objects_Control          *found;
+  size_t                    max_name_length;
+
+  _Assert( _Objects_Allocator_is_owner() );
+
+  found = NULL;
+  max_name_length = information->name_length;
+  index = information->name_index;
+  object_index = index->buckets[
+    _Objects_Name_index_hash_string( name, max_name_length )
+      & index->bucket_mask
+  ];
+
+  while ( object_index != 0 ) {
+    Objects_Control *the_object;
+
+    the_object = information->local_table[
+      object_index - OBJECTS_INDEX_MINIMUM
+    ];
+
+    /*
+     * The object is removed from the local table before it is removed from
+     * the name index, see _Objects_Close().
+     */
+    if (
+      the_object != NULL
+        && strncmp( name, the_object->name.name_p, max_name_length ) == 0
+        && ( found == NULL || the_object->id < found->id )
+    ) {
+      found = the_object;
+    }
+
+    object_index = index->next[ object_index - OBJECTS_INDEX_MINIMUM ];
+  }
+
+  return found;
+}
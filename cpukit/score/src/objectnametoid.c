@@ -70,17 +70,24 @@ Status_Control _Objects_Name_to_id_u32(
     Objects_Maximum maximum;
     Objects_Maximum index;
 
-    maximum = _Objects_Get_maximum_index( information );
+    if ( information->name_index != NULL ) {
+      if ( _Objects_Name_index_find_u32( information, name, id ) ) {
+        _Assert( name != 0 );
+        return STATUS_SUCCESSFUL;
+      }
+    } else {
+      maximum = _Objects_Get_maximum_index( information );
 
-    for ( index = 0; index < maximum; ++index ) {
-      const Objects_Control *the_object;
+      for ( index = 0; index < maximum; ++index ) {
+        const Objects_Control *the_object;
 
-      the_object = information->local_table[ index ];
+        the_object = information->local_table[ index ];
 
-      if ( the_object != NULL && name == the_object->name.name_u32 ) {
-        *id = the_object->id;
-        _Assert( name != 0 );
-        return STATUS_SUCCESSFUL;
+        if ( the_object != NULL && name == the_object->name.name_u32 ) {
+          *id = the_object->id;
+          _Assert( name != 0 );
+          return STATUS_SUCCESSFUL;
+        }
       }
     }
   }
@@ -50,6 +50,11 @@ Status_Control _Objects_Set_name(
   const char                *name
 )
 {
+  Objects_Name new_name;
+  const char  *old_string;
+
+  old_string = NULL;
+
   if ( _Objects_Has_string_name( information ) ) {
     size_t  length;
     char   *dup;
@@ -60,8 +65,8 @@ Status_Control _Objects_Set_name(
       return STATUS_NO_MEMORY;
     }
 
-    _Workspace_Free( RTEMS_DECONST( char *, the_object->name.name_p ) );
-    the_object->name.name_p = dup;
+    old_string = the_object->name.name_p;
+    new_name.name_p = dup;
   } else {
     char c[ 4 ];
     size_t i;
@@ -76,9 +81,16 @@ Status_Control _Objects_Set_name(
       c[ i ] = name[ i ];
     }
 
-    the_object->name.name_u32 =
-      _Objects_Build_name( c[ 0 ], c[ 1 ], c[ 2 ], c[ 3 ] );
+    new_name.name_u32 = _Objects_Build_name( c[ 0 ], c[ 1 ], c[ 2 ], c[ 3 ] );
+  }
+
+  if ( information->name_index != NULL ) {
+    _Objects_Name_index_set_name( information, the_object, new_name );
+  } else {
+    the_object->name = new_name;
   }
 
+  _Workspace_Free( RTEMS_DECONST( char *, old_string ) );
+
   return STATUS_SUCCESSFUL;
 }
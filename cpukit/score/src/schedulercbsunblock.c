@@ -70,7 +70,7 @@ void _Scheduler_CBS_Unblock(
     time_t deadline = serv_info->parameters.deadline;
     time_t budget = serv_info->parameters.budget;
     uint32_t deadline_left = the_thread->CPU_budget.available;
-    Priority_Control budget_left = priority - _Watchdog_Ticks_since_boot;
+    Priority_Control budget_left = priority - _Watchdog_Get_ticks_since_boot();
 
     if ( deadline * budget_left > budget * deadline_left ) {
       Thread_queue_Context queue_context;
@@ -0,0 +1,786 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreSchedulerShardedSMP
+ *
+ * @brief This source file contains the implementation of
+ *   _Scheduler_sharded_SMP_Add_processor(),
+ *   _Scheduler_sharded_SMP_Ask_for_help(), _Scheduler_sharded_SMP_Block(),
+ *   _Scheduler_sharded_SMP_Initialize(),
+ *   _Scheduler_sharded_SMP_Node_initialize(),
+ *   _Scheduler_sharded_SMP_Reconsider_help_request(),
+ *   _Scheduler_sharded_SMP_Remove_processor(),
+ *   _Scheduler_sharded_SMP_Unblock(),
+ *   _Scheduler_sharded_SMP_Update_priority(),
+ *   _Scheduler_sharded_SMP_Withdraw_node(),
+ *   _Scheduler_sharded_SMP_Make_sticky(),
+ *   _Scheduler_sharded_SMP_Clean_sticky(), and _Scheduler_sharded_SMP_Yield().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/schedulershardedsmp.h>
+#include <rtems/score/schedulerpriorityimpl.h>
+#include <rtems/score/schedulersmpimpl.h>
+
+static Scheduler_sharded_SMP_Context *
+_Scheduler_sharded_SMP_Get_context( const Scheduler_Control *scheduler )
+{
+  return (Scheduler_sharded_SMP_Context *) _Scheduler_Get_context( scheduler );
+}
+
+static Scheduler_sharded_SMP_Context *_Scheduler_sharded_SMP_Get_self(
+  Scheduler_Context *context
+)
+{
+  return (Scheduler_sharded_SMP_Context *) context;
+}
+
+static Scheduler_sharded_SMP_Node *_Scheduler_sharded_SMP_Node_downcast(
+  Scheduler_Node *node
+)
+{
+  return (Scheduler_sharded_SMP_Node *) node;
+}
+
+static Per_CPU_Control *_Scheduler_sharded_SMP_Get_CPU(
+  const Scheduler_Node *node
+)
+{
+  return _Thread_Get_CPU( _Scheduler_Node_get_user( node ) );
+}
+
+static Scheduler_sharded_SMP_Shard *_Scheduler_sharded_SMP_Get_shard(
+  Scheduler_sharded_SMP_Context *self,
+  const Per_CPU_Control         *cpu
+)
+{
+  return &self->Shard[ _Per_CPU_Get_index( cpu ) ];
+}
+
+static void _Scheduler_sharded_SMP_Initialize_shard(
+  Scheduler_sharded_SMP_Shard *shard,
+  Chain_Control               *ready,
+  uint32_t                     index,
+  Priority_Control             maximum_priority
+)
+{
+  _Priority_bit_map_Initialize( &shard->Bit_map );
+  shard->Ready = ready;
+  shard->index = index;
+  _Scheduler_priority_Ready_queue_initialize( ready, maximum_priority );
+}
+
+static bool _Scheduler_sharded_SMP_Has_ready( Scheduler_Context *context )
+{
+  Scheduler_sharded_SMP_Context *self;
+
+  self = _Scheduler_sharded_SMP_Get_self( context );
+
+  return !_Priority_bit_map_Is_empty( &self->Bit_map )
+    || !_Priority_bit_map_Is_empty( &self->Idle.Bit_map );
+}
+
+static void _Scheduler_sharded_SMP_Add_to_shards(
+  Scheduler_sharded_SMP_Context *self,
+  uint32_t                       index,
+  unsigned int                   priority
+)
+{
+  Processor_mask *shards;
+
+  shards = &self->Shards[ priority ];
+
+  if ( _Processor_mask_Is_zero( shards ) ) {
+    Priority_bit_map_Information bit_map_info;
+
+    _Priority_bit_map_Initialize_information(
+      &self->Bit_map,
+      &bit_map_info,
+      priority
+    );
+    _Priority_bit_map_Add( &self->Bit_map, &bit_map_info );
+  }
+
+  _Processor_mask_Set( shards, index );
+}
+
+static void _Scheduler_sharded_SMP_Remove_from_shards(
+  Scheduler_sharded_SMP_Context *self,
+  uint32_t                       index,
+  unsigned int                   priority
+)
+{
+  Processor_mask *shards;
+
+  shards = &self->Shards[ priority ];
+  _Processor_mask_Clear( shards, index );
+
+  if ( _Processor_mask_Is_zero( shards ) ) {
+    Priority_bit_map_Information bit_map_info;
+
+    _Priority_bit_map_Initialize_information(
+      &self->Bit_map,
+      &bit_map_info,
+      priority
+    );
+    _Priority_bit_map_Remove( &self->Bit_map, &bit_map_info );
+  }
+}
+
+static void _Scheduler_sharded_SMP_Enqueue_in_shard(
+  Scheduler_sharded_SMP_Context *self,
+  Scheduler_sharded_SMP_Node    *node,
+  Scheduler_sharded_SMP_Shard   *shard,
+  bool                           append
+)
+{
+  unsigned int priority;
+  bool         was_empty;
+
+  priority = node->Ready_queue.current_priority;
+
+  /*
+   * The priority map references the bit map of the shard, so it has to be
+   * updated if the node moves to another shard.
+   */
+  if ( node->shard != shard ) {
+    node->shard = shard;
+    _Scheduler_priority_Ready_queue_update(
+      &node->Ready_queue,
+      priority,
+      &shard->Bit_map,
+      &shard->Ready[ 0 ]
+    );
+  }
+
+  was_empty = _Chain_Is_empty( &shard->Ready[ priority ] );
+
+  if ( append ) {
+    _Scheduler_priority_Ready_queue_enqueue(
+      &node->Base.Base.Node.Chain,
+      &node->Ready_queue,
+      &shard->Bit_map
+    );
+  } else {
+    _Scheduler_priority_Ready_queue_enqueue_first(
+      &node->Base.Base.Node.Chain,
+      &node->Ready_queue,
+      &shard->Bit_map
+    );
+  }
+
+  if ( shard != &self->Idle && was_empty ) {
+    _Scheduler_sharded_SMP_Add_to_shards( self, shard->index, priority );
+  }
+}
+
+static void _Scheduler_sharded_SMP_Enqueue_ready(
+  Scheduler_sharded_SMP_Context *self,
+  Scheduler_sharded_SMP_Node    *node,
+  bool                           append
+)
+{
+  Scheduler_sharded_SMP_Shard *shard;
+
+  if ( node->Ready_queue.current_priority == self->idle_priority ) {
+    shard = &self->Idle;
+  } else {
+    shard = _Scheduler_sharded_SMP_Get_shard(
+      self,
+      _Scheduler_sharded_SMP_Get_CPU( &node->Base.Base )
+    );
+  }
+
+  _Scheduler_sharded_SMP_Enqueue_in_shard( self, node, shard, append );
+}
+
+static void _Scheduler_sharded_SMP_Extract_from_shard(
+  Scheduler_sharded_SMP_Context *self,
+  Scheduler_sharded_SMP_Node    *node
+)
+{
+  Scheduler_sharded_SMP_Shard *shard;
+
+  shard = node->shard;
+  _Scheduler_priority_Ready_queue_extract(
+    &node->Base.Base.Node.Chain,
+    &node->Ready_queue,
+    &shard->Bit_map
+  );
+
+  if (
+    shard != &self->Idle &&
+    _Chain_Is_empty( node->Ready_queue.ready_chain )
+  ) {
+    _Scheduler_sharded_SMP_Remove_from_shards(
+      self,
+      shard->index,
+      node->Ready_queue.current_priority
+    );
+  }
+}
+
+static void _Scheduler_sharded_SMP_Move_from_scheduled_to_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *scheduled_to_ready
+)
+{
+  Scheduler_sharded_SMP_Context *self;
+  Scheduler_sharded_SMP_Node    *node;
+
+  self = _Scheduler_sharded_SMP_Get_self( context );
+  node = _Scheduler_sharded_SMP_Node_downcast( scheduled_to_ready );
+
+  _Chain_Extract_unprotected( &node->Base.Base.Node.Chain );
+  _Scheduler_sharded_SMP_Enqueue_ready( self, node, false );
+}
+
+static void _Scheduler_sharded_SMP_Move_from_ready_to_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *ready_to_scheduled
+)
+{
+  Scheduler_sharded_SMP_Context *self;
+  Scheduler_sharded_SMP_Node    *node;
+  Priority_Control               insert_priority;
+
+  self = _Scheduler_sharded_SMP_Get_self( context );
+  node = _Scheduler_sharded_SMP_Node_downcast( ready_to_scheduled );
+
+  _Scheduler_sharded_SMP_Extract_from_shard( self, node );
+  insert_priority = _Scheduler_SMP_Node_priority( &node->Base.Base );
+  insert_priority = SCHEDULER_PRIORITY_APPEND( insert_priority );
+  _Chain_Insert_ordered_unprotected(
+    &self->Base.Scheduled,
+    &node->Base.Base.Node.Chain,
+    &insert_priority,
+    _Scheduler_SMP_Priority_less_equal
+  );
+}
+
+static void _Scheduler_sharded_SMP_Insert_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_base,
+  Priority_Control   insert_priority
+)
+{
+  Scheduler_sharded_SMP_Context *self;
+  Scheduler_sharded_SMP_Node    *node;
+
+  self = _Scheduler_sharded_SMP_Get_self( context );
+  node = _Scheduler_sharded_SMP_Node_downcast( node_base );
+
+  _Scheduler_sharded_SMP_Enqueue_ready(
+    self,
+    node,
+    SCHEDULER_PRIORITY_IS_APPEND( insert_priority )
+  );
+}
+
+static void _Scheduler_sharded_SMP_Extract_from_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_extract
+)
+{
+  Scheduler_sharded_SMP_Context *self;
+  Scheduler_sharded_SMP_Node    *node;
+
+  self = _Scheduler_sharded_SMP_Get_self( context );
+  node = _Scheduler_sharded_SMP_Node_downcast( node_to_extract );
+
+  _Scheduler_sharded_SMP_Extract_from_shard( self, node );
+}
+
+static Scheduler_Node *_Scheduler_sharded_SMP_Get_idle( void *arg )
+{
+  Scheduler_sharded_SMP_Context *self;
+  Scheduler_sharded_SMP_Node    *lowest_ready;
+
+  self = _Scheduler_sharded_SMP_Get_self( arg );
+  lowest_ready = (Scheduler_sharded_SMP_Node *)
+    _Chain_Last( &self->Idle.Ready[ self->idle_priority ] );
+  _Scheduler_sharded_SMP_Extract_from_shard( self, lowest_ready );
+
+  return &lowest_ready->Base.Base;
+}
+
+static void _Scheduler_sharded_SMP_Release_idle(
+  Scheduler_Node *node_base,
+  void           *arg
+)
+{
+  Scheduler_sharded_SMP_Context *self;
+  Scheduler_sharded_SMP_Node    *node;
+
+  self = _Scheduler_sharded_SMP_Get_self( arg );
+  node = _Scheduler_sharded_SMP_Node_downcast( node_base );
+
+  _Scheduler_sharded_SMP_Enqueue_in_shard( self, node, &self->Idle, true );
+}
+
+static void _Scheduler_sharded_SMP_Do_update(
+  Scheduler_Context *context,
+  Scheduler_Node    *node_to_update,
+  Priority_Control   new_priority
+)
+{
+  Scheduler_sharded_SMP_Node *node;
+
+  (void) context;
+  node = _Scheduler_sharded_SMP_Node_downcast( node_to_update );
+
+  _Scheduler_SMP_Node_update_priority( &node->Base, new_priority );
+  _Scheduler_priority_Ready_queue_update(
+    &node->Ready_queue,
+    SCHEDULER_PRIORITY_UNMAP( new_priority ),
+    &node->shard->Bit_map,
+    &node->shard->Ready[ 0 ]
+  );
+}
+
+void _Scheduler_sharded_SMP_Initialize( const Scheduler_Control *scheduler )
+{
+  Scheduler_sharded_SMP_Context *self;
+  Priority_Control               maximum_priority;
+  Chain_Control                 *ready;
+  uint32_t                       shard_count;
+  uint32_t                       index;
+  Priority_Control               priority;
+
+  self = _Scheduler_sharded_SMP_Get_context( scheduler );
+  maximum_priority = scheduler->maximum_priority;
+  shard_count = _SMP_Processor_configured_maximum;
+
+  _Scheduler_SMP_Initialize( &self->Base );
+  _Priority_bit_map_Initialize( &self->Bit_map );
+  self->idle_priority = (unsigned int) maximum_priority;
+
+  /* The ready chains follow the processor shards */
+  ready = (Chain_Control *) &self->Shard[ shard_count ];
+
+  for ( index = 0; index < shard_count; ++index ) {
+    _Scheduler_sharded_SMP_Initialize_shard(
+      &self->Shard[ index ],
+      ready,
+      index,
+      maximum_priority
+    );
+    ready += maximum_priority + 1;
+  }
+
+  _Scheduler_sharded_SMP_Initialize_shard(
+    &self->Idle,
+    ready,
+    shard_count,
+    maximum_priority
+  );
+  ready += maximum_priority + 1;
+
+  /* The shard sets follow the ready chains */
+  self->Shards = (Processor_mask *) ready;
+
+  for ( priority = 0; priority <= maximum_priority; ++priority ) {
+    _Processor_mask_Zero( &self->Shards[ priority ] );
+  }
+}
+
+void _Scheduler_sharded_SMP_Node_initialize(
+  const Scheduler_Control *scheduler,
+  Scheduler_Node          *node,
+  Thread_Control          *the_thread,
+  Priority_Control         priority
+)
+{
+  Scheduler_sharded_SMP_Context *self;
+  Scheduler_sharded_SMP_Node    *the_node;
+
+  the_node = _Scheduler_sharded_SMP_Node_downcast( node );
+  _Scheduler_SMP_Node_initialize(
+    scheduler,
+    &the_node->Base,
+    the_thread,
+    priority
+  );
+
+  self = _Scheduler_sharded_SMP_Get_context( scheduler );
+  the_node->shard = &self->Idle;
+  _Scheduler_priority_Ready_queue_update(
+    &the_node->Ready_queue,
+    SCHEDULER_PRIORITY_UNMAP( priority ),
+    &self->Idle.Bit_map,
+    &self->Idle.Ready[ 0 ]
+  );
+}
+
+/*
+ * Returns the highest ready node for the processor used by the filter node.
+ * The node is taken from the shard of this processor unless another shard
+ * contains a node of a strictly higher priority.  In this case the node is
+ * stolen from the other shard.
+ */
+static Scheduler_Node *_Scheduler_sharded_SMP_Get_highest_ready(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_sharded_SMP_Context *self;
+  const Processor_mask          *shards;
+  unsigned int                   priority;
+  uint32_t                       index;
+
+  self = _Scheduler_sharded_SMP_Get_self( context );
+
+  if ( _Priority_bit_map_Is_empty( &self->Bit_map ) ) {
+    return (Scheduler_Node *) _Scheduler_priority_Ready_queue_first(
+      &self->Idle.Bit_map,
+      &self->Idle.Ready[ 0 ]
+    );
+  }
+
+  priority = _Priority_bit_map_Get_highest( &self->Bit_map );
+  shards = &self->Shards[ priority ];
+  index = _Per_CPU_Get_index( _Scheduler_sharded_SMP_Get_CPU( filter ) );
+
+  if ( !_Processor_mask_Is_set( shards, index ) ) {
+    index = _Processor_mask_Find_last_set( shards ) - 1;
+  }
+
+  _Assert( !_Chain_Is_empty( &self->Shard[ index ].Ready[ priority ] ) );
+  return (Scheduler_Node *) _Chain_First(
+    &self->Shard[ index ].Ready[ priority ]
+  );
+}
+
+/*
+ * Returns a lowest priority scheduled node.  If there are several of them,
+ * then the node using the processor used last by the thread of the filter
+ * node is preferred.
+ */
+static Scheduler_Node *_Scheduler_sharded_SMP_Get_lowest_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *filter
+)
+{
+  Scheduler_SMP_Context *self;
+  Scheduler_Node        *lowest_scheduled;
+  Chain_Node            *node;
+  Per_CPU_Control       *cpu;
+  Priority_Control       lowest_priority;
+
+  self = _Scheduler_SMP_Get_self( context );
+
+  _Assert( !_Chain_Is_empty( &self->Scheduled ) );
+  lowest_scheduled = (Scheduler_Node *) _Chain_Last( &self->Scheduled );
+  lowest_priority = _Scheduler_SMP_Node_priority( lowest_scheduled );
+  cpu = _Scheduler_sharded_SMP_Get_CPU( filter );
+  node = &lowest_scheduled->Node.Chain;
+
+  do {
+    Scheduler_Node *scheduled;
+
+    scheduled = (Scheduler_Node *) node;
+
+    if ( _Scheduler_SMP_Node_priority( scheduled ) != lowest_priority ) {
+      break;
+    }
+
+    if ( _Scheduler_sharded_SMP_Get_CPU( scheduled ) == cpu ) {
+      return scheduled;
+    }
+
+    node = _Chain_Previous( node );
+  } while ( node != _Chain_Head( &self->Scheduled ) );
+
+  return lowest_scheduled;
+}
+
+void _Scheduler_sharded_SMP_Block(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Block(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_sharded_SMP_Extract_from_ready,
+    _Scheduler_sharded_SMP_Get_highest_ready,
+    _Scheduler_sharded_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy,
+    _Scheduler_sharded_SMP_Get_idle
+  );
+}
+
+static bool _Scheduler_sharded_SMP_Enqueue(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  return _Scheduler_SMP_Enqueue(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_sharded_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_sharded_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_sharded_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_sharded_SMP_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy,
+    _Scheduler_sharded_SMP_Get_idle,
+    _Scheduler_sharded_SMP_Release_idle
+  );
+}
+
+static void _Scheduler_sharded_SMP_Enqueue_scheduled(
+  Scheduler_Context *context,
+  Scheduler_Node    *node,
+  Priority_Control   insert_priority
+)
+{
+  _Scheduler_SMP_Enqueue_scheduled(
+    context,
+    node,
+    insert_priority,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_sharded_SMP_Extract_from_ready,
+    _Scheduler_sharded_SMP_Get_highest_ready,
+    _Scheduler_sharded_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_sharded_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy,
+    _Scheduler_sharded_SMP_Get_idle,
+    _Scheduler_sharded_SMP_Release_idle
+  );
+}
+
+void _Scheduler_sharded_SMP_Unblock(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Unblock(
+    context,
+    thread,
+    node,
+    _Scheduler_sharded_SMP_Do_update,
+    _Scheduler_sharded_SMP_Enqueue,
+    _Scheduler_sharded_SMP_Release_idle
+  );
+}
+
+static bool _Scheduler_sharded_SMP_Do_ask_for_help(
+  Scheduler_Context *context,
+  Thread_Control    *the_thread,
+  Scheduler_Node    *node
+)
+{
+  return _Scheduler_SMP_Ask_for_help(
+    context,
+    the_thread,
+    node,
+    _Scheduler_SMP_Priority_less_equal,
+    _Scheduler_sharded_SMP_Insert_ready,
+    _Scheduler_SMP_Insert_scheduled,
+    _Scheduler_sharded_SMP_Move_from_scheduled_to_ready,
+    _Scheduler_sharded_SMP_Get_lowest_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy,
+    _Scheduler_sharded_SMP_Release_idle
+  );
+}
+
+void _Scheduler_sharded_SMP_Update_priority(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Update_priority(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_sharded_SMP_Extract_from_ready,
+    _Scheduler_sharded_SMP_Do_update,
+    _Scheduler_sharded_SMP_Enqueue,
+    _Scheduler_sharded_SMP_Enqueue_scheduled,
+    _Scheduler_sharded_SMP_Do_ask_for_help
+  );
+}
+
+bool _Scheduler_sharded_SMP_Ask_for_help(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_sharded_SMP_Do_ask_for_help( context, the_thread, node );
+}
+
+void _Scheduler_sharded_SMP_Reconsider_help_request(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Reconsider_help_request(
+    context,
+    the_thread,
+    node,
+    _Scheduler_sharded_SMP_Extract_from_ready
+  );
+}
+
+void _Scheduler_sharded_SMP_Withdraw_node(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node,
+  Thread_Scheduler_state   next_state
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Withdraw_node(
+    context,
+    the_thread,
+    node,
+    next_state,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_sharded_SMP_Extract_from_ready,
+    _Scheduler_sharded_SMP_Get_highest_ready,
+    _Scheduler_sharded_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy,
+    _Scheduler_sharded_SMP_Get_idle
+  );
+}
+
+void _Scheduler_sharded_SMP_Make_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  _Scheduler_SMP_Make_sticky(
+    scheduler,
+    the_thread,
+    node,
+    _Scheduler_sharded_SMP_Do_update,
+    _Scheduler_sharded_SMP_Enqueue
+  );
+}
+
+void _Scheduler_sharded_SMP_Clean_sticky(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *the_thread,
+  Scheduler_Node          *node
+)
+{
+  _Scheduler_SMP_Clean_sticky(
+    scheduler,
+    the_thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_sharded_SMP_Extract_from_ready,
+    _Scheduler_sharded_SMP_Get_highest_ready,
+    _Scheduler_sharded_SMP_Move_from_ready_to_scheduled,
+    _Scheduler_SMP_Allocate_processor_lazy,
+    _Scheduler_sharded_SMP_Get_idle,
+    _Scheduler_sharded_SMP_Release_idle
+  );
+}
+
+void _Scheduler_sharded_SMP_Add_processor(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *idle
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Add_processor(
+    context,
+    idle,
+    _Scheduler_sharded_SMP_Has_ready,
+    _Scheduler_sharded_SMP_Enqueue_scheduled,
+    _Scheduler_SMP_Do_nothing_register_idle
+  );
+}
+
+Thread_Control *_Scheduler_sharded_SMP_Remove_processor(
+  const Scheduler_Control *scheduler,
+  Per_CPU_Control         *cpu
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  return _Scheduler_SMP_Remove_processor(
+    context,
+    cpu,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_sharded_SMP_Extract_from_ready,
+    _Scheduler_sharded_SMP_Enqueue,
+    _Scheduler_sharded_SMP_Get_idle,
+    _Scheduler_sharded_SMP_Release_idle
+  );
+}
+
+void _Scheduler_sharded_SMP_Yield(
+  const Scheduler_Control *scheduler,
+  Thread_Control          *thread,
+  Scheduler_Node          *node
+)
+{
+  Scheduler_Context *context = _Scheduler_Get_context( scheduler );
+
+  _Scheduler_SMP_Yield(
+    context,
+    thread,
+    node,
+    _Scheduler_SMP_Extract_from_scheduled,
+    _Scheduler_sharded_SMP_Extract_from_ready,
+    _Scheduler_sharded_SMP_Enqueue,
+    _Scheduler_sharded_SMP_Enqueue_scheduled
+  );
+}
@@ -6,7 +6,9 @@
  * @ingroup RTEMSScoreSMP
  *
  * @brief This source file contains the implementation of
- *   _SMP_Multicast_action().
+ *   _SMP_Multicast_action(), _SMP_Multicast_action_is_done(),
+ *   _SMP_Multicast_action_post(), _SMP_Multicast_action_wait(),
+ *   _SMP_Multicast_batch_add(), and _SMP_Multicast_batch_submit().
  */
 
 /*
@@ -41,68 +43,137 @@
 #include <rtems/score/smpimpl.h>
 #include <rtems/score/assert.h>
 
-typedef struct {
-  Per_CPU_Job_context Context;
-  Per_CPU_Job         Jobs[ CPU_MAXIMUM_PROCESSORS ];
-} SMP_Multicast_jobs;
-
-static void _SMP_Issue_action_jobs(
-  const Processor_mask *targets,
-  SMP_Multicast_jobs   *jobs,
-  uint32_t              cpu_max
+static void _SMP_Add_action_jobs(
+  SMP_Multicast_action_control *action,
+  const Processor_mask         *targets,
+  SMP_Action_handler            handler,
+  void                         *arg,
+  bool                          send_message
 )
 {
+  uint32_t cpu_max;
   uint32_t cpu_index;
 
+  cpu_max = _SMP_Get_processor_maximum();
+  _Assert( cpu_max <= RTEMS_ARRAY_SIZE( action->Jobs ) );
+
+  action->Context.handler = handler;
+  action->Context.arg = arg;
+  _Processor_mask_Assign( &action->targets, targets );
+
   for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
     if ( _Processor_mask_Is_set( targets, cpu_index ) ) {
       Per_CPU_Job     *job;
       Per_CPU_Control *cpu;
 
-      job = &jobs->Jobs[ cpu_index ];
-      job->context = &jobs->Context;
+      job = &action->Jobs[ cpu_index ];
+      job->context = &action->Context;
       cpu = _Per_CPU_Get_by_index( cpu_index );
 
-      _Per_CPU_Submit_job( cpu, job );
+      if ( send_message ) {
+        _Per_CPU_Submit_job( cpu, job );
+      } else {
+        _Per_CPU_Add_job( cpu, job );
+      }
     }
   }
 }
 
-static void _SMP_Wait_for_action_jobs(
-  const Processor_mask     *targets,
-  const SMP_Multicast_jobs *jobs,
-  uint32_t                  cpu_max
+void _SMP_Multicast_action_post(
+  SMP_Multicast_action_control *action,
+  const Processor_mask         *targets,
+  SMP_Action_handler            handler,
+  void                         *arg
 )
 {
+  _SMP_Add_action_jobs( action, targets, handler, arg, true );
+}
+
+bool _SMP_Multicast_action_is_done(
+  const SMP_Multicast_action_control *action
+)
+{
+  uint32_t cpu_max;
   uint32_t cpu_index;
 
+  cpu_max = _SMP_Get_processor_maximum();
+
   for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
-    if ( _Processor_mask_Is_set( targets, cpu_index ) ) {
+    if ( _Processor_mask_Is_set( &action->targets, cpu_index ) ) {
+      const Per_CPU_Job *job;
+
+      job = &action->Jobs[ cpu_index ];
+
+      if (
+        _Atomic_Load_ulong( &job->done, ATOMIC_ORDER_ACQUIRE )
+          != PER_CPU_JOB_DONE
+      ) {
+        return false;
+      }
+    }
+  }
+
+  return true;
+}
+
+void _SMP_Multicast_action_wait( const SMP_Multicast_action_control *action )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &action->targets, cpu_index ) ) {
       const Per_CPU_Control *cpu;
       const Per_CPU_Job     *job;
 
       cpu = _Per_CPU_Get_by_index( cpu_index );
-      job = &jobs->Jobs[ cpu_index ];
+      job = &action->Jobs[ cpu_index ];
       _Per_CPU_Wait_for_job( cpu, job );
     }
   }
 }
 
+void _SMP_Multicast_batch_add(
+  SMP_Multicast_batch          *batch,
+  SMP_Multicast_action_control *action,
+  const Processor_mask         *targets,
+  SMP_Action_handler            handler,
+  void                         *arg
+)
+{
+  _SMP_Add_action_jobs( action, targets, handler, arg, false );
+  _Processor_mask_Or( &batch->targets, &batch->targets, targets );
+}
+
+void _SMP_Multicast_batch_submit( SMP_Multicast_batch *batch )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &batch->targets, cpu_index ) ) {
+      _SMP_Send_message(
+        _Per_CPU_Get_by_index( cpu_index ),
+        SMP_MESSAGE_PERFORM_JOBS
+      );
+    }
+  }
+
+  _Processor_mask_Zero( &batch->targets );
+}
+
 void _SMP_Multicast_action(
   const Processor_mask *targets,
   SMP_Action_handler    handler,
   void                 *arg
 )
 {
-  SMP_Multicast_jobs jobs;
-  uint32_t           cpu_max;
-
-  cpu_max = _SMP_Get_processor_maximum();
-  _Assert( cpu_max <= RTEMS_ARRAY_SIZE( jobs.Jobs ) );
-
-  jobs.Context.handler = handler;
-  jobs.Context.arg = arg;
+  SMP_Multicast_action_control action;
 
-  _SMP_Issue_action_jobs( targets, &jobs, cpu_max );
-  _SMP_Wait_for_action_jobs( targets, &jobs, cpu_max );
+  _SMP_Add_action_jobs( &action, targets, handler, arg, true );
+  _SMP_Multicast_action_wait( &action );
 }
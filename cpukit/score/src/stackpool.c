@@ -0,0 +1,264 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreStack
+ *
+ * @brief This source file contains the implementation of
+ *   _Stack_Pool_Allocate(), _Stack_Pool_Flush(), _Stack_Pool_Free(),
+ *   _Stack_Pool_Get_information(), and _Stack_Pool_Initialize().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/stackpool.h>
+#include <rtems/score/freechainimpl.h>
+#include <rtems/score/wkspace.h>
+
+#include <string.h>
+
+/*
+ * Each stack area allocated by the stack pool has a header which contains the
+ * index of its size class.  The size classes have four subclasses for each
+ * power of two, so that the rounding up to the class size wastes less than a
+ * quarter of the requested size.  A free stack area is put on the free list
+ * of its size class.  The chain node of the free list is placed at the begin
+ * of the stack area.
+ */
+
+typedef struct {
+  uint32_t class_index;
+} Stack_Pool_Header;
+
+RTEMS_STATIC_ASSERT(
+  sizeof( Stack_Pool_Header ) <= STACK_POOL_HEADER_SIZE,
+  stack_pool_header_size
+);
+
+RTEMS_STATIC_ASSERT(
+  sizeof( Chain_Node ) <= ( (size_t) 1 << STACK_POOL_MINIMUM_CLASS_LOG2 ),
+  stack_pool_chain_node
+);
+
+static uint32_t _Stack_Pool_Most_significant_bit( size_t size )
+{
+  return 63U - (uint32_t) __builtin_clzll( (unsigned long long) size );
+}
+
+static uint32_t _Stack_Pool_Get_class_index( size_t stack_size )
+{
+  uint32_t msb;
+  uint32_t level;
+  uint32_t subclass;
+  size_t   class_size;
+
+  if ( stack_size <= ( (size_t) 1 << STACK_POOL_MINIMUM_CLASS_LOG2 ) ) {
+    return 0;
+  }
+
+  if ( stack_size > STACK_POOL_MAXIMUM_CLASS_SIZE ) {
+    return STACK_POOL_CLASS_COUNT;
+  }
+
+  msb = _Stack_Pool_Most_significant_bit( stack_size );
+  class_size = RTEMS_ALIGN_UP(
+    stack_size,
+    (size_t) 1 << ( msb - STACK_POOL_SUBCLASS_LOG2 )
+  );
+  msb = _Stack_Pool_Most_significant_bit( class_size );
+  level = msb - STACK_POOL_MINIMUM_CLASS_LOG2;
+  subclass = (uint32_t) ( class_size >> ( msb - STACK_POOL_SUBCLASS_LOG2 ) )
+    & ( STACK_POOL_SUBCLASS_COUNT - 1 );
+
+  return level * STACK_POOL_SUBCLASS_COUNT + subclass;
+}
+
+static size_t _Stack_Pool_Get_class_size( uint32_t class_index )
+{
+  uint32_t level;
+  uint32_t subclass;
+
+  level = class_index / STACK_POOL_SUBCLASS_COUNT;
+  subclass = class_index % STACK_POOL_SUBCLASS_COUNT;
+
+  return (size_t) ( STACK_POOL_SUBCLASS_COUNT + subclass )
+    << ( STACK_POOL_MINIMUM_CLASS_LOG2 + level - STACK_POOL_SUBCLASS_LOG2 );
+}
+
+static Stack_Pool_Header *_Stack_Pool_Get_header( void *stack_area )
+{
+  return (Stack_Pool_Header *)
+    ( (char *) stack_area - STACK_POOL_HEADER_SIZE );
+}
+
+void _Stack_Pool_Initialize( void )
+{
+  Stack_Pool_Control *pool;
+  uint32_t            class_index;
+
+  pool = _Stack_Pool;
+  memset( pool, 0, sizeof( *pool ) );
+
+  for ( class_index = 0; class_index < STACK_POOL_CLASS_COUNT; ++class_index ) {
+    _Freechain_Initialize( &pool->Classes[ class_index ].Free, NULL, 0, 0 );
+  }
+}
+
+void *_Stack_Pool_Allocate( size_t stack_size )
+{
+  Stack_Pool_Control *pool;
+  Stack_Pool_Header  *header;
+  uint32_t            class_index;
+  size_t              alloc_size;
+
+  pool = _Stack_Pool;
+  class_index = _Stack_Pool_Get_class_index( stack_size );
+
+  if ( class_index < STACK_POOL_CLASS_COUNT ) {
+    Stack_Pool_Class *pool_class;
+
+    pool_class = &pool->Classes[ class_index ];
+
+    if ( !_Freechain_Is_empty( &pool_class->Free ) ) {
+      --pool_class->cached;
+      ++pool_class->hits;
+      return _Freechain_Pop( &pool_class->Free );
+    }
+
+    ++pool_class->misses;
+    alloc_size = _Stack_Pool_Get_class_size( class_index );
+  } else {
+    ++pool->oversized;
+    alloc_size = stack_size;
+
+    if ( alloc_size > SIZE_MAX - STACK_POOL_HEADER_SIZE ) {
+      return NULL;
+    }
+  }
+
+  alloc_size += STACK_POOL_HEADER_SIZE;
+  header = _Workspace_Allocate( alloc_size );
+
+  if ( header == NULL ) {
+    /*
+     * The free stack areas of other size classes may be sufficient to satisfy
+     * the request after they are returned to the RTEMS Workspace.
+     */
+    _Stack_Pool_Flush();
+    header = _Workspace_Allocate( alloc_size );
+
+    if ( header == NULL ) {
+      return NULL;
+    }
+  }
+
+  header->class_index = class_index;
+  return (char *) header + STACK_POOL_HEADER_SIZE;
+}
+
+void _Stack_Pool_Free( void *stack_area )
+{
+  Stack_Pool_Header *header;
+  uint32_t           class_index;
+
+  if ( stack_area == NULL ) {
+    return;
+  }
+
+  header = _Stack_Pool_Get_header( stack_area );
+  class_index = header->class_index;
+
+  if ( class_index < STACK_POOL_CLASS_COUNT ) {
+    Stack_Pool_Class *pool_class;
+
+    pool_class = &_Stack_Pool->Classes[ class_index ];
+    ++pool_class->cached;
+    _Freechain_Push( &pool_class->Free, stack_area );
+  } else {
+    _Workspace_Free( header );
+  }
+}
+
+void _Stack_Pool_Flush( void )
+{
+  Stack_Pool_Control *pool;
+  uint32_t            class_index;
+
+  pool = _Stack_Pool;
+
+  if ( pool == NULL ) {
+    return;
+  }
+
+  ++pool->flushes;
+
+  for ( class_index = 0; class_index < STACK_POOL_CLASS_COUNT; ++class_index ) {
+    Stack_Pool_Class *pool_class;
+
+    pool_class = &pool->Classes[ class_index ];
+
+    while ( !_Freechain_Is_empty( &pool_class->Free ) ) {
+      void *stack_area;
+
+      stack_area = _Freechain_Pop( &pool_class->Free );
+      _Workspace_Free( _Stack_Pool_Get_header( stack_area ) );
+    }
+
+    pool_class->cached = 0;
+  }
+}
+
+void _Stack_Pool_Get_information( Stack_Pool_Information *info )
+{
+  const Stack_Pool_Control *pool;
+  uint32_t                  class_index;
+
+  memset( info, 0, sizeof( *info ) );
+  pool = _Stack_Pool;
+
+  if ( pool == NULL ) {
+    return;
+  }
+
+  info->oversized = pool->oversized;
+  info->flushes = pool->flushes;
+
+  for ( class_index = 0; class_index < STACK_POOL_CLASS_COUNT; ++class_index ) {
+    const Stack_Pool_Class *pool_class;
+
+    pool_class = &pool->Classes[ class_index ];
+    info->hits += pool_class->hits;
+    info->misses += pool_class->misses;
+    info->cached += pool_class->cached;
+    info->cached_size += (uintptr_t) pool_class->cached
+      * _Stack_Pool_Get_class_size( class_index );
+  }
+}
@@ -274,6 +274,35 @@ static void _Thread_Run_post_switch_actions( Thread_Control *executing )
   _Thread_State_release( executing, &lock_context );
 }
 
+static void _Thread_Update_wakeup_latency(
+  Per_CPU_Control *cpu_self,
+  Thread_Control  *executing,
+  Thread_Control  *heir
+)
+{
+#if defined(RTEMS_PROFILING)
+  if ( heir->is_wakeup_latency_pending ) {
+    heir->is_wakeup_latency_pending = false;
+    _Profiling_Update_wakeup_latency(
+      cpu_self,
+      _CPU_Counter_read() - heir->unblock_instant,
+      _Thread_Get_unmapped_priority( heir )
+    );
+  }
+
+  /*
+   * The executing thread may have been unblocked before it was able to
+   * switch away.  Do not account the unblock instant for the next context
+   * switch to this thread.
+   */
+  executing->is_wakeup_latency_pending = false;
+#else
+  (void) cpu_self;
+  (void) executing;
+  (void) heir;
+#endif
+}
+
 void _Thread_Do_dispatch( Per_CPU_Control *cpu_self, ISR_Level level )
 {
   Thread_Control *executing;
@@ -299,6 +328,7 @@ void _Thread_Do_dispatch( Per_CPU_Control *cpu_self, ISR_Level level )
 
     level = _Thread_Preemption_intervention( executing, cpu_self, level );
     heir = _Thread_Get_heir_and_make_it_executing( cpu_self );
+    _Thread_Update_wakeup_latency( cpu_self, executing, heir );
 
     /*
      *  When the heir and executing are the same, then we are being
@@ -0,0 +1,249 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWaitSet
+ *
+ * @brief This source file contains the implementation of _Wait_set_Add(),
+ *   _Wait_set_Destroy(), _Wait_set_Initialize(), _Wait_set_Notify(),
+ *   _Wait_set_Remove(), and _Wait_set_Wait().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/waitsetimpl.h>
+#include <rtems/score/statesimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/threadqimpl.h>
+
+#include <string.h>
+
+#define WAIT_SET_TQ_OPERATIONS &_Thread_queue_Operations_FIFO
+
+void _Wait_set_Initialize( Wait_set_Control *wait_set )
+{
+  memset( wait_set, 0, sizeof( *wait_set ) );
+  _Thread_queue_Initialize( &wait_set->Wait_queue, "Wait Set" );
+}
+
+void _Wait_set_Destroy( Wait_set_Control *wait_set )
+{
+  Thread_queue_Context queue_context;
+  uint32_t             index;
+
+  for ( index = 0; index < WAIT_SET_MAXIMUM_MEMBERS; ++index ) {
+    if ( _Wait_set_Is_member_in_use( wait_set, index ) ) {
+      _Wait_set_Member_detach_and_remove( wait_set, index );
+    }
+  }
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Acquire( &wait_set->Wait_queue, &queue_context );
+  _Thread_queue_Flush_critical(
+    &wait_set->Wait_queue.Queue,
+    WAIT_SET_TQ_OPERATIONS,
+    _Thread_queue_Flush_status_object_was_deleted,
+    &queue_context
+  );
+  _Thread_queue_Destroy( &wait_set->Wait_queue );
+}
+
+Status_Control _Wait_set_Add(
+  Wait_set_Control                 *wait_set,
+  uint32_t                          index,
+  const Wait_set_Member_operations *operations,
+  Objects_Id                        id,
+  uint32_t                          option
+)
+{
+  Wait_set_Member *member;
+  Status_Control   status;
+
+  if ( !_Wait_set_Is_index_valid( index ) ) {
+    return STATUS_INVALID_NUMBER;
+  }
+
+  if ( _Wait_set_Is_member_in_use( wait_set, index ) ) {
+    return STATUS_RESOURCE_IN_USE;
+  }
+
+  member = _Wait_set_Member_insert( wait_set, index, operations, id, option );
+  status = ( *operations->attach )( member );
+
+  if ( status != STATUS_SUCCESSFUL ) {
+    _Wait_set_Member_remove( wait_set, index );
+  }
+
+  return status;
+}
+
+Status_Control _Wait_set_Remove( Wait_set_Control *wait_set, uint32_t index )
+{
+  if ( !_Wait_set_Is_index_valid( index ) ) {
+    return STATUS_INVALID_NUMBER;
+  }
+
+  if ( !_Wait_set_Is_member_in_use( wait_set, index ) ) {
+    return STATUS_INCORRECT_STATE;
+  }
+
+  _Wait_set_Member_detach_and_remove( wait_set, index );
+  return STATUS_SUCCESSFUL;
+}
+
+void _Wait_set_Notify( Wait_set_Control *wait_set )
+{
+  Thread_queue_Context queue_context;
+
+  _Thread_queue_Context_initialize( &queue_context );
+  _Thread_queue_Acquire( &wait_set->Wait_queue, &queue_context );
+  ++wait_set->notifications;
+  _Thread_queue_Flush_critical(
+    &wait_set->Wait_queue.Queue,
+    WAIT_SET_TQ_OPERATIONS,
+    _Thread_queue_Flush_default_filter,
+    &queue_context
+  );
+}
+
+static bool _Wait_set_Find_ready_member(
+  Wait_set_Control *wait_set,
+  uint32_t          next_index,
+  uint32_t         *index
+)
+{
+  uint32_t i;
+
+  for ( i = 0; i < WAIT_SET_MAXIMUM_MEMBERS; ++i ) {
+    uint32_t               candidate;
+    const Wait_set_Member *member;
+
+    candidate = ( next_index + i ) % WAIT_SET_MAXIMUM_MEMBERS;
+
+    if ( !_Wait_set_Is_member_in_use( wait_set, candidate ) ) {
+      continue;
+    }
+
+    member = &wait_set->Members[ candidate ];
+
+    if ( ( *member->operations->is_ready )( member ) ) {
+      *index = candidate;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+Status_Control _Wait_set_Wait(
+  Wait_set_Control  *wait_set,
+  Thread_Control    *executing,
+  bool               wait,
+  Watchdog_Interval  timeout,
+  uint32_t          *index
+)
+{
+  Thread_queue_Context queue_context;
+  Watchdog_Interval    deadline;
+
+  deadline = _Watchdog_Get_ticks_since_boot() + timeout;
+
+  while ( true ) {
+    uint32_t       notifications;
+    uint32_t       next_index;
+    Status_Control status;
+
+    _Thread_queue_Context_initialize( &queue_context );
+
+    /*
+     * The members are checked without the wait set lock, since the checks
+     * acquire the locks of the objects.  The objects notify the wait set
+     * after they released their locks.  A notification during the checks is
+     * detected through the notification count before the thread blocks.
+     */
+    _Thread_queue_Acquire( &wait_set->Wait_queue, &queue_context );
+    notifications = wait_set->notifications;
+    next_index = wait_set->next_index;
+    _Thread_queue_Release( &wait_set->Wait_queue, &queue_context );
+
+    if ( _Wait_set_Find_ready_member( wait_set, next_index, index ) ) {
+      _Thread_queue_Acquire( &wait_set->Wait_queue, &queue_context );
+      wait_set->next_index = ( *index + 1 ) % WAIT_SET_MAXIMUM_MEMBERS;
+      _Thread_queue_Release( &wait_set->Wait_queue, &queue_context );
+      return STATUS_SUCCESSFUL;
+    }
+
+    if ( !wait ) {
+      return STATUS_UNSATISFIED;
+    }
+
+    _Thread_queue_Acquire( &wait_set->Wait_queue, &queue_context );
+
+    if ( wait_set->notifications != notifications ) {
+      _Thread_queue_Release( &wait_set->Wait_queue, &queue_context );
+      continue;
+    }
+
+    if ( timeout != WATCHDOG_NO_TIMEOUT ) {
+      Watchdog_Interval remaining;
+
+      remaining = deadline - _Watchdog_Get_ticks_since_boot();
+
+      if ( remaining == 0 || remaining > timeout ) {
+        _Thread_queue_Release( &wait_set->Wait_queue, &queue_context );
+        return STATUS_TIMEOUT;
+      }
+
+      _Thread_queue_Context_set_enqueue_timeout_ticks(
+        &queue_context,
+        remaining
+      );
+    } else {
+      _Thread_queue_Context_set_enqueue_do_nothing_extra( &queue_context );
+    }
+
+    _Thread_queue_Context_set_thread_state(
+      &queue_context,
+      STATES_WAITING_FOR_WAIT_SET
+    );
+    _Thread_queue_Enqueue(
+      &wait_set->Wait_queue.Queue,
+      WAIT_SET_TQ_OPERATIONS,
+      executing,
+      &queue_context
+    );
+    status = _Thread_Wait_get_status( executing );
+
+    if ( status != STATUS_SUCCESSFUL ) {
+      return status;
+    }
+  }
+}
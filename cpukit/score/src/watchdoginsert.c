@@ -53,13 +53,18 @@ void _Watchdog_Insert(
 
   _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
 
+  the_watchdog->expire = expire;
+
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_insert( header->wheel, the_watchdog );
+    return;
+  }
+
   link = _RBTree_Root_reference( &header->Watchdogs );
   parent = NULL;
   old_first = header->first;
   new_first = &the_watchdog->Node.RBTree;
 
-  the_watchdog->expire = expire;
-
   while ( *link != NULL ) {
     Watchdog_Control *parent_watchdog;
 
@@ -78,4 +83,11 @@ void _Watchdog_Insert(
   _RBTree_Initialize_node( &the_watchdog->Node.RBTree );
   _RBTree_Add_child( &the_watchdog->Node.RBTree, parent, link );
   _RBTree_Insert_color( &header->Watchdogs, &the_watchdog->Node.RBTree );
+
+  if (
+    RTEMS_PREDICT_FALSE( _Watchdog_Tickless_is_active )
+      && new_first != old_first
+  ) {
+    _Watchdog_Tickless_update( _Watchdog_Get_CPU( the_watchdog ) );
+  }
 }
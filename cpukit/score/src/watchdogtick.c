@@ -83,6 +83,11 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
   Thread_Control                     *executing;
   const Thread_CPU_budget_operations *cpu_budget_operations;
 
+  if ( RTEMS_PREDICT_FALSE( _Watchdog_Tickless_is_active ) ) {
+    _Watchdog_Tickless_tick( cpu );
+    return;
+  }
+
 #ifdef RTEMS_SMP
   if ( _Per_CPU_Is_boot_processor( cpu ) ) {
 #endif
@@ -99,16 +104,26 @@ void _Watchdog_Tick( Per_CPU_Control *cpu )
   cpu->Watchdog.ticks = ticks;
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
-  first = _Watchdog_Header_first( header );
 
-  if ( first != NULL ) {
-    _Watchdog_Tickle(
-      header,
-      first,
+  if ( header->wheel != NULL ) {
+    _Watchdog_Wheel_tickle(
+      header->wheel,
       ticks,
       &cpu->Watchdog.Lock,
       &lock_context
     );
+  } else {
+    first = _Watchdog_Header_first( header );
+
+    if ( first != NULL ) {
+      _Watchdog_Tickle(
+        header,
+        first,
+        ticks,
+        &cpu->Watchdog.Lock,
+        &lock_context
+      );
+    }
   }
 
   header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
@@ -0,0 +1,442 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Tickless_enable(), _Watchdog_Tickless_get_ticks(),
+ *   _Watchdog_Tickless_get_ticks_since_boot(), _Watchdog_Tickless_tick(), and
+ *   _Watchdog_Tickless_update().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/threadimpl.h>
+#include <rtems/score/timecounter.h>
+#include <rtems/score/userextimpl.h>
+
+bool _Watchdog_Tickless_is_active;
+
+Watchdog_Tickless_control _Watchdog_Tickless;
+
+static User_extensions_Control _Watchdog_Tickless_extension;
+
+static uint64_t _Watchdog_Tickless_nanoseconds_from_timespec(
+  const struct timespec *ts
+)
+{
+  return (uint64_t) ts->tv_sec * 1000000000 + (uint64_t) ts->tv_nsec;
+}
+
+static uint64_t _Watchdog_Tickless_get_uptime( void )
+{
+  struct timespec now;
+
+  _Timecounter_Nanouptime( &now );
+
+  return _Watchdog_Tickless_nanoseconds_from_timespec( &now );
+}
+
+static uint64_t _Watchdog_Tickless_get_delta(
+  uint64_t expire_nanoseconds,
+  uint64_t now_nanoseconds
+)
+{
+  if ( expire_nanoseconds <= now_nanoseconds ) {
+    return 0;
+  }
+
+  return expire_nanoseconds - now_nanoseconds;
+}
+
+static uint64_t _Watchdog_Tickless_get_timespec_delta(
+  const Watchdog_Control *first,
+  uint64_t                now_nanoseconds
+)
+{
+  struct timespec expire;
+
+  _Watchdog_Ticks_to_timespec( first->expire, &expire );
+
+  return _Watchdog_Tickless_get_delta(
+    _Watchdog_Tickless_nanoseconds_from_timespec( &expire ),
+    now_nanoseconds
+  );
+}
+
+static bool _Watchdog_Tickless_has_cpu_budget( const Thread_Control *the_thread )
+{
+  return the_thread->CPU_budget.operations != NULL;
+}
+
+/*
+ * The watchdog lock of the processor shall be owned by the caller and the
+ * processor shall be the current processor.
+ */
+static void _Watchdog_Tickless_program_next_event( Per_CPU_Control *cpu )
+{
+  uint64_t                now;
+  uint64_t                now_ticks;
+  uint64_t                delta;
+  uint64_t                candidate;
+  const Watchdog_Control *first;
+
+  now = _Watchdog_Tickless_get_uptime();
+  now_ticks = ( now - _Watchdog_Tickless.base_nanoseconds ) /
+    _Watchdog_Nanoseconds_per_tick;
+  delta = _Watchdog_Tickless.maximum_nanoseconds;
+
+  /*
+   * While a thread with a CPU budget executes, the clock interrupt shall
+   * occur at each watchdog tick boundary to carry out the timeslicing.
+   */
+  if (
+    _Watchdog_Tickless_has_cpu_budget( _Per_CPU_Get_executing( cpu ) )
+      || _Watchdog_Tickless_has_cpu_budget( cpu->heir )
+  ) {
+    candidate = _Watchdog_Tickless_get_delta(
+      _Watchdog_Tickless.base_nanoseconds +
+        ( now_ticks + 1 ) * _Watchdog_Nanoseconds_per_tick,
+      now
+    );
+
+    if ( candidate < delta ) {
+      delta = candidate;
+    }
+  }
+
+  first = _Watchdog_Header_first(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ]
+  );
+
+  if ( first != NULL ) {
+    if ( first->expire <= now_ticks ) {
+      delta = 0;
+    } else if (
+      first->expire - now_ticks <= delta / _Watchdog_Nanoseconds_per_tick
+    ) {
+      candidate = _Watchdog_Tickless_get_delta(
+        _Watchdog_Tickless.base_nanoseconds +
+          first->expire * _Watchdog_Nanoseconds_per_tick,
+        now
+      );
+
+      if ( candidate < delta ) {
+        delta = candidate;
+      }
+    }
+  }
+
+  first = _Watchdog_Header_first(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ]
+  );
+
+  if ( first != NULL ) {
+    candidate = _Watchdog_Tickless_get_timespec_delta( first, now );
+
+    if ( candidate < delta ) {
+      delta = candidate;
+    }
+  }
+
+  first = _Watchdog_Header_first(
+    &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ]
+  );
+
+  if ( first != NULL ) {
+    struct timespec realtime;
+
+    _Timecounter_Nanotime( &realtime );
+    candidate = _Watchdog_Tickless_get_timespec_delta(
+      first,
+      _Watchdog_Tickless_nanoseconds_from_timespec( &realtime )
+    );
+
+    if ( candidate < delta ) {
+      delta = candidate;
+    }
+  }
+
+  ( *_Watchdog_Tickless.program )( delta );
+}
+
+#if defined(RTEMS_SMP)
+static void _Watchdog_Tickless_do_update( void *arg )
+{
+  Per_CPU_Control  *cpu;
+  ISR_lock_Context  lock_context;
+
+  (void) arg;
+
+  cpu = _Per_CPU_Get();
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+  cpu->Watchdog.tickless_job_pending = false;
+  _Watchdog_Tickless_program_next_event( cpu );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
+
+static const Per_CPU_Job_context _Watchdog_Tickless_job_context = {
+  .handler = _Watchdog_Tickless_do_update
+};
+#endif
+
+static void _Watchdog_Tickless_thread_switch(
+  Thread_Control *executing,
+  Thread_Control *heir
+)
+{
+  Per_CPU_Control  *cpu;
+  ISR_lock_Context  lock_context;
+
+  (void) executing;
+
+  /*
+   * The heir may start with a CPU budget while the clock interrupt of the
+   * processor is programmed to the next watchdog expiration time.  The CPU
+   * budget accounting starts at the current watchdog tick.
+   */
+  if ( !_Watchdog_Tickless_has_cpu_budget( heir ) ) {
+    return;
+  }
+
+  _ISR_lock_ISR_disable( &lock_context );
+  cpu = _Per_CPU_Get();
+  _ISR_lock_Acquire( &cpu->Watchdog.Lock, &lock_context );
+  cpu->Watchdog.budget_ticks = _Watchdog_Per_CPU_get_ticks( cpu );
+  _Watchdog_Tickless_program_next_event( cpu );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+}
+
+static const User_extensions_Table _Watchdog_Tickless_extension_table = {
+  .thread_switch = _Watchdog_Tickless_thread_switch
+};
+
+void _Watchdog_Tickless_enable(
+  Watchdog_Tickless_program program,
+  uint64_t                  maximum_nanoseconds
+)
+{
+  struct timecounter *tc;
+  uint64_t            uptime;
+  uint64_t            elapsed;
+  uint64_t            maximum;
+  uint32_t            cpu_max;
+  uint32_t            cpu_index;
+
+  _Assert( !_Watchdog_Tickless_is_active );
+  _Assert( _Watchdog_Nanoseconds_per_tick > 0 );
+
+  /*
+   * The timecounter is updated by the clock interrupts of the boot processor.
+   * Make sure that this happens before the hardware counter overflows.
+   */
+  tc = _Timecounter;
+  maximum = ( (uint64_t) ( tc->tc_counter_mask / 2 ) * 1000000000 ) /
+    tc->tc_frequency;
+
+  if ( maximum_nanoseconds > maximum ) {
+    maximum_nanoseconds = maximum;
+  }
+
+  if ( maximum_nanoseconds < _Watchdog_Nanoseconds_per_tick ) {
+    maximum_nanoseconds = _Watchdog_Nanoseconds_per_tick;
+  }
+
+  uptime = _Watchdog_Tickless_get_uptime();
+  elapsed = (uint64_t) _Watchdog_Ticks_since_boot *
+    _Watchdog_Nanoseconds_per_tick;
+
+  if ( elapsed > uptime ) {
+    elapsed = uptime;
+  }
+
+  _Watchdog_Tickless.program = program;
+  _Watchdog_Tickless.maximum_nanoseconds = maximum_nanoseconds;
+  _Watchdog_Tickless.base_nanoseconds = uptime - elapsed;
+
+  cpu_max = _SMP_Get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control *cpu;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    cpu->Watchdog.budget_ticks = cpu->Watchdog.ticks;
+#if defined(RTEMS_SMP)
+    cpu->Watchdog.tickless_job.context = &_Watchdog_Tickless_job_context;
+    _Atomic_Store_ulong(
+      &cpu->Watchdog.tickless_job.done,
+      PER_CPU_JOB_DONE,
+      ATOMIC_ORDER_RELAXED
+    );
+#endif
+  }
+
+  _User_extensions_Add_set_with_table(
+    &_Watchdog_Tickless_extension,
+    &_Watchdog_Tickless_extension_table
+  );
+
+  _Watchdog_Tickless_is_active = true;
+}
+
+uint64_t _Watchdog_Tickless_get_ticks( void )
+{
+  return ( _Watchdog_Tickless_get_uptime() -
+    _Watchdog_Tickless.base_nanoseconds ) / _Watchdog_Nanoseconds_per_tick;
+}
+
+Watchdog_Interval _Watchdog_Tickless_get_ticks_since_boot( void )
+{
+  return (Watchdog_Interval) _Watchdog_Tickless_get_ticks();
+}
+
+void _Watchdog_Tickless_tick( Per_CPU_Control *cpu )
+{
+  ISR_lock_Context                    lock_context;
+  Watchdog_Header                    *header;
+  Watchdog_Control                   *first;
+  uint64_t                            ticks;
+  uint64_t                            budget_ticks;
+  struct timespec                     now;
+  Thread_Control                     *executing;
+  const Thread_CPU_budget_operations *cpu_budget_operations;
+
+  _ISR_lock_ISR_disable_and_acquire( &cpu->Watchdog.Lock, &lock_context );
+
+  ticks = _Watchdog_Per_CPU_get_ticks( cpu );
+  cpu->Watchdog.ticks = ticks;
+
+#ifdef RTEMS_SMP
+  if ( _Per_CPU_Is_boot_processor( cpu ) ) {
+#endif
+    _Watchdog_Ticks_since_boot = (Watchdog_Interval) ticks;
+#ifdef RTEMS_SMP
+  }
+#endif
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+  first = _Watchdog_Header_first( header );
+
+  if ( first != NULL ) {
+    _Watchdog_Tickle(
+      header,
+      first,
+      ticks,
+      &cpu->Watchdog.Lock,
+      &lock_context
+    );
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_MONOTONIC ];
+  first = _Watchdog_Header_first( header );
+
+  if ( first != NULL ) {
+    _Timecounter_Nanouptime( &now );
+    _Watchdog_Tickle(
+      header,
+      first,
+      _Watchdog_Ticks_from_timespec( &now ),
+      &cpu->Watchdog.Lock,
+      &lock_context
+    );
+  }
+
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_REALTIME ];
+  first = _Watchdog_Header_first( header );
+
+  if ( first != NULL ) {
+    _Timecounter_Nanotime( &now );
+    _Watchdog_Tickle(
+      header,
+      first,
+      _Watchdog_Ticks_from_timespec( &now ),
+      &cpu->Watchdog.Lock,
+      &lock_context
+    );
+  }
+
+  if ( ticks > cpu->Watchdog.budget_ticks ) {
+    budget_ticks = ticks - cpu->Watchdog.budget_ticks;
+    cpu->Watchdog.budget_ticks = ticks;
+  } else {
+    budget_ticks = 0;
+  }
+
+  _Watchdog_Tickless_program_next_event( cpu );
+  _ISR_lock_Release_and_ISR_enable( &cpu->Watchdog.Lock, &lock_context );
+
+  executing = _Per_CPU_Get_executing( cpu );
+  _Assert( executing != NULL );
+  cpu_budget_operations = executing->CPU_budget.operations;
+
+  if ( cpu_budget_operations != NULL ) {
+    while ( budget_ticks > 0 ) {
+      --budget_ticks;
+      ( *cpu_budget_operations->at_tick )( executing );
+    }
+  }
+}
+
+void _Watchdog_Tickless_update( Per_CPU_Control *cpu )
+{
+#if defined(RTEMS_SMP)
+  if ( cpu != _Per_CPU_Get() ) {
+    Per_CPU_Job *job;
+
+    if ( cpu->Watchdog.tickless_job_pending ) {
+      return;
+    }
+
+    cpu->Watchdog.tickless_job_pending = true;
+    job = &cpu->Watchdog.tickless_job;
+
+    /*
+     * The job handler clears the pending indicator before the job is marked
+     * as done.  Wait for this short time window to pass before the job is
+     * submitted again.
+     */
+    while (
+      _Atomic_Load_ulong( &job->done, ATOMIC_ORDER_ACQUIRE )
+        != PER_CPU_JOB_DONE
+    ) {
+      /* Wait */
+    }
+
+    _Per_CPU_Submit_job( cpu, job );
+    return;
+  }
+#endif
+
+  _Watchdog_Tickless_program_next_event( cpu );
+}
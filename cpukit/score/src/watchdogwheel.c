@@ -0,0 +1,277 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/**
+ * @file
+ *
+ * @ingroup RTEMSScoreWatchdog
+ *
+ * @brief This source file contains the implementation of
+ *   _Watchdog_Wheel_do_tickle(), _Watchdog_Wheel_initialize(),
+ *   _Watchdog_Wheel_insert(), and _Watchdog_Wheel_remove().
+ */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/watchdogimpl.h>
+#include <rtems/score/smp.h>
+
+#include <stddef.h>
+
+#define WATCHDOG_WHEEL_SLOT_MASK ( WATCHDOG_WHEEL_SLOT_COUNT - 1 )
+
+#define WATCHDOG_WHEEL_RANGE_BITS \
+  ( WATCHDOG_WHEEL_SLOT_BITS * WATCHDOG_WHEEL_LEVEL_COUNT )
+
+/*
+ * The state of a watchdog is stored in the color of the red-black tree node.
+ * The timing wheel node shall not overlap with it.
+ */
+RTEMS_STATIC_ASSERT(
+  offsetof( Watchdog_Control, Node.Wheel.previous_next )
+    < offsetof( Watchdog_Control, Node.RBTree.Node.rbe_color ),
+  WATCHDOG_WHEEL_NODE
+);
+
+static void _Watchdog_Wheel_enqueue(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog,
+  uint64_t          expire
+)
+{
+  uint64_t           delta;
+  Watchdog_Control **head;
+  Watchdog_Control  *next;
+
+  _Assert( expire >= wheel->now );
+  delta = expire - wheel->now;
+
+  if ( delta < ( UINT64_C( 1 ) << WATCHDOG_WHEEL_RANGE_BITS ) ) {
+    unsigned int level;
+    unsigned int slot;
+
+    if ( delta < WATCHDOG_WHEEL_SLOT_COUNT ) {
+      level = 0;
+    } else {
+      level = ( 63U - (unsigned int) __builtin_clzll( delta ) )
+        / WATCHDOG_WHEEL_SLOT_BITS;
+    }
+
+    slot = (unsigned int) ( expire >> ( level * WATCHDOG_WHEEL_SLOT_BITS ) )
+      & WATCHDOG_WHEEL_SLOT_MASK;
+    head = &wheel->slots[ level ][ slot ];
+    wheel->occupied[ level ] |= UINT64_C( 1 ) << slot;
+  } else {
+    head = &wheel->overflow;
+  }
+
+  next = *head;
+  the_watchdog->Node.Wheel.next = next;
+  the_watchdog->Node.Wheel.previous_next = head;
+
+  if ( next != NULL ) {
+    next->Node.Wheel.previous_next = &the_watchdog->Node.Wheel.next;
+  }
+
+  *head = the_watchdog;
+}
+
+/*
+ * The requeue is done after the time of the wheel was advanced and before the
+ * level zero slot of the current time is processed.  Watchdogs which expire
+ * at the current time are placed on this slot.
+ */
+static void _Watchdog_Wheel_requeue(
+  Watchdog_Wheel     *wheel,
+  Watchdog_Control  **head
+)
+{
+  Watchdog_Control *the_watchdog;
+
+  the_watchdog = *head;
+  *head = NULL;
+
+  while ( the_watchdog != NULL ) {
+    Watchdog_Control *next;
+
+    next = the_watchdog->Node.Wheel.next;
+    _Watchdog_Wheel_enqueue( wheel, the_watchdog, the_watchdog->expire );
+    the_watchdog = next;
+  }
+}
+
+static void _Watchdog_Wheel_cascade( Watchdog_Wheel *wheel, uint64_t now )
+{
+  unsigned int level;
+
+  for ( level = 1; level < WATCHDOG_WHEEL_LEVEL_COUNT; ++level ) {
+    unsigned int shift;
+    unsigned int slot;
+
+    shift = level * WATCHDOG_WHEEL_SLOT_BITS;
+
+    if ( ( now & ( ( UINT64_C( 1 ) << shift ) - 1 ) ) != 0 ) {
+      return;
+    }
+
+    slot = (unsigned int) ( now >> shift ) & WATCHDOG_WHEEL_SLOT_MASK;
+
+    if ( ( wheel->occupied[ level ] & ( UINT64_C( 1 ) << slot ) ) != 0 ) {
+      wheel->occupied[ level ] &= ~( UINT64_C( 1 ) << slot );
+      _Watchdog_Wheel_requeue( wheel, &wheel->slots[ level ][ slot ] );
+    }
+  }
+
+  if (
+    ( now & ( ( UINT64_C( 1 ) << WATCHDOG_WHEEL_RANGE_BITS ) - 1 ) ) == 0
+  ) {
+    _Watchdog_Wheel_requeue( wheel, &wheel->overflow );
+  }
+}
+
+void _Watchdog_Wheel_insert(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  uint64_t expire;
+
+  _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_INACTIVE );
+
+  /*
+   * The level zero slot of the time of the wheel was already processed or is
+   * processed currently.
+   */
+  expire = the_watchdog->expire;
+
+  if ( expire <= wheel->now ) {
+    expire = wheel->now + 1;
+  }
+
+  _Watchdog_Wheel_enqueue( wheel, the_watchdog, expire );
+  _Watchdog_Set_state( the_watchdog, WATCHDOG_SCHEDULED_WHEEL );
+}
+
+void _Watchdog_Wheel_remove(
+  Watchdog_Wheel   *wheel,
+  Watchdog_Control *the_watchdog
+)
+{
+  Watchdog_Control  *next;
+  Watchdog_Control **previous_next;
+
+  _Assert( _Watchdog_Get_state( the_watchdog ) == WATCHDOG_SCHEDULED_WHEEL );
+
+  next = the_watchdog->Node.Wheel.next;
+  previous_next = the_watchdog->Node.Wheel.previous_next;
+  *previous_next = next;
+
+  if ( next != NULL ) {
+    next->Node.Wheel.previous_next = previous_next;
+  } else {
+    uintptr_t offset;
+
+    /*
+     * If the watchdog was the only one of a slot, then the previous next
+     * pointer is the head of this slot.
+     */
+    offset = (uintptr_t) previous_next - (uintptr_t) &wheel->slots[ 0 ][ 0 ];
+
+    if ( offset < sizeof( wheel->slots ) ) {
+      size_t index;
+
+      index = offset / sizeof( wheel->slots[ 0 ][ 0 ] );
+      wheel->occupied[ index / WATCHDOG_WHEEL_SLOT_COUNT ] &=
+        ~( UINT64_C( 1 ) << ( index % WATCHDOG_WHEEL_SLOT_COUNT ) );
+    }
+  }
+}
+
+void _Watchdog_Wheel_do_tickle(
+  Watchdog_Wheel   *wheel,
+  uint64_t          now,
+#ifdef RTEMS_SMP
+  ISR_lock_Control *lock,
+#endif
+  ISR_lock_Context *lock_context
+)
+{
+  Watchdog_Control **head;
+  Watchdog_Control  *the_watchdog;
+
+  _Assert( now == wheel->now + 1 );
+  wheel->now = now;
+
+  if ( ( now & WATCHDOG_WHEEL_SLOT_MASK ) == 0 ) {
+    _Watchdog_Wheel_cascade( wheel, now );
+  }
+
+  head = &wheel->slots[ 0 ][ now & WATCHDOG_WHEEL_SLOT_MASK ];
+
+  /*
+   * The lock is released while the routine of a watchdog is called.  So,
+   * always start again with the first watchdog of the slot.  A watchdog
+   * inserted by the routine expires not before the next tick and is
+   * therefore never placed on this slot.
+   */
+  while ( ( the_watchdog = *head ) != NULL ) {
+    Watchdog_Service_routine_entry routine;
+
+    _Assert( the_watchdog->expire <= now );
+    _Watchdog_Wheel_remove( wheel, the_watchdog );
+    _Watchdog_Set_state( the_watchdog, WATCHDOG_INACTIVE );
+    routine = the_watchdog->routine;
+
+    _ISR_lock_Release_and_ISR_enable( lock, lock_context );
+    ( *routine )( the_watchdog );
+    _ISR_lock_ISR_disable_and_acquire( lock, lock_context );
+  }
+}
+
+void _Watchdog_Wheel_initialize( void )
+{
+  uint32_t cpu_max;
+  uint32_t cpu_index;
+
+  cpu_max = _SMP_Processor_configured_maximum;
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    Per_CPU_Control *cpu;
+    Watchdog_Header *header;
+    Watchdog_Wheel  *wheel;
+
+    cpu = _Per_CPU_Get_by_index( cpu_index );
+    header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+    wheel = &_Watchdog_Wheels[ cpu_index ];
+
+    _Assert( _Watchdog_Header_first( header ) == NULL );
+    wheel->now = cpu->Watchdog.ticks;
+    header->wheel = wheel;
+  }
+}
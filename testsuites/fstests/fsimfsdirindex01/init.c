@@ -0,0 +1,231 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <dirent.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+
+const char rtems_test_name[] = "FSIMFSDIRINDEX 1";
+
+/* Enough entries to build the hash index and to grow it twice */
+#define NODE_COUNT ( 5 * IMFS_DIRECTORY_INDEX_THRESHOLD )
+
+static char name[ 32 ];
+
+static const char *node_name( const char *dir, size_t i )
+{
+  snprintf( name, sizeof( name ), "%s/node-%zu", dir, i );
+
+  return name;
+}
+
+static void make_node( const char *dir, size_t i )
+{
+  int rv;
+
+  rv = mknod( node_name( dir, i ), S_IFCHR | S_IRWXU, 0 );
+  rtems_test_assert( rv == 0 );
+}
+
+static void check_node( const char *dir, size_t i, bool exists )
+{
+  struct stat st;
+  int rv;
+
+  errno = 0;
+  rv = stat( node_name( dir, i ), &st );
+
+  if ( exists ) {
+    rtems_test_assert( rv == 0 );
+    rtems_test_assert( S_ISCHR( st.st_mode ) );
+  } else {
+    rtems_test_assert( rv == -1 );
+    rtems_test_assert( errno == ENOENT );
+  }
+}
+
+static void check_size( const char *dir, size_t count )
+{
+  struct stat st;
+  int rv;
+
+  rv = stat( dir, &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( st.st_size == (off_t) ( count * sizeof( struct dirent ) ) );
+}
+
+static void check_readdir_order( const char *dir )
+{
+  DIR *dirp;
+  struct dirent *d;
+  size_t i;
+
+  dirp = opendir( dir );
+  rtems_test_assert( dirp != NULL );
+
+  for ( i = 0; i < NODE_COUNT; ++i ) {
+    char expected[ 16 ];
+
+    d = readdir( dirp );
+    rtems_test_assert( d != NULL );
+    snprintf( expected, sizeof( expected ), "node-%zu", i );
+    rtems_test_assert( strcmp( d->d_name, expected ) == 0 );
+  }
+
+  d = readdir( dirp );
+  rtems_test_assert( d == NULL );
+
+  closedir( dirp );
+}
+
+static void test_lookup( void )
+{
+  size_t i;
+  int rv;
+
+  puts( "lookup" );
+
+  rv = mkdir( "a", S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  for ( i = 0; i < NODE_COUNT; ++i ) {
+    make_node( "a", i );
+  }
+
+  check_size( "a", NODE_COUNT );
+
+  for ( i = 0; i < NODE_COUNT; ++i ) {
+    check_node( "a", i, true );
+  }
+
+  check_node( "a", NODE_COUNT, false );
+
+  errno = 0;
+  rv = mknod( node_name( "a", 0 ), S_IFCHR | S_IRWXU, 0 );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == EEXIST );
+
+  check_readdir_order( "a" );
+}
+
+static void test_rename( void )
+{
+  char new_name[ 32 ];
+  struct stat st;
+  size_t i;
+  int rv;
+
+  puts( "rename" );
+
+  rv = mkdir( "b", S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  /* Move every even node to the other directory and rename it there */
+  for ( i = 0; i < NODE_COUNT; i += 2 ) {
+    snprintf( new_name, sizeof( new_name ), "b/node-%zu", i );
+    rv = rename( node_name( "a", i ), new_name );
+    rtems_test_assert( rv == 0 );
+  }
+
+  check_size( "a", NODE_COUNT / 2 );
+  check_size( "b", NODE_COUNT / 2 );
+
+  for ( i = 0; i < NODE_COUNT; ++i ) {
+    check_node( "a", i, ( i % 2 ) != 0 );
+    check_node( "b", i, ( i % 2 ) == 0 );
+  }
+
+  /* Rename within the directory */
+  rv = rename( node_name( "b", 0 ), "b/zero" );
+  rtems_test_assert( rv == 0 );
+  check_node( "b", 0, false );
+  rv = stat( "b/zero", &st );
+  rtems_test_assert( rv == 0 );
+  rv = rename( "b/zero", node_name( "b", 0 ) );
+  rtems_test_assert( rv == 0 );
+  check_node( "b", 0, true );
+}
+
+static void test_unlink( void )
+{
+  size_t i;
+  int rv;
+
+  puts( "unlink" );
+
+  for ( i = 0; i < NODE_COUNT; ++i ) {
+    rv = unlink( node_name( ( i % 2 ) != 0 ? "a" : "b", i ) );
+    rtems_test_assert( rv == 0 );
+    check_node( "a", i, false );
+    check_node( "b", i, false );
+  }
+
+  check_size( "a", 0 );
+  check_size( "b", 0 );
+
+  rv = rmdir( "a" );
+  rtems_test_assert( rv == 0 );
+
+  rv = rmdir( "b" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  TEST_BEGIN();
+  test_lookup();
+  test_rename();
+  test_unlink();
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,308 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/param.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libcsupport.h>
+
+const char rtems_test_name[] = "FSIMFSEXTFILE 1";
+
+/* Covers the doubling extents and several extents of the maximum size */
+#define MAXIMUM_EXTENT_SIZE \
+  ( IMFS_EXTFILE_FIRST_EXTENT_SIZE << IMFS_EXTFILE_MAXIMUM_EXTENT_SHIFT )
+
+#define FILE_SIZE ( 5 * MAXIMUM_EXTENT_SIZE )
+
+static const char file[] = "file";
+
+static uint8_t buf[ 4093 ];
+
+static uint8_t pattern( size_t position )
+{
+  return (uint8_t) ( ( position * 7 ) ^ ( position >> 11 ) );
+}
+
+static void fill( size_t position, size_t n )
+{
+  size_t i;
+
+  for ( i = 0; i < n; ++i ) {
+    buf[ i ] = pattern( position + i );
+  }
+}
+
+static void check_pattern( int fd, off_t position, size_t size )
+{
+  while ( size > 0 ) {
+    ssize_t n;
+    size_t  i;
+
+    n = pread( fd, buf, sizeof( buf ), position );
+    rtems_test_assert( n == (ssize_t) MIN( size, sizeof( buf ) ) );
+
+    for ( i = 0; i < (size_t) n; ++i ) {
+      rtems_test_assert( buf[ i ] == pattern( (size_t) position + i ) );
+    }
+
+    position += n;
+    size -= (size_t) n;
+  }
+}
+
+static void check_zero( int fd, off_t position, size_t size )
+{
+  while ( size > 0 ) {
+    ssize_t n;
+    size_t  i;
+
+    n = pread( fd, buf, sizeof( buf ), position );
+    rtems_test_assert( n == (ssize_t) MIN( size, sizeof( buf ) ) );
+
+    for ( i = 0; i < (size_t) n; ++i ) {
+      rtems_test_assert( buf[ i ] == 0 );
+    }
+
+    position += n;
+    size -= (size_t) n;
+  }
+}
+
+static void check_size( int fd, off_t size )
+{
+  struct stat st;
+  int         rv;
+
+  rv = fstat( fd, &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( st.st_size == size );
+}
+
+static int create_file( void )
+{
+  int    fd;
+  size_t position;
+
+  fd = open( file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  for ( position = 0; position < FILE_SIZE; ) {
+    size_t  n;
+    ssize_t m;
+
+    n = MIN( sizeof( buf ), FILE_SIZE - position );
+    fill( position, n );
+    m = write( fd, buf, n );
+    rtems_test_assert( m == (ssize_t) n );
+    position += n;
+  }
+
+  check_size( fd, FILE_SIZE );
+
+  return fd;
+}
+
+static void test_read_write( void )
+{
+  int     fd;
+  int     rv;
+  off_t   position;
+  ssize_t n;
+
+  puts( "read and write" );
+
+  fd = create_file();
+  check_pattern( fd, 0, FILE_SIZE );
+
+  /* Unaligned reads across extent boundaries */
+  for (
+    position = IMFS_EXTFILE_FIRST_EXTENT_SIZE - 3;
+    position < FILE_SIZE;
+    position = 2 * position + 1
+  ) {
+    check_pattern( fd, position, MIN( 1000, FILE_SIZE - position ) );
+  }
+
+  /* A read at the end of file returns zero bytes */
+  n = pread( fd, buf, sizeof( buf ), FILE_SIZE );
+  rtems_test_assert( n == 0 );
+
+  /* Overwrite an area across an extent boundary */
+  position = 3 * IMFS_EXTFILE_FIRST_EXTENT_SIZE - 100;
+  memset( buf, 0, 200 );
+  n = pwrite( fd, buf, 200, position );
+  rtems_test_assert( n == 200 );
+  check_pattern( fd, 0, (size_t) position );
+  check_zero( fd, position, 200 );
+  check_pattern( fd, position + 200, FILE_SIZE - (size_t) position - 200 );
+  check_size( fd, FILE_SIZE );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_sparse( void )
+{
+  int     fd;
+  int     rv;
+  ssize_t n;
+  off_t   position;
+
+  puts( "sparse" );
+
+  fd = open( file, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  /* A write after the end of file fills the gap with zeros */
+  position = FILE_SIZE - 10;
+  fill( (size_t) position, 10 );
+  n = pwrite( fd, buf, 10, position );
+  rtems_test_assert( n == 10 );
+  check_size( fd, FILE_SIZE );
+  check_zero( fd, 0, (size_t) position );
+  check_pattern( fd, position, 10 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_truncate( void )
+{
+  int   fd;
+  int   rv;
+  off_t length;
+
+  puts( "truncate" );
+
+  fd = create_file();
+
+  /* Shrink into the middle of an extent and extend again */
+  length = 5 * IMFS_EXTFILE_FIRST_EXTENT_SIZE + 17;
+  rv = ftruncate( fd, length );
+  rtems_test_assert( rv == 0 );
+  check_size( fd, length );
+  check_pattern( fd, 0, (size_t) length );
+
+  rv = ftruncate( fd, FILE_SIZE );
+  rtems_test_assert( rv == 0 );
+  check_size( fd, FILE_SIZE );
+  check_pattern( fd, 0, (size_t) length );
+  check_zero( fd, length, FILE_SIZE - (size_t) length );
+
+  rv = ftruncate( fd, 0 );
+  rtems_test_assert( rv == 0 );
+  check_size( fd, 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_append( void )
+{
+  int     fd;
+  int     rv;
+  ssize_t n;
+
+  puts( "append" );
+
+  fd = create_file();
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  fd = open( file, O_RDWR | O_APPEND );
+  rtems_test_assert( fd >= 0 );
+
+  fill( FILE_SIZE, 100 );
+  n = write( fd, buf, 100 );
+  rtems_test_assert( n == 100 );
+  check_size( fd, FILE_SIZE + 100 );
+  check_pattern( fd, 0, FILE_SIZE + 100 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  rtems_resource_snapshot snapshot;
+
+  TEST_BEGIN();
+
+  rtems_resource_snapshot_take( &snapshot );
+
+  test_read_write();
+  test_sparse();
+  test_truncate();
+  test_append();
+
+  rtems_test_assert( rtems_resource_snapshot_check( &snapshot ) );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
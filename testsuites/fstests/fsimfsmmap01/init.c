@@ -0,0 +1,271 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/imfs.h>
+#include <rtems/libcsupport.h>
+
+const char rtems_test_name[] = "FSIMFSMMAP 1";
+
+#define MAXIMUM_EXTENT_SIZE \
+  ( IMFS_EXTFILE_FIRST_EXTENT_SIZE << IMFS_EXTFILE_MAXIMUM_EXTENT_SHIFT )
+
+/* Spans several extents of an extent file */
+#define FILE_SIZE ( 3 * MAXIMUM_EXTENT_SIZE + 123 )
+
+static const char image[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+
+static uint8_t buf[ FILE_SIZE ];
+
+static uint8_t pattern( size_t position )
+{
+  return (uint8_t) ( position * 13 + ( position >> 9 ) );
+}
+
+static void test_linfile( void )
+{
+  const char *p;
+  int         fd;
+  int         rv;
+
+  puts( "linear file" );
+
+  rv = IMFS_make_linearfile( "lin", S_IRWXU, image, sizeof( image ) );
+  rtems_test_assert( rv == 0 );
+
+  fd = open( "lin", O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  /* A shared read-only mapping refers directly to the file image */
+  p = mmap( NULL, sizeof( image ), PROT_READ, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p == image );
+
+  rv = munmap( RTEMS_DECONST( char *, p ), sizeof( image ) );
+  rtems_test_assert( rv == 0 );
+
+  p = mmap( NULL, 10, PROT_READ, MAP_SHARED, fd, 7 );
+  rtems_test_assert( p == &image[ 7 ] );
+
+  rv = munmap( RTEMS_DECONST( char *, p ), 10 );
+  rtems_test_assert( rv == 0 );
+
+  /* The file is not open for writing */
+  errno = 0;
+  p = mmap( NULL, 10, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == EACCES );
+
+  /* The mapping shall not exceed the file size */
+  errno = 0;
+  p = mmap( NULL, sizeof( image ) + 1, PROT_READ, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == EOVERFLOW );
+
+  /* Private mappings still need write permission */
+  errno = 0;
+  p = mmap( NULL, 10, PROT_READ, MAP_PRIVATE, fd, 0 );
+  rtems_test_assert( p == MAP_FAILED );
+  rtems_test_assert( errno == ENOTSUP );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( "lin" );
+  rtems_test_assert( rv == 0 );
+}
+
+static int create_extfile( void )
+{
+  size_t  i;
+  ssize_t n;
+  int     fd;
+
+  for ( i = 0; i < FILE_SIZE; ++i ) {
+    buf[ i ] = pattern( i );
+  }
+
+  fd = open( "ext", O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  n = write( fd, buf, FILE_SIZE );
+  rtems_test_assert( n == FILE_SIZE );
+
+  return fd;
+}
+
+static void test_extfile( void )
+{
+  uint8_t *p;
+  uint8_t *q;
+  ssize_t  n;
+  size_t   i;
+  int      fd;
+  int      rv;
+
+  puts( "extent file" );
+
+  fd = create_extfile();
+
+  /* The mapping of the whole file makes the extents contiguous */
+  p = mmap( NULL, FILE_SIZE, PROT_READ, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p != MAP_FAILED );
+
+  for ( i = 0; i < FILE_SIZE; ++i ) {
+    rtems_test_assert( p[ i ] == pattern( i ) );
+  }
+
+  /* Writes are visible through the shared mapping */
+  n = pwrite( fd, "xyz", 3, MAXIMUM_EXTENT_SIZE - 1 );
+  rtems_test_assert( n == 3 );
+  rtems_test_assert( memcmp( &p[ MAXIMUM_EXTENT_SIZE - 1 ], "xyz", 3 ) == 0 );
+
+  /* A second mapping refers to the same memory */
+  q = mmap( NULL, 100, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 1000 );
+  rtems_test_assert( q == &p[ 1000 ] );
+
+  q[ 0 ] = 'q';
+  n = pread( fd, buf, 1, 1000 );
+  rtems_test_assert( n == 1 );
+  rtems_test_assert( buf[ 0 ] == 'q' );
+
+  rv = munmap( q, 100 );
+  rtems_test_assert( rv == 0 );
+
+  /* The mapping pins the file memory against truncation and removal */
+  rv = ftruncate( fd, 0 );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( "ext" );
+  rtems_test_assert( rv == 0 );
+
+  rtems_test_assert( p[ FILE_SIZE - 1 ] == pattern( FILE_SIZE - 1 ) );
+
+  rv = munmap( p, FILE_SIZE );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_extfile_pinned( void )
+{
+  uint8_t *p;
+  int      fd;
+  int      fd2;
+  int      rv;
+
+  puts( "pinned extent file" );
+
+  fd = create_extfile();
+
+  /* A mapping within the first extent needs no contiguous extents */
+  fd2 = open( "ext", O_RDONLY );
+  rtems_test_assert( fd2 >= 0 );
+  p = mmap( NULL, 10, PROT_READ, MAP_SHARED, fd2, 0 );
+  rtems_test_assert( p != MAP_FAILED );
+
+  /* The mapping pins the extents after the close */
+  rv = close( fd2 );
+  rtems_test_assert( rv == 0 );
+
+  /* The extents cannot be moved while they are mapped */
+  errno = 0;
+  rtems_test_assert(
+    mmap( NULL, FILE_SIZE, PROT_READ, MAP_SHARED, fd, 0 ) == MAP_FAILED
+  );
+  rtems_test_assert( errno == EBUSY );
+
+  rv = munmap( p, 10 );
+  rtems_test_assert( rv == 0 );
+
+  /* Another open file descriptor does not pin the extents */
+  fd2 = open( "ext", O_RDONLY );
+  rtems_test_assert( fd2 >= 0 );
+
+  p = mmap( NULL, FILE_SIZE, PROT_READ, MAP_SHARED, fd, 0 );
+  rtems_test_assert( p != MAP_FAILED );
+
+  rv = close( fd2 );
+  rtems_test_assert( rv == 0 );
+
+  rv = munmap( p, FILE_SIZE );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( "ext" );
+  rtems_test_assert( rv == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  rtems_resource_snapshot snapshot;
+
+  TEST_BEGIN();
+
+  rtems_resource_snapshot_take( &snapshot );
+
+  test_linfile();
+  test_extfile();
+  test_extfile_pinned();
+
+  rtems_test_assert( rtems_resource_snapshot_check( &snapshot ) );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_IMFS_ENABLE_EXTENT_FILES
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
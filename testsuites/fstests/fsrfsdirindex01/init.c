@@ -0,0 +1,288 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <dirent.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/libio.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "FSRFSDIRINDEX 1";
+
+#define BLOCK_SIZE 512
+
+#define LINEAR_LINKS 300
+
+#define INDEXED_LINKS 2000
+
+static const char rda[] = "/dev/rda";
+
+static const char mnt[] = "/mnt";
+
+static const char dir[] = "/mnt/d";
+
+static const char target[] = "/mnt/d/target";
+
+static char path[64];
+
+static const char *link_path( size_t i )
+{
+  int n;
+
+  n = snprintf( path, sizeof( path ), "%s/l%04zu", dir, i );
+  rtems_test_assert( n > 0 && (size_t) n < sizeof( path ) );
+
+  return path;
+}
+
+static fsblkcnt_t free_blocks( void )
+{
+  struct statvfs sv;
+  int            rv;
+
+  rv = statvfs( mnt, &sv );
+  rtems_test_assert( rv == 0 );
+
+  return sv.f_bfree;
+}
+
+static void test_mount( void )
+{
+  int rv;
+
+  rv = mount( rda, mnt, RTEMS_FILESYSTEM_TYPE_RFS,
+              RTEMS_FILESYSTEM_READ_WRITE, NULL );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_unmount( void )
+{
+  int rv;
+
+  rv = unmount( mnt );
+  rtems_test_assert( rv == 0 );
+}
+
+static void add_links( size_t first, size_t last, size_t step )
+{
+  size_t i;
+  int    rv;
+
+  for ( i = first; i < last; i += step ) {
+    rv = link( target, link_path( i ) );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+static void remove_links( size_t first, size_t last, size_t step )
+{
+  size_t i;
+  int    rv;
+
+  for ( i = first; i < last; i += step ) {
+    rv = unlink( link_path( i ) );
+    rtems_test_assert( rv == 0 );
+  }
+}
+
+static void check_links( size_t count, size_t removed_step )
+{
+  struct stat st_target;
+  struct stat st;
+  size_t      i;
+  int         rv;
+
+  rv = stat( target, &st_target );
+  rtems_test_assert( rv == 0 );
+
+  for ( i = 0; i < count; ++i ) {
+    errno = 0;
+    rv = stat( link_path( i ), &st );
+
+    if ( removed_step != 0 && ( i % removed_step ) == 0 ) {
+      rtems_test_assert( rv == -1 );
+      rtems_test_assert( errno == ENOENT );
+    } else {
+      rtems_test_assert( rv == 0 );
+      rtems_test_assert( st.st_ino == st_target.st_ino );
+    }
+  }
+
+  errno = 0;
+  rv = stat( link_path( count ), &st );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOENT );
+}
+
+static size_t count_entries( void )
+{
+  struct dirent *de;
+  DIR           *d;
+  size_t         count = 0;
+  int            rv;
+
+  d = opendir( dir );
+  rtems_test_assert( d != NULL );
+
+  while ( ( de = readdir( d ) ) != NULL ) {
+    ++count;
+  }
+
+  rv = closedir( d );
+  rtems_test_assert( rv == 0 );
+
+  return count;
+}
+
+static void test_directory( const char *name, bool dir_index, size_t count )
+{
+  rtems_rfs_format_config config;
+  fsblkcnt_t              free_before;
+  int                     fd;
+  int                     rv;
+
+  puts( name );
+
+  memset( &config, 0, sizeof( config ) );
+  config.block_size = BLOCK_SIZE;
+  config.dir_index = dir_index;
+
+  rv = rtems_rfs_format( rda, &config );
+  rtems_test_assert( rv == 0 );
+
+  test_mount();
+
+  free_before = free_blocks();
+
+  rv = mkdir( dir, S_IRWXU );
+  rtems_test_assert( rv == 0 );
+
+  fd = open( target, O_RDWR | O_CREAT, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  add_links( 0, count, 1 );
+  check_links( count, 0 );
+  rtems_test_assert( count_entries() == count + 3 );
+
+  test_unmount();
+  test_mount();
+
+  check_links( count, 0 );
+
+  /* Remove every third link and add them back */
+  remove_links( 0, count, 3 );
+  check_links( count, 3 );
+  rtems_test_assert( count_entries() == count + 3 - ( ( count + 2 ) / 3 ) );
+
+  add_links( 0, count, 3 );
+  check_links( count, 0 );
+
+  test_unmount();
+  test_mount();
+
+  check_links( count, 0 );
+
+  errno = 0;
+  rv = rmdir( dir );
+  rtems_test_assert( rv == -1 );
+  rtems_test_assert( errno == ENOTEMPTY );
+
+  remove_links( 0, count, 1 );
+
+  rv = unlink( target );
+  rtems_test_assert( rv == 0 );
+
+  rtems_test_assert( count_entries() == 2 );
+
+  rv = rmdir( dir );
+  rtems_test_assert( rv == 0 );
+
+  rtems_test_assert( free_blocks() == free_before );
+
+  test_unmount();
+}
+
+static void Init( rtems_task_argument arg )
+{
+  int rv;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  rv = mkdir( mnt, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  test_directory( "Linear directory", false, LINEAR_LINKS );
+  test_directory( "Indexed directory", true, INDEXED_LINKS );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration[] = {
+  { .block_size = BLOCK_SIZE, .block_num = 4096 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
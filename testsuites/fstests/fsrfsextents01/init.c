@@ -0,0 +1,308 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <sys/stat.h>
+#include <sys/statvfs.h>
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/libio.h>
+#include <rtems/rtems-rfs-format.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "FSRFSEXTENTS 1";
+
+#define BLOCK_SIZE 512
+
+#define INTERLEAVED_BLOCKS 96
+
+#define LARGE_BLOCKS 600
+
+static const rtems_rfs_format_config rfs_config = {
+  .block_size = BLOCK_SIZE,
+  .extents = true
+};
+
+static const char rda[] = "/dev/rda";
+
+static const char mnt[] = "/mnt";
+
+static const char file_a[] = "/mnt/a";
+
+static const char file_b[] = "/mnt/b";
+
+static char buf[BLOCK_SIZE];
+
+static void fill_block( char *data, int id, size_t block )
+{
+  size_t i;
+
+  for ( i = 0; i < BLOCK_SIZE; ++i ) {
+    data[ i ] = (char) ( id + block + i );
+  }
+}
+
+static void check_block( const char *data, int id, size_t block )
+{
+  char expected[ BLOCK_SIZE ];
+
+  fill_block( expected, id, block );
+  rtems_test_assert( memcmp( data, expected, BLOCK_SIZE ) == 0 );
+}
+
+static void write_block( int fd, int id, size_t block )
+{
+  ssize_t n;
+
+  fill_block( buf, id, block );
+  n = write( fd, buf, BLOCK_SIZE );
+  rtems_test_assert( n == BLOCK_SIZE );
+}
+
+static void check_file( const char *path, int id, size_t blocks )
+{
+  struct stat st;
+  size_t      block;
+  ssize_t     n;
+  off_t       off;
+  int         fd;
+  int         rv;
+
+  fd = open( path, O_RDONLY );
+  rtems_test_assert( fd >= 0 );
+
+  rv = fstat( fd, &st );
+  rtems_test_assert( rv == 0 );
+  rtems_test_assert( st.st_size == (off_t) ( blocks * BLOCK_SIZE ) );
+
+  for ( block = 0; block < blocks; ++block ) {
+    n = read( fd, buf, BLOCK_SIZE );
+    rtems_test_assert( n == BLOCK_SIZE );
+    check_block( buf, id, block );
+  }
+
+  n = read( fd, buf, BLOCK_SIZE );
+  rtems_test_assert( n == 0 );
+
+  /* Read backwards so the extent search cannot start at the last extent */
+  block = blocks;
+  while ( block > 0 ) {
+    --block;
+    off = lseek( fd, (off_t) ( block * BLOCK_SIZE ), SEEK_SET );
+    rtems_test_assert( off == (off_t) ( block * BLOCK_SIZE ) );
+    n = read( fd, buf, BLOCK_SIZE );
+    rtems_test_assert( n == BLOCK_SIZE );
+    check_block( buf, id, block );
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+}
+
+static fsblkcnt_t free_blocks( void )
+{
+  struct statvfs sv;
+  int            rv;
+
+  rv = statvfs( mnt, &sv );
+  rtems_test_assert( rv == 0 );
+
+  return sv.f_bfree;
+}
+
+static void test_mount( void )
+{
+  int rv;
+
+  rv = mount( rda, mnt, RTEMS_FILESYSTEM_TYPE_RFS,
+              RTEMS_FILESYSTEM_READ_WRITE, NULL );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_unmount( void )
+{
+  int rv;
+
+  rv = unmount( mnt );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_interleaved( void )
+{
+  fsblkcnt_t free_before;
+  size_t     block;
+  int        fd_a;
+  int        fd_b;
+  int        rv;
+
+  puts( "Interleaved writes" );
+
+  free_before = free_blocks();
+
+  fd_a = open( file_a, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd_a >= 0 );
+
+  fd_b = open( file_b, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd_b >= 0 );
+
+  for ( block = 0; block < INTERLEAVED_BLOCKS; ++block ) {
+    write_block( fd_a, 1, block );
+    write_block( fd_b, 2, block );
+  }
+
+  rv = close( fd_a );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd_b );
+  rtems_test_assert( rv == 0 );
+
+  /* The reservations are returned when the files are closed */
+  rtems_test_assert(
+    free_blocks() + ( 2 * INTERLEAVED_BLOCKS ) + 2 >= free_before
+  );
+
+  test_unmount();
+  test_mount();
+
+  check_file( file_a, 1, INTERLEAVED_BLOCKS );
+  check_file( file_b, 2, INTERLEAVED_BLOCKS );
+
+  rv = unlink( file_a );
+  rtems_test_assert( rv == 0 );
+
+  rv = unlink( file_b );
+  rtems_test_assert( rv == 0 );
+
+  rtems_test_assert( free_blocks() == free_before );
+}
+
+static void test_truncate( void )
+{
+  fsblkcnt_t free_before;
+  size_t     block;
+  int        fd;
+  int        rv;
+
+  puts( "Truncate" );
+
+  free_before = free_blocks();
+
+  fd = open( file_a, O_RDWR | O_CREAT | O_TRUNC, S_IRWXU );
+  rtems_test_assert( fd >= 0 );
+
+  for ( block = 0; block < LARGE_BLOCKS; ++block ) {
+    write_block( fd, 3, block );
+  }
+
+  rv = ftruncate( fd, 10 * BLOCK_SIZE );
+  rtems_test_assert( rv == 0 );
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  check_file( file_a, 3, 10 );
+
+  fd = open( file_a, O_RDWR | O_APPEND );
+  rtems_test_assert( fd >= 0 );
+
+  for ( block = 10; block < LARGE_BLOCKS; ++block ) {
+    write_block( fd, 3, block );
+  }
+
+  rv = close( fd );
+  rtems_test_assert( rv == 0 );
+
+  check_file( file_a, 3, LARGE_BLOCKS );
+
+  rv = truncate( file_a, 0 );
+  rtems_test_assert( rv == 0 );
+
+  check_file( file_a, 3, 0 );
+
+  rv = unlink( file_a );
+  rtems_test_assert( rv == 0 );
+
+  rtems_test_assert( free_blocks() == free_before );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  int rv;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  rv = mkdir( mnt, S_IRWXU | S_IRWXG | S_IRWXO );
+  rtems_test_assert( rv == 0 );
+
+  rv = rtems_rfs_format( rda, &rfs_config );
+  rtems_test_assert( rv == 0 );
+
+  test_mount();
+  test_interleaved();
+  test_truncate();
+  test_unmount();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+rtems_ramdisk_config rtems_ramdisk_configuration[] = {
+  { .block_size = BLOCK_SIZE, .block_num = 4096 }
+};
+
+size_t rtems_ramdisk_configuration_size = 1;
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_EXTRA_DRIVERS RAMDISK_DRIVER_TABLE_ENTRY
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 6
+
+#define CONFIGURE_FILESYSTEM_RFS
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS (8 * 1024)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
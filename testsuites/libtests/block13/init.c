@@ -188,8 +188,8 @@ static void test_read_ahead(rtems_disk_device *dd)
       memset(&block_access_counts, 0, sizeof(block_access_counts));
     }
 
-    rtems_test_assert(trigger [i] == dd->read_ahead.trigger);
-    rtems_test_assert(next [i] == dd->read_ahead.next);
+    rtems_test_assert(trigger [i] == dd->read_ahead.streams [0].trigger);
+    rtems_test_assert(next [i] == dd->read_ahead.streams [0].next);
   }
 
   printf("\n");
@@ -0,0 +1,300 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+#include <rtems/blkdev.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "BLOCK 18";
+
+#define ASSERT_SC(sc) rtems_test_assert((sc) == RTEMS_SUCCESSFUL)
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 256
+
+#define WORKER_COUNT 3
+
+#define BLOCKS_PER_WORKER (BLOCK_COUNT / (WORKER_COUNT + 1))
+
+#define EVENT_DONE RTEMS_EVENT_0
+
+static const char device[] = "/dev/rda";
+
+static unsigned char disk[BLOCK_COUNT][BLOCK_SIZE];
+
+static rtems_disk_device *dd;
+
+static rtems_id init_task;
+
+static unsigned char pattern(rtems_blkdev_bnum block, size_t i)
+{
+  return (unsigned char) (block * 7 + i);
+}
+
+static void write_blocks(rtems_blkdev_bnum begin, rtems_blkdev_bnum end)
+{
+  rtems_blkdev_bnum block;
+
+  for (block = begin; block < end; ++block) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+    size_t i;
+
+    sc = rtems_bdbuf_get(dd, block, &bd);
+    ASSERT_SC(sc);
+
+    for (i = 0; i < BLOCK_SIZE; ++i) {
+      bd->buffer[i] = pattern(block, i);
+    }
+
+    sc = rtems_bdbuf_release_modified(bd);
+    ASSERT_SC(sc);
+  }
+
+  for (block = begin; block < end; ++block) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_read(dd, block, &bd);
+    ASSERT_SC(sc);
+    rtems_test_assert(bd->buffer[0] == pattern(block, 0));
+
+    sc = rtems_bdbuf_release(bd);
+    ASSERT_SC(sc);
+  }
+}
+
+static void worker(rtems_task_argument arg)
+{
+  rtems_blkdev_bnum begin = (rtems_blkdev_bnum) arg * BLOCKS_PER_WORKER;
+  rtems_status_code sc;
+
+  write_blocks(begin, begin + BLOCKS_PER_WORKER);
+
+  sc = rtems_event_send(init_task, EVENT_DONE);
+  ASSERT_SC(sc);
+
+  rtems_task_exit();
+}
+
+static void create_disk(void)
+{
+  rtems_status_code sc;
+  ramdisk *rd;
+  int fd;
+  int rv;
+
+  rd = ramdisk_allocate(disk, BLOCK_SIZE, BLOCK_COUNT, false);
+  rtems_test_assert(rd != NULL);
+
+  sc = rtems_blkdev_create(device, BLOCK_SIZE, BLOCK_COUNT, ramdisk_ioctl, rd);
+  ASSERT_SC(sc);
+
+  fd = open(device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_concurrent_writes(void)
+{
+  rtems_status_code sc;
+  rtems_event_set events;
+  rtems_blkdev_bnum block;
+  rtems_task_argument w;
+
+  puts("concurrent writes");
+
+  init_task = rtems_task_self();
+
+  for (w = 0; w < WORKER_COUNT; ++w) {
+    rtems_id id;
+
+    sc = rtems_task_create(
+      rtems_build_name('W', 'O', 'R', 'K'),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &id
+    );
+    ASSERT_SC(sc);
+
+    sc = rtems_task_start(id, worker, w + 1);
+    ASSERT_SC(sc);
+  }
+
+  write_blocks(0, BLOCKS_PER_WORKER);
+
+  for (w = 0; w < WORKER_COUNT; ++w) {
+    sc = rtems_event_receive(
+      EVENT_DONE,
+      RTEMS_EVENT_ALL | RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT,
+      &events
+    );
+    ASSERT_SC(sc);
+  }
+
+  sc = rtems_bdbuf_syncdev(dd);
+  ASSERT_SC(sc);
+
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    size_t i;
+
+    for (i = 0; i < BLOCK_SIZE; ++i) {
+      rtems_test_assert(disk[block][i] == pattern(block, i));
+    }
+  }
+}
+
+static void test_purge(void)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+  rtems_blkdev_stats stats;
+
+  puts("purge");
+
+  /* Let the read-ahead task finish the requests of the previous test */
+  sc = rtems_task_wake_after(2);
+  ASSERT_SC(sc);
+
+  rtems_bdbuf_purge_dev(dd);
+  rtems_bdbuf_reset_device_stats(dd);
+
+  disk[1][0] = 0xff;
+
+  sc = rtems_bdbuf_read(dd, 1, &bd);
+  ASSERT_SC(sc);
+  rtems_test_assert(bd->buffer[0] == 0xff);
+
+  sc = rtems_bdbuf_release(bd);
+  ASSERT_SC(sc);
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_hits == 0);
+  rtems_test_assert(stats.read_misses == 1);
+}
+
+static void test_peek_across_shards(void)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum block;
+  int retries;
+
+  puts("peek across shards");
+
+  rtems_bdbuf_purge_dev(dd);
+  rtems_bdbuf_reset_device_stats(dd);
+
+  /*
+   * Blocks 60 up to 63 and 64 up to 67 belong to different runs of blocks and
+   * thus the peek is carried out by two read-ahead transfers.
+   */
+  rtems_bdbuf_peek(dd, 60, 8);
+
+  retries = 100;
+  do {
+    rtems_status_code sc;
+
+    sc = rtems_task_wake_after(1);
+    ASSERT_SC(sc);
+
+    rtems_bdbuf_get_device_stats(dd, &stats);
+    --retries;
+  } while (stats.read_ahead_peeks < 2 && retries > 0);
+
+  rtems_test_assert(stats.read_ahead_peeks == 2);
+  rtems_test_assert(stats.read_ahead_transfers == 2);
+  rtems_test_assert(stats.read_blocks == 8);
+
+  for (block = 60; block < 68; ++block) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_read(dd, block, &bd);
+    ASSERT_SC(sc);
+    rtems_test_assert(bd->buffer[1] == pattern(block, 1));
+
+    sc = rtems_bdbuf_release(bd);
+    ASSERT_SC(sc);
+  }
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_hits == 8);
+  rtems_test_assert(stats.read_misses == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  create_disk();
+  test_concurrent_writes();
+  test_purge();
+  test_peek_across_shards();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (32 * BLOCK_SIZE)
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 8
+#define CONFIGURE_BDBUF_SHARD_COUNT 4
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + WORKER_COUNT)
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
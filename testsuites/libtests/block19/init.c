@@ -0,0 +1,174 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <rtems/bdbuf.h>
+#include <rtems/blkdev.h>
+#include <rtems/counter.h>
+#include <rtems/ramdisk.h>
+
+const char rtems_test_name[] = "BLOCK 19";
+
+#define ASSERT_SC(sc) rtems_test_assert((sc) == RTEMS_SUCCESSFUL)
+
+#define BLOCK_SIZE 128
+
+#define BLOCK_COUNT 2048
+
+#define REPETITIONS 4
+
+static const char device[] = "/dev/rda";
+
+static const rtems_blkdev_bnum cache_sizes[] = { 16, 128, 512, BLOCK_COUNT };
+
+static rtems_disk_device *dd;
+
+static void create_disk(void)
+{
+  rtems_status_code sc;
+  ramdisk *rd;
+  int fd;
+  int rv;
+
+  rd = ramdisk_allocate(NULL, BLOCK_SIZE, BLOCK_COUNT, false);
+  rtems_test_assert(rd != NULL);
+
+  sc = rtems_blkdev_create(device, BLOCK_SIZE, BLOCK_COUNT, ramdisk_ioctl, rd);
+  ASSERT_SC(sc);
+
+  fd = open(device, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+}
+
+static void fill_cache(rtems_blkdev_bnum block_count)
+{
+  rtems_blkdev_bnum block;
+
+  for (block = 0; block < block_count; ++block) {
+    rtems_status_code sc;
+    rtems_bdbuf_buffer *bd;
+
+    sc = rtems_bdbuf_get(dd, block, &bd);
+    ASSERT_SC(sc);
+
+    sc = rtems_bdbuf_release(bd);
+    ASSERT_SC(sc);
+  }
+}
+
+static void measure_lookups(rtems_blkdev_bnum block_count)
+{
+  rtems_counter_ticks t0;
+  rtems_counter_ticks d;
+  rtems_blkdev_stats stats;
+  uint64_t ns;
+  int r;
+
+  rtems_bdbuf_purge_dev(dd);
+  fill_cache(block_count);
+  rtems_bdbuf_reset_device_stats(dd);
+
+  t0 = rtems_counter_read();
+
+  for (r = 0; r < REPETITIONS; ++r) {
+    rtems_blkdev_bnum block;
+
+    for (block = 0; block < block_count; ++block) {
+      rtems_status_code sc;
+      rtems_bdbuf_buffer *bd;
+
+      sc = rtems_bdbuf_read(dd, block, &bd);
+      ASSERT_SC(sc);
+
+      sc = rtems_bdbuf_release(bd);
+      ASSERT_SC(sc);
+    }
+  }
+
+  d = rtems_counter_difference(rtems_counter_read(), t0);
+  ns = rtems_counter_ticks_to_nanoseconds(d);
+
+  /* Every lookup must be a cache hit, otherwise the transfers are measured */
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_hits == REPETITIONS * block_count);
+  rtems_test_assert(stats.read_misses == 0);
+
+  printf(
+    "cached blocks %4" PRIu32 ": %" PRIu64 " ns per read and release\n",
+    (uint32_t) block_count,
+    ns / (REPETITIONS * block_count)
+  );
+}
+
+static void Init(rtems_task_argument arg)
+{
+  size_t i;
+
+  TEST_BEGIN();
+
+  create_disk();
+
+  for (i = 0; i < RTEMS_ARRAY_SIZE(cache_sizes); ++i) {
+    measure_lookups(cache_sizes[i]);
+  }
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE BLOCK_SIZE
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE (BLOCK_COUNT * BLOCK_SIZE)
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,235 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 20";
+
+#define BLOCK_COUNT 64
+
+#define DISK_PATH "/disk"
+
+static int block_access_counts [BLOCK_COUNT];
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t i;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_READ);
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_bnum block = sg [i].block;
+
+      rtems_test_assert(block < BLOCK_COUNT);
+
+      ++block_access_counts [block];
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void read_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void reset(rtems_disk_device *dd)
+{
+  rtems_bdbuf_purge_dev(dd);
+  rtems_bdbuf_reset_device_stats(dd);
+  memset(&block_access_counts, 0, sizeof(block_access_counts));
+}
+
+static void test_interleaved_streams(rtems_disk_device *dd)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum block;
+
+  puts("interleaved streams");
+
+  reset(dd);
+
+  /*
+   * Two sequential streams are read alternately.  Each stream triggers its
+   * own read-ahead requests.
+   */
+  for (block = 0; block < 6; ++block) {
+    read_block(dd, block);
+    read_block(dd, 32 + block);
+  }
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 4);
+  rtems_test_assert(stats.read_hits == 8);
+  rtems_test_assert(stats.read_ahead_transfers == 4);
+  rtems_test_assert(stats.read_ahead_hits == 8);
+  rtems_test_assert(stats.read_blocks == 20);
+  rtems_test_assert(stats.read_ahead_waste == 0);
+
+  for (block = 0; block < 10; ++block) {
+    rtems_test_assert(block_access_counts [block] == 1);
+    rtems_test_assert(block_access_counts [32 + block] == 1);
+  }
+
+  rtems_test_assert(block_access_counts [10] == 0);
+  rtems_test_assert(block_access_counts [42] == 0);
+
+  /* The blocks 6 up to 9 and 38 up to 41 were read ahead but not used */
+  rtems_bdbuf_purge_dev(dd);
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_ahead_waste == 8);
+}
+
+static void test_strided_stream(rtems_disk_device *dd)
+{
+  rtems_blkdev_stats stats;
+  rtems_blkdev_bnum block;
+
+  puts("strided stream");
+
+  reset(dd);
+
+  /* The third access with the same distance detects the stride */
+  read_block(dd, 0);
+  read_block(dd, 4);
+  read_block(dd, 8);
+
+  rtems_test_assert(dd->read_ahead.streams [0].stride == 4);
+
+  for (block = 12; block < 28; block += 4) {
+    read_block(dd, block);
+  }
+
+  rtems_bdbuf_get_device_stats(dd, &stats);
+  rtems_test_assert(stats.read_misses == 3);
+  rtems_test_assert(stats.read_hits == 4);
+  rtems_test_assert(stats.read_ahead_transfers == 2);
+  rtems_test_assert(stats.read_ahead_hits == 4);
+  rtems_test_assert(stats.read_blocks == 11);
+
+  for (block = 0; block < BLOCK_COUNT; ++block) {
+    int expected = (block % 4 == 0 && block < 44) ? 1 : 0;
+
+    rtems_test_assert(block_access_counts [block] == expected);
+  }
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int fd;
+  int rv;
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(DISK_PATH, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  test_interleaved_streams(dd);
+  test_strided_stream(dd);
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BLOCK_COUNT
+#define CONFIGURE_BDBUF_MAX_READ_AHEAD_BLOCKS 4
+#define CONFIGURE_BDBUF_READ_AHEAD_TASK_PRIORITY 1
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+#define CONFIGURE_INIT_TASK_ATTRIBUTES RTEMS_FLOATING_POINT
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,213 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+
+const char rtems_test_name[] = "BLOCK 21";
+
+#define BLOCK_COUNT 512
+
+#define BUFFER_COUNT 16
+
+#define DISK_PATH "/disk"
+
+static int block_access_counts [BLOCK_COUNT];
+
+static int test_disk_ioctl(rtems_disk_device *dd, uint32_t req, void *arg)
+{
+  int rv = 0;
+
+  if (req == RTEMS_BLKIO_REQUEST) {
+    rtems_blkdev_request *breq = arg;
+    rtems_blkdev_sg_buffer *sg = breq->bufs;
+    uint32_t i;
+
+    rtems_test_assert(breq->req == RTEMS_BLKDEV_REQ_READ);
+
+    for (i = 0; i < breq->bufnum; ++i) {
+      rtems_blkdev_bnum block = sg [i].block;
+
+      rtems_test_assert(block < BLOCK_COUNT);
+
+      ++block_access_counts [block];
+    }
+
+    rtems_blkdev_request_done(breq, RTEMS_SUCCESSFUL);
+  } else {
+    rv = rtems_blkdev_ioctl(dd, req, arg);
+  }
+
+  return rv;
+}
+
+static void read_block(rtems_disk_device *dd, rtems_blkdev_bnum block)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_read(dd, block, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+}
+
+static void scan(
+  rtems_disk_device *dd,
+  rtems_blkdev_bnum begin,
+  rtems_blkdev_bnum end
+)
+{
+  rtems_blkdev_bnum block;
+
+  for (block = begin; block < end; ++block) {
+    read_block(dd, block);
+  }
+}
+
+static void test_scan_resistance(rtems_disk_device *dd)
+{
+  rtems_bdbuf_cache_stats stats;
+
+  rtems_bdbuf_reset_cache_stats();
+
+  /* Fill the cache and evict the blocks 0 and 1 from the probationary list */
+  read_block(dd, 0);
+  read_block(dd, 1);
+  scan(dd, 100, 100 + BUFFER_COUNT);
+
+  rtems_bdbuf_get_cache_stats(&stats);
+  rtems_test_assert(stats.hits == 0);
+  rtems_test_assert(stats.misses == BUFFER_COUNT + 2);
+  rtems_test_assert(stats.evictions == 2);
+  rtems_test_assert(stats.promotions == 0);
+
+  /* The blocks 0 and 1 are referenced again and promoted to the hot list */
+  read_block(dd, 0);
+  read_block(dd, 1);
+
+  rtems_bdbuf_get_cache_stats(&stats);
+  rtems_test_assert(stats.promotions == 2);
+  rtems_test_assert(block_access_counts [0] == 2);
+  rtems_test_assert(block_access_counts [1] == 2);
+
+  /* A scan which is four times the cache size passes the probationary list */
+  scan(dd, 200, 200 + 4 * BUFFER_COUNT);
+
+  rtems_bdbuf_reset_cache_stats();
+
+  read_block(dd, 0);
+  read_block(dd, 1);
+
+  rtems_bdbuf_get_cache_stats(&stats);
+  rtems_test_assert(stats.hits == 2);
+  rtems_test_assert(stats.misses == 0);
+  rtems_test_assert(stats.evictions == 0);
+  rtems_test_assert(block_access_counts [0] == 2);
+  rtems_test_assert(block_access_counts [1] == 2);
+
+  /* The blocks of the scan were read once */
+  read_block(dd, 200);
+
+  rtems_bdbuf_get_cache_stats(&stats);
+  rtems_test_assert(stats.misses == 1);
+  rtems_test_assert(stats.promotions == 0);
+  rtems_test_assert(block_access_counts [200] == 2);
+}
+
+static void test(void)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int fd;
+  int rv;
+
+  sc = rtems_blkdev_create(
+    DISK_PATH,
+    1,
+    BLOCK_COUNT,
+    test_disk_ioctl,
+    NULL
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  fd = open(DISK_PATH, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  test_scan_resistance(dd);
+
+  rv = unlink(DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_BDBUF_BUFFER_MIN_SIZE 1
+#define CONFIGURE_BDBUF_BUFFER_MAX_SIZE 1
+#define CONFIGURE_BDBUF_CACHE_MEMORY_SIZE BUFFER_COUNT
+#define CONFIGURE_BDBUF_REPLACEMENT_POLICY RTEMS_BDBUF_POLICY_2Q
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
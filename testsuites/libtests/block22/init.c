@@ -0,0 +1,285 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include "tmacros.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <rtems/bdbuf.h>
+#include <rtems/blkdev.h>
+#include <rtems/ramdisk.h>
+#include <rtems/sparse-disk.h>
+
+const char rtems_test_name[] = "BLOCK 22";
+
+#define BLOCK_SIZE 512
+
+#define BLOCK_COUNT 8
+
+#define QUEUE_DEPTH 3
+
+#define RAMDISK_PATH "/ramdisk"
+
+#define SPARSE_DISK_PATH "/sparse"
+
+typedef struct {
+  rtems_blkdev_request req;
+  rtems_blkdev_sg_buffer buf;
+} test_request;
+
+static test_request requests [QUEUE_DEPTH];
+
+static uint8_t buffers [QUEUE_DEPTH][BLOCK_SIZE];
+
+static size_t completion_order [QUEUE_DEPTH];
+
+static size_t completion_count;
+
+static void request_done(rtems_blkdev_request *req, rtems_status_code status)
+{
+  rtems_test_assert(status == RTEMS_SUCCESSFUL);
+  rtems_test_assert(completion_count < QUEUE_DEPTH);
+
+  completion_order [completion_count] = (size_t) req->done_arg;
+  ++completion_count;
+}
+
+static void submit(
+  rtems_disk_device *dd,
+  size_t index,
+  rtems_blkdev_request_op op
+)
+{
+  test_request *r = &requests [index];
+
+  memset(r, 0, sizeof(*r));
+  r->req.req = op;
+  r->req.done = request_done;
+  r->req.done_arg = (void *) index;
+  r->req.bufnum = 1;
+  r->req.bufs [0].block = index;
+  r->req.bufs [0].length = BLOCK_SIZE;
+  r->req.bufs [0].buffer = &buffers [index][0];
+
+  rtems_blkdev_submit_request(dd, &r->req);
+}
+
+static rtems_disk_device *open_disk(const char *path)
+{
+  rtems_disk_device *dd;
+  uint32_t queue_depth;
+  int fd;
+  int rv;
+
+  fd = open(path, O_RDWR);
+  rtems_test_assert(fd >= 0);
+
+  rv = rtems_disk_fd_get_disk_device(fd, &dd);
+  rtems_test_assert(rv == 0);
+
+  rv = rtems_disk_fd_get_queue_depth(fd, &queue_depth);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(queue_depth == RTEMS_DISK_QUEUE_DEPTH_UNLIMITED);
+
+  rv = rtems_disk_fd_set_queue_depth(fd, QUEUE_DEPTH);
+  rtems_test_assert(rv == 0);
+
+  rv = rtems_disk_fd_get_queue_depth(fd, &queue_depth);
+  rtems_test_assert(rv == 0);
+  rtems_test_assert(queue_depth == QUEUE_DEPTH);
+
+  rv = close(fd);
+  rtems_test_assert(rv == 0);
+
+  return dd;
+}
+
+static void test_out_of_order_completion(rtems_disk_device *dd)
+{
+  size_t i;
+
+  for (i = 0; i < QUEUE_DEPTH; ++i) {
+    memset(&buffers [i][0], (int) ('a' + i), BLOCK_SIZE);
+  }
+
+  /* The requests are held back until the queue is full */
+  completion_count = 0;
+  submit(dd, 0, RTEMS_BLKDEV_REQ_WRITE);
+  submit(dd, 1, RTEMS_BLKDEV_REQ_WRITE);
+  rtems_test_assert(completion_count == 0);
+
+  submit(dd, 2, RTEMS_BLKDEV_REQ_WRITE);
+  rtems_test_assert(completion_count == 3);
+  rtems_test_assert(completion_order [0] == 2);
+  rtems_test_assert(completion_order [1] == 1);
+  rtems_test_assert(completion_order [2] == 0);
+
+  memset(&buffers [0][0], 0, sizeof(buffers));
+
+  /* The requests are held back until the disk is unplugged */
+  completion_count = 0;
+  submit(dd, 0, RTEMS_BLKDEV_REQ_READ);
+  submit(dd, 1, RTEMS_BLKDEV_REQ_READ);
+  rtems_test_assert(completion_count == 0);
+
+  rtems_blkdev_unplug(dd);
+  rtems_test_assert(completion_count == 2);
+  rtems_test_assert(completion_order [0] == 1);
+  rtems_test_assert(completion_order [1] == 0);
+
+  rtems_test_assert(buffers [0][0] == 'a');
+  rtems_test_assert(buffers [0][BLOCK_SIZE - 1] == 'a');
+  rtems_test_assert(buffers [1][0] == 'b');
+  rtems_test_assert(buffers [1][BLOCK_SIZE - 1] == 'b');
+
+  /* Nothing is held back after an unplug */
+  rtems_blkdev_unplug(dd);
+  rtems_test_assert(completion_count == 2);
+}
+
+static void test_bdbuf(rtems_disk_device *dd)
+{
+  rtems_status_code sc;
+  rtems_bdbuf_buffer *bd;
+
+  sc = rtems_bdbuf_get(dd, BLOCK_COUNT - 1, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  memset(bd->buffer, 'x', BLOCK_SIZE);
+
+  sc = rtems_bdbuf_sync(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_bdbuf_purge_dev(dd);
+
+  sc = rtems_bdbuf_read(dd, BLOCK_COUNT - 1, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(bd->buffer [0] == 'x');
+  rtems_test_assert(bd->buffer [BLOCK_SIZE - 1] == 'x');
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  sc = rtems_bdbuf_read(dd, 2, &bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  rtems_test_assert(bd->buffer [0] == 'c');
+
+  sc = rtems_bdbuf_release(bd);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  rtems_bdbuf_purge_dev(dd);
+}
+
+static void test_ramdisk(void)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  ramdisk *rd;
+  int rv;
+
+  puts("ramdisk");
+
+  rd = ramdisk_allocate(NULL, BLOCK_SIZE, BLOCK_COUNT, false);
+  rtems_test_assert(rd != NULL);
+
+  rd->free_at_delete_request = true;
+
+  sc = rtems_blkdev_create(
+    RAMDISK_PATH,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    ramdisk_ioctl,
+    rd
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  dd = open_disk(RAMDISK_PATH);
+  test_out_of_order_completion(dd);
+  test_bdbuf(dd);
+
+  rv = unlink(RAMDISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void test_sparse_disk(void)
+{
+  rtems_status_code sc;
+  rtems_disk_device *dd;
+  int rv;
+
+  puts("sparse disk");
+
+  sc = rtems_sparse_disk_create_and_register(
+    SPARSE_DISK_PATH,
+    BLOCK_SIZE,
+    BLOCK_COUNT,
+    BLOCK_COUNT,
+    0
+  );
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  dd = open_disk(SPARSE_DISK_PATH);
+  test_out_of_order_completion(dd);
+  test_bdbuf(dd);
+
+  rv = unlink(SPARSE_DISK_PATH);
+  rtems_test_assert(rv == 0);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  test_ramdisk();
+  test_sparse_disk();
+
+  TEST_END();
+
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_LIBBLOCK
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 4
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,249 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <rtems/libcsupport.h>
+#include <rtems/malloc.h>
+#include <rtems/score/threaddispatch.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+const char rtems_test_name[] = "MALLOC 5";
+
+static void *do_malloc( size_t size )
+{
+  void *p;
+
+  p = malloc( size );
+  RTEMS_OBFUSCATE_VARIABLE( p );
+  rtems_test_assert( p != NULL );
+
+  return p;
+}
+
+static void do_free( void *p )
+{
+  RTEMS_OBFUSCATE_VARIABLE( p );
+  free( p );
+}
+
+static void get_info( Heap_Information_block *info )
+{
+  int rv;
+
+  rv = malloc_info( info );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_cache_hit( void )
+{
+  Heap_Information_block info;
+  void *p;
+  void *q;
+
+  puts( "Cache hit" );
+
+  rtems_malloc_cache_flush();
+  get_info( &info );
+  rtems_test_assert( info.Cached.number == 0 );
+  rtems_test_assert( info.Cached.total == 0 );
+
+  /* The refill puts the remaining objects of the batch into the cache */
+  p = do_malloc( 24 );
+  get_info( &info );
+  rtems_test_assert( info.Cached.number > 0 );
+  rtems_test_assert( info.Cached.total > 0 );
+  rtems_test_assert( info.Cached.largest > 0 );
+
+  do_free( p );
+  q = do_malloc( 24 );
+  rtems_test_assert( p == q );
+
+  do_free( q );
+  rtems_malloc_cache_flush();
+  get_info( &info );
+  rtems_test_assert( info.Cached.number == 0 );
+}
+
+static void test_size_classes( void )
+{
+  void *p[ 8 ];
+  size_t size;
+  size_t i;
+
+  puts( "Size classes" );
+
+  size = 1;
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( p ); ++i ) {
+    p[ i ] = do_malloc( size );
+    memset( p[ i ], 0, size );
+    size *= 3;
+  }
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( p ); ++i ) {
+    do_free( p[ i ] );
+  }
+
+  rtems_malloc_cache_flush();
+}
+
+static void test_drain( void )
+{
+  void *p[ 100 ];
+  size_t i;
+
+  puts( "Drain full magazines" );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( p ); ++i ) {
+    p[ i ] = do_malloc( 100 );
+  }
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( p ); ++i ) {
+    do_free( p[ i ] );
+  }
+
+  rtems_malloc_cache_flush();
+}
+
+static void test_remote_free( void )
+{
+  Heap_Information_block info;
+  Per_CPU_Control *cpu_self;
+  void *p;
+  void *q;
+
+  puts( "Remote free" );
+
+  rtems_malloc_cache_flush();
+  p = do_malloc( 200 );
+  rtems_malloc_cache_flush();
+
+  get_info( &info );
+  rtems_test_assert( info.Cached.number == 0 );
+
+  /* With thread dispatching disabled, the free is deferred */
+  cpu_self = _Thread_Dispatch_disable();
+  do_free( p );
+  _Thread_Dispatch_enable( cpu_self );
+
+  get_info( &info );
+  rtems_test_assert( info.Cached.number == 0 );
+
+  /* The next allocation moves the remote free to the cache and uses it */
+  q = do_malloc( 200 );
+  rtems_test_assert( p == q );
+
+  do_free( q );
+  rtems_malloc_cache_flush();
+}
+
+static void test_realloc( void )
+{
+  char *p;
+  char *q;
+  size_t i;
+
+  puts( "Resize cached areas" );
+
+  p = do_malloc( 20 );
+  memset( p, 0x5a, 20 );
+
+  /* The size class area is large enough */
+  q = realloc( p, 32 );
+  rtems_test_assert( q == p );
+
+  q = realloc( p, 300 );
+  RTEMS_OBFUSCATE_VARIABLE( q );
+  rtems_test_assert( q != NULL );
+
+  for ( i = 0; i < 20; ++i ) {
+    rtems_test_assert( q[ i ] == 0x5a );
+  }
+
+  do_free( q );
+  rtems_malloc_cache_flush();
+}
+
+static void test_free_to_heap( void )
+{
+  Heap_Information_block info;
+  void *p;
+  int rv;
+
+  puts( "Free areas not handed out by the cache" );
+
+  rtems_malloc_cache_flush();
+
+  rv = posix_memalign( &p, 64, 24 );
+  rtems_test_assert( rv == 0 );
+  do_free( p );
+
+  get_info( &info );
+  rtems_test_assert( info.Cached.number == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  rtems_resource_snapshot snapshot;
+
+  TEST_BEGIN();
+
+  rtems_resource_snapshot_take( &snapshot );
+
+  test_cache_hit();
+  test_size_classes();
+  test_drain();
+  test_remote_free();
+  test_realloc();
+  test_free_to_heap();
+
+  rtems_test_assert( rtems_resource_snapshot_check( &snapshot ) );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MALLOC_PER_CPU_CACHE
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
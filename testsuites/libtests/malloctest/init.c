@@ -1109,6 +1109,91 @@ static void test_heap_no_extend(void)
   rtems_test_assert( extended_space == 0 );
 }
 
+static uint8_t SegregatedFitHeapMemory[ 16384 ];
+
+static void test_heap_segregated_fit(void)
+{
+  Heap_Control *heap = &TestHeap;
+  uint8_t *area_begin = SegregatedFitHeapMemory;
+  uintptr_t area_size = sizeof( SegregatedFitHeapMemory ) / 2;
+  Heap_Information_block info;
+  Heap_Resize_status rsc;
+  uintptr_t old_size;
+  uintptr_t new_size;
+  uintptr_t rv;
+  bool ret;
+  void *p1;
+  void *p2;
+  void *p3;
+  void *p4;
+  void *p5;
+
+  puts( "heap segregated fit - area too small" );
+  rv = _Heap_Initialize_segregated_fit(
+    heap,
+    area_begin,
+    sizeof( Heap_Segregated_fit_index ),
+    0
+  );
+  rtems_test_assert( rv == 0 );
+
+  puts( "heap segregated fit - initialize" );
+  rv = _Heap_Initialize_segregated_fit( heap, area_begin, area_size, 0 );
+  rtems_test_assert( rv > 0 );
+  rtems_test_assert( rv < area_size );
+  rtems_test_assert( _Heap_Is_segregated_fit( heap ) );
+  test_heap_assert( true, true );
+
+  p1 = _Heap_Allocate( heap, 1000 );
+  rtems_test_assert( p1 != NULL );
+  p2 = _Heap_Allocate( heap, 16 );
+  rtems_test_assert( p2 != NULL );
+  p3 = _Heap_Allocate( heap, 64 );
+  rtems_test_assert( p3 != NULL );
+  p4 = _Heap_Allocate( heap, 16 );
+  rtems_test_assert( p4 != NULL );
+  test_heap_assert( true, true );
+
+  /*
+   * In first fit mode, the next allocation would be carved from the first
+   * (and larger) free block.  In segregated fit mode, the free block of the
+   * smallest size class which is large enough is used.
+   */
+  puts( "heap segregated fit - allocate from smallest size class" );
+  test_free( p1 );
+  test_free( p3 );
+  test_heap_assert( true, true );
+  p5 = _Heap_Allocate( heap, 16 );
+  rtems_test_assert( p5 != NULL );
+  rtems_test_assert( (uintptr_t) p5 - (uintptr_t) p3 < 64 );
+  test_heap_assert( true, true );
+
+  puts( "heap segregated fit - aligned allocation" );
+  p3 = _Heap_Allocate_aligned_with_boundary( heap, 100, 256, 0 );
+  rtems_test_assert( p3 != NULL );
+  rtems_test_assert( ( (uintptr_t) p3 % 256 ) == 0 );
+  test_heap_assert( true, true );
+
+  puts( "heap segregated fit - resize block" );
+  rsc = _Heap_Resize_block( heap, p4, 512, &old_size, &new_size );
+  rtems_test_assert( rsc == HEAP_RESIZE_SUCCESSFUL );
+  test_heap_assert( true, true );
+
+  puts( "heap segregated fit - extend" );
+  ret = _Protected_heap_Extend( heap, area_begin + area_size, 2048 );
+  test_heap_assert( ret, true );
+
+  test_free( p2 );
+  test_free( p3 );
+  test_free( p4 );
+  test_free( p5 );
+  test_heap_assert( true, true );
+
+  _Heap_Get_information( heap, &info );
+  rtems_test_assert( info.Used.number == 0 );
+  rtems_test_assert( info.Free.number == 1 );
+}
+
 static void free_all_delayed_blocks( void )
 {
   rtems_resource_snapshot unused;
@@ -1451,6 +1536,7 @@ rtems_task Init(
   test_heap_extend_allocation_order();
   test_heap_extend_allocation_order_with_empty_heap();
   test_heap_no_extend();
+  test_heap_segregated_fit();
   test_heap_info();
   test_heap_size_with_overhead();
   test_protected_heap_info();
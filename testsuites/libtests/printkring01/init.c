@@ -0,0 +1,210 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <rtems/bspIo.h>
+#include <rtems/printer.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <unistd.h>
+
+const char rtems_test_name[] = "PRINTKRING 1";
+
+#define RING_SIZE 1024
+
+#define BUFFER_COUNT 2
+
+#define BUFFER_SIZE 128
+
+#define LOG_FILE "/log"
+
+typedef struct {
+  rtems_printer_task_context printer_task;
+  rtems_printer              printer;
+  int                        fd;
+  off_t                      offset;
+  char                       buffers[ BUFFER_COUNT ][ BUFFER_SIZE ];
+  char                       content[ 4096 ];
+} test_context;
+
+static test_context test_instance;
+
+static const char *read_new_content( test_context *ctx )
+{
+  ssize_t n;
+
+  rtems_printer_task_drain( &ctx->printer_task );
+
+  n = pread(
+    ctx->fd,
+    &ctx->content[ 0 ],
+    sizeof( ctx->content ) - 1,
+    ctx->offset
+  );
+  rtems_test_assert( n >= 0 );
+  ctx->content[ n ] = '\0';
+  ctx->offset += n;
+
+  return &ctx->content[ 0 ];
+}
+
+static void test_start( test_context *ctx )
+{
+  int eno;
+
+  ctx->fd = open( LOG_FILE, O_RDWR | O_CREAT | O_TRUNC, 0666 );
+  rtems_test_assert( ctx->fd >= 0 );
+
+  rtems_printer_task_initialize( &ctx->printer_task );
+  rtems_printer_task_set_priority( &ctx->printer_task, 2 );
+  rtems_printer_task_set_stack_size(
+    &ctx->printer_task,
+    RTEMS_MINIMUM_STACK_SIZE
+  );
+  rtems_printer_task_set_file_descriptor( &ctx->printer_task, ctx->fd );
+  rtems_printer_task_set_buffer_table( &ctx->printer_task, ctx->buffers );
+  rtems_printer_task_set_buffer_count( &ctx->printer_task, BUFFER_COUNT );
+  rtems_printer_task_set_buffer_size( &ctx->printer_task, BUFFER_SIZE );
+
+  eno = rtems_printk_ring_start( &ctx->printer, &ctx->printer_task, 1000 );
+  rtems_test_assert( eno == EINVAL );
+
+  eno = rtems_printk_ring_start( &ctx->printer, &ctx->printer_task, 16 );
+  rtems_test_assert( eno == EINVAL );
+
+  eno = rtems_printk_ring_start(
+    &ctx->printer,
+    &ctx->printer_task,
+    RING_SIZE
+  );
+  rtems_test_assert( eno == 0 );
+
+  eno = rtems_printk_ring_start(
+    &ctx->printer,
+    &ctx->printer_task,
+    RING_SIZE
+  );
+  rtems_test_assert( eno == EBUSY );
+}
+
+static void test_order( test_context *ctx )
+{
+  printk( "a%i\n", 1 );
+  putk( "b" );
+  rtems_printf( &ctx->printer, "c%s\n", "2" );
+
+  rtems_test_assert( strcmp( read_new_content( ctx ), "a1\nb\nc2\n" ) == 0 );
+}
+
+static void test_long_output( test_context *ctx )
+{
+  char        line[ 301 ];
+  const char *content;
+
+  memset( line, 'x', sizeof( line ) - 1 );
+  line[ sizeof( line ) - 1 ] = '\0';
+
+  printk( "%s\n", line );
+
+  content = read_new_content( ctx );
+  rtems_test_assert( strlen( content ) == sizeof( line ) );
+  rtems_test_assert( strncmp( content, line, sizeof( line ) - 1 ) == 0 );
+  rtems_test_assert( content[ sizeof( line ) - 1 ] == '\n' );
+}
+
+static void test_dropped( test_context *ctx )
+{
+  const char *content;
+  int         i;
+
+  /*
+   * The printer task has a lower priority, so it cannot drain the ring buffer
+   * in between.
+   */
+  for ( i = 0; i < RING_SIZE; ++i ) {
+    printk( "%i\n", i );
+  }
+
+  content = read_new_content( ctx );
+  rtems_test_assert(
+    strstr( content, "RECORDS DROPPED ON PROCESSOR 0" ) != NULL
+  );
+  rtems_test_assert( strstr( content, "\n0\n1\n2\n" ) != NULL );
+  rtems_test_assert( strstr( content, "1023\n" ) == NULL );
+
+  printk( "d\n" );
+  rtems_test_assert( strcmp( read_new_content( ctx ), "d\n" ) == 0 );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context      *ctx;
+  rtems_status_code  sc;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  test_start( ctx );
+  test_order( ctx );
+  test_long_output( ctx );
+  test_dropped( ctx );
+
+  /*
+   * The end of test message is written into the ring buffer.  The printer task
+   * is suspended, so it is output synchronously through the fatal error
+   * fallback.
+   */
+  sc = rtems_task_suspend( ctx->printer_task.task );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_FILE_DESCRIPTORS 5
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
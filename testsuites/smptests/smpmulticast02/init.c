@@ -0,0 +1,341 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems/score/smpimpl.h>
+#include <rtems/score/atomic.h>
+#include <rtems/score/threaddispatch.h>
+#include <rtems/counter.h>
+#include <rtems.h>
+
+#include <rtems/test.h>
+#include <tmacros.h>
+
+#define CPU_COUNT 32
+
+#define ACTION_COUNT 16
+
+#define SAMPLE_COUNT 100
+
+const char rtems_test_name[] = "SMPMULTICAST 2";
+
+typedef struct {
+  Atomic_Uint                  counter[ CPU_COUNT ];
+  unsigned int                 order[ CPU_COUNT ][ ACTION_COUNT ];
+  unsigned int                 next[ CPU_COUNT ];
+  SMP_Multicast_action_control actions[ ACTION_COUNT ];
+  SMP_Multicast_batch          batch;
+  Processor_mask               targets;
+} test_context;
+
+static test_context test_instance;
+
+static void count_action( void *arg )
+{
+  test_context *ctx;
+  uint32_t      self;
+
+  ctx = arg;
+  self = rtems_scheduler_get_processor();
+  _Atomic_Fetch_add_uint( &ctx->counter[ self ], 1, ATOMIC_ORDER_RELAXED );
+}
+
+static void order_action( void *arg )
+{
+  test_context *ctx;
+  uint32_t      self;
+  size_t        action_index;
+
+  ctx = &test_instance;
+  self = rtems_scheduler_get_processor();
+  action_index = (size_t) (uintptr_t) arg;
+  ctx->order[ self ][ ctx->next[ self ] ] = (unsigned int) action_index;
+  ++ctx->next[ self ];
+}
+
+static void prepare( test_context *ctx )
+{
+  uint32_t cpu_index;
+
+  for ( cpu_index = 0; cpu_index < CPU_COUNT; ++cpu_index ) {
+    _Atomic_Store_uint( &ctx->counter[ cpu_index ], 0, ATOMIC_ORDER_RELAXED );
+    ctx->next[ cpu_index ] = 0;
+  }
+
+  _Processor_mask_Assign( &ctx->targets, _SMP_Get_online_processors() );
+}
+
+static void check_counters( test_context *ctx, unsigned int expected )
+{
+  uint32_t cpu_index;
+  uint32_t cpu_max;
+
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    unsigned int count;
+
+    count = _Atomic_Load_uint( &ctx->counter[ cpu_index ], ATOMIC_ORDER_RELAXED );
+
+    if ( _Processor_mask_Is_set( &ctx->targets, cpu_index ) ) {
+      T_quiet_eq_uint( count, expected );
+    } else {
+      T_quiet_eq_uint( count, 0 );
+    }
+  }
+}
+
+T_TEST_CASE( MulticastPost )
+{
+  test_context    *ctx;
+  Per_CPU_Control *cpu_self;
+
+  ctx = &test_instance;
+  prepare( ctx );
+
+  cpu_self = _Thread_Dispatch_disable();
+  _SMP_Multicast_action_post(
+    &ctx->actions[ 0 ],
+    &ctx->targets,
+    count_action,
+    ctx
+  );
+  _SMP_Multicast_action_wait( &ctx->actions[ 0 ] );
+  T_true( _SMP_Multicast_action_is_done( &ctx->actions[ 0 ] ) );
+  _Thread_Dispatch_enable( cpu_self );
+
+  check_counters( ctx, 1 );
+}
+
+T_TEST_CASE( MulticastPostAndPoll )
+{
+  test_context    *ctx;
+  Per_CPU_Control *cpu_self;
+  Processor_mask   targets;
+
+  ctx = &test_instance;
+  prepare( ctx );
+
+  /* The current processor carries out its job when interrupts are enabled */
+  cpu_self = _Thread_Dispatch_disable();
+  _Processor_mask_Zero( &targets );
+  _Processor_mask_Set( &targets, _Per_CPU_Get_index( cpu_self ) );
+  _Processor_mask_Assign( &ctx->targets, &targets );
+  _SMP_Multicast_action_post( &ctx->actions[ 0 ], &targets, count_action, ctx );
+
+  while ( !_SMP_Multicast_action_is_done( &ctx->actions[ 0 ] ) ) {
+    /* Wait */
+  }
+
+  _Thread_Dispatch_enable( cpu_self );
+
+  check_counters( ctx, 1 );
+}
+
+T_TEST_CASE( MulticastBatch )
+{
+  test_context    *ctx;
+  Per_CPU_Control *cpu_self;
+  uint32_t         cpu_index;
+  uint32_t         cpu_max;
+  size_t           i;
+
+  ctx = &test_instance;
+  prepare( ctx );
+
+  cpu_self = _Thread_Dispatch_disable();
+  _SMP_Multicast_batch_initialize( &ctx->batch );
+
+  for ( i = 0; i < ACTION_COUNT; ++i ) {
+    _SMP_Multicast_batch_add(
+      &ctx->batch,
+      &ctx->actions[ i ],
+      &ctx->targets,
+      order_action,
+      (void *) (uintptr_t) i
+    );
+  }
+
+  _SMP_Multicast_batch_submit( &ctx->batch );
+  T_true( _Processor_mask_Is_zero( &ctx->batch.targets ) );
+
+  for ( i = 0; i < ACTION_COUNT; ++i ) {
+    _SMP_Multicast_action_wait( &ctx->actions[ i ] );
+  }
+
+  _Thread_Dispatch_enable( cpu_self );
+
+  /* The actions are carried out in the order of the additions */
+  cpu_max = rtems_scheduler_get_processor_maximum();
+
+  for ( cpu_index = 0; cpu_index < cpu_max; ++cpu_index ) {
+    if ( _Processor_mask_Is_set( &ctx->targets, cpu_index ) ) {
+      T_quiet_eq_uint( ctx->next[ cpu_index ], ACTION_COUNT );
+
+      for ( i = 0; i < ACTION_COUNT; ++i ) {
+        T_quiet_eq_uint( ctx->order[ cpu_index ][ i ], i );
+      }
+    }
+  }
+}
+
+static rtems_counter_ticks measure_sequential( test_context *ctx, size_t n )
+{
+  Per_CPU_Control     *cpu_self;
+  rtems_counter_ticks  begin;
+  rtems_counter_ticks  end;
+  size_t               i;
+
+  cpu_self = _Thread_Dispatch_disable();
+  begin = rtems_counter_read();
+
+  for ( i = 0; i < n; ++i ) {
+    _SMP_Multicast_action( &ctx->targets, count_action, ctx );
+  }
+
+  end = rtems_counter_read();
+  _Thread_Dispatch_enable( cpu_self );
+
+  return rtems_counter_difference( end, begin );
+}
+
+static rtems_counter_ticks measure_batch( test_context *ctx, size_t n )
+{
+  Per_CPU_Control     *cpu_self;
+  rtems_counter_ticks  begin;
+  rtems_counter_ticks  end;
+  size_t               i;
+
+  cpu_self = _Thread_Dispatch_disable();
+  begin = rtems_counter_read();
+  _SMP_Multicast_batch_initialize( &ctx->batch );
+
+  for ( i = 0; i < n; ++i ) {
+    _SMP_Multicast_batch_add(
+      &ctx->batch,
+      &ctx->actions[ i ],
+      &ctx->targets,
+      count_action,
+      ctx
+    );
+  }
+
+  _SMP_Multicast_batch_submit( &ctx->batch );
+
+  for ( i = 0; i < n; ++i ) {
+    _SMP_Multicast_action_wait( &ctx->actions[ i ] );
+  }
+
+  end = rtems_counter_read();
+  _Thread_Dispatch_enable( cpu_self );
+
+  return rtems_counter_difference( end, begin );
+}
+
+static uint64_t median_nanoseconds( rtems_counter_ticks *samples )
+{
+  size_t i;
+
+  /* Insertion sort is good enough for the few samples */
+  for ( i = 1; i < SAMPLE_COUNT; ++i ) {
+    rtems_counter_ticks sample;
+    size_t              j;
+
+    sample = samples[ i ];
+    j = i;
+
+    while ( j > 0 && samples[ j - 1 ] > sample ) {
+      samples[ j ] = samples[ j - 1 ];
+      --j;
+    }
+
+    samples[ j ] = sample;
+  }
+
+  return rtems_counter_ticks_to_nanoseconds( samples[ SAMPLE_COUNT / 2 ] );
+}
+
+static rtems_counter_ticks sequential_samples[ SAMPLE_COUNT ];
+
+static rtems_counter_ticks batch_samples[ SAMPLE_COUNT ];
+
+T_TEST_CASE( MulticastBatchingBenchmark )
+{
+  test_context *ctx;
+  size_t        n;
+
+  ctx = &test_instance;
+
+  for ( n = 1; n <= ACTION_COUNT; n *= 2 ) {
+    uint64_t sequential_ns;
+    uint64_t batch_ns;
+    size_t   i;
+
+    prepare( ctx );
+
+    for ( i = 0; i < SAMPLE_COUNT; ++i ) {
+      sequential_samples[ i ] = measure_sequential( ctx, n );
+      batch_samples[ i ] = measure_batch( ctx, n );
+    }
+
+    check_counters( ctx, (unsigned int) ( 2 * SAMPLE_COUNT * n ) );
+
+    sequential_ns = median_nanoseconds( sequential_samples );
+    batch_ns = median_nanoseconds( batch_samples );
+
+    T_log(
+      T_NORMAL,
+      "actions %zu: sequential %" PRIu64 "ns, batch %" PRIu64 "ns",
+      n,
+      sequential_ns,
+      batch_ns
+    );
+  }
+}
+
+static void Init( rtems_task_argument arg )
+{
+  rtems_test_run( arg, TEST_STATE );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 1
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
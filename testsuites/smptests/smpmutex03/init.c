@@ -0,0 +1,341 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdio.h>
+
+#include <rtems.h>
+#include <rtems/counter.h>
+#include <rtems/thread.h>
+#include <rtems/score/mutexspin.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPMUTEX 3";
+
+#define SPIN_NANOSECONDS 100000
+
+#define SHORT_SECTION_NANOSECONDS 1000
+
+#define LONG_SECTION_NANOSECONDS 10000000
+
+#define ITERATIONS 1000
+
+#define EVENT_SHORT_SECTIONS RTEMS_EVENT_0
+
+#define EVENT_LONG_SECTION RTEMS_EVENT_1
+
+#define EVENT_DONE RTEMS_EVENT_2
+
+typedef struct test_context test_context;
+
+typedef struct {
+  const char *name;
+  void ( *obtain )( test_context * );
+  void ( *release )( test_context * );
+} test_variant;
+
+struct test_context {
+  rtems_id main_task;
+  rtems_id worker_task;
+  const test_variant *variant;
+  rtems_mutex self_contained_mutex;
+  rtems_id semaphore;
+  pthread_mutex_t posix_mutex;
+  volatile bool stop;
+  volatile bool owner_ready;
+};
+
+static test_context test_instance = {
+  .self_contained_mutex = RTEMS_MUTEX_INITIALIZER( "test" )
+};
+
+static void send_events( rtems_id id, rtems_event_set events )
+{
+  rtems_status_code sc;
+
+  sc = rtems_event_send( id, events );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static rtems_event_set wait_for_events( void )
+{
+  rtems_status_code sc;
+  rtems_event_set   events;
+
+  sc = rtems_event_receive(
+    RTEMS_ALL_EVENTS,
+    RTEMS_EVENT_ANY | RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &events
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return events;
+}
+
+static void self_contained_obtain( test_context *ctx )
+{
+  rtems_mutex_lock( &ctx->self_contained_mutex );
+}
+
+static void self_contained_release( test_context *ctx )
+{
+  rtems_mutex_unlock( &ctx->self_contained_mutex );
+}
+
+static void semaphore_obtain( test_context *ctx )
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_obtain( ctx->semaphore, RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void semaphore_release( test_context *ctx )
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_release( ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void posix_obtain( test_context *ctx )
+{
+  int eno;
+
+  eno = pthread_mutex_lock( &ctx->posix_mutex );
+  rtems_test_assert( eno == 0 );
+}
+
+static void posix_release( test_context *ctx )
+{
+  int eno;
+
+  eno = pthread_mutex_unlock( &ctx->posix_mutex );
+  rtems_test_assert( eno == 0 );
+}
+
+static const test_variant test_variants[] = {
+  { "self-contained mutex", self_contained_obtain, self_contained_release },
+  { "Classic semaphore", semaphore_obtain, semaphore_release },
+  { "POSIX mutex", posix_obtain, posix_release }
+};
+
+static void worker( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    rtems_event_set events;
+
+    events = wait_for_events();
+
+    if ( ( events & EVENT_SHORT_SECTIONS ) != 0 ) {
+      while ( !ctx->stop ) {
+        ( *ctx->variant->obtain )( ctx );
+        rtems_counter_delay_nanoseconds( SHORT_SECTION_NANOSECONDS );
+        ( *ctx->variant->release )( ctx );
+        rtems_counter_delay_nanoseconds( SHORT_SECTION_NANOSECONDS );
+      }
+    }
+
+    if ( ( events & EVENT_LONG_SECTION ) != 0 ) {
+      ( *ctx->variant->obtain )( ctx );
+      ctx->owner_ready = true;
+      rtems_counter_delay_nanoseconds( LONG_SECTION_NANOSECONDS );
+      ( *ctx->variant->release )( ctx );
+    }
+
+    send_events( ctx->main_task, EVENT_DONE );
+  }
+}
+
+static void print_statistics(
+  const char                  *what,
+  const Mutex_Spin_statistics *before,
+  const Mutex_Spin_statistics *after
+)
+{
+  printf(
+    "%s: %" PRIu64 " spin successes, %" PRIu64 " spin failures\n",
+    what,
+    after->successes - before->successes,
+    after->failures - before->failures
+  );
+}
+
+static void test_short_sections( test_context *ctx )
+{
+  Mutex_Spin_statistics before;
+  Mutex_Spin_statistics after;
+  size_t                i;
+
+  ctx->stop = false;
+  _Mutex_Spin_get_statistics( &before );
+  send_events( ctx->worker_task, EVENT_SHORT_SECTIONS );
+
+  for ( i = 0; i < ITERATIONS; ++i ) {
+    ( *ctx->variant->obtain )( ctx );
+    ( *ctx->variant->release )( ctx );
+  }
+
+  ctx->stop = true;
+  rtems_test_assert( wait_for_events() == EVENT_DONE );
+  _Mutex_Spin_get_statistics( &after );
+  print_statistics( "short sections", &before, &after );
+
+  /*
+   * The sections are much shorter than the spin time, so some obtains should
+   * end with the mutex obtained by the spinning thread.
+   */
+  rtems_test_assert( after.successes > before.successes );
+}
+
+static void test_long_section( test_context *ctx )
+{
+  Mutex_Spin_statistics before;
+  Mutex_Spin_statistics after;
+
+  ctx->owner_ready = false;
+  _Mutex_Spin_get_statistics( &before );
+  send_events( ctx->worker_task, EVENT_LONG_SECTION );
+
+  while ( !ctx->owner_ready ) {
+    /* Wait for the worker to obtain the mutex */
+  }
+
+  /* The spinning is bounded, the thread blocks on the mutex after the spin */
+  ( *ctx->variant->obtain )( ctx );
+  ( *ctx->variant->release )( ctx );
+
+  rtems_test_assert( wait_for_events() == EVENT_DONE );
+  _Mutex_Spin_get_statistics( &after );
+  print_statistics( "long section", &before, &after );
+  rtems_test_assert( after.failures > before.failures );
+}
+
+static void test( test_context *ctx )
+{
+  rtems_status_code   sc;
+  pthread_mutexattr_t attr;
+  int                 eno;
+  size_t              i;
+
+  ctx->main_task = rtems_task_self();
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'M', 'U', 'T', 'X' ),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY,
+    0,
+    &ctx->semaphore
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  eno = pthread_mutexattr_init( &attr );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutexattr_setprotocol( &attr, PTHREAD_PRIO_INHERIT );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutex_init( &ctx->posix_mutex, &attr );
+  rtems_test_assert( eno == 0 );
+
+  eno = pthread_mutexattr_destroy( &attr );
+  rtems_test_assert( eno == 0 );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker_task
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( ctx->worker_task, worker, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  for ( i = 0; i < RTEMS_ARRAY_SIZE( test_variants ); ++i ) {
+    ctx->variant = &test_variants[ i ];
+    printf( "%s\n", ctx->variant->name );
+    test_short_sections( ctx );
+    test_long_section( ctx );
+  }
+
+  sc = rtems_task_delete( ctx->worker_task );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  eno = pthread_mutex_destroy( &ctx->posix_mutex );
+  rtems_test_assert( eno == 0 );
+
+  sc = rtems_semaphore_delete( ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  if ( rtems_scheduler_get_processor_maximum() >= 2 ) {
+    test( &test_instance );
+  }
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_PROCESSORS 2
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_SEMAPHORES 1
+
+#define CONFIGURE_MUTEX_SPIN_NANOSECONDS SPIN_NANOSECONDS
+
+#define CONFIGURE_INIT_TASK_PRIORITY 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
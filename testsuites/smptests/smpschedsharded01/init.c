@@ -0,0 +1,402 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <rtems.h>
+
+#include "tmacros.h"
+
+const char rtems_test_name[] = "SMPSCHEDSHARDED 1";
+
+#define CPU_COUNT 32
+
+#define PRIO_COUNT 64
+
+#define PRIO_WORKER 2
+
+#define PAIR_COUNT (CPU_COUNT - 1)
+
+#define TASK_COUNT (2 * PAIR_COUNT)
+
+#define SCHED_CTRL rtems_build_name('C', 'T', 'R', 'L')
+
+#define SCHED_PRIO rtems_build_name('M', 'P', 'D', ' ')
+
+#define SCHED_APA rtems_build_name('M', 'A', 'P', 'A')
+
+#define SCHED_SHRD rtems_build_name('M', 'P', 'S', 'H')
+
+#define SCHEDULER_COUNT 3
+
+typedef struct {
+  rtems_id partner;
+  uint32_t round_trips;
+} RTEMS_ALIGNED(CPU_CACHE_LINE_BYTES) test_worker;
+
+typedef enum {
+  TEST_PAIRS,
+  TEST_YIELD
+} test_kind;
+
+typedef struct {
+  rtems_id scheduler_ids[SCHEDULER_COUNT];
+  rtems_id task_ids[TASK_COUNT];
+  test_worker workers[TASK_COUNT];
+  volatile bool stop;
+} test_context;
+
+static test_context test_instance;
+
+static const rtems_name scheduler_names[SCHEDULER_COUNT] = {
+  SCHED_PRIO,
+  SCHED_APA,
+  SCHED_SHRD
+};
+
+static const char *const scheduler_descriptions[SCHEDULER_COUNT] = {
+  "Deterministic Priority SMP",
+  "Strong APA",
+  "Sharded Priority SMP"
+};
+
+/*
+ * The first worker of a pair wakes up its partner and waits for the answer.
+ * Each round trip consists of two unblock and two block operations of the
+ * scheduler.
+ */
+static void ping_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  test_worker *worker = &ctx->workers[arg];
+
+  while (!ctx->stop) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_send(worker->partner);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++worker->round_trips;
+  }
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void pong_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  test_worker *worker = &ctx->workers[arg];
+
+  while (true) {
+    rtems_status_code sc;
+
+    sc = rtems_event_transient_receive(RTEMS_WAIT, RTEMS_NO_TIMEOUT);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++worker->round_trips;
+
+    sc = rtems_event_transient_send(worker->partner);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+/*
+ * There are two yield workers for each processor, so each yield moves a ready
+ * node and all processors contend for the scheduler instance lock.
+ */
+static void yield_task(rtems_task_argument arg)
+{
+  test_context *ctx = &test_instance;
+  test_worker *worker = &ctx->workers[arg];
+
+  while (!ctx->stop) {
+    rtems_status_code sc;
+
+    sc = rtems_task_wake_after(RTEMS_YIELD_PROCESSOR);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ++worker->round_trips;
+  }
+
+  rtems_task_suspend(RTEMS_SELF);
+  rtems_test_assert(0);
+}
+
+static void move_processors(uint32_t cpu_count, rtems_id scheduler_id)
+{
+  uint32_t cpu_index;
+
+  for (cpu_index = 1; cpu_index < cpu_count; ++cpu_index) {
+    rtems_status_code sc;
+    rtems_id id;
+
+    sc = rtems_scheduler_ident_by_processor(cpu_index, &id);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    if (id != scheduler_id) {
+      sc = rtems_scheduler_remove_processor(id, cpu_index);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+      sc = rtems_scheduler_add_processor(scheduler_id, cpu_index);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+  }
+}
+
+static void create_workers(
+  test_context *ctx,
+  uint32_t pair_count,
+  rtems_id scheduler_id,
+  test_kind kind
+)
+{
+  uint32_t i;
+
+  for (i = 0; i < 2 * pair_count; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_task_create(
+      rtems_build_name('W', 'R', 'K', ' '),
+      PRIO_WORKER,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_DEFAULT_MODES,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ctx->task_ids[i]
+    );
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_set_scheduler(ctx->task_ids[i], scheduler_id, PRIO_WORKER);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    ctx->workers[i].round_trips = 0;
+  }
+
+  if (kind == TEST_YIELD) {
+    for (i = 0; i < 2 * pair_count; ++i) {
+      rtems_status_code sc;
+
+      sc = rtems_task_start(ctx->task_ids[i], yield_task, i);
+      rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+    }
+
+    return;
+  }
+
+  for (i = 0; i < 2 * pair_count; i += 2) {
+    ctx->workers[i].partner = ctx->task_ids[i + 1];
+    ctx->workers[i + 1].partner = ctx->task_ids[i];
+  }
+
+  for (i = 0; i < 2 * pair_count; i += 2) {
+    rtems_status_code sc;
+
+    sc = rtems_task_start(ctx->task_ids[i + 1], pong_task, i + 1);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+    sc = rtems_task_start(ctx->task_ids[i], ping_task, i);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void delete_workers(test_context *ctx, uint32_t pair_count)
+{
+  uint32_t i;
+
+  for (i = 0; i < 2 * pair_count; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_task_delete(ctx->task_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+}
+
+static void benchmark(
+  test_context *ctx,
+  size_t index,
+  uint32_t cpu_count,
+  test_kind kind
+)
+{
+  rtems_status_code sc;
+  rtems_interval duration;
+  uint32_t pair_count;
+  uint64_t total;
+  uint32_t i;
+
+  pair_count = cpu_count - 1;
+  duration = rtems_clock_get_ticks_per_second();
+
+  move_processors(cpu_count, ctx->scheduler_ids[index]);
+
+  ctx->stop = false;
+  create_workers(ctx, pair_count, ctx->scheduler_ids[index], kind);
+
+  sc = rtems_task_wake_after(duration);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  ctx->stop = true;
+
+  sc = rtems_task_wake_after(1);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  delete_workers(ctx, pair_count);
+
+  total = 0;
+
+  if (kind == TEST_YIELD) {
+    for (i = 0; i < 2 * pair_count; ++i) {
+      rtems_test_assert(ctx->workers[i].round_trips > 0);
+      total += ctx->workers[i].round_trips;
+    }
+
+    printf(
+      "%s scheduler: %" PRIu64 " yields in %" PRIu32 " ticks with %"
+        PRIu32 " processors\n",
+      scheduler_descriptions[index],
+      total,
+      duration,
+      cpu_count - 1
+    );
+  } else {
+    for (i = 0; i < 2 * pair_count; i += 2) {
+      rtems_test_assert(ctx->workers[i].round_trips > 0);
+      total += ctx->workers[i].round_trips;
+    }
+
+    printf(
+      "%s scheduler: %" PRIu64 " round trips in %" PRIu32 " ticks with %"
+        PRIu32 " processors\n",
+      scheduler_descriptions[index],
+      total,
+      duration,
+      cpu_count - 1
+    );
+  }
+}
+
+static void test(void)
+{
+  test_context *ctx = &test_instance;
+  uint32_t cpu_count;
+  size_t i;
+
+  cpu_count = rtems_scheduler_get_processor_maximum();
+
+  for (i = 0; i < SCHEDULER_COUNT; ++i) {
+    rtems_status_code sc;
+
+    sc = rtems_scheduler_ident(scheduler_names[i], &ctx->scheduler_ids[i]);
+    rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+  }
+
+  puts("Pairs of tasks exchanging events");
+
+  for (i = 0; i < SCHEDULER_COUNT; ++i) {
+    benchmark(ctx, i, cpu_count, TEST_PAIRS);
+  }
+
+  puts("Yielding tasks contending for the scheduler instance lock");
+
+  for (i = 0; i < SCHEDULER_COUNT; ++i) {
+    benchmark(ctx, i, cpu_count, TEST_YIELD);
+  }
+
+  move_processors(cpu_count, ctx->scheduler_ids[0]);
+}
+
+static void Init(rtems_task_argument arg)
+{
+  TEST_BEGIN();
+
+  if (rtems_scheduler_get_processor_maximum() > 1) {
+    test();
+  } else {
+    puts("warning: not enough processors to run the test");
+  }
+
+  TEST_END();
+  rtems_test_exit(0);
+}
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS (1 + TASK_COUNT)
+
+#define CONFIGURE_MAXIMUM_PROCESSORS CPU_COUNT
+
+#define CONFIGURE_MAXIMUM_PRIORITY (PRIO_COUNT - 1)
+
+#define CONFIGURE_SCHEDULER_PRIORITY_SMP
+#define CONFIGURE_SCHEDULER_SHARDED_SMP
+#define CONFIGURE_SCHEDULER_STRONG_APA
+
+#include <rtems/scheduler.h>
+
+RTEMS_SCHEDULER_PRIORITY_SMP(ctrl, PRIO_COUNT);
+
+RTEMS_SCHEDULER_PRIORITY_SMP(prio, PRIO_COUNT);
+
+RTEMS_SCHEDULER_STRONG_APA(apa, PRIO_COUNT);
+
+RTEMS_SCHEDULER_SHARDED_SMP(shrd, PRIO_COUNT);
+
+#define CONFIGURE_SCHEDULER_TABLE_ENTRIES \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_SMP(ctrl, SCHED_CTRL), \
+  RTEMS_SCHEDULER_TABLE_PRIORITY_SMP(prio, SCHED_PRIO), \
+  RTEMS_SCHEDULER_TABLE_STRONG_APA(apa, SCHED_APA), \
+  RTEMS_SCHEDULER_TABLE_SHARDED_SMP(shrd, SCHED_SHRD)
+
+#define ASSIGN_TEST \
+  RTEMS_SCHEDULER_ASSIGN(1, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_OPTIONAL)
+
+#define CONFIGURE_SCHEDULER_ASSIGNMENTS \
+  RTEMS_SCHEDULER_ASSIGN(0, RTEMS_SCHEDULER_ASSIGN_PROCESSOR_MANDATORY), \
+  ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, \
+  ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, \
+  ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, \
+  ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, \
+  ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, \
+  ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, ASSIGN_TEST, \
+  ASSIGN_TEST
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
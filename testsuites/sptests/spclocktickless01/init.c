@@ -0,0 +1,237 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <rtems/clockdrv.h>
+#include <rtems/score/watchdogimpl.h>
+
+const char rtems_test_name[] = "SPCLOCKTICKLESS 1";
+
+#define DELAY_TICKS 100
+
+#define TIMER_TICKS 20
+
+#define WORKER_COUNT 2
+
+typedef struct {
+  rtems_id               main_task;
+  rtems_interval         timer_fired;
+  volatile unsigned long counters[ WORKER_COUNT ];
+} test_context;
+
+static test_context test_instance;
+
+static void test_ticks_since_boot( void )
+{
+  rtems_interval first;
+  rtems_interval last;
+  rtems_interval now;
+
+  puts( "Ticks since boot" );
+
+  first = rtems_clock_get_ticks_since_boot();
+  last = first;
+
+  /*
+   * The ticks since boot shall advance also if no clock interrupt occurs
+   * while we busy wait.
+   */
+  do {
+    now = rtems_clock_get_ticks_since_boot();
+    rtems_test_assert( now - last <= 1 );
+    last = now;
+  } while ( now - first < 10 );
+
+  if ( _Watchdog_Tickless_is_active ) {
+    uint64_t uptime;
+    uint64_t ticks;
+
+    ticks = rtems_clock_get_ticks_since_boot();
+    uptime = rtems_clock_get_uptime_nanoseconds();
+    rtems_test_assert(
+      ticks <= uptime / rtems_configuration_get_nanoseconds_per_tick()
+    );
+  }
+}
+
+static void test_task_delay( void )
+{
+  rtems_status_code sc;
+  rtems_interval    start;
+  rtems_interval    end;
+  uint32_t          interrupts;
+
+  puts( "Task delay" );
+
+  start = rtems_clock_get_ticks_since_boot();
+  interrupts = Clock_driver_ticks;
+
+  sc = rtems_task_wake_after( DELAY_TICKS );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  end = rtems_clock_get_ticks_since_boot();
+  interrupts = Clock_driver_ticks - interrupts;
+  rtems_test_assert( end - start >= DELAY_TICKS );
+
+  if ( _Watchdog_Tickless_is_active ) {
+    rtems_test_assert( interrupts < DELAY_TICKS / 2 );
+  }
+}
+
+static void timer_routine( rtems_id timer, void *arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  (void) timer;
+
+  ctx = arg;
+  ctx->timer_fired = rtems_clock_get_ticks_since_boot();
+
+  sc = rtems_event_transient_send( ctx->main_task );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_timer( test_context *ctx )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+  rtems_interval    start;
+
+  puts( "Timer" );
+
+  sc = rtems_timer_create( rtems_build_name( 'T', 'I', 'M', 'R' ), &id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  start = rtems_clock_get_ticks_since_boot();
+
+  sc = rtems_timer_fire_after( id, TIMER_TICKS, timer_routine, ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( ctx->timer_fired - start >= TIMER_TICKS );
+
+  sc = rtems_timer_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void worker( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = &test_instance;
+
+  while ( true ) {
+    ++ctx->counters[ arg ];
+  }
+}
+
+static void test_timeslicing( test_context *ctx )
+{
+  rtems_status_code sc;
+  rtems_id          ids[ WORKER_COUNT ];
+  size_t            i;
+
+  puts( "Timeslicing" );
+
+  for ( i = 0; i < WORKER_COUNT; ++i ) {
+    sc = rtems_task_create(
+      rtems_build_name( 'W', 'O', 'R', 'K' ),
+      2,
+      RTEMS_MINIMUM_STACK_SIZE,
+      RTEMS_TIMESLICE | RTEMS_PREEMPT,
+      RTEMS_DEFAULT_ATTRIBUTES,
+      &ids[ i ]
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    sc = rtems_task_start( ids[ i ], worker, i );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  /*
+   * The workers never block, so the second worker executes only if the first
+   * worker is preempted at the end of its timeslice.
+   */
+  sc = rtems_task_wake_after( DELAY_TICKS );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  for ( i = 0; i < WORKER_COUNT; ++i ) {
+    rtems_test_assert( ctx->counters[ i ] != 0 );
+
+    sc = rtems_task_delete( ids[ i ] );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+}
+
+static rtems_task Init( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  ctx->main_task = rtems_task_self();
+
+  test_ticks_since_boot();
+  test_task_delay();
+  test_timer( ctx );
+  test_timeslicing( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_TICKLESS_CLOCK
+
+#define CONFIGURE_MICROSECONDS_PER_TICK 1000
+
+#define CONFIGURE_TICKS_PER_TIMESLICE 5
+
+#define CONFIGURE_MAXIMUM_TASKS ( 1 + WORKER_COUNT )
+
+#define CONFIGURE_MAXIMUM_TIMERS 1
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,378 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <string.h>
+
+const char rtems_test_name[] = "SPMSGQBUF 1";
+
+#define MAXIMUM_PENDING_MESSAGES 3
+
+#define MAXIMUM_MESSAGE_SIZE 16
+
+typedef struct {
+  rtems_id queue;
+  rtems_id worker;
+  void    *buffer;
+  size_t   size;
+  char     content[ MAXIMUM_MESSAGE_SIZE ];
+  uint32_t count;
+} test_context;
+
+static test_context test_instance;
+
+static void *obtain_buffer( const test_context *ctx )
+{
+  rtems_status_code sc;
+  void             *buffer;
+
+  buffer = NULL;
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, &buffer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( buffer != NULL );
+
+  return buffer;
+}
+
+static void release_buffer( const test_context *ctx, void *buffer )
+{
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, buffer );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void send_buffer( const test_context *ctx, const char *message )
+{
+  rtems_status_code sc;
+  void             *buffer;
+  size_t            size;
+
+  buffer = obtain_buffer( ctx );
+  size = strlen( message ) + 1;
+  memcpy( buffer, message, size );
+  sc = rtems_message_queue_send_buffer( ctx->queue, buffer, size );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void *receive_buffer( const test_context *ctx, const char *message )
+{
+  rtems_status_code sc;
+  void             *buffer;
+  size_t            size;
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &buffer,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( size == strlen( message ) + 1 );
+  rtems_test_assert( memcmp( buffer, message, size ) == 0 );
+
+  return buffer;
+}
+
+static uint32_t get_number_pending( const test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          count;
+
+  sc = rtems_message_queue_get_number_pending( ctx->queue, &count );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return count;
+}
+
+static void worker( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  while ( true ) {
+    rtems_status_code sc;
+
+    sc = rtems_message_queue_receive_buffer(
+      ctx->queue,
+      &ctx->buffer,
+      &ctx->size,
+      RTEMS_WAIT,
+      RTEMS_NO_TIMEOUT
+    );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+    memcpy( ctx->content, ctx->buffer, ctx->size );
+    ++ctx->count;
+    release_buffer( ctx, ctx->buffer );
+  }
+}
+
+static void test_obtain_and_release( test_context *ctx )
+{
+  rtems_status_code sc;
+  void             *buffers[ MAXIMUM_PENDING_MESSAGES ];
+  void             *buffer;
+  size_t            i;
+
+  puts( "Obtain and release" );
+
+  for ( i = 0; i < MAXIMUM_PENDING_MESSAGES; ++i ) {
+    buffers[ i ] = obtain_buffer( ctx );
+  }
+
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, &buffer );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+
+  sc = rtems_message_queue_send( ctx->queue, "x", 1 );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+
+  for ( i = 0; i < MAXIMUM_PENDING_MESSAGES; ++i ) {
+    release_buffer( ctx, buffers[ i ] );
+  }
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, buffers[ 0 ] );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_obtain_buffer( ctx->queue, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_obtain_buffer( 0, &buffer );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+}
+
+static void test_invalid_buffers( test_context *ctx )
+{
+  rtems_status_code sc;
+  char              local[ MAXIMUM_MESSAGE_SIZE ];
+  void             *buffer;
+
+  puts( "Invalid buffers" );
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_release_buffer( ctx->queue, local );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_buffer( ctx->queue, local, 1 );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  buffer = obtain_buffer( ctx );
+
+  sc = rtems_message_queue_release_buffer(
+    ctx->queue,
+    (char *) buffer + 1
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_buffer(
+    ctx->queue,
+    buffer,
+    MAXIMUM_MESSAGE_SIZE + 1
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+
+  sc = rtems_message_queue_urgent_buffer( 0, buffer, 1 );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  release_buffer( ctx, buffer );
+}
+
+static void test_send_and_receive( test_context *ctx )
+{
+  rtems_status_code sc;
+  char              message[ MAXIMUM_MESSAGE_SIZE ];
+  void             *a;
+  void             *b;
+  size_t            size;
+
+  puts( "Send and receive" );
+
+  sc = rtems_message_queue_receive_buffer(
+    ctx->queue,
+    &a,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_UNSATISFIED );
+
+  /* The message buffer is lent to the receiver without a copy */
+  a = obtain_buffer( ctx );
+  strcpy( a, "a" );
+  sc = rtems_message_queue_send_buffer( ctx->queue, a, 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  b = obtain_buffer( ctx );
+  strcpy( b, "b" );
+  sc = rtems_message_queue_urgent_buffer( ctx->queue, b, 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( get_number_pending( ctx ) == 2 );
+  rtems_test_assert( receive_buffer( ctx, "b" ) == b );
+  rtems_test_assert( receive_buffer( ctx, "a" ) == a );
+  rtems_test_assert( get_number_pending( ctx ) == 0 );
+
+  /* A borrowed message buffer can be forwarded, but only once */
+  sc = rtems_message_queue_send_buffer( ctx->queue, a, 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  sc = rtems_message_queue_send_buffer( ctx->queue, a, 2 );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+  rtems_test_assert( receive_buffer( ctx, "a" ) == a );
+
+  release_buffer( ctx, a );
+  release_buffer( ctx, b );
+
+  /* Lending and copying directives can be mixed */
+  send_buffer( ctx, "c" );
+  sc = rtems_message_queue_send( ctx->queue, "d", 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_receive(
+    ctx->queue,
+    message,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( size == 2 );
+  rtems_test_assert( strcmp( message, "c" ) == 0 );
+
+  release_buffer( ctx, receive_buffer( ctx, "d" ) );
+}
+
+static void test_wait( test_context *ctx )
+{
+  rtems_status_code sc;
+  void             *buffer;
+
+  puts( "Wait" );
+
+  sc = rtems_task_start(
+    ctx->worker,
+    worker,
+    (rtems_task_argument) ctx
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The waiting receiver borrows the submitted message buffer */
+  buffer = obtain_buffer( ctx );
+  strcpy( buffer, "e" );
+  sc = rtems_message_queue_send_buffer( ctx->queue, buffer, 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->count == 1 );
+  rtems_test_assert( ctx->buffer == buffer );
+  rtems_test_assert( ctx->size == 2 );
+  rtems_test_assert( strcmp( ctx->content, "e" ) == 0 );
+
+  /* The waiting receiver borrows a message buffer with a copy */
+  sc = rtems_message_queue_urgent( ctx->queue, "f", 2 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( ctx->count == 2 );
+  rtems_test_assert( ctx->size == 2 );
+  rtems_test_assert( strcmp( ctx->content, "f" ) == 0 );
+
+  rtems_test_assert( get_number_pending( ctx ) == 0 );
+
+  sc = rtems_task_delete( ctx->worker );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  (void) arg;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'Q', 'U', 'E', 'U' ),
+    MAXIMUM_PENDING_MESSAGES,
+    MAXIMUM_MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_obtain_and_release( ctx );
+  test_invalid_buffers( ctx );
+  test_send_and_receive( ctx );
+  test_wait( ctx );
+
+  sc = rtems_message_queue_delete( ctx->queue );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( \
+    MAXIMUM_PENDING_MESSAGES, \
+    MAXIMUM_MESSAGE_SIZE \
+  )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
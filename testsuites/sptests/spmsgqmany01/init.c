@@ -0,0 +1,392 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+
+#include <string.h>
+
+const char rtems_test_name[] = "SPMSGQMANY 1";
+
+#define MAXIMUM_PENDING_MESSAGES 3
+
+#define MAXIMUM_MESSAGE_SIZE 8
+
+#define BATCH_COUNT 5
+
+typedef struct {
+  rtems_id queue;
+  rtems_id worker;
+  char     content[ MAXIMUM_MESSAGE_SIZE ];
+  size_t   size;
+  uint32_t count;
+  char     messages[ BATCH_COUNT ][ MAXIMUM_MESSAGE_SIZE ];
+  size_t   sizes[ BATCH_COUNT ];
+} test_context;
+
+static test_context test_instance;
+
+static void prepare_messages( test_context *ctx, const char *names )
+{
+  size_t i;
+
+  memset( ctx->messages, 0, sizeof( ctx->messages ) );
+
+  for ( i = 0; i < BATCH_COUNT; ++i ) {
+    ctx->messages[ i ][ 0 ] = names[ i ];
+    ctx->sizes[ i ] = i + 1;
+  }
+}
+
+static uint32_t get_number_pending( const test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          count;
+
+  sc = rtems_message_queue_get_number_pending( ctx->queue, &count );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return count;
+}
+
+static void receive_all( test_context *ctx, const char *names )
+{
+  rtems_status_code sc;
+  char              messages[ BATCH_COUNT ][ MAXIMUM_MESSAGE_SIZE ];
+  size_t            sizes[ BATCH_COUNT ];
+  uint32_t          received;
+  size_t            n;
+  size_t            i;
+
+  n = strlen( names );
+  received = 0;
+  sc = rtems_message_queue_receive_many(
+    ctx->queue,
+    messages,
+    sizes,
+    BATCH_COUNT,
+    &received,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( received == n );
+
+  for ( i = 0; i < n; ++i ) {
+    rtems_test_assert( messages[ i ][ 0 ] == names[ i ] );
+    rtems_test_assert( sizes[ i ] == (size_t) ( names[ i ] - 'a' + 1 ) );
+  }
+
+  rtems_test_assert( get_number_pending( ctx ) == 0 );
+}
+
+static void worker( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  ctx = (test_context *) arg;
+
+  sc = rtems_message_queue_receive(
+    ctx->queue,
+    ctx->content,
+    &ctx->size,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  ++ctx->count;
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+static void test_invalid_parameters( test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          sent;
+  uint32_t          received;
+
+  puts( "Invalid parameters" );
+
+  prepare_messages( ctx, "abcde" );
+
+  sc = rtems_message_queue_send_many( ctx->queue, NULL, ctx->sizes, 1, &sent );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_many(
+    ctx->queue,
+    ctx->messages,
+    NULL,
+    1,
+    &sent
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_many(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    1,
+    NULL
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_message_queue_send_many(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    0,
+    &sent
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  sc = rtems_message_queue_urgent_many(
+    0,
+    ctx->messages,
+    ctx->sizes,
+    1,
+    &sent
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_message_queue_receive_many(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    0,
+    &received,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  sc = rtems_message_queue_receive_many(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    BATCH_COUNT,
+    &received,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_UNSATISFIED );
+}
+
+static void test_invalid_size( test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          sent;
+
+  puts( "Invalid size" );
+
+  /* No message is sent if one message of the batch is too large */
+  prepare_messages( ctx, "abcde" );
+  ctx->sizes[ 1 ] = MAXIMUM_MESSAGE_SIZE + 1;
+  sent = 1;
+  sc = rtems_message_queue_send_many(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    2,
+    &sent
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+  rtems_test_assert( sent == 0 );
+  rtems_test_assert( get_number_pending( ctx ) == 0 );
+
+  sent = 1;
+  sc = rtems_message_queue_urgent_many(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    2,
+    &sent
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_SIZE );
+  rtems_test_assert( sent == 0 );
+  rtems_test_assert( get_number_pending( ctx ) == 0 );
+}
+
+static void test_partial_count( test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          sent;
+
+  puts( "Partial count" );
+
+  /* The batch stops if the message buffers run out */
+  prepare_messages( ctx, "abcde" );
+  sc = rtems_message_queue_send_many(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    BATCH_COUNT,
+    &sent
+  );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+  rtems_test_assert( sent == MAXIMUM_PENDING_MESSAGES );
+  rtems_test_assert( get_number_pending( ctx ) == MAXIMUM_PENDING_MESSAGES );
+  receive_all( ctx, "abc" );
+
+  sc = rtems_message_queue_send_many(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    1,
+    &sent
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( sent == 1 );
+
+  sc = rtems_message_queue_send_many(
+    ctx->queue,
+    ctx->messages[ 1 ],
+    &ctx->sizes[ 1 ],
+    BATCH_COUNT - 1,
+    &sent
+  );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+  rtems_test_assert( sent == MAXIMUM_PENDING_MESSAGES - 1 );
+  receive_all( ctx, "abc" );
+
+  /* The last urgent message of the batch is at the front of the queue */
+  sc = rtems_message_queue_urgent_many(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    BATCH_COUNT,
+    &sent
+  );
+  rtems_test_assert( sc == RTEMS_TOO_MANY );
+  rtems_test_assert( sent == MAXIMUM_PENDING_MESSAGES );
+  receive_all( ctx, "cba" );
+}
+
+static void test_waiting_receiver( test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          sent;
+
+  puts( "Waiting receiver" );
+
+  sc = rtems_task_start(
+    ctx->worker,
+    worker,
+    (rtems_task_argument) ctx
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The waiting receiver gets the first message, the others are pending */
+  prepare_messages( ctx, "abcde" );
+  sc = rtems_message_queue_send_many(
+    ctx->queue,
+    ctx->messages,
+    ctx->sizes,
+    MAXIMUM_PENDING_MESSAGES,
+    &sent
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( sent == MAXIMUM_PENDING_MESSAGES );
+  rtems_test_assert( ctx->count == 1 );
+  rtems_test_assert( ctx->size == 1 );
+  rtems_test_assert( ctx->content[ 0 ] == 'a' );
+
+  receive_all( ctx, "bc" );
+
+  sc = rtems_task_delete( ctx->worker );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void Init( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  (void) arg;
+
+  TEST_BEGIN();
+  ctx = &test_instance;
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'Q', 'U', 'E', 'U' ),
+    MAXIMUM_PENDING_MESSAGES,
+    MAXIMUM_MESSAGE_SIZE,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->queue
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    1,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->worker
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_invalid_parameters( ctx );
+  test_invalid_size( ctx );
+  test_partial_count( ctx );
+  test_waiting_receiver( ctx );
+
+  sc = rtems_message_queue_delete( ctx->queue );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( \
+    MAXIMUM_PENDING_MESSAGES, \
+    MAXIMUM_MESSAGE_SIZE \
+  )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_INIT_TASK_PRIORITY 2
+
+#define CONFIGURE_INIT_TASK_INITIAL_MODES RTEMS_DEFAULT_MODES
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -0,0 +1,325 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <rtems/libcsupport.h>
+#include <rtems/posix/mqueue.h>
+#include <rtems/posix/semaphore.h>
+#include <rtems/rtems/semdata.h>
+#include <rtems/rtems/tasksdata.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <mqueue.h>
+#include <semaphore.h>
+
+const char rtems_test_name[] = "SPOBJNAMEINDEX 1";
+
+#define SEMAPHORE_COUNT 7
+
+static rtems_id create_semaphore( rtems_name name )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_semaphore_create( name, 0, RTEMS_COUNTING_SEMAPHORE, 0, &id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  return id;
+}
+
+static void delete_semaphore( rtems_id id )
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void assert_semaphore_ident( rtems_name name, rtems_id expected_id )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_semaphore_ident( name, RTEMS_SEARCH_LOCAL_NODE, &id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( id == expected_id );
+}
+
+static void assert_semaphore_no_ident( rtems_name name )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_semaphore_ident( name, RTEMS_SEARCH_LOCAL_NODE, &id );
+  rtems_test_assert( sc == RTEMS_INVALID_NAME );
+}
+
+static void test_tasks( void )
+{
+  rtems_status_code sc;
+  rtems_id          worker_id;
+  rtems_id          id;
+
+  puts( "Tasks" );
+
+  rtems_test_assert( _RTEMS_tasks_Information.Objects.name_index != NULL );
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &worker_id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_ident(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    RTEMS_SEARCH_LOCAL_NODE,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( id == worker_id );
+
+  sc = rtems_task_ident(
+    rtems_build_name( 'U', 'I', '1', ' ' ),
+    RTEMS_SEARCH_LOCAL_NODE,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( id == rtems_task_self() );
+
+  sc = rtems_object_set_name( worker_id, "NEW" );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_ident(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    RTEMS_SEARCH_LOCAL_NODE,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NAME );
+
+  sc = rtems_task_ident(
+    rtems_build_name( 'N', 'E', 'W', ' ' ),
+    RTEMS_SEARCH_LOCAL_NODE,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( id == worker_id );
+
+  sc = rtems_task_delete( worker_id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_ident(
+    rtems_build_name( 'N', 'E', 'W', ' ' ),
+    RTEMS_SEARCH_LOCAL_NODE,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NAME );
+}
+
+static void test_semaphores( void )
+{
+  rtems_id ids[ SEMAPHORE_COUNT ];
+  rtems_id dup_id;
+  size_t   i;
+
+  puts( "Semaphores" );
+
+  rtems_test_assert( _Semaphore_Information.name_index != NULL );
+
+  /* Create enough semaphores to extend the information several times */
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    ids[ i ] = create_semaphore( rtems_build_name( 'S', 'E', 'M', 'A' + i ) );
+  }
+
+  for ( i = 0; i < SEMAPHORE_COUNT; ++i ) {
+    assert_semaphore_ident(
+      rtems_build_name( 'S', 'E', 'M', 'A' + i ),
+      ids[ i ]
+    );
+  }
+
+  /* Duplicate names identify the object with the lowest identifier */
+  dup_id = create_semaphore( rtems_build_name( 'S', 'E', 'M', 'A' ) );
+  assert_semaphore_ident( rtems_build_name( 'S', 'E', 'M', 'A' ), ids[ 0 ] );
+
+  delete_semaphore( ids[ 0 ] );
+  assert_semaphore_ident( rtems_build_name( 'S', 'E', 'M', 'A' ), dup_id );
+
+  delete_semaphore( dup_id );
+  assert_semaphore_no_ident( rtems_build_name( 'S', 'E', 'M', 'A' ) );
+
+  for ( i = 1; i < SEMAPHORE_COUNT; ++i ) {
+    delete_semaphore( ids[ i ] );
+    assert_semaphore_no_ident( rtems_build_name( 'S', 'E', 'M', 'A' + i ) );
+  }
+
+  /* The name index of a shrunk information is still valid */
+  ids[ 0 ] = create_semaphore( rtems_build_name( 'S', 'E', 'M', 'A' ) );
+  assert_semaphore_ident( rtems_build_name( 'S', 'E', 'M', 'A' ), ids[ 0 ] );
+  delete_semaphore( ids[ 0 ] );
+}
+
+static void test_posix_semaphores( void )
+{
+  sem_t *a;
+  sem_t *b;
+  sem_t *c;
+  int    rv;
+
+  puts( "POSIX semaphores" );
+
+  rtems_test_assert( _POSIX_Semaphore_Information.name_index != NULL );
+
+  a = sem_open( "/a", O_CREAT | O_EXCL, 0777, 0 );
+  rtems_test_assert( a != SEM_FAILED );
+
+  b = sem_open( "/b", O_CREAT | O_EXCL, 0777, 0 );
+  rtems_test_assert( b != SEM_FAILED );
+  rtems_test_assert( a != b );
+
+  rtems_test_assert( sem_open( "/a", 0 ) == a );
+  rtems_test_assert( sem_open( "/b", 0 ) == b );
+
+  errno = 0;
+  c = sem_open( "/a", O_CREAT | O_EXCL, 0777, 0 );
+  rtems_test_assert( c == SEM_FAILED );
+  rtems_test_assert( errno == EEXIST );
+
+  rv = sem_unlink( "/a" );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  c = sem_open( "/a", 0 );
+  rtems_test_assert( c == SEM_FAILED );
+  rtems_test_assert( errno == ENOENT );
+
+  rv = sem_close( a );
+  rtems_test_assert( rv == 0 );
+
+  rv = sem_close( a );
+  rtems_test_assert( rv == 0 );
+
+  rv = sem_unlink( "/b" );
+  rtems_test_assert( rv == 0 );
+
+  rv = sem_close( b );
+  rtems_test_assert( rv == 0 );
+
+  rv = sem_close( b );
+  rtems_test_assert( rv == 0 );
+}
+
+static void test_posix_message_queues( void )
+{
+  struct mq_attr attr;
+  mqd_t          a;
+  mqd_t          b;
+  int            rv;
+
+  puts( "POSIX message queues" );
+
+  rtems_test_assert( _POSIX_Message_queue_Information.name_index != NULL );
+
+  memset( &attr, 0, sizeof( attr ) );
+  attr.mq_maxmsg = 1;
+  attr.mq_msgsize = 1;
+
+  a = mq_open( "/mq", O_CREAT | O_EXCL | O_RDWR, 0777, &attr );
+  rtems_test_assert( a != (mqd_t) -1 );
+
+  b = mq_open( "/mq", O_RDWR );
+  rtems_test_assert( b == a );
+
+  rv = mq_unlink( "/mq" );
+  rtems_test_assert( rv == 0 );
+
+  errno = 0;
+  b = mq_open( "/mq", O_RDWR );
+  rtems_test_assert( b == (mqd_t) -1 );
+  rtems_test_assert( errno == ENOENT );
+
+  rv = mq_close( a );
+  rtems_test_assert( rv == 0 );
+
+  rv = mq_close( a );
+  rtems_test_assert( rv == 0 );
+}
+
+static rtems_task Init( rtems_task_argument arg )
+{
+  rtems_resource_snapshot snapshot;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  /*
+   * The extended object tables of the semaphores are not freed, so this test
+   * runs before the resource snapshot.
+   */
+  test_semaphores();
+
+  rtems_resource_snapshot_take( &snapshot );
+
+  test_tasks();
+  test_posix_semaphores();
+  test_posix_message_queues();
+
+  rtems_test_assert( rtems_resource_snapshot_check( &snapshot ) );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_SEMAPHORES rtems_resource_unlimited( 2 )
+#define CONFIGURE_MAXIMUM_POSIX_SEMAPHORES 2
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( 1, 1 )
+
+#define CONFIGURE_OBJECTS_NAME_INDEX
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
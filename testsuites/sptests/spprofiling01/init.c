@@ -138,12 +138,69 @@ static void test_report_xml(void)
   printf("characters produced by rtems_profiling_report_xml(): %i\n", rv);
 }
 
+static void wakeup_latency_visitor(
+  void *arg,
+  const rtems_profiling_data *data
+)
+{
+  uint64_t *count = arg;
+
+  if (data->header.type == RTEMS_PROFILING_WAKEUP_LATENCY) {
+    const rtems_profiling_wakeup_latency *pwl = &data->wakeup_latency;
+    uint32_t i;
+    uint32_t j;
+
+    rtems_test_assert(
+      pwl->processor_index < rtems_scheduler_get_processor_maximum()
+    );
+    rtems_test_assert(pwl->bucket_lower_bounds[0] == 0);
+
+    for (j = 1; j < RTEMS_PROFILING_WAKEUP_LATENCY_BUCKETS; ++j) {
+      rtems_test_assert(
+        pwl->bucket_lower_bounds[j - 1] <= pwl->bucket_lower_bounds[j]
+      );
+    }
+
+    for (i = 0; i < RTEMS_PROFILING_WAKEUP_LATENCY_PRIORITY_BANDS; ++i) {
+      for (j = 0; j < RTEMS_PROFILING_WAKEUP_LATENCY_BUCKETS; ++j) {
+        *count += pwl->histograms[i][j];
+      }
+    }
+  }
+}
+
+static void test_wakeup_latency(void)
+{
+  rtems_status_code sc;
+  uint64_t count;
+  int rv;
+
+  sc = rtems_task_wake_after(2);
+  rtems_test_assert(sc == RTEMS_SUCCESSFUL);
+
+  count = 0;
+  rtems_profiling_iterate(wakeup_latency_visitor, &count);
+
+#ifdef RTEMS_PROFILING
+  rtems_test_assert(count > 0);
+#else
+  rtems_test_assert(count == 0);
+#endif
+
+  rv = rtems_profiling_report_wakeup_latency(&rtems_test_printer);
+  printf(
+    "characters produced by rtems_profiling_report_wakeup_latency(): %i\n",
+    rv
+  );
+}
+
 static void Init(rtems_task_argument arg)
 {
   TEST_BEGIN();
 
   test_iterate();
   test_report_xml();
+  test_wakeup_latency();
 
   TEST_END();
 
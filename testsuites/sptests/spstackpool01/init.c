@@ -0,0 +1,175 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <rtems/libcsupport.h>
+#include <rtems/score/apimutex.h>
+#include <rtems/score/stackpool.h>
+#include <rtems/score/threadimpl.h>
+
+const char rtems_test_name[] = "SPSTACKPOOL 1";
+
+#define ITERATIONS 10
+
+static __thread int tls_value = 123;
+
+static rtems_id main_task;
+
+static void get_information( Stack_Pool_Information *info )
+{
+  _RTEMS_Lock_allocator();
+  _Thread_Kill_zombies();
+  _Stack_Pool_Get_information( info );
+  _RTEMS_Unlock_allocator();
+}
+
+static void worker( rtems_task_argument arg )
+{
+  rtems_status_code sc;
+
+  (void) arg;
+
+  /* The thread-local storage is initialized also in a recycled stack area */
+  rtems_test_assert( tls_value == 123 );
+  tls_value = 456;
+
+  sc = rtems_event_transient_send( main_task );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+static void create_and_delete( size_t stack_size )
+{
+  rtems_status_code sc;
+  rtems_id          id;
+
+  sc = rtems_task_create(
+    rtems_build_name( 'W', 'O', 'R', 'K' ),
+    2,
+    stack_size,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &id
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( id, worker, 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_event_transient_receive( RTEMS_WAIT, RTEMS_NO_TIMEOUT );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_delete( id );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_recycling( void )
+{
+  rtems_resource_snapshot snapshot;
+  Stack_Pool_Information  before;
+  Stack_Pool_Information  after;
+  int                     i;
+
+  puts( "Recycling" );
+
+  rtems_resource_snapshot_take( &snapshot );
+
+  get_information( &before );
+  rtems_test_assert( before.cached == 0 );
+  rtems_test_assert( before.cached_size == 0 );
+
+  for ( i = 0; i < ITERATIONS; ++i ) {
+    create_and_delete( RTEMS_MINIMUM_STACK_SIZE );
+  }
+
+  get_information( &after );
+  rtems_test_assert( after.misses == before.misses + 1 );
+  rtems_test_assert( after.hits == before.hits + ITERATIONS - 1 );
+  rtems_test_assert( after.cached == 1 );
+  rtems_test_assert( after.cached_size >= RTEMS_MINIMUM_STACK_SIZE );
+
+  /* A different size class does not use the cached stack area */
+  create_and_delete( 4 * RTEMS_MINIMUM_STACK_SIZE );
+
+  get_information( &after );
+  rtems_test_assert( after.misses == before.misses + 2 );
+  rtems_test_assert( after.hits == before.hits + ITERATIONS - 1 );
+  rtems_test_assert( after.cached == 2 );
+
+  create_and_delete( 4 * RTEMS_MINIMUM_STACK_SIZE );
+
+  get_information( &after );
+  rtems_test_assert( after.misses == before.misses + 2 );
+  rtems_test_assert( after.hits == before.hits + ITERATIONS );
+  rtems_test_assert( after.cached == 2 );
+
+  /* The resource snapshot returns the cached stack areas to the workspace */
+  rtems_test_assert( rtems_resource_snapshot_check( &snapshot ) );
+
+  get_information( &after );
+  rtems_test_assert( after.cached == 0 );
+  rtems_test_assert( after.cached_size == 0 );
+  rtems_test_assert( after.flushes > before.flushes );
+}
+
+static rtems_task Init( rtems_task_argument arg )
+{
+  (void) arg;
+
+  TEST_BEGIN();
+
+  main_task = rtems_task_self();
+  rtems_test_assert( _Stack_Pool != NULL );
+
+  test_recycling();
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_DOES_NOT_NEED_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+
+#define CONFIGURE_EXTRA_TASK_STACKS ( 8 * RTEMS_MINIMUM_STACK_SIZE )
+
+#define CONFIGURE_TASK_STACK_RECYCLING
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
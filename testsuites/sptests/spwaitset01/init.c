@@ -0,0 +1,608 @@
+/* SPDX-License-Identifier: BSD-2-Clause */
+
+/*
+ * Copyright (C) 2026 On-Line Applications Research Corporation (OAR)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions
+ * are met:
+ * 1. Redistributions of source code must retain the above copyright
+ *    notice, this list of conditions and the following disclaimer.
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT OWNER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifdef HAVE_CONFIG_H
+#include "config.h"
+#endif
+
+#include <tmacros.h>
+#include <rtems/libcsupport.h>
+
+#include <fcntl.h>
+#include <mqueue.h>
+
+const char rtems_test_name[] = "SPWAITSET 1";
+
+#define EVENT_WAIT_SET RTEMS_EVENT_1
+
+#define EVENT_OTHER RTEMS_EVENT_2
+
+typedef struct {
+  rtems_wait_set wait_set;
+  rtems_id       main_task;
+  rtems_id       helper_task;
+  rtems_id       semaphore;
+  rtems_id       mutex;
+  rtems_id       message_queue;
+} test_context;
+
+static test_context test_instance;
+
+static uint32_t wait_no_wait( test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          index;
+
+  index = UINT32_MAX;
+  sc = rtems_wait_set_wait( &ctx->wait_set, RTEMS_NO_WAIT, 0, &index );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( index < RTEMS_WAIT_SET_MAXIMUM_MEMBERS );
+
+  return index;
+}
+
+static void assert_not_ready( test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          index;
+
+  index = UINT32_MAX;
+  sc = rtems_wait_set_wait( &ctx->wait_set, RTEMS_NO_WAIT, 0, &index );
+  rtems_test_assert( sc == RTEMS_UNSATISFIED );
+  rtems_test_assert( index == UINT32_MAX );
+}
+
+static void create_objects( test_context *ctx )
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'S', 'E', 'M', 'A' ),
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &ctx->semaphore
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'M', 'T', 'X', ' ' ),
+    1,
+    RTEMS_BINARY_SEMAPHORE | RTEMS_PRIORITY | RTEMS_INHERIT_PRIORITY,
+    0,
+    &ctx->mutex
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_create(
+    rtems_build_name( 'M', 'S', 'G', 'Q' ),
+    1,
+    sizeof( uint32_t ),
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->message_queue
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void delete_objects( test_context *ctx )
+{
+  rtems_status_code sc;
+
+  sc = rtems_semaphore_delete( ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_semaphore_delete( ctx->mutex );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_delete( ctx->message_queue );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void test_errors( test_context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          index;
+
+  puts( "Errors" );
+
+  rtems_wait_set_initialize( &ctx->wait_set );
+
+  sc = rtems_wait_set_wait( &ctx->wait_set, RTEMS_NO_WAIT, 0, NULL );
+  rtems_test_assert( sc == RTEMS_INVALID_ADDRESS );
+
+  sc = rtems_wait_set_wait( &ctx->wait_set, RTEMS_NO_WAIT, 0, &index );
+  rtems_test_assert( sc == RTEMS_INCORRECT_STATE );
+
+  sc = rtems_wait_set_add_semaphore(
+    &ctx->wait_set,
+    RTEMS_WAIT_SET_MAXIMUM_MEMBERS,
+    ctx->semaphore
+  );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  sc = rtems_wait_set_add_semaphore( &ctx->wait_set, 0, 0 );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_wait_set_add_message_queue( &ctx->wait_set, 0, 0 );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_wait_set_add_posix_message_queue( &ctx->wait_set, 0, 0 );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_wait_set_add_semaphore( &ctx->wait_set, 0, ctx->mutex );
+  rtems_test_assert( sc == RTEMS_NOT_DEFINED );
+
+  sc = rtems_wait_set_add_events( &ctx->wait_set, 0, 0 );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  sc = rtems_wait_set_remove( &ctx->wait_set, 0 );
+  rtems_test_assert( sc == RTEMS_INCORRECT_STATE );
+
+  sc = rtems_wait_set_remove( &ctx->wait_set, RTEMS_WAIT_SET_MAXIMUM_MEMBERS );
+  rtems_test_assert( sc == RTEMS_INVALID_NUMBER );
+
+  sc = rtems_wait_set_add_semaphore( &ctx->wait_set, 0, ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_wait_set_add_message_queue(
+    &ctx->wait_set,
+    0,
+    ctx->message_queue
+  );
+  rtems_test_assert( sc == RTEMS_RESOURCE_IN_USE );
+
+  /* An object may be a member of at most one wait set */
+  sc = rtems_wait_set_add_semaphore( &ctx->wait_set, 1, ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_RESOURCE_IN_USE );
+
+  sc = rtems_wait_set_remove( &ctx->wait_set, 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_wait_set_add_semaphore( &ctx->wait_set, 1, ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_wait_set_destroy( &ctx->wait_set );
+}
+
+static void test_ready( test_context *ctx )
+{
+  rtems_status_code sc;
+  rtems_event_set   events;
+  uint32_t          message;
+  size_t            size;
+  uint32_t          index;
+
+  puts( "Ready members" );
+
+  rtems_wait_set_initialize( &ctx->wait_set );
+
+  sc = rtems_wait_set_add_semaphore( &ctx->wait_set, 3, ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_wait_set_add_message_queue(
+    &ctx->wait_set,
+    7,
+    ctx->message_queue
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_wait_set_add_events( &ctx->wait_set, 11, EVENT_WAIT_SET );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  assert_not_ready( ctx );
+
+  sc = rtems_wait_set_wait( &ctx->wait_set, RTEMS_WAIT, 2, &index );
+  rtems_test_assert( sc == RTEMS_TIMEOUT );
+
+  sc = rtems_semaphore_release( ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  /* The readiness is level-triggered */
+  rtems_test_assert( wait_no_wait( ctx ) == 3 );
+  rtems_test_assert( wait_no_wait( ctx ) == 3 );
+
+  sc = rtems_semaphore_obtain( ctx->semaphore, RTEMS_NO_WAIT, 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  assert_not_ready( ctx );
+
+  message = 123;
+  sc = rtems_message_queue_send(
+    ctx->message_queue,
+    &message,
+    sizeof( message )
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( wait_no_wait( ctx ) == 7 );
+
+  message = 0;
+  sc = rtems_message_queue_receive(
+    ctx->message_queue,
+    &message,
+    &size,
+    RTEMS_NO_WAIT,
+    0
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( size == sizeof( message ) );
+  rtems_test_assert( message == 123 );
+
+  assert_not_ready( ctx );
+
+  sc = rtems_event_send( ctx->main_task, EVENT_OTHER );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  assert_not_ready( ctx );
+
+  sc = rtems_event_send( ctx->main_task, EVENT_WAIT_SET );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( wait_no_wait( ctx ) == 11 );
+
+  events = 0;
+  sc = rtems_event_receive(
+    EVENT_WAIT_SET | EVENT_OTHER,
+    RTEMS_EVENT_ALL | RTEMS_NO_WAIT,
+    0,
+    &events
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( events == ( EVENT_WAIT_SET | EVENT_OTHER ) );
+
+  assert_not_ready( ctx );
+
+  /* Ready members are reported in a round-robin order */
+  sc = rtems_semaphore_release( ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  message = 456;
+  sc = rtems_message_queue_send(
+    ctx->message_queue,
+    &message,
+    sizeof( message )
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( wait_no_wait( ctx ) == 3 );
+  rtems_test_assert( wait_no_wait( ctx ) == 7 );
+  rtems_test_assert( wait_no_wait( ctx ) == 3 );
+
+  sc = rtems_semaphore_obtain( ctx->semaphore, RTEMS_NO_WAIT, 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_message_queue_flush( ctx->message_queue, &message );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( message == 1 );
+
+  assert_not_ready( ctx );
+
+  rtems_wait_set_destroy( &ctx->wait_set );
+
+  /* The objects are no longer attached to the destroyed wait set */
+  rtems_wait_set_initialize( &ctx->wait_set );
+
+  sc = rtems_wait_set_add_semaphore( &ctx->wait_set, 0, ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_wait_set_destroy( &ctx->wait_set );
+}
+
+static void test_posix_message_queue( test_context *ctx )
+{
+  struct mq_attr    attr;
+  rtems_status_code sc;
+  mqd_t             mq;
+  uint32_t          message;
+  ssize_t           n;
+  int               rv;
+
+  puts( "POSIX message queues" );
+
+  memset( &attr, 0, sizeof( attr ) );
+  attr.mq_maxmsg = 1;
+  attr.mq_msgsize = sizeof( message );
+
+  mq = mq_open( "/mq", O_CREAT | O_EXCL | O_RDWR, 0777, &attr );
+  rtems_test_assert( mq != (mqd_t) -1 );
+
+  rtems_wait_set_initialize( &ctx->wait_set );
+
+  sc = rtems_wait_set_add_posix_message_queue( &ctx->wait_set, 5, mq );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  assert_not_ready( ctx );
+
+  message = 789;
+  rv = mq_send( mq, (const char *) &message, sizeof( message ), 0 );
+  rtems_test_assert( rv == 0 );
+
+  rtems_test_assert( wait_no_wait( ctx ) == 5 );
+
+  message = 0;
+  n = mq_receive( mq, (char *) &message, sizeof( message ), NULL );
+  rtems_test_assert( n == (ssize_t) sizeof( message ) );
+  rtems_test_assert( message == 789 );
+
+  assert_not_ready( ctx );
+
+  rv = mq_unlink( "/mq" );
+  rtems_test_assert( rv == 0 );
+
+  rv = mq_close( mq );
+  rtems_test_assert( rv == 0 );
+
+  /* A member of a deleted object is ready */
+  rtems_test_assert( wait_no_wait( ctx ) == 5 );
+
+  rtems_wait_set_destroy( &ctx->wait_set );
+}
+
+static void helper_release_semaphore( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  ctx = (test_context *) arg;
+
+  sc = rtems_semaphore_release( ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+static void helper_send_message( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+  uint32_t          message;
+
+  ctx = (test_context *) arg;
+
+  message = 1;
+  sc = rtems_message_queue_send(
+    ctx->message_queue,
+    &message,
+    sizeof( message )
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+static void helper_send_event( rtems_task_argument arg )
+{
+  test_context     *ctx;
+  rtems_status_code sc;
+
+  ctx = (test_context *) arg;
+
+  sc = rtems_event_send( ctx->main_task, EVENT_WAIT_SET );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+static void helper_destroy( rtems_task_argument arg )
+{
+  test_context *ctx;
+
+  ctx = (test_context *) arg;
+
+  rtems_wait_set_destroy( &ctx->wait_set );
+
+  (void) rtems_task_suspend( RTEMS_SELF );
+  rtems_test_assert( 0 );
+}
+
+static void start_helper( test_context *ctx, rtems_task_entry entry )
+{
+  rtems_status_code sc;
+
+  if ( ctx->helper_task != 0 ) {
+    sc = rtems_task_delete( ctx->helper_task );
+    rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  }
+
+  sc = rtems_task_create(
+    rtems_build_name( 'H', 'E', 'L', 'P' ),
+    2,
+    RTEMS_MINIMUM_STACK_SIZE,
+    RTEMS_DEFAULT_MODES,
+    RTEMS_DEFAULT_ATTRIBUTES,
+    &ctx->helper_task
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_task_start( ctx->helper_task, entry, (rtems_task_argument) ctx );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+}
+
+static void wait_for_helper(
+  test_context      *ctx,
+  rtems_task_entry   entry,
+  rtems_status_code  expected_sc,
+  uint32_t           expected_index
+)
+{
+  rtems_status_code sc;
+  uint32_t          index;
+
+  /* The helper task has a lower priority and runs once we are blocked */
+  start_helper( ctx, entry );
+
+  index = UINT32_MAX;
+  sc = rtems_wait_set_wait(
+    &ctx->wait_set,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT,
+    &index
+  );
+  rtems_test_assert( sc == expected_sc );
+  rtems_test_assert( index == expected_index );
+}
+
+static void test_blocking( test_context *ctx )
+{
+  rtems_status_code sc;
+  rtems_event_set   events;
+  uint32_t          message;
+
+  puts( "Blocking wait" );
+
+  rtems_wait_set_initialize( &ctx->wait_set );
+
+  sc = rtems_wait_set_add_semaphore( &ctx->wait_set, 0, ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_wait_set_add_message_queue(
+    &ctx->wait_set,
+    1,
+    ctx->message_queue
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  sc = rtems_wait_set_add_events( &ctx->wait_set, 2, EVENT_WAIT_SET );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  wait_for_helper( ctx, helper_release_semaphore, RTEMS_SUCCESSFUL, 0 );
+
+  sc = rtems_semaphore_obtain( ctx->semaphore, RTEMS_NO_WAIT, 0 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  wait_for_helper( ctx, helper_send_message, RTEMS_SUCCESSFUL, 1 );
+
+  sc = rtems_message_queue_flush( ctx->message_queue, &message );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( message == 1 );
+
+  wait_for_helper( ctx, helper_send_event, RTEMS_SUCCESSFUL, 2 );
+
+  sc = rtems_event_receive(
+    EVENT_WAIT_SET,
+    RTEMS_EVENT_ALL | RTEMS_NO_WAIT,
+    0,
+    &events
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  rtems_test_assert( events == EVENT_WAIT_SET );
+
+  wait_for_helper( ctx, helper_destroy, RTEMS_OBJECT_WAS_DELETED, UINT32_MAX );
+
+  sc = rtems_task_delete( ctx->helper_task );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+  ctx->helper_task = 0;
+}
+
+static void test_deleted_object( test_context *ctx )
+{
+  rtems_status_code sc;
+
+  puts( "Deleted objects" );
+
+  rtems_wait_set_initialize( &ctx->wait_set );
+
+  sc = rtems_wait_set_add_semaphore( &ctx->wait_set, 9, ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  assert_not_ready( ctx );
+
+  sc = rtems_semaphore_delete( ctx->semaphore );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_test_assert( wait_no_wait( ctx ) == 9 );
+
+  sc = rtems_semaphore_obtain( ctx->semaphore, RTEMS_NO_WAIT, 0 );
+  rtems_test_assert( sc == RTEMS_INVALID_ID );
+
+  sc = rtems_wait_set_remove( &ctx->wait_set, 9 );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  rtems_wait_set_destroy( &ctx->wait_set );
+}
+
+static rtems_task Init( rtems_task_argument arg )
+{
+  test_context            *ctx;
+  rtems_resource_snapshot  snapshot;
+  rtems_status_code        sc;
+
+  (void) arg;
+
+  TEST_BEGIN();
+
+  ctx = &test_instance;
+  ctx->main_task = rtems_task_self();
+
+  rtems_resource_snapshot_take( &snapshot );
+
+  create_objects( ctx );
+  test_errors( ctx );
+  test_ready( ctx );
+  test_posix_message_queue( ctx );
+  test_blocking( ctx );
+  delete_objects( ctx );
+
+  rtems_test_assert( rtems_resource_snapshot_check( &snapshot ) );
+
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'S', 'E', 'M', 'A' ),
+    0,
+    RTEMS_COUNTING_SEMAPHORE,
+    0,
+    &ctx->semaphore
+  );
+  rtems_test_assert( sc == RTEMS_SUCCESSFUL );
+
+  test_deleted_object( ctx );
+
+  TEST_END();
+  rtems_test_exit( 0 );
+}
+
+#define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
+#define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
+
+#define CONFIGURE_MAXIMUM_TASKS 2
+#define CONFIGURE_MAXIMUM_SEMAPHORES 2
+#define CONFIGURE_MAXIMUM_MESSAGE_QUEUES 1
+#define CONFIGURE_MAXIMUM_POSIX_MESSAGE_QUEUES 1
+
+#define CONFIGURE_MESSAGE_BUFFER_MEMORY \
+  ( CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( 1, sizeof( uint32_t ) ) \
+    + CONFIGURE_MESSAGE_BUFFERS_FOR_QUEUE( 1, sizeof( uint32_t ) ) )
+
+#define CONFIGURE_INITIAL_EXTENSIONS RTEMS_TEST_INITIAL_EXTENSION
+
+#define CONFIGURE_RTEMS_INIT_TASKS_TABLE
+
+#define CONFIGURE_INIT
+
+#include <rtems/confdefs.h>
@@ -250,6 +250,127 @@ static void test_watchdog_operations( void )
   _Watchdog_Header_destroy( &header );
 }
 
+static uint64_t test_watchdog_wheel_tick(
+  Watchdog_Wheel *wheel,
+  uint64_t        now
+)
+{
+  ISR_LOCK_DEFINE( , lock, "Test" )
+  ISR_lock_Context lock_context;
+
+  _ISR_lock_ISR_disable_and_acquire( &lock, &lock_context );
+  ++now;
+  _Watchdog_Wheel_tickle( wheel, now, &lock, &lock_context );
+  _ISR_lock_Release_and_ISR_enable( &lock, &lock_context );
+  _ISR_lock_Destroy( &lock );
+
+  return now;
+}
+
+static void test_watchdog_wheel_operations( void )
+{
+  static Watchdog_Wheel wheel;
+  Watchdog_Header header;
+  uint64_t now;
+  test_watchdog a;
+  test_watchdog b;
+  test_watchdog c;
+
+  _Watchdog_Header_initialize( &header );
+  header.wheel = &wheel;
+
+  test_watchdog_init( &a, 10 );
+  test_watchdog_init( &b, 20 );
+  test_watchdog_init( &c, 30 );
+
+  now = 0;
+  now = test_watchdog_wheel_tick( &wheel, now );
+  rtems_test_assert( wheel.now == 1 );
+
+  _Watchdog_Insert( &header, &a.Base, now + 1 );
+  rtems_test_assert(
+    _Watchdog_Get_state( &a.Base ) == WATCHDOG_SCHEDULED_WHEEL
+  );
+  rtems_test_assert( a.Base.expire == 2 );
+  rtems_test_assert( wheel.occupied[ 0 ] == ( UINT64_C( 1 ) << 2 ) );
+  rtems_test_assert( wheel.slots[ 0 ][ 2 ] == &a.Base );
+
+  _Watchdog_Remove( &header, &a.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( wheel.occupied[ 0 ] == 0 );
+  rtems_test_assert( wheel.slots[ 0 ][ 2 ] == NULL );
+
+  _Watchdog_Remove( &header, &a.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+
+  _Watchdog_Insert( &header, &a.Base, now + 1 );
+  _Watchdog_Insert( &header, &b.Base, now + 1 );
+  rtems_test_assert( wheel.occupied[ 0 ] == ( UINT64_C( 1 ) << 2 ) );
+
+  _Watchdog_Remove( &header, &b.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &b ) );
+  rtems_test_assert( wheel.occupied[ 0 ] == ( UINT64_C( 1 ) << 2 ) );
+
+  _Watchdog_Insert( &header, &b.Base, now + 100 );
+  rtems_test_assert( wheel.occupied[ 1 ] == ( UINT64_C( 1 ) << 1 ) );
+
+  _Watchdog_Insert( &header, &c.Base, now + 5000 );
+  rtems_test_assert( wheel.occupied[ 2 ] == ( UINT64_C( 1 ) << 1 ) );
+
+  _Watchdog_Remove( &header, &b.Base );
+  rtems_test_assert( wheel.occupied[ 1 ] == 0 );
+
+  _Watchdog_Insert( &header, &b.Base, WATCHDOG_MAXIMUM_TICKS );
+  rtems_test_assert( wheel.overflow == &b.Base );
+
+  now = test_watchdog_wheel_tick( &wheel, now );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( a.counter == 11 );
+  rtems_test_assert( wheel.occupied[ 0 ] == 0 );
+
+  while ( now < c.Base.expire - 1 ) {
+    now = test_watchdog_wheel_tick( &wheel, now );
+  }
+
+  rtems_test_assert( !test_watchdog_is_inactive( &c ) );
+  rtems_test_assert( c.counter == 30 );
+  rtems_test_assert( wheel.occupied[ 2 ] == 0 );
+  rtems_test_assert( wheel.occupied[ 1 ] == 0 );
+  rtems_test_assert(
+    wheel.occupied[ 0 ] == ( UINT64_C( 1 ) << ( c.Base.expire % 64 ) )
+  );
+
+  now = test_watchdog_wheel_tick( &wheel, now );
+  rtems_test_assert( test_watchdog_is_inactive( &c ) );
+  rtems_test_assert( c.counter == 31 );
+  rtems_test_assert( wheel.occupied[ 0 ] == 0 );
+
+  _Watchdog_Insert( &header, &a.Base, now );
+  rtems_test_assert( a.Base.expire == now );
+  now = test_watchdog_wheel_tick( &wheel, now );
+  rtems_test_assert( test_watchdog_is_inactive( &a ) );
+  rtems_test_assert( a.counter == 12 );
+
+  rtems_test_assert( !test_watchdog_is_inactive( &b ) );
+  _Watchdog_Remove( &header, &b.Base );
+  rtems_test_assert( test_watchdog_is_inactive( &b ) );
+  rtems_test_assert( b.counter == 20 );
+  rtems_test_assert( wheel.overflow == NULL );
+
+  _Watchdog_Header_destroy( &header );
+}
+
+static void test_watchdog_wheel_config( void )
+{
+  Per_CPU_Control *cpu;
+  Watchdog_Header *header;
+
+  cpu = _Per_CPU_Get_by_index( 0 );
+  header = &cpu->Watchdog.Header[ PER_CPU_WATCHDOG_TICKS ];
+  rtems_test_assert( header->wheel == &_Watchdog_Wheels[ 0 ] );
+  rtems_test_assert( _Watchdog_Header_first( header ) == NULL );
+}
+
 rtems_task Init(
   rtems_task_argument argument
 )
@@ -260,6 +381,8 @@ rtems_task Init(
   TEST_BEGIN();
 
   test_watchdog_operations();
+  test_watchdog_wheel_operations();
+  test_watchdog_wheel_config();
   test_watchdog_static_init();
   test_watchdog_config();
 
@@ -54,6 +54,8 @@ rtems_task Task_1(
 #define CONFIGURE_APPLICATION_NEEDS_SIMPLE_CONSOLE_DRIVER
 #define CONFIGURE_APPLICATION_NEEDS_CLOCK_DRIVER
 
+#define CONFIGURE_WATCHDOG_TIMING_WHEEL
+
 #define CONFIGURE_MAXIMUM_TASKS           2
 #define CONFIGURE_MAXIMUM_TIMERS          2
 #define CONFIGURE_INIT_TASK_STACK_SIZE    (RTEMS_MINIMUM_STACK_SIZE * 2)
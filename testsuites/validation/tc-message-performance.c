@@ -83,6 +83,28 @@ typedef struct {
    */
   long message;
 
+  /**
+   * @brief This member provides a message queue identifier for the batch
+   *   operations.
+   */
+  rtems_id batch_queue_id;
+
+  /**
+   * @brief This member provides the messages of a batch.
+   */
+  uint64_t batch_messages[ 16 ];
+
+  /**
+   * @brief This member provides the message sizes of a batch.
+   */
+  size_t batch_sizes[ 16 ];
+
+  /**
+   * @brief This member provides the count of messages transferred by a batch
+   *   operation.
+   */
+  uint32_t batch_count;
+
   /**
    * @brief This member provides a worker identifier.
    */
@@ -121,6 +143,8 @@ static RtemsMessageValPerf_Context
 
 #define MAXIMUM_MESSAGE_SIZE 8
 
+#define BATCH_SIZE 16
+
 typedef RtemsMessageValPerf_Context Context;
 
 typedef enum {
@@ -142,6 +166,53 @@ rtems_message_queue_config config = {
   .storage_size = sizeof( storage_area )
 };
 
+static RTEMS_MESSAGE_QUEUE_BUFFER( MAXIMUM_MESSAGE_SIZE )
+  batch_storage_area[ BATCH_SIZE ];
+
+static const rtems_message_queue_config batch_config = {
+  .name = OBJECT_NAME,
+  .maximum_pending_messages = BATCH_SIZE,
+  .maximum_message_size = MAXIMUM_MESSAGE_SIZE,
+  .storage_area = batch_storage_area,
+  .storage_size = sizeof( batch_storage_area )
+};
+
+RTEMS_STATIC_ASSERT(
+  sizeof( ( (Context *) 0 )->batch_messages[ 0 ] ) == MAXIMUM_MESSAGE_SIZE,
+  batch_message_size
+);
+
+RTEMS_STATIC_ASSERT(
+  RTEMS_ARRAY_SIZE( ( (Context *) 0 )->batch_messages ) == BATCH_SIZE,
+  batch_size
+);
+
+static void FillBatch( Context *ctx )
+{
+  uint32_t          sent;
+  rtems_status_code sc;
+
+  sc = rtems_message_queue_send_many(
+    ctx->batch_queue_id,
+    ctx->batch_messages,
+    ctx->batch_sizes,
+    BATCH_SIZE,
+    &sent
+  );
+  T_quiet_rsc_success( sc );
+  T_quiet_eq_u32( sent, BATCH_SIZE );
+}
+
+static void FlushBatch( Context *ctx )
+{
+  rtems_status_code sc;
+  uint32_t          count;
+
+  sc = rtems_message_queue_flush( ctx->batch_queue_id, &count );
+  T_quiet_rsc_success( sc );
+  T_quiet_eq_u32( count, BATCH_SIZE );
+}
+
 static void Send( const Context *ctx, rtems_event_set events )
 {
   SendEvents( ctx->worker_id, events );
@@ -221,17 +292,26 @@ static void RtemsMessageValPerf_Setup_Context(
 }
 
 /**
- * @brief Create a message queue and a worker task.
+ * @brief Create the message queues and a worker task.
  */
 static void RtemsMessageValPerf_Setup( RtemsMessageValPerf_Context *ctx )
 {
   rtems_status_code sc;
+  uint32_t          i;
 
   SetSelfPriority( PRIO_NORMAL );
 
   sc = rtems_message_queue_construct( &config, &ctx->queue_id );
   T_rsc_success( sc );
 
+  sc = rtems_message_queue_construct( &batch_config, &ctx->batch_queue_id );
+  T_rsc_success( sc );
+
+  for ( i = 0; i < BATCH_SIZE; ++i ) {
+    ctx->batch_messages[ i ] = i;
+    ctx->batch_sizes[ i ] = sizeof( ctx->batch_messages[ i ] );
+  }
+
   ctx->worker_id = CreateTask( "WORK", PRIO_HIGH );
   StartTask( ctx->worker_id, Worker, ctx );
 }
@@ -246,7 +326,7 @@ static void RtemsMessageValPerf_Setup_Wrap( void *arg )
 }
 
 /**
- * @brief Delete the worker task and the message queue.
+ * @brief Delete the worker task and the message queues.
  */
 static void RtemsMessageValPerf_Teardown( RtemsMessageValPerf_Context *ctx )
 {
@@ -257,6 +337,9 @@ static void RtemsMessageValPerf_Teardown( RtemsMessageValPerf_Context *ctx )
   sc = rtems_message_queue_delete( ctx->queue_id );
   T_rsc_success( sc );
 
+  sc = rtems_message_queue_delete( ctx->batch_queue_id );
+  T_rsc_success( sc );
+
   RestoreRunnerPriority();
 }
 
@@ -823,6 +906,301 @@ static bool RtemsMessageReqPerfSendPreempt_Teardown_Wrap(
   );
 }
 
+/**
+ * @brief Send a batch of messages with one directive call per message.
+ */
+static void RtemsMessageReqPerfSendSequence_Body(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  uint32_t i;
+
+  for ( i = 0; i < BATCH_SIZE; ++i ) {
+    ctx->status = rtems_message_queue_send(
+      ctx->batch_queue_id,
+      &ctx->batch_messages[ i ],
+      ctx->batch_sizes[ i ]
+    );
+  }
+}
+
+static void RtemsMessageReqPerfSendSequence_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSendSequence_Body( ctx );
+}
+
+/**
+ * @brief Flush the message queue.  Discard samples interrupted by a clock
+ *   tick.
+ */
+static bool RtemsMessageReqPerfSendSequence_Teardown(
+  RtemsMessageValPerf_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  FlushBatch( ctx );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfSendSequence_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfSendSequence_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @brief Send a batch of messages with one directive call.
+ */
+static void RtemsMessageReqPerfSendMany_Body(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  ctx->status = rtems_message_queue_send_many(
+    ctx->batch_queue_id,
+    ctx->batch_messages,
+    ctx->batch_sizes,
+    BATCH_SIZE,
+    &ctx->batch_count
+  );
+}
+
+static void RtemsMessageReqPerfSendMany_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfSendMany_Body( ctx );
+}
+
+/**
+ * @brief Flush the message queue.  Discard samples interrupted by a clock
+ *   tick.
+ */
+static bool RtemsMessageReqPerfSendMany_Teardown(
+  RtemsMessageValPerf_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_u32( ctx->batch_count, BATCH_SIZE );
+  FlushBatch( ctx );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfSendMany_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfSendMany_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @brief Fill the message queue.
+ */
+static void RtemsMessageReqPerfReceiveSequence_Setup(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  FillBatch( ctx );
+}
+
+static void RtemsMessageReqPerfReceiveSequence_Setup_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceiveSequence_Setup( ctx );
+}
+
+/**
+ * @brief Receive a batch of messages with one directive call per message.
+ */
+static void RtemsMessageReqPerfReceiveSequence_Body(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  uint64_t messages[ BATCH_SIZE ];
+  size_t   size;
+  uint32_t i;
+
+  for ( i = 0; i < BATCH_SIZE; ++i ) {
+    ctx->status = rtems_message_queue_receive(
+      ctx->batch_queue_id,
+      &messages[ i ],
+      &size,
+      RTEMS_NO_WAIT,
+      0
+    );
+  }
+}
+
+static void RtemsMessageReqPerfReceiveSequence_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceiveSequence_Body( ctx );
+}
+
+/**
+ * @brief Discard samples interrupted by a clock tick.
+ */
+static bool RtemsMessageReqPerfReceiveSequence_Teardown(
+  RtemsMessageValPerf_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfReceiveSequence_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfReceiveSequence_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
+/**
+ * @brief Fill the message queue.
+ */
+static void RtemsMessageReqPerfReceiveMany_Setup(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  FillBatch( ctx );
+}
+
+static void RtemsMessageReqPerfReceiveMany_Setup_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceiveMany_Setup( ctx );
+}
+
+/**
+ * @brief Receive a batch of messages with one directive call.
+ */
+static void RtemsMessageReqPerfReceiveMany_Body(
+  RtemsMessageValPerf_Context *ctx
+)
+{
+  uint64_t messages[ BATCH_SIZE ];
+  size_t   sizes[ BATCH_SIZE ];
+
+  ctx->status = rtems_message_queue_receive_many(
+    ctx->batch_queue_id,
+    messages,
+    sizes,
+    BATCH_SIZE,
+    &ctx->batch_count,
+    RTEMS_NO_WAIT,
+    0
+  );
+}
+
+static void RtemsMessageReqPerfReceiveMany_Body_Wrap( void *arg )
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsMessageReqPerfReceiveMany_Body( ctx );
+}
+
+/**
+ * @brief Discard samples interrupted by a clock tick.
+ */
+static bool RtemsMessageReqPerfReceiveMany_Teardown(
+  RtemsMessageValPerf_Context *ctx,
+  T_ticks                     *delta,
+  uint32_t                     tic,
+  uint32_t                     toc,
+  unsigned int                 retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+  T_quiet_eq_u32( ctx->batch_count, BATCH_SIZE );
+
+  return tic == toc;
+}
+
+static bool RtemsMessageReqPerfReceiveMany_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsMessageValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsMessageReqPerfReceiveMany_Teardown(
+    ctx,
+    delta,
+    tic,
+    toc,
+    retry
+  );
+}
+
 /**
  * @fn void T_case_body_RtemsMessageValPerf( void )
  */
@@ -877,6 +1255,29 @@ T_TEST_CASE_FIXTURE( RtemsMessageValPerf, &RtemsMessageValPerf_Fixture )
   ctx->request.body = RtemsMessageReqPerfSendPreempt_Body_Wrap;
   ctx->request.teardown = RtemsMessageReqPerfSendPreempt_Teardown_Wrap;
   T_measure_runtime( ctx->context, &ctx->request );
+  ctx->request.name = "RtemsMessageReqPerfSendSequence";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsMessageReqPerfSendSequence_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfSendSequence_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfSendMany";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsMessageReqPerfSendMany_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfSendMany_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfReceiveSequence";
+  ctx->request.setup = RtemsMessageReqPerfReceiveSequence_Setup_Wrap;
+  ctx->request.body = RtemsMessageReqPerfReceiveSequence_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfReceiveSequence_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsMessageReqPerfReceiveMany";
+  ctx->request.setup = RtemsMessageReqPerfReceiveMany_Setup_Wrap;
+  ctx->request.body = RtemsMessageReqPerfReceiveMany_Body_Wrap;
+  ctx->request.teardown = RtemsMessageReqPerfReceiveMany_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
 }
 
 /** @} */
@@ -387,10 +387,19 @@ static void GetSemAttributes( Context *ctx )
 
     semaphore = _Semaphore_Get( ctx->id_value, &queue_context );
     T_assert_not_null( semaphore );
+    flags = _Semaphore_Get_flags( semaphore );
+    _Thread_queue_Acquire_critical(
+      &semaphore->Core_control.Wait_queue,
+      &queue_context
+    );
+    _Semaphore_Fast_path_freeze( semaphore, _Semaphore_Get_variant( flags ) );
     ctx->sem_count = semaphore->Core_control.Semaphore.count;
     ctx->owner = semaphore->Core_control.Wait_queue.Queue.owner;
-    flags = _Semaphore_Get_flags( semaphore );
-    _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+    _Semaphore_Fast_path_thaw( semaphore, _Semaphore_Get_variant( flags ) );
+    _Thread_queue_Release(
+      &semaphore->Core_control.Wait_queue,
+      &queue_context
+    );
     ctx->variant = _Semaphore_Get_variant( flags );
     ctx->discipline = _Semaphore_Get_discipline( flags );
   } else {
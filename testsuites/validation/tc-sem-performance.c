@@ -78,6 +78,17 @@ typedef struct {
    */
   rtems_id mutex_id;
 
+  /**
+   * @brief This member provides a mutex without a locking protocol
+   *   identifier.
+   */
+  rtems_id mutex_no_protocol_id;
+
+  /**
+   * @brief This member provides a counting semaphore identifier.
+   */
+  rtems_id counting_id;
+
   /**
    * @brief This member provides a worker identifier.
    */
@@ -190,12 +201,24 @@ static void RtemsSemValPerf_Setup_Context( RtemsSemValPerf_Context *ctx )
 }
 
 /**
- * @brief Create a mutex and a worker task.
+ * @brief Create a mutex, a mutex without a locking protocol, a counting
+ *   semaphore, and a worker task.
  */
 static void RtemsSemValPerf_Setup( RtemsSemValPerf_Context *ctx )
 {
+  rtems_status_code sc;
+
   SetSelfPriority( PRIO_NORMAL );
   ctx->mutex_id = CreateMutex();
+  ctx->mutex_no_protocol_id = CreateMutexNoProtocol();
+  sc = rtems_semaphore_create(
+    rtems_build_name( 'C', 'N', 'T', ' ' ),
+    1,
+    RTEMS_COUNTING_SEMAPHORE | RTEMS_PRIORITY,
+    0,
+    &ctx->counting_id
+  );
+  T_rsc_success( sc );
   ctx->worker_id = CreateTask( "WORK", PRIO_HIGH );
   StartTask( ctx->worker_id, Worker, ctx );
 }
@@ -210,11 +233,16 @@ static void RtemsSemValPerf_Setup_Wrap( void *arg )
 }
 
 /**
- * @brief Delete the worker task and the mutex.
+ * @brief Delete the worker task, the counting semaphore, and the mutexes.
  */
 static void RtemsSemValPerf_Teardown( RtemsSemValPerf_Context *ctx )
 {
+  rtems_status_code sc;
+
   DeleteTask( ctx->worker_id );
+  sc = rtems_semaphore_delete( ctx->counting_id );
+  T_rsc_success( sc );
+  DeleteMutex( ctx->mutex_no_protocol_id );
   DeleteMutex( ctx->mutex_id );
   RestoreRunnerPriority();
 }
@@ -823,6 +851,241 @@ static bool RtemsSemReqPerfMtxPiWaitTimed_Teardown_Wrap(
   return RtemsSemReqPerfMtxPiWaitTimed_Teardown( ctx, delta, tic, toc, retry );
 }
 
+/**
+ * @brief Obtain the available mutex without a locking protocol.
+ */
+static void RtemsSemReqPerfMtxObtain_Body( RtemsSemValPerf_Context *ctx )
+{
+  ctx->status = rtems_semaphore_obtain(
+    ctx->mutex_no_protocol_id,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static void RtemsSemReqPerfMtxObtain_Body_Wrap( void *arg )
+{
+  RtemsSemValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxObtain_Body( ctx );
+}
+
+/**
+ * @brief Release the mutex.  Discard samples interrupted by a clock tick.
+ */
+static bool RtemsSemReqPerfMtxObtain_Teardown(
+  RtemsSemValPerf_Context *ctx,
+  T_ticks                 *delta,
+  uint32_t                 tic,
+  uint32_t                 toc,
+  unsigned int             retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  ReleaseMutex( ctx->mutex_no_protocol_id );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfMtxObtain_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfMtxObtain_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Obtain the mutex without a locking protocol.
+ */
+static void RtemsSemReqPerfMtxRelease_Setup( RtemsSemValPerf_Context *ctx )
+{
+  ObtainMutex( ctx->mutex_no_protocol_id );
+}
+
+static void RtemsSemReqPerfMtxRelease_Setup_Wrap( void *arg )
+{
+  RtemsSemValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxRelease_Setup( ctx );
+}
+
+/**
+ * @brief Release the mutex without a locking protocol.
+ */
+static void RtemsSemReqPerfMtxRelease_Body( RtemsSemValPerf_Context *ctx )
+{
+  ctx->status = rtems_semaphore_release( ctx->mutex_no_protocol_id );
+}
+
+static void RtemsSemReqPerfMtxRelease_Body_Wrap( void *arg )
+{
+  RtemsSemValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfMtxRelease_Body( ctx );
+}
+
+/**
+ * @brief Discard samples interrupted by a clock tick.
+ */
+static bool RtemsSemReqPerfMtxRelease_Teardown(
+  RtemsSemValPerf_Context *ctx,
+  T_ticks                 *delta,
+  uint32_t                 tic,
+  uint32_t                 toc,
+  unsigned int             retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfMtxRelease_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfMtxRelease_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Obtain the available counting semaphore.
+ */
+static void RtemsSemReqPerfSemObtain_Body( RtemsSemValPerf_Context *ctx )
+{
+  ctx->status = rtems_semaphore_obtain(
+    ctx->counting_id,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+}
+
+static void RtemsSemReqPerfSemObtain_Body_Wrap( void *arg )
+{
+  RtemsSemValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfSemObtain_Body( ctx );
+}
+
+/**
+ * @brief Release the counting semaphore.  Discard samples interrupted by a
+ *   clock tick.
+ */
+static bool RtemsSemReqPerfSemObtain_Teardown(
+  RtemsSemValPerf_Context *ctx,
+  T_ticks                 *delta,
+  uint32_t                 tic,
+  uint32_t                 toc,
+  unsigned int             retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  ctx->status = rtems_semaphore_release( ctx->counting_id );
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfSemObtain_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfSemObtain_Teardown( ctx, delta, tic, toc, retry );
+}
+
+/**
+ * @brief Obtain the counting semaphore.
+ */
+static void RtemsSemReqPerfSemRelease_Setup( RtemsSemValPerf_Context *ctx )
+{
+  ctx->status = rtems_semaphore_obtain(
+    ctx->counting_id,
+    RTEMS_WAIT,
+    RTEMS_NO_TIMEOUT
+  );
+  T_quiet_rsc_success( ctx->status );
+}
+
+static void RtemsSemReqPerfSemRelease_Setup_Wrap( void *arg )
+{
+  RtemsSemValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfSemRelease_Setup( ctx );
+}
+
+/**
+ * @brief Release the counting semaphore.
+ */
+static void RtemsSemReqPerfSemRelease_Body( RtemsSemValPerf_Context *ctx )
+{
+  ctx->status = rtems_semaphore_release( ctx->counting_id );
+}
+
+static void RtemsSemReqPerfSemRelease_Body_Wrap( void *arg )
+{
+  RtemsSemValPerf_Context *ctx;
+
+  ctx = arg;
+  RtemsSemReqPerfSemRelease_Body( ctx );
+}
+
+/**
+ * @brief Discard samples interrupted by a clock tick.
+ */
+static bool RtemsSemReqPerfSemRelease_Teardown(
+  RtemsSemValPerf_Context *ctx,
+  T_ticks                 *delta,
+  uint32_t                 tic,
+  uint32_t                 toc,
+  unsigned int             retry
+)
+{
+  T_quiet_rsc_success( ctx->status );
+
+  return tic == toc;
+}
+
+static bool RtemsSemReqPerfSemRelease_Teardown_Wrap(
+  void        *arg,
+  T_ticks     *delta,
+  uint32_t     tic,
+  uint32_t     toc,
+  unsigned int retry
+)
+{
+  RtemsSemValPerf_Context *ctx;
+
+  ctx = arg;
+  return RtemsSemReqPerfSemRelease_Teardown( ctx, delta, tic, toc, retry );
+}
+
 /**
  * @fn void T_case_body_RtemsSemValPerf( void )
  */
@@ -885,6 +1148,30 @@ T_TEST_CASE_FIXTURE( RtemsSemValPerf, &RtemsSemValPerf_Fixture )
   ctx->request.body = RtemsSemReqPerfMtxPiWaitTimed_Body_Wrap;
   ctx->request.teardown = RtemsSemReqPerfMtxPiWaitTimed_Teardown_Wrap;
   T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsSemReqPerfMtxObtain";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsSemReqPerfMtxObtain_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfMtxObtain_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsSemReqPerfMtxRelease";
+  ctx->request.setup = RtemsSemReqPerfMtxRelease_Setup_Wrap;
+  ctx->request.body = RtemsSemReqPerfMtxRelease_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfMtxRelease_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsSemReqPerfSemObtain";
+  ctx->request.setup = NULL;
+  ctx->request.body = RtemsSemReqPerfSemObtain_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfSemObtain_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
+
+  ctx->request.name = "RtemsSemReqPerfSemRelease";
+  ctx->request.setup = RtemsSemReqPerfSemRelease_Setup_Wrap;
+  ctx->request.body = RtemsSemReqPerfSemRelease_Body_Wrap;
+  ctx->request.teardown = RtemsSemReqPerfSemRelease_Teardown_Wrap;
+  T_measure_runtime( ctx->context, &ctx->request );
 }
 
 /** @} */
@@ -485,8 +485,10 @@ bool IsMutexOwner( rtems_id id )
   }
 
   _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
-  return the_semaphore->Core_control.Wait_queue.Queue.owner ==
-    _Thread_Get_executing();
+  return _Semaphore_Get_mutex_owner(
+    the_semaphore,
+    _Semaphore_Get_variant( _Semaphore_Get_flags( the_semaphore ) )
+  ) == _Thread_Get_executing();
 }
 
 void ObtainMutex( rtems_id id )
@@ -816,7 +816,10 @@ rtems_tcb *TQGetOwnerClassicSem( TQContext *ctx )
 
   semaphore = _Semaphore_Get( ctx->thread_queue_id, &queue_context );
   T_assert_not_null( semaphore );
-  thread = semaphore->Core_control.Wait_queue.Queue.owner;
+  thread = _Semaphore_Get_mutex_owner(
+    semaphore,
+    _Semaphore_Get_variant( _Semaphore_Get_flags( semaphore ) )
+  );
   _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
 
   return thread;
@@ -840,7 +843,7 @@ uint32_t TQSemGetCountClassic( TQSemContext *ctx )
 
   semaphore = _Semaphore_Get( ctx->base.thread_queue_id, &queue_context );
   T_assert_not_null( semaphore );
-  count = semaphore->Core_control.Semaphore.count;
+  count = _Semaphore_Get_count( semaphore );
   _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
 
   return count;
@@ -850,9 +853,17 @@ void TQSemSetCountClassic( TQSemContext *ctx, uint32_t count )
 {
   Semaphore_Control   *semaphore;
   Thread_queue_Context queue_context;
+  Semaphore_Variant    variant;
 
   semaphore = _Semaphore_Get( ctx->base.thread_queue_id, &queue_context );
   T_assert_not_null( semaphore );
+  variant = _Semaphore_Get_variant( _Semaphore_Get_flags( semaphore ) );
+  _Thread_queue_Acquire_critical(
+    &semaphore->Core_control.Wait_queue,
+    &queue_context
+  );
+  _Semaphore_Fast_path_freeze( semaphore, variant );
   semaphore->Core_control.Semaphore.count = count;
-  _ISR_lock_ISR_enable( &queue_context.Lock_context.Lock_context );
+  _Semaphore_Fast_path_thaw( semaphore, variant );
+  _Thread_queue_Release( &semaphore->Core_control.Wait_queue, &queue_context );
 }